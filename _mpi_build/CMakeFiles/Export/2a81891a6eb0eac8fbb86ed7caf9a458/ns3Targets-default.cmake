@@ -0,0 +1,119 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "default".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "ns3::applications" for configuration "default"
+set_property(TARGET ns3::applications APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::applications PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-applications-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-applications-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::applications )
+list(APPEND _cmake_import_check_files_for_ns3::applications "${_IMPORT_PREFIX}/lib/libns3-dev-applications-default.so" )
+
+# Import target "ns3::csma" for configuration "default"
+set_property(TARGET ns3::csma APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::csma PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-csma-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-csma-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::csma )
+list(APPEND _cmake_import_check_files_for_ns3::csma "${_IMPORT_PREFIX}/lib/libns3-dev-csma-default.so" )
+
+# Import target "ns3::internet" for configuration "default"
+set_property(TARGET ns3::internet APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::internet PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-internet-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-internet-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::internet )
+list(APPEND _cmake_import_check_files_for_ns3::internet "${_IMPORT_PREFIX}/lib/libns3-dev-internet-default.so" )
+
+# Import target "ns3::mpi" for configuration "default"
+set_property(TARGET ns3::mpi APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::mpi PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-mpi-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-mpi-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::mpi )
+list(APPEND _cmake_import_check_files_for_ns3::mpi "${_IMPORT_PREFIX}/lib/libns3-dev-mpi-default.so" )
+
+# Import target "ns3::nix-vector-routing" for configuration "default"
+set_property(TARGET ns3::nix-vector-routing APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::nix-vector-routing PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-nix-vector-routing-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-nix-vector-routing-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::nix-vector-routing )
+list(APPEND _cmake_import_check_files_for_ns3::nix-vector-routing "${_IMPORT_PREFIX}/lib/libns3-dev-nix-vector-routing-default.so" )
+
+# Import target "ns3::point-to-point" for configuration "default"
+set_property(TARGET ns3::point-to-point APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::point-to-point PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-point-to-point-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-point-to-point-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::point-to-point )
+list(APPEND _cmake_import_check_files_for_ns3::point-to-point "${_IMPORT_PREFIX}/lib/libns3-dev-point-to-point-default.so" )
+
+# Import target "ns3::bridge" for configuration "default"
+set_property(TARGET ns3::bridge APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::bridge PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-bridge-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-bridge-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::bridge )
+list(APPEND _cmake_import_check_files_for_ns3::bridge "${_IMPORT_PREFIX}/lib/libns3-dev-bridge-default.so" )
+
+# Import target "ns3::network" for configuration "default"
+set_property(TARGET ns3::network APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::network PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-network-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-network-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::network )
+list(APPEND _cmake_import_check_files_for_ns3::network "${_IMPORT_PREFIX}/lib/libns3-dev-network-default.so" )
+
+# Import target "ns3::stats" for configuration "default"
+set_property(TARGET ns3::stats APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::stats PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-stats-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-stats-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::stats )
+list(APPEND _cmake_import_check_files_for_ns3::stats "${_IMPORT_PREFIX}/lib/libns3-dev-stats-default.so" )
+
+# Import target "ns3::core" for configuration "default"
+set_property(TARGET ns3::core APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::core PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-core-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-core-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::core )
+list(APPEND _cmake_import_check_files_for_ns3::core "${_IMPORT_PREFIX}/lib/libns3-dev-core-default.so" )
+
+# Import target "ns3::traffic-control" for configuration "default"
+set_property(TARGET ns3::traffic-control APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::traffic-control PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-traffic-control-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-traffic-control-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::traffic-control )
+list(APPEND _cmake_import_check_files_for_ns3::traffic-control "${_IMPORT_PREFIX}/lib/libns3-dev-traffic-control-default.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
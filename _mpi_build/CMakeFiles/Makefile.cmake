@@ -0,0 +1,358 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/VerifyGlobs.cmake"
+  "CMakeFiles/cmake.verify_globs"
+  "/root/repo/build-support/3rd-party/FindEigen3.cmake"
+  "/root/repo/build-support/3rd-party/FindHarfBuzz.cmake"
+  "/root/repo/build-support/3rd-party/FindSphinx.cmake"
+  "/root/repo/build-support/3rd-party/colored-messages.cmake"
+  "/root/repo/build-support/3rd-party/find-program-hints.cmake"
+  "/root/repo/build-support/Config.cmake.in"
+  "/root/repo/build-support/core-config-template.h"
+  "/root/repo/build-support/custom-modules/ns3-check-dependencies.cmake"
+  "/root/repo/build-support/custom-modules/ns3-cmake-package.cmake"
+  "/root/repo/build-support/custom-modules/ns3-compiler-and-linker-support.cmake"
+  "/root/repo/build-support/custom-modules/ns3-compiler-workarounds.cmake"
+  "/root/repo/build-support/custom-modules/ns3-configtable.cmake"
+  "/root/repo/build-support/custom-modules/ns3-contributions.cmake"
+  "/root/repo/build-support/custom-modules/ns3-coverage.cmake"
+  "/root/repo/build-support/custom-modules/ns3-executables.cmake"
+  "/root/repo/build-support/custom-modules/ns3-filter-modules.cmake"
+  "/root/repo/build-support/custom-modules/ns3-find-external-library.cmake"
+  "/root/repo/build-support/custom-modules/ns3-hidden-settings.cmake"
+  "/root/repo/build-support/custom-modules/ns3-lock.cmake"
+  "/root/repo/build-support/custom-modules/ns3-module-macros.cmake"
+  "/root/repo/build-support/custom-modules/ns3-ns3rc-parser.cmake"
+  "/root/repo/build-support/custom-modules/ns3-output-directory.cmake"
+  "/root/repo/build-support/custom-modules/ns3-platform-support.cmake"
+  "/root/repo/build-support/custom-modules/ns3-vcpkg-hunter.cmake"
+  "/root/repo/build-support/custom-modules/ns3-versioning.cmake"
+  "/root/repo/build-support/macros-and-definitions.cmake"
+  "/root/repo/build-support/pkgconfig-template.pc.in"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/channel-models/CMakeLists.txt"
+  "/root/repo/examples/energy/CMakeLists.txt"
+  "/root/repo/examples/error-model/CMakeLists.txt"
+  "/root/repo/examples/ipv6/CMakeLists.txt"
+  "/root/repo/examples/matrix-topology/CMakeLists.txt"
+  "/root/repo/examples/naming/CMakeLists.txt"
+  "/root/repo/examples/realtime/CMakeLists.txt"
+  "/root/repo/examples/routing/CMakeLists.txt"
+  "/root/repo/examples/socket/CMakeLists.txt"
+  "/root/repo/examples/stats/CMakeLists.txt"
+  "/root/repo/examples/tcp/CMakeLists.txt"
+  "/root/repo/examples/traffic-control/CMakeLists.txt"
+  "/root/repo/examples/tutorial/CMakeLists.txt"
+  "/root/repo/examples/udp-client-server/CMakeLists.txt"
+  "/root/repo/examples/udp/CMakeLists.txt"
+  "/root/repo/examples/wireless/CMakeLists.txt"
+  "/root/repo/scratch/CMakeLists.txt"
+  "/root/repo/scratch/nested-subdir/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/applications/CMakeLists.txt"
+  "/root/repo/src/applications/examples/CMakeLists.txt"
+  "/root/repo/src/bridge/CMakeLists.txt"
+  "/root/repo/src/bridge/examples/CMakeLists.txt"
+  "/root/repo/src/core/CMakeLists.txt"
+  "/root/repo/src/core/examples/CMakeLists.txt"
+  "/root/repo/src/csma/CMakeLists.txt"
+  "/root/repo/src/csma/examples/CMakeLists.txt"
+  "/root/repo/src/internet/CMakeLists.txt"
+  "/root/repo/src/internet/examples/CMakeLists.txt"
+  "/root/repo/src/mpi/CMakeLists.txt"
+  "/root/repo/src/mpi/examples/CMakeLists.txt"
+  "/root/repo/src/network/CMakeLists.txt"
+  "/root/repo/src/network/examples/CMakeLists.txt"
+  "/root/repo/src/nix-vector-routing/CMakeLists.txt"
+  "/root/repo/src/nix-vector-routing/examples/CMakeLists.txt"
+  "/root/repo/src/point-to-point/CMakeLists.txt"
+  "/root/repo/src/point-to-point/examples/CMakeLists.txt"
+  "/root/repo/src/stats/CMakeLists.txt"
+  "/root/repo/src/stats/examples/CMakeLists.txt"
+  "/root/repo/src/traffic-control/CMakeLists.txt"
+  "/root/repo/src/traffic-control/examples/CMakeLists.txt"
+  "/root/repo/utils/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-ExactVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMPI.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/ProcessorCount.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Modules/exportheader.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "out/include/ns3/core-config.h"
+  "pkgconfig/ns3-traffic-control.pc"
+  "pkgconfig/ns3-core.pc"
+  "pkgconfig/ns3-stats.pc"
+  "pkgconfig/ns3-network.pc"
+  "pkgconfig/ns3-bridge.pc"
+  "pkgconfig/ns3-point-to-point.pc"
+  "pkgconfig/ns3-nix-vector-routing.pc"
+  "pkgconfig/ns3-mpi.pc"
+  "pkgconfig/ns3-internet.pc"
+  "pkgconfig/ns3-csma.pc"
+  "pkgconfig/ns3-applications.pc"
+  "ns3Config.cmake"
+  "ns3ConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/applications/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/applications/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/csma/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/csma/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "out/include/ns3/internet-export.h"
+  "src/internet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/internet/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/mpi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/mpi/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/nix-vector-routing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/nix-vector-routing/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/point-to-point/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/point-to-point/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/bridge/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/bridge/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/network/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/network/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/stats/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/stats/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/traffic-control/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/traffic-control/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/channel-models/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/energy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/error-model/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/ipv6/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/matrix-topology/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/naming/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/realtime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/routing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/socket/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/stats/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/tcp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/traffic-control/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/tutorial/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/udp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/udp-client-server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/wireless/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "scratch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "scratch/nested-subdir/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "CMakeFiles/copy_all_headers.dir/DependInfo.cmake"
+  "CMakeFiles/check-version.dir/DependInfo.cmake"
+  "CMakeFiles/test-runner-examples-as-tests.dir/DependInfo.cmake"
+  "CMakeFiles/all-test-targets.dir/DependInfo.cmake"
+  "CMakeFiles/run_test_py.dir/DependInfo.cmake"
+  "CMakeFiles/run-print-introspected-doxygen.dir/DependInfo.cmake"
+  "CMakeFiles/run-introspected-command-line.dir/DependInfo.cmake"
+  "CMakeFiles/assemble-introspected-command-line.dir/DependInfo.cmake"
+  "CMakeFiles/update_doxygen_version.dir/DependInfo.cmake"
+  "CMakeFiles/doxygen.dir/DependInfo.cmake"
+  "CMakeFiles/doxygen-no-build.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_manual.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_models.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_tutorial.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_contributing.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_installation.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_traffic-control.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_core.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_stats.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_network.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_bridge.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_point-to-point.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_nix-vector-routing.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_mpi.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_internet.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_csma.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_applications.dir/DependInfo.cmake"
+  "src/applications/CMakeFiles/applications.dir/DependInfo.cmake"
+  "src/applications/CMakeFiles/applications-test.dir/DependInfo.cmake"
+  "src/applications/examples/CMakeFiles/three-gpp-http-example.dir/DependInfo.cmake"
+  "src/csma/CMakeFiles/csma.dir/DependInfo.cmake"
+  "src/csma/CMakeFiles/csma-test.dir/DependInfo.cmake"
+  "src/csma/examples/CMakeFiles/csma-one-subnet.dir/DependInfo.cmake"
+  "src/csma/examples/CMakeFiles/csma-broadcast.dir/DependInfo.cmake"
+  "src/csma/examples/CMakeFiles/csma-packet-socket.dir/DependInfo.cmake"
+  "src/csma/examples/CMakeFiles/csma-multicast.dir/DependInfo.cmake"
+  "src/internet/CMakeFiles/internet.dir/DependInfo.cmake"
+  "src/internet/CMakeFiles/internet-test.dir/DependInfo.cmake"
+  "src/internet/examples/CMakeFiles/main-simple.dir/DependInfo.cmake"
+  "src/internet/examples/CMakeFiles/neighbor-cache-example.dir/DependInfo.cmake"
+  "src/internet/examples/CMakeFiles/neighbor-cache-dynamic.dir/DependInfo.cmake"
+  "src/mpi/CMakeFiles/mpi.dir/DependInfo.cmake"
+  "src/mpi/CMakeFiles/mpi-test.dir/DependInfo.cmake"
+  "src/mpi/examples/CMakeFiles/simple-distributed.dir/DependInfo.cmake"
+  "src/mpi/examples/CMakeFiles/simple-distributed-mpi-comm.dir/DependInfo.cmake"
+  "src/mpi/examples/CMakeFiles/nms-p2p-nix-distributed.dir/DependInfo.cmake"
+  "src/mpi/examples/CMakeFiles/simple-distributed-empty-node.dir/DependInfo.cmake"
+  "src/nix-vector-routing/CMakeFiles/nix-vector-routing.dir/DependInfo.cmake"
+  "src/nix-vector-routing/CMakeFiles/nix-vector-routing-test.dir/DependInfo.cmake"
+  "src/nix-vector-routing/examples/CMakeFiles/nix-simple.dir/DependInfo.cmake"
+  "src/nix-vector-routing/examples/CMakeFiles/nix-simple-multi-address.dir/DependInfo.cmake"
+  "src/nix-vector-routing/examples/CMakeFiles/nms-p2p-nix.dir/DependInfo.cmake"
+  "src/point-to-point/CMakeFiles/point-to-point.dir/DependInfo.cmake"
+  "src/point-to-point/CMakeFiles/point-to-point-test.dir/DependInfo.cmake"
+  "src/point-to-point/examples/CMakeFiles/main-attribute-value.dir/DependInfo.cmake"
+  "src/bridge/CMakeFiles/bridge.dir/DependInfo.cmake"
+  "src/bridge/examples/CMakeFiles/csma-bridge.dir/DependInfo.cmake"
+  "src/bridge/examples/CMakeFiles/csma-bridge-one-hop.dir/DependInfo.cmake"
+  "src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "src/network/CMakeFiles/network-test.dir/DependInfo.cmake"
+  "src/network/examples/CMakeFiles/bit-serializer.dir/DependInfo.cmake"
+  "src/network/examples/CMakeFiles/main-packet-header.dir/DependInfo.cmake"
+  "src/network/examples/CMakeFiles/main-packet-tag.dir/DependInfo.cmake"
+  "src/network/examples/CMakeFiles/packet-socket-apps.dir/DependInfo.cmake"
+  "src/network/examples/CMakeFiles/lollipop-comparisons.dir/DependInfo.cmake"
+  "src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "src/stats/CMakeFiles/stats-test.dir/DependInfo.cmake"
+  "src/stats/examples/CMakeFiles/time-probe-example.dir/DependInfo.cmake"
+  "src/stats/examples/CMakeFiles/gnuplot-example.dir/DependInfo.cmake"
+  "src/stats/examples/CMakeFiles/double-probe-example.dir/DependInfo.cmake"
+  "src/stats/examples/CMakeFiles/gnuplot-aggregator-example.dir/DependInfo.cmake"
+  "src/stats/examples/CMakeFiles/gnuplot-helper-example.dir/DependInfo.cmake"
+  "src/stats/examples/CMakeFiles/file-aggregator-example.dir/DependInfo.cmake"
+  "src/stats/examples/CMakeFiles/file-helper-example.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/core-test.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/assert-example.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/command-line-example.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/fatal-example.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/hash-example.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/length-example.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/main-callback.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/main-ptr.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/sample-log-time-format.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/sample-random-variable.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/sample-random-variable-stream.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/sample-show-progress.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/sample-simulator.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/system-path-examples.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/test-string-value-formatting.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/main-test-sync.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/empirical-random-variable-example.dir/DependInfo.cmake"
+  "src/core/examples/CMakeFiles/log-example.dir/DependInfo.cmake"
+  "src/traffic-control/CMakeFiles/traffic-control.dir/DependInfo.cmake"
+  "src/traffic-control/CMakeFiles/traffic-control-test.dir/DependInfo.cmake"
+  "src/traffic-control/examples/CMakeFiles/codel-vs-pfifo-basic-test.dir/DependInfo.cmake"
+  "examples/error-model/CMakeFiles/simple-error-model.dir/DependInfo.cmake"
+  "examples/ipv6/CMakeFiles/fragmentation-ipv6.dir/DependInfo.cmake"
+  "examples/ipv6/CMakeFiles/fragmentation-ipv6-two-MTU.dir/DependInfo.cmake"
+  "examples/ipv6/CMakeFiles/test-ipv6.dir/DependInfo.cmake"
+  "examples/ipv6/CMakeFiles/fragmentation-ipv6-PMTU.dir/DependInfo.cmake"
+  "examples/naming/CMakeFiles/object-names.dir/DependInfo.cmake"
+  "examples/realtime/CMakeFiles/realtime-udp-echo.dir/DependInfo.cmake"
+  "examples/routing/CMakeFiles/dynamic-global-routing.dir/DependInfo.cmake"
+  "examples/routing/CMakeFiles/static-routing-slash32.dir/DependInfo.cmake"
+  "examples/routing/CMakeFiles/global-routing-slash32.dir/DependInfo.cmake"
+  "examples/routing/CMakeFiles/global-injection-slash32.dir/DependInfo.cmake"
+  "examples/routing/CMakeFiles/simple-alternate-routing.dir/DependInfo.cmake"
+  "examples/routing/CMakeFiles/mixed-global-routing.dir/DependInfo.cmake"
+  "examples/routing/CMakeFiles/global-routing-multi-switch-plus-router.dir/DependInfo.cmake"
+  "examples/routing/CMakeFiles/simple-multicast-flooding.dir/DependInfo.cmake"
+  "examples/socket/CMakeFiles/socket-bound-static-routing.dir/DependInfo.cmake"
+  "examples/socket/CMakeFiles/socket-bound-tcp-static-routing.dir/DependInfo.cmake"
+  "examples/socket/CMakeFiles/socket-options-ipv4.dir/DependInfo.cmake"
+  "examples/socket/CMakeFiles/socket-options-ipv6.dir/DependInfo.cmake"
+  "examples/tcp/CMakeFiles/tcp-large-transfer.dir/DependInfo.cmake"
+  "examples/tcp/CMakeFiles/tcp-star-server.dir/DependInfo.cmake"
+  "examples/tcp/CMakeFiles/tcp-bulk-send.dir/DependInfo.cmake"
+  "examples/tcp/CMakeFiles/tcp-pcap-nanosec-example.dir/DependInfo.cmake"
+  "examples/tcp/CMakeFiles/tcp-linux-reno.dir/DependInfo.cmake"
+  "examples/tcp/CMakeFiles/dctcp-example.dir/DependInfo.cmake"
+  "examples/traffic-control/CMakeFiles/tbf-example.dir/DependInfo.cmake"
+  "examples/traffic-control/CMakeFiles/cobalt-vs-codel.dir/DependInfo.cmake"
+  "examples/tutorial/CMakeFiles/hello-simulator.dir/DependInfo.cmake"
+  "examples/tutorial/CMakeFiles/first.dir/DependInfo.cmake"
+  "examples/tutorial/CMakeFiles/second.dir/DependInfo.cmake"
+  "examples/tutorial/CMakeFiles/fourth.dir/DependInfo.cmake"
+  "examples/tutorial/CMakeFiles/fifth.dir/DependInfo.cmake"
+  "examples/tutorial/CMakeFiles/sixth.dir/DependInfo.cmake"
+  "examples/tutorial/CMakeFiles/seventh.dir/DependInfo.cmake"
+  "examples/udp/CMakeFiles/udp-echo.dir/DependInfo.cmake"
+  "examples/udp-client-server/CMakeFiles/udp-client-server.dir/DependInfo.cmake"
+  "examples/udp-client-server/CMakeFiles/udp-trace-client-server.dir/DependInfo.cmake"
+  "scratch/CMakeFiles/scratch_log-distance-random-propagation-model-plot.dir/DependInfo.cmake"
+  "scratch/CMakeFiles/scratch_myfirst-hw1.dir/DependInfo.cmake"
+  "scratch/CMakeFiles/scratch_myfirst.dir/DependInfo.cmake"
+  "scratch/CMakeFiles/scratch_mysecond-hw1.dir/DependInfo.cmake"
+  "scratch/CMakeFiles/scratch_mysecond.dir/DependInfo.cmake"
+  "scratch/CMakeFiles/scratch_scratch-simulator.dir/DependInfo.cmake"
+  "scratch/CMakeFiles/scratch_subdir_scratch-subdir.dir/DependInfo.cmake"
+  "scratch/nested-subdir/CMakeFiles/scratch-nested-subdir-lib.dir/DependInfo.cmake"
+  "scratch/nested-subdir/CMakeFiles/scratch_nested-subdir_scratch-nested-subdir-executable.dir/DependInfo.cmake"
+  "utils/CMakeFiles/test-runner.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-scheduler.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-packets.dir/DependInfo.cmake"
+  "utils/CMakeFiles/print-introspected-doxygen.dir/DependInfo.cmake"
+  "utils/CMakeFiles/perf-io.dir/DependInfo.cmake"
+  )
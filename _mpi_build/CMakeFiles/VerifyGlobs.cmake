@@ -0,0 +1,49 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by CMake Version 3.25
+cmake_policy(SET CMP0009 NEW)
+
+# scratch_subdirectories at scratch/CMakeLists.txt:83 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/scratch/**")
+set(OLD_GLOB
+  "/root/repo/scratch/.gitignore"
+  "/root/repo/scratch/CMakeLists.txt"
+  "/root/repo/scratch/log-distance-random-propagation-model-plot.cc"
+  "/root/repo/scratch/log-distance-random-propagation-model-plot.h"
+  "/root/repo/scratch/myfirst-hw1.cc"
+  "/root/repo/scratch/myfirst.cc"
+  "/root/repo/scratch/mysecond-hw1.cc"
+  "/root/repo/scratch/mysecond.cc"
+  "/root/repo/scratch/nested-subdir"
+  "/root/repo/scratch/scratch-simulator.cc"
+  "/root/repo/scratch/subdir"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_mpi_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# single_source_file_scratches at scratch/CMakeLists.txt:77 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/scratch/[^.]*.cc")
+set(OLD_GLOB
+  "/root/repo/scratch/log-distance-random-propagation-model-plot.cc"
+  "/root/repo/scratch/myfirst-hw1.cc"
+  "/root/repo/scratch/myfirst.cc"
+  "/root/repo/scratch/mysecond-hw1.cc"
+  "/root/repo/scratch/mysecond.cc"
+  "/root/repo/scratch/scratch-simulator.cc"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_mpi_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# scratch_sources at scratch/CMakeLists.txt:108 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/scratch/subdir/[^.]*.cc")
+set(OLD_GLOB
+  "/root/repo/scratch/subdir/scratch-subdir-additional-header.cc"
+  "/root/repo/scratch/subdir/scratch-subdir.cc"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_mpi_build/CMakeFiles/cmake.verify_globs")
+endif()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/error-model/ns3-dev-simple-error-model-default"
+  "../../out/examples/error-model/ns3-dev-simple-error-model-default.pdb"
+  "CMakeFiles/simple-error-model.dir/simple-error-model.cc.o"
+  "CMakeFiles/simple-error-model.dir/simple-error-model.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple-error-model.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
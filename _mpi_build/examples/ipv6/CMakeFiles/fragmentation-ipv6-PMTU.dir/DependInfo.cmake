@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/ipv6/fragmentation-ipv6-PMTU.cc" "examples/ipv6/CMakeFiles/fragmentation-ipv6-PMTU.dir/fragmentation-ipv6-PMTU.cc.o" "gcc" "examples/ipv6/CMakeFiles/fragmentation-ipv6-PMTU.dir/fragmentation-ipv6-PMTU.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mpi_build/src/applications/CMakeFiles/applications.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/csma/CMakeFiles/csma.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/internet/CMakeFiles/internet.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/point-to-point/CMakeFiles/point-to-point.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/bridge/CMakeFiles/bridge.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/traffic-control/CMakeFiles/traffic-control.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/mpi/CMakeFiles/mpi.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
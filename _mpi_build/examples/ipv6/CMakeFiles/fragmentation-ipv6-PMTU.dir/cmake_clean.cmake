@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/ipv6/ns3-dev-fragmentation-ipv6-PMTU-default"
+  "../../out/examples/ipv6/ns3-dev-fragmentation-ipv6-PMTU-default.pdb"
+  "CMakeFiles/fragmentation-ipv6-PMTU.dir/fragmentation-ipv6-PMTU.cc.o"
+  "CMakeFiles/fragmentation-ipv6-PMTU.dir/fragmentation-ipv6-PMTU.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fragmentation-ipv6-PMTU.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/ipv6/ns3-dev-fragmentation-ipv6-two-MTU-default"
+  "../../out/examples/ipv6/ns3-dev-fragmentation-ipv6-two-MTU-default.pdb"
+  "CMakeFiles/fragmentation-ipv6-two-MTU.dir/fragmentation-ipv6-two-MTU.cc.o"
+  "CMakeFiles/fragmentation-ipv6-two-MTU.dir/fragmentation-ipv6-two-MTU.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fragmentation-ipv6-two-MTU.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/ipv6/ns3-dev-test-ipv6-default"
+  "../../out/examples/ipv6/ns3-dev-test-ipv6-default.pdb"
+  "CMakeFiles/test-ipv6.dir/test-ipv6.cc.o"
+  "CMakeFiles/test-ipv6.dir/test-ipv6.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test-ipv6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
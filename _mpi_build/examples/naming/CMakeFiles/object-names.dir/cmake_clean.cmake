@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/naming/ns3-dev-object-names-default"
+  "../../out/examples/naming/ns3-dev-object-names-default.pdb"
+  "CMakeFiles/object-names.dir/object-names.cc.o"
+  "CMakeFiles/object-names.dir/object-names.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/object-names.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/realtime/ns3-dev-realtime-udp-echo-default"
+  "../../out/examples/realtime/ns3-dev-realtime-udp-echo-default.pdb"
+  "CMakeFiles/realtime-udp-echo.dir/realtime-udp-echo.cc.o"
+  "CMakeFiles/realtime-udp-echo.dir/realtime-udp-echo.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/realtime-udp-echo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
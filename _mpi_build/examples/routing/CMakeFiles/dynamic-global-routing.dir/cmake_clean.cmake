@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/routing/ns3-dev-dynamic-global-routing-default"
+  "../../out/examples/routing/ns3-dev-dynamic-global-routing-default.pdb"
+  "CMakeFiles/dynamic-global-routing.dir/dynamic-global-routing.cc.o"
+  "CMakeFiles/dynamic-global-routing.dir/dynamic-global-routing.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dynamic-global-routing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
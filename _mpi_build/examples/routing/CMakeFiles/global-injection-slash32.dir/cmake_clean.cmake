@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/routing/ns3-dev-global-injection-slash32-default"
+  "../../out/examples/routing/ns3-dev-global-injection-slash32-default.pdb"
+  "CMakeFiles/global-injection-slash32.dir/global-injection-slash32.cc.o"
+  "CMakeFiles/global-injection-slash32.dir/global-injection-slash32.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/global-injection-slash32.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
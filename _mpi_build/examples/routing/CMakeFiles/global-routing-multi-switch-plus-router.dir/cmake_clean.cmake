@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/routing/ns3-dev-global-routing-multi-switch-plus-router-default"
+  "../../out/examples/routing/ns3-dev-global-routing-multi-switch-plus-router-default.pdb"
+  "CMakeFiles/global-routing-multi-switch-plus-router.dir/global-routing-multi-switch-plus-router.cc.o"
+  "CMakeFiles/global-routing-multi-switch-plus-router.dir/global-routing-multi-switch-plus-router.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/global-routing-multi-switch-plus-router.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/routing/ns3-dev-mixed-global-routing-default"
+  "../../out/examples/routing/ns3-dev-mixed-global-routing-default.pdb"
+  "CMakeFiles/mixed-global-routing.dir/mixed-global-routing.cc.o"
+  "CMakeFiles/mixed-global-routing.dir/mixed-global-routing.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mixed-global-routing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
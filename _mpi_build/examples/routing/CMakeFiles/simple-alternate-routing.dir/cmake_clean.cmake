@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/routing/ns3-dev-simple-alternate-routing-default"
+  "../../out/examples/routing/ns3-dev-simple-alternate-routing-default.pdb"
+  "CMakeFiles/simple-alternate-routing.dir/simple-alternate-routing.cc.o"
+  "CMakeFiles/simple-alternate-routing.dir/simple-alternate-routing.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple-alternate-routing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/routing/ns3-dev-simple-multicast-flooding-default"
+  "../../out/examples/routing/ns3-dev-simple-multicast-flooding-default.pdb"
+  "CMakeFiles/simple-multicast-flooding.dir/simple-multicast-flooding.cc.o"
+  "CMakeFiles/simple-multicast-flooding.dir/simple-multicast-flooding.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple-multicast-flooding.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
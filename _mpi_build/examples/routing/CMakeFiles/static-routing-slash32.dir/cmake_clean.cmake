@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/routing/ns3-dev-static-routing-slash32-default"
+  "../../out/examples/routing/ns3-dev-static-routing-slash32-default.pdb"
+  "CMakeFiles/static-routing-slash32.dir/static-routing-slash32.cc.o"
+  "CMakeFiles/static-routing-slash32.dir/static-routing-slash32.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/static-routing-slash32.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/socket/ns3-dev-socket-bound-static-routing-default"
+  "../../out/examples/socket/ns3-dev-socket-bound-static-routing-default.pdb"
+  "CMakeFiles/socket-bound-static-routing.dir/socket-bound-static-routing.cc.o"
+  "CMakeFiles/socket-bound-static-routing.dir/socket-bound-static-routing.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/socket-bound-static-routing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/socket/ns3-dev-socket-options-ipv4-default"
+  "../../out/examples/socket/ns3-dev-socket-options-ipv4-default.pdb"
+  "CMakeFiles/socket-options-ipv4.dir/socket-options-ipv4.cc.o"
+  "CMakeFiles/socket-options-ipv4.dir/socket-options-ipv4.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/socket-options-ipv4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
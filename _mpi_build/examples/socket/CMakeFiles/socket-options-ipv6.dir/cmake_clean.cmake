@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/socket/ns3-dev-socket-options-ipv6-default"
+  "../../out/examples/socket/ns3-dev-socket-options-ipv6-default.pdb"
+  "CMakeFiles/socket-options-ipv6.dir/socket-options-ipv6.cc.o"
+  "CMakeFiles/socket-options-ipv6.dir/socket-options-ipv6.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/socket-options-ipv6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tcp/ns3-dev-dctcp-example-default"
+  "../../out/examples/tcp/ns3-dev-dctcp-example-default.pdb"
+  "CMakeFiles/dctcp-example.dir/dctcp-example.cc.o"
+  "CMakeFiles/dctcp-example.dir/dctcp-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dctcp-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tcp/ns3-dev-tcp-bulk-send-default"
+  "../../out/examples/tcp/ns3-dev-tcp-bulk-send-default.pdb"
+  "CMakeFiles/tcp-bulk-send.dir/tcp-bulk-send.cc.o"
+  "CMakeFiles/tcp-bulk-send.dir/tcp-bulk-send.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcp-bulk-send.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tcp/ns3-dev-tcp-large-transfer-default"
+  "../../out/examples/tcp/ns3-dev-tcp-large-transfer-default.pdb"
+  "CMakeFiles/tcp-large-transfer.dir/tcp-large-transfer.cc.o"
+  "CMakeFiles/tcp-large-transfer.dir/tcp-large-transfer.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcp-large-transfer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
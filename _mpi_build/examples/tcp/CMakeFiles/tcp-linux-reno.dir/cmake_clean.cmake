@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tcp/ns3-dev-tcp-linux-reno-default"
+  "../../out/examples/tcp/ns3-dev-tcp-linux-reno-default.pdb"
+  "CMakeFiles/tcp-linux-reno.dir/tcp-linux-reno.cc.o"
+  "CMakeFiles/tcp-linux-reno.dir/tcp-linux-reno.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcp-linux-reno.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
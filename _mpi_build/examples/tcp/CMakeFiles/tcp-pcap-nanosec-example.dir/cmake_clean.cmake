@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tcp/ns3-dev-tcp-pcap-nanosec-example-default"
+  "../../out/examples/tcp/ns3-dev-tcp-pcap-nanosec-example-default.pdb"
+  "CMakeFiles/tcp-pcap-nanosec-example.dir/tcp-pcap-nanosec-example.cc.o"
+  "CMakeFiles/tcp-pcap-nanosec-example.dir/tcp-pcap-nanosec-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcp-pcap-nanosec-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
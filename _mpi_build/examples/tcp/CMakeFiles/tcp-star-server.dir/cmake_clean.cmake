@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tcp/ns3-dev-tcp-star-server-default"
+  "../../out/examples/tcp/ns3-dev-tcp-star-server-default.pdb"
+  "CMakeFiles/tcp-star-server.dir/tcp-star-server.cc.o"
+  "CMakeFiles/tcp-star-server.dir/tcp-star-server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcp-star-server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/traffic-control/ns3-dev-cobalt-vs-codel-default"
+  "../../out/examples/traffic-control/ns3-dev-cobalt-vs-codel-default.pdb"
+  "CMakeFiles/cobalt-vs-codel.dir/cobalt-vs-codel.cc.o"
+  "CMakeFiles/cobalt-vs-codel.dir/cobalt-vs-codel.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cobalt-vs-codel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
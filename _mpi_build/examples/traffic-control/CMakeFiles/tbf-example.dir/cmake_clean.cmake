@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/traffic-control/ns3-dev-tbf-example-default"
+  "../../out/examples/traffic-control/ns3-dev-tbf-example-default.pdb"
+  "CMakeFiles/tbf-example.dir/tbf-example.cc.o"
+  "CMakeFiles/tbf-example.dir/tbf-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tbf-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
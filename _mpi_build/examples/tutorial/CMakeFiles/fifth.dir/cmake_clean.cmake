@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tutorial/ns3-dev-fifth-default"
+  "../../out/examples/tutorial/ns3-dev-fifth-default.pdb"
+  "CMakeFiles/fifth.dir/fifth.cc.o"
+  "CMakeFiles/fifth.dir/fifth.cc.o.d"
+  "CMakeFiles/fifth.dir/tutorial-app.cc.o"
+  "CMakeFiles/fifth.dir/tutorial-app.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fifth.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tutorial/ns3-dev-first-default"
+  "../../out/examples/tutorial/ns3-dev-first-default.pdb"
+  "CMakeFiles/first.dir/first.cc.o"
+  "CMakeFiles/first.dir/first.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/first.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
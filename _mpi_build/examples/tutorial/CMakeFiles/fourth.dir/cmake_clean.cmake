@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tutorial/ns3-dev-fourth-default"
+  "../../out/examples/tutorial/ns3-dev-fourth-default.pdb"
+  "CMakeFiles/fourth.dir/fourth.cc.o"
+  "CMakeFiles/fourth.dir/fourth.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fourth.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tutorial/ns3-dev-hello-simulator-default"
+  "../../out/examples/tutorial/ns3-dev-hello-simulator-default.pdb"
+  "CMakeFiles/hello-simulator.dir/hello-simulator.cc.o"
+  "CMakeFiles/hello-simulator.dir/hello-simulator.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hello-simulator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tutorial/ns3-dev-second-default"
+  "../../out/examples/tutorial/ns3-dev-second-default.pdb"
+  "CMakeFiles/second.dir/second.cc.o"
+  "CMakeFiles/second.dir/second.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/second.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
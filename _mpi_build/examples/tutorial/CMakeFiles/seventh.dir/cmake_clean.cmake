@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tutorial/ns3-dev-seventh-default"
+  "../../out/examples/tutorial/ns3-dev-seventh-default.pdb"
+  "CMakeFiles/seventh.dir/seventh.cc.o"
+  "CMakeFiles/seventh.dir/seventh.cc.o.d"
+  "CMakeFiles/seventh.dir/tutorial-app.cc.o"
+  "CMakeFiles/seventh.dir/tutorial-app.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/seventh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
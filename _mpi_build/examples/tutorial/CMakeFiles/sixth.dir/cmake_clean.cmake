@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../out/examples/tutorial/ns3-dev-sixth-default"
+  "../../out/examples/tutorial/ns3-dev-sixth-default.pdb"
+  "CMakeFiles/sixth.dir/sixth.cc.o"
+  "CMakeFiles/sixth.dir/sixth.cc.o.d"
+  "CMakeFiles/sixth.dir/tutorial-app.cc.o"
+  "CMakeFiles/sixth.dir/tutorial-app.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sixth.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/udp-client-server/ns3-dev-udp-client-server-default"
+  "../../out/examples/udp-client-server/ns3-dev-udp-client-server-default.pdb"
+  "CMakeFiles/udp-client-server.dir/udp-client-server.cc.o"
+  "CMakeFiles/udp-client-server.dir/udp-client-server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/udp-client-server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
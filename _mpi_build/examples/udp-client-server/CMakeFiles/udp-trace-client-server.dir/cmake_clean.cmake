@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/udp-client-server/ns3-dev-udp-trace-client-server-default"
+  "../../out/examples/udp-client-server/ns3-dev-udp-trace-client-server-default.pdb"
+  "CMakeFiles/udp-trace-client-server.dir/udp-trace-client-server.cc.o"
+  "CMakeFiles/udp-trace-client-server.dir/udp-trace-client-server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/udp-trace-client-server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/examples/udp/ns3-dev-udp-echo-default"
+  "../../out/examples/udp/ns3-dev-udp-echo-default.pdb"
+  "CMakeFiles/udp-echo.dir/udp-echo.cc.o"
+  "CMakeFiles/udp-echo.dir/udp-echo.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/udp-echo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1 @@
+#include "/root/repo/src/internet/model/icmpv4-l4-protocol.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/network/utils/mac8-address.h"
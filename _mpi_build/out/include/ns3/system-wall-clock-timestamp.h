@@ -0,0 +1 @@
+#include "/root/repo/src/core/model/system-wall-clock-timestamp.h"
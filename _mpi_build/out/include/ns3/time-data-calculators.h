@@ -0,0 +1 @@
+#include "/root/repo/src/stats/model/time-data-calculators.h"
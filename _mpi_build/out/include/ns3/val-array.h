@@ -0,0 +1 @@
+#include "/root/repo/src/core/model/val-array.h"
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../out/scratch/ns3-dev-log-distance-random-propagation-model-plot-default"
+  "../out/scratch/ns3-dev-log-distance-random-propagation-model-plot-default.pdb"
+  "CMakeFiles/scratch_log-distance-random-propagation-model-plot.dir/log-distance-random-propagation-model-plot.cc.o"
+  "CMakeFiles/scratch_log-distance-random-propagation-model-plot.dir/log-distance-random-propagation-model-plot.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scratch_log-distance-random-propagation-model-plot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../out/scratch/ns3-dev-myfirst-hw1-default"
+  "../out/scratch/ns3-dev-myfirst-hw1-default.pdb"
+  "CMakeFiles/scratch_myfirst-hw1.dir/myfirst-hw1.cc.o"
+  "CMakeFiles/scratch_myfirst-hw1.dir/myfirst-hw1.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scratch_myfirst-hw1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
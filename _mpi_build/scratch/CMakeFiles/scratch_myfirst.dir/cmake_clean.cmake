@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../out/scratch/ns3-dev-myfirst-default"
+  "../out/scratch/ns3-dev-myfirst-default.pdb"
+  "CMakeFiles/scratch_myfirst.dir/myfirst.cc.o"
+  "CMakeFiles/scratch_myfirst.dir/myfirst.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scratch_myfirst.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
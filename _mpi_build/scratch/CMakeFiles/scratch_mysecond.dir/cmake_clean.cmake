@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../out/scratch/ns3-dev-mysecond-default"
+  "../out/scratch/ns3-dev-mysecond-default.pdb"
+  "CMakeFiles/scratch_mysecond.dir/mysecond.cc.o"
+  "CMakeFiles/scratch_mysecond.dir/mysecond.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scratch_mysecond.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-applications-default.pdb"
+  "../../out/lib/libns3-dev-applications-default.so"
+  "CMakeFiles/applications.dir/helper/bulk-send-helper.cc.o"
+  "CMakeFiles/applications.dir/helper/bulk-send-helper.cc.o.d"
+  "CMakeFiles/applications.dir/helper/on-off-helper.cc.o"
+  "CMakeFiles/applications.dir/helper/on-off-helper.cc.o.d"
+  "CMakeFiles/applications.dir/helper/packet-sink-helper.cc.o"
+  "CMakeFiles/applications.dir/helper/packet-sink-helper.cc.o.d"
+  "CMakeFiles/applications.dir/helper/three-gpp-http-helper.cc.o"
+  "CMakeFiles/applications.dir/helper/three-gpp-http-helper.cc.o.d"
+  "CMakeFiles/applications.dir/helper/udp-client-server-helper.cc.o"
+  "CMakeFiles/applications.dir/helper/udp-client-server-helper.cc.o.d"
+  "CMakeFiles/applications.dir/helper/udp-echo-helper.cc.o"
+  "CMakeFiles/applications.dir/helper/udp-echo-helper.cc.o.d"
+  "CMakeFiles/applications.dir/model/application-packet-probe.cc.o"
+  "CMakeFiles/applications.dir/model/application-packet-probe.cc.o.d"
+  "CMakeFiles/applications.dir/model/bulk-send-application.cc.o"
+  "CMakeFiles/applications.dir/model/bulk-send-application.cc.o.d"
+  "CMakeFiles/applications.dir/model/onoff-application.cc.o"
+  "CMakeFiles/applications.dir/model/onoff-application.cc.o.d"
+  "CMakeFiles/applications.dir/model/packet-loss-counter.cc.o"
+  "CMakeFiles/applications.dir/model/packet-loss-counter.cc.o.d"
+  "CMakeFiles/applications.dir/model/packet-sink.cc.o"
+  "CMakeFiles/applications.dir/model/packet-sink.cc.o.d"
+  "CMakeFiles/applications.dir/model/seq-ts-echo-header.cc.o"
+  "CMakeFiles/applications.dir/model/seq-ts-echo-header.cc.o.d"
+  "CMakeFiles/applications.dir/model/seq-ts-header.cc.o"
+  "CMakeFiles/applications.dir/model/seq-ts-header.cc.o.d"
+  "CMakeFiles/applications.dir/model/seq-ts-size-header.cc.o"
+  "CMakeFiles/applications.dir/model/seq-ts-size-header.cc.o.d"
+  "CMakeFiles/applications.dir/model/sink-application.cc.o"
+  "CMakeFiles/applications.dir/model/sink-application.cc.o.d"
+  "CMakeFiles/applications.dir/model/source-application.cc.o"
+  "CMakeFiles/applications.dir/model/source-application.cc.o.d"
+  "CMakeFiles/applications.dir/model/three-gpp-http-client.cc.o"
+  "CMakeFiles/applications.dir/model/three-gpp-http-client.cc.o.d"
+  "CMakeFiles/applications.dir/model/three-gpp-http-header.cc.o"
+  "CMakeFiles/applications.dir/model/three-gpp-http-header.cc.o.d"
+  "CMakeFiles/applications.dir/model/three-gpp-http-server.cc.o"
+  "CMakeFiles/applications.dir/model/three-gpp-http-server.cc.o.d"
+  "CMakeFiles/applications.dir/model/three-gpp-http-variables.cc.o"
+  "CMakeFiles/applications.dir/model/three-gpp-http-variables.cc.o.d"
+  "CMakeFiles/applications.dir/model/udp-client.cc.o"
+  "CMakeFiles/applications.dir/model/udp-client.cc.o.d"
+  "CMakeFiles/applications.dir/model/udp-echo-client.cc.o"
+  "CMakeFiles/applications.dir/model/udp-echo-client.cc.o.d"
+  "CMakeFiles/applications.dir/model/udp-echo-server.cc.o"
+  "CMakeFiles/applications.dir/model/udp-echo-server.cc.o.d"
+  "CMakeFiles/applications.dir/model/udp-server.cc.o"
+  "CMakeFiles/applications.dir/model/udp-server.cc.o.d"
+  "CMakeFiles/applications.dir/model/udp-trace-client.cc.o"
+  "CMakeFiles/applications.dir/model/udp-trace-client.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/applications.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
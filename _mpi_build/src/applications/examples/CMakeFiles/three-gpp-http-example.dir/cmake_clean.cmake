@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/applications/examples/ns3-dev-three-gpp-http-example-default"
+  "../../../out/src/applications/examples/ns3-dev-three-gpp-http-example-default.pdb"
+  "CMakeFiles/three-gpp-http-example.dir/three-gpp-http-example.cc.o"
+  "CMakeFiles/three-gpp-http-example.dir/three-gpp-http-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/three-gpp-http-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/bridge/helper/bridge-helper.cc" "src/bridge/CMakeFiles/bridge.dir/helper/bridge-helper.cc.o" "gcc" "src/bridge/CMakeFiles/bridge.dir/helper/bridge-helper.cc.o.d"
+  "/root/repo/src/bridge/model/bridge-channel.cc" "src/bridge/CMakeFiles/bridge.dir/model/bridge-channel.cc.o" "gcc" "src/bridge/CMakeFiles/bridge.dir/model/bridge-channel.cc.o.d"
+  "/root/repo/src/bridge/model/bridge-net-device.cc" "src/bridge/CMakeFiles/bridge.dir/model/bridge-net-device.cc.o" "gcc" "src/bridge/CMakeFiles/bridge.dir/model/bridge-net-device.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mpi_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
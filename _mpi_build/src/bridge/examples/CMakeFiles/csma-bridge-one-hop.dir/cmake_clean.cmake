@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/bridge/examples/ns3-dev-csma-bridge-one-hop-default"
+  "../../../out/src/bridge/examples/ns3-dev-csma-bridge-one-hop-default.pdb"
+  "CMakeFiles/csma-bridge-one-hop.dir/csma-bridge-one-hop.cc.o"
+  "CMakeFiles/csma-bridge-one-hop.dir/csma-bridge-one-hop.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csma-bridge-one-hop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
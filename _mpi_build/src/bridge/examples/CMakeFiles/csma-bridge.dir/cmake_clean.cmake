@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/bridge/examples/ns3-dev-csma-bridge-default"
+  "../../../out/src/bridge/examples/ns3-dev-csma-bridge-default.pdb"
+  "CMakeFiles/csma-bridge.dir/csma-bridge.cc.o"
+  "CMakeFiles/csma-bridge.dir/csma-bridge.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csma-bridge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
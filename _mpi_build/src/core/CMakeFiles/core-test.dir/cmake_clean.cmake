@@ -0,0 +1,79 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-core-test-default.pdb"
+  "../../out/lib/libns3-dev-core-test-default.so"
+  "CMakeFiles/core-test.dir/test/attribute-container-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/attribute-container-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/attribute-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/attribute-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/build-profile-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/build-profile-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/callback-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/callback-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/command-line-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/command-line-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/config-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/config-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/environment-variable-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/environment-variable-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/event-garbage-collector-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/event-garbage-collector-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/examples-as-tests-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/examples-as-tests-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/global-value-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/global-value-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/hash-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/hash-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/int64x64-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/int64x64-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/length-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/length-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/many-uniform-random-variables-one-get-value-call-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/many-uniform-random-variables-one-get-value-call-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/mapped-file-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/mapped-file-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/matrix-array-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/matrix-array-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/names-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/names-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/object-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/object-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/one-uniform-random-variable-many-get-value-calls-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/one-uniform-random-variable-many-get-value-calls-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/pair-value-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/pair-value-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/ptr-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/ptr-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/sample-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/sample-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/simulator-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/simulator-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/splitstring-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/splitstring-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/thread-pool-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/thread-pool-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/threaded-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/threaded-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/time-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/time-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/timer-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/timer-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/traced-callback-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/traced-callback-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/trickle-timer-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/trickle-timer-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/tuple-value-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/tuple-value-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/type-id-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/type-id-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/type-traits-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/type-traits-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/val-array-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/val-array-test-suite.cc.o.d"
+  "CMakeFiles/core-test.dir/test/watchdog-test-suite.cc.o"
+  "CMakeFiles/core-test.dir/test/watchdog-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/core-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
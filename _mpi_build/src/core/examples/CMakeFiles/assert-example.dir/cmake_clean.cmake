@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-assert-example-default"
+  "../../../out/src/core/examples/ns3-dev-assert-example-default.pdb"
+  "CMakeFiles/assert-example.dir/assert-example.cc.o"
+  "CMakeFiles/assert-example.dir/assert-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/assert-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-command-line-example-default"
+  "../../../out/src/core/examples/ns3-dev-command-line-example-default.pdb"
+  "CMakeFiles/command-line-example.dir/command-line-example.cc.o"
+  "CMakeFiles/command-line-example.dir/command-line-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/command-line-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
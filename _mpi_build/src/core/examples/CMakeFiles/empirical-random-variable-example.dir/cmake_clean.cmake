@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-empirical-random-variable-example-default"
+  "../../../out/src/core/examples/ns3-dev-empirical-random-variable-example-default.pdb"
+  "CMakeFiles/empirical-random-variable-example.dir/empirical-random-variable-example.cc.o"
+  "CMakeFiles/empirical-random-variable-example.dir/empirical-random-variable-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/empirical-random-variable-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-fatal-example-default"
+  "../../../out/src/core/examples/ns3-dev-fatal-example-default.pdb"
+  "CMakeFiles/fatal-example.dir/fatal-example.cc.o"
+  "CMakeFiles/fatal-example.dir/fatal-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fatal-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
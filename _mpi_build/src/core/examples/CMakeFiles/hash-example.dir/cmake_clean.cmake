@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-hash-example-default"
+  "../../../out/src/core/examples/ns3-dev-hash-example-default.pdb"
+  "CMakeFiles/hash-example.dir/hash-example.cc.o"
+  "CMakeFiles/hash-example.dir/hash-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
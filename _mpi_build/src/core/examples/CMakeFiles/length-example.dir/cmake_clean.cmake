@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-length-example-default"
+  "../../../out/src/core/examples/ns3-dev-length-example-default.pdb"
+  "CMakeFiles/length-example.dir/length-example.cc.o"
+  "CMakeFiles/length-example.dir/length-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/length-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
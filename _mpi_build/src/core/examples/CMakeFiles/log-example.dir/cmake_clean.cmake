@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-log-example-default"
+  "../../../out/src/core/examples/ns3-dev-log-example-default.pdb"
+  "CMakeFiles/log-example.dir/log-example.cc.o"
+  "CMakeFiles/log-example.dir/log-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/log-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
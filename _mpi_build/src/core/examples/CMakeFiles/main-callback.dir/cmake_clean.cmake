@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-main-callback-default"
+  "../../../out/src/core/examples/ns3-dev-main-callback-default.pdb"
+  "CMakeFiles/main-callback.dir/main-callback.cc.o"
+  "CMakeFiles/main-callback.dir/main-callback.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main-callback.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-main-ptr-default"
+  "../../../out/src/core/examples/ns3-dev-main-ptr-default.pdb"
+  "CMakeFiles/main-ptr.dir/main-ptr.cc.o"
+  "CMakeFiles/main-ptr.dir/main-ptr.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main-ptr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
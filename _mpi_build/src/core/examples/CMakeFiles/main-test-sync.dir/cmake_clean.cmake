@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-main-test-sync-default"
+  "../../../out/src/core/examples/ns3-dev-main-test-sync-default.pdb"
+  "CMakeFiles/main-test-sync.dir/main-test-sync.cc.o"
+  "CMakeFiles/main-test-sync.dir/main-test-sync.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main-test-sync.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-sample-log-time-format-default"
+  "../../../out/src/core/examples/ns3-dev-sample-log-time-format-default.pdb"
+  "CMakeFiles/sample-log-time-format.dir/sample-log-time-format.cc.o"
+  "CMakeFiles/sample-log-time-format.dir/sample-log-time-format.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sample-log-time-format.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-sample-random-variable-stream-default"
+  "../../../out/src/core/examples/ns3-dev-sample-random-variable-stream-default.pdb"
+  "CMakeFiles/sample-random-variable-stream.dir/sample-random-variable-stream.cc.o"
+  "CMakeFiles/sample-random-variable-stream.dir/sample-random-variable-stream.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sample-random-variable-stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-sample-random-variable-default"
+  "../../../out/src/core/examples/ns3-dev-sample-random-variable-default.pdb"
+  "CMakeFiles/sample-random-variable.dir/sample-random-variable.cc.o"
+  "CMakeFiles/sample-random-variable.dir/sample-random-variable.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sample-random-variable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
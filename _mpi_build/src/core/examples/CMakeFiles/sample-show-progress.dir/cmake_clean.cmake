@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-sample-show-progress-default"
+  "../../../out/src/core/examples/ns3-dev-sample-show-progress-default.pdb"
+  "CMakeFiles/sample-show-progress.dir/sample-show-progress.cc.o"
+  "CMakeFiles/sample-show-progress.dir/sample-show-progress.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sample-show-progress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
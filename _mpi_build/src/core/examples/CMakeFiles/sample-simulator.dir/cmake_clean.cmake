@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-sample-simulator-default"
+  "../../../out/src/core/examples/ns3-dev-sample-simulator-default.pdb"
+  "CMakeFiles/sample-simulator.dir/sample-simulator.cc.o"
+  "CMakeFiles/sample-simulator.dir/sample-simulator.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sample-simulator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
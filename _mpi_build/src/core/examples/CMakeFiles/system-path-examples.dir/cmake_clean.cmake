@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-system-path-examples-default"
+  "../../../out/src/core/examples/ns3-dev-system-path-examples-default.pdb"
+  "CMakeFiles/system-path-examples.dir/system-path-examples.cc.o"
+  "CMakeFiles/system-path-examples.dir/system-path-examples.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/system-path-examples.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
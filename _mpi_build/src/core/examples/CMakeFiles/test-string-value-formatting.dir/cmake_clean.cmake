@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/core/examples/ns3-dev-test-string-value-formatting-default"
+  "../../../out/src/core/examples/ns3-dev-test-string-value-formatting-default.pdb"
+  "CMakeFiles/test-string-value-formatting.dir/test-string-value-formatting.cc.o"
+  "CMakeFiles/test-string-value-formatting.dir/test-string-value-formatting.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test-string-value-formatting.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
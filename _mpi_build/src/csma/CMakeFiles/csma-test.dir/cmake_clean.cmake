@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-csma-test-default.pdb"
+  "../../out/lib/libns3-dev-csma-test-default.so"
+  "CMakeFiles/csma-test.dir/test/csma-test.cc.o"
+  "CMakeFiles/csma-test.dir/test/csma-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csma-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/csma/examples/ns3-dev-csma-broadcast-default"
+  "../../../out/src/csma/examples/ns3-dev-csma-broadcast-default.pdb"
+  "CMakeFiles/csma-broadcast.dir/csma-broadcast.cc.o"
+  "CMakeFiles/csma-broadcast.dir/csma-broadcast.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csma-broadcast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/csma/examples/ns3-dev-csma-multicast-default"
+  "../../../out/src/csma/examples/ns3-dev-csma-multicast-default.pdb"
+  "CMakeFiles/csma-multicast.dir/csma-multicast.cc.o"
+  "CMakeFiles/csma-multicast.dir/csma-multicast.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csma-multicast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
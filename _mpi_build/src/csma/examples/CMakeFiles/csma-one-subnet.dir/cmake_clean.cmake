@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/csma/examples/ns3-dev-csma-one-subnet-default"
+  "../../../out/src/csma/examples/ns3-dev-csma-one-subnet-default.pdb"
+  "CMakeFiles/csma-one-subnet.dir/csma-one-subnet.cc.o"
+  "CMakeFiles/csma-one-subnet.dir/csma-one-subnet.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csma-one-subnet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
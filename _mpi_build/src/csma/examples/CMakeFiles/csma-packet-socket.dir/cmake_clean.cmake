@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/csma/examples/ns3-dev-csma-packet-socket-default"
+  "../../../out/src/csma/examples/ns3-dev-csma-packet-socket-default.pdb"
+  "CMakeFiles/csma-packet-socket.dir/csma-packet-socket.cc.o"
+  "CMakeFiles/csma-packet-socket.dir/csma-packet-socket.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csma-packet-socket.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
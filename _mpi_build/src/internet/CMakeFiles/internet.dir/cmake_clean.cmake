@@ -0,0 +1,263 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-internet-default.pdb"
+  "../../out/lib/libns3-dev-internet-default.so"
+  "CMakeFiles/internet.dir/helper/internet-stack-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/internet-stack-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/internet-trace-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/internet-trace-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/ipv4-address-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/ipv4-address-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/ipv4-global-routing-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/ipv4-global-routing-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/ipv4-interface-container.cc.o"
+  "CMakeFiles/internet.dir/helper/ipv4-interface-container.cc.o.d"
+  "CMakeFiles/internet.dir/helper/ipv4-list-routing-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/ipv4-list-routing-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/ipv4-routing-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/ipv4-routing-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/ipv4-static-routing-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/ipv4-static-routing-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/ipv6-address-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/ipv6-address-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/ipv6-interface-container.cc.o"
+  "CMakeFiles/internet.dir/helper/ipv6-interface-container.cc.o.d"
+  "CMakeFiles/internet.dir/helper/ipv6-list-routing-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/ipv6-list-routing-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/ipv6-routing-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/ipv6-routing-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/ipv6-static-routing-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/ipv6-static-routing-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/neighbor-cache-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/neighbor-cache-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/rip-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/rip-helper.cc.o.d"
+  "CMakeFiles/internet.dir/helper/ripng-helper.cc.o"
+  "CMakeFiles/internet.dir/helper/ripng-helper.cc.o.d"
+  "CMakeFiles/internet.dir/model/arp-cache.cc.o"
+  "CMakeFiles/internet.dir/model/arp-cache.cc.o.d"
+  "CMakeFiles/internet.dir/model/arp-header.cc.o"
+  "CMakeFiles/internet.dir/model/arp-header.cc.o.d"
+  "CMakeFiles/internet.dir/model/arp-l3-protocol.cc.o"
+  "CMakeFiles/internet.dir/model/arp-l3-protocol.cc.o.d"
+  "CMakeFiles/internet.dir/model/arp-queue-disc-item.cc.o"
+  "CMakeFiles/internet.dir/model/arp-queue-disc-item.cc.o.d"
+  "CMakeFiles/internet.dir/model/candidate-queue.cc.o"
+  "CMakeFiles/internet.dir/model/candidate-queue.cc.o.d"
+  "CMakeFiles/internet.dir/model/global-route-manager-impl.cc.o"
+  "CMakeFiles/internet.dir/model/global-route-manager-impl.cc.o.d"
+  "CMakeFiles/internet.dir/model/global-route-manager.cc.o"
+  "CMakeFiles/internet.dir/model/global-route-manager.cc.o.d"
+  "CMakeFiles/internet.dir/model/global-router-interface.cc.o"
+  "CMakeFiles/internet.dir/model/global-router-interface.cc.o.d"
+  "CMakeFiles/internet.dir/model/icmpv4-l4-protocol.cc.o"
+  "CMakeFiles/internet.dir/model/icmpv4-l4-protocol.cc.o.d"
+  "CMakeFiles/internet.dir/model/icmpv4.cc.o"
+  "CMakeFiles/internet.dir/model/icmpv4.cc.o.d"
+  "CMakeFiles/internet.dir/model/icmpv6-header.cc.o"
+  "CMakeFiles/internet.dir/model/icmpv6-header.cc.o.d"
+  "CMakeFiles/internet.dir/model/icmpv6-l4-protocol.cc.o"
+  "CMakeFiles/internet.dir/model/icmpv6-l4-protocol.cc.o.d"
+  "CMakeFiles/internet.dir/model/ip-l4-protocol.cc.o"
+  "CMakeFiles/internet.dir/model/ip-l4-protocol.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-address-generator.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-address-generator.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-end-point-demux.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-end-point-demux.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-end-point.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-end-point.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-global-routing.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-global-routing.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-header.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-header.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-interface-address.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-interface-address.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-interface.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-interface.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-l3-protocol.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-l3-protocol.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-list-routing.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-list-routing.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-packet-filter.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-packet-filter.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-packet-info-tag.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-packet-info-tag.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-packet-probe.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-packet-probe.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-queue-disc-item.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-queue-disc-item.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-raw-socket-factory-impl.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-raw-socket-factory-impl.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-raw-socket-factory.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-raw-socket-factory.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-raw-socket-impl.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-raw-socket-impl.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-route.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-route.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-routing-protocol.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-routing-protocol.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-routing-table-entry.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-routing-table-entry.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4-static-routing.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4-static-routing.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv4.cc.o"
+  "CMakeFiles/internet.dir/model/ipv4.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-address-generator.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-address-generator.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-autoconfigured-prefix.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-autoconfigured-prefix.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-end-point-demux.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-end-point-demux.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-end-point.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-end-point.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-extension-demux.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-extension-demux.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-extension-header.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-extension-header.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-extension.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-extension.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-header.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-header.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-interface-address.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-interface-address.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-interface.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-interface.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-l3-protocol.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-l3-protocol.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-list-routing.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-list-routing.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-option-demux.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-option-demux.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-option-header.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-option-header.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-option.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-option.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-packet-filter.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-packet-filter.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-packet-info-tag.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-packet-info-tag.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-packet-probe.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-packet-probe.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-pmtu-cache.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-pmtu-cache.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-queue-disc-item.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-queue-disc-item.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-raw-socket-factory-impl.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-raw-socket-factory-impl.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-raw-socket-factory.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-raw-socket-factory.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-raw-socket-impl.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-raw-socket-impl.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-route.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-route.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-routing-protocol.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-routing-protocol.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-routing-table-entry.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-routing-table-entry.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6-static-routing.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6-static-routing.cc.o.d"
+  "CMakeFiles/internet.dir/model/ipv6.cc.o"
+  "CMakeFiles/internet.dir/model/ipv6.cc.o.d"
+  "CMakeFiles/internet.dir/model/loopback-net-device.cc.o"
+  "CMakeFiles/internet.dir/model/loopback-net-device.cc.o.d"
+  "CMakeFiles/internet.dir/model/ndisc-cache.cc.o"
+  "CMakeFiles/internet.dir/model/ndisc-cache.cc.o.d"
+  "CMakeFiles/internet.dir/model/rip-header.cc.o"
+  "CMakeFiles/internet.dir/model/rip-header.cc.o.d"
+  "CMakeFiles/internet.dir/model/rip.cc.o"
+  "CMakeFiles/internet.dir/model/rip.cc.o.d"
+  "CMakeFiles/internet.dir/model/ripng-header.cc.o"
+  "CMakeFiles/internet.dir/model/ripng-header.cc.o.d"
+  "CMakeFiles/internet.dir/model/ripng.cc.o"
+  "CMakeFiles/internet.dir/model/ripng.cc.o.d"
+  "CMakeFiles/internet.dir/model/rtt-estimator.cc.o"
+  "CMakeFiles/internet.dir/model/rtt-estimator.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-bbr.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-bbr.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-bic.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-bic.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-congestion-ops.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-congestion-ops.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-cubic.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-cubic.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-dctcp.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-dctcp.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-header.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-header.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-highspeed.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-highspeed.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-htcp.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-htcp.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-hybla.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-hybla.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-illinois.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-illinois.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-l4-protocol.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-l4-protocol.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-ledbat.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-ledbat.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-linux-reno.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-linux-reno.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-lp.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-lp.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-option-rfc793.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-option-rfc793.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-option-sack-permitted.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-option-sack-permitted.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-option-sack.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-option-sack.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-option-ts.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-option-ts.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-option-winscale.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-option-winscale.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-option.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-option.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-prr-recovery.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-prr-recovery.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-rate-ops.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-rate-ops.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-recovery-ops.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-recovery-ops.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-rx-buffer.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-rx-buffer.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-scalable.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-scalable.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-socket-base.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-socket-base.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-socket-factory-impl.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-socket-factory-impl.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-socket-factory.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-socket-factory.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-socket-state.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-socket-state.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-socket.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-socket.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-tx-buffer.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-tx-buffer.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-tx-item.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-tx-item.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-vegas.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-vegas.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-veno.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-veno.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-westwood-plus.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-westwood-plus.cc.o.d"
+  "CMakeFiles/internet.dir/model/tcp-yeah.cc.o"
+  "CMakeFiles/internet.dir/model/tcp-yeah.cc.o.d"
+  "CMakeFiles/internet.dir/model/udp-header.cc.o"
+  "CMakeFiles/internet.dir/model/udp-header.cc.o.d"
+  "CMakeFiles/internet.dir/model/udp-l4-protocol.cc.o"
+  "CMakeFiles/internet.dir/model/udp-l4-protocol.cc.o.d"
+  "CMakeFiles/internet.dir/model/udp-socket-factory-impl.cc.o"
+  "CMakeFiles/internet.dir/model/udp-socket-factory-impl.cc.o.d"
+  "CMakeFiles/internet.dir/model/udp-socket-factory.cc.o"
+  "CMakeFiles/internet.dir/model/udp-socket-factory.cc.o.d"
+  "CMakeFiles/internet.dir/model/udp-socket-impl.cc.o"
+  "CMakeFiles/internet.dir/model/udp-socket-impl.cc.o.d"
+  "CMakeFiles/internet.dir/model/udp-socket.cc.o"
+  "CMakeFiles/internet.dir/model/udp-socket.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/internet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
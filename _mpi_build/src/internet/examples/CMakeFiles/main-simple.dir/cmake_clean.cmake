@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/internet/examples/ns3-dev-main-simple-default"
+  "../../../out/src/internet/examples/ns3-dev-main-simple-default.pdb"
+  "CMakeFiles/main-simple.dir/main-simple.cc.o"
+  "CMakeFiles/main-simple.dir/main-simple.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main-simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/internet/examples/ns3-dev-neighbor-cache-dynamic-default"
+  "../../../out/src/internet/examples/ns3-dev-neighbor-cache-dynamic-default.pdb"
+  "CMakeFiles/neighbor-cache-dynamic.dir/neighbor-cache-dynamic.cc.o"
+  "CMakeFiles/neighbor-cache-dynamic.dir/neighbor-cache-dynamic.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/neighbor-cache-dynamic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/internet/examples/ns3-dev-neighbor-cache-example-default"
+  "../../../out/src/internet/examples/ns3-dev-neighbor-cache-example-default.pdb"
+  "CMakeFiles/neighbor-cache-example.dir/neighbor-cache-example.cc.o"
+  "CMakeFiles/neighbor-cache-example.dir/neighbor-cache-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/neighbor-cache-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-mpi-test-default.pdb"
+  "../../out/lib/libns3-dev-mpi-test-default.so"
+  "CMakeFiles/mpi-test.dir/test/mpi-test-suite.cc.o"
+  "CMakeFiles/mpi-test.dir/test/mpi-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mpi-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/mpi/model/distributed-simulator-impl.cc" "src/mpi/CMakeFiles/mpi.dir/model/distributed-simulator-impl.cc.o" "gcc" "src/mpi/CMakeFiles/mpi.dir/model/distributed-simulator-impl.cc.o.d"
+  "/root/repo/src/mpi/model/granted-time-window-mpi-interface.cc" "src/mpi/CMakeFiles/mpi.dir/model/granted-time-window-mpi-interface.cc.o" "gcc" "src/mpi/CMakeFiles/mpi.dir/model/granted-time-window-mpi-interface.cc.o.d"
+  "/root/repo/src/mpi/model/mpi-interface.cc" "src/mpi/CMakeFiles/mpi.dir/model/mpi-interface.cc.o" "gcc" "src/mpi/CMakeFiles/mpi.dir/model/mpi-interface.cc.o.d"
+  "/root/repo/src/mpi/model/mpi-receiver.cc" "src/mpi/CMakeFiles/mpi.dir/model/mpi-receiver.cc.o" "gcc" "src/mpi/CMakeFiles/mpi.dir/model/mpi-receiver.cc.o.d"
+  "/root/repo/src/mpi/model/null-message-mpi-interface.cc" "src/mpi/CMakeFiles/mpi.dir/model/null-message-mpi-interface.cc.o" "gcc" "src/mpi/CMakeFiles/mpi.dir/model/null-message-mpi-interface.cc.o.d"
+  "/root/repo/src/mpi/model/null-message-simulator-impl.cc" "src/mpi/CMakeFiles/mpi.dir/model/null-message-simulator-impl.cc.o" "gcc" "src/mpi/CMakeFiles/mpi.dir/model/null-message-simulator-impl.cc.o.d"
+  "/root/repo/src/mpi/model/remote-channel-bundle-manager.cc" "src/mpi/CMakeFiles/mpi.dir/model/remote-channel-bundle-manager.cc.o" "gcc" "src/mpi/CMakeFiles/mpi.dir/model/remote-channel-bundle-manager.cc.o.d"
+  "/root/repo/src/mpi/model/remote-channel-bundle.cc" "src/mpi/CMakeFiles/mpi.dir/model/remote-channel-bundle.cc.o" "gcc" "src/mpi/CMakeFiles/mpi.dir/model/remote-channel-bundle.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mpi_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-mpi-default.pdb"
+  "../../out/lib/libns3-dev-mpi-default.so"
+  "CMakeFiles/mpi.dir/model/distributed-simulator-impl.cc.o"
+  "CMakeFiles/mpi.dir/model/distributed-simulator-impl.cc.o.d"
+  "CMakeFiles/mpi.dir/model/granted-time-window-mpi-interface.cc.o"
+  "CMakeFiles/mpi.dir/model/granted-time-window-mpi-interface.cc.o.d"
+  "CMakeFiles/mpi.dir/model/mpi-interface.cc.o"
+  "CMakeFiles/mpi.dir/model/mpi-interface.cc.o.d"
+  "CMakeFiles/mpi.dir/model/mpi-receiver.cc.o"
+  "CMakeFiles/mpi.dir/model/mpi-receiver.cc.o.d"
+  "CMakeFiles/mpi.dir/model/null-message-mpi-interface.cc.o"
+  "CMakeFiles/mpi.dir/model/null-message-mpi-interface.cc.o.d"
+  "CMakeFiles/mpi.dir/model/null-message-simulator-impl.cc.o"
+  "CMakeFiles/mpi.dir/model/null-message-simulator-impl.cc.o.d"
+  "CMakeFiles/mpi.dir/model/remote-channel-bundle-manager.cc.o"
+  "CMakeFiles/mpi.dir/model/remote-channel-bundle-manager.cc.o.d"
+  "CMakeFiles/mpi.dir/model/remote-channel-bundle.cc.o"
+  "CMakeFiles/mpi.dir/model/remote-channel-bundle.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mpi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../out/src/mpi/examples/ns3-dev-nms-p2p-nix-distributed-default"
+  "../../../out/src/mpi/examples/ns3-dev-nms-p2p-nix-distributed-default.pdb"
+  "CMakeFiles/nms-p2p-nix-distributed.dir/mpi-test-fixtures.cc.o"
+  "CMakeFiles/nms-p2p-nix-distributed.dir/mpi-test-fixtures.cc.o.d"
+  "CMakeFiles/nms-p2p-nix-distributed.dir/nms-p2p-nix-distributed.cc.o"
+  "CMakeFiles/nms-p2p-nix-distributed.dir/nms-p2p-nix-distributed.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nms-p2p-nix-distributed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
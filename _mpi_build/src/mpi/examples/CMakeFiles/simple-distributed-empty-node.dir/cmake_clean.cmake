@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../out/src/mpi/examples/ns3-dev-simple-distributed-empty-node-default"
+  "../../../out/src/mpi/examples/ns3-dev-simple-distributed-empty-node-default.pdb"
+  "CMakeFiles/simple-distributed-empty-node.dir/mpi-test-fixtures.cc.o"
+  "CMakeFiles/simple-distributed-empty-node.dir/mpi-test-fixtures.cc.o.d"
+  "CMakeFiles/simple-distributed-empty-node.dir/simple-distributed-empty-node.cc.o"
+  "CMakeFiles/simple-distributed-empty-node.dir/simple-distributed-empty-node.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple-distributed-empty-node.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
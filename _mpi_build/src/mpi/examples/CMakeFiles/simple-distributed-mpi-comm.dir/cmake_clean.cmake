@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../out/src/mpi/examples/ns3-dev-simple-distributed-mpi-comm-default"
+  "../../../out/src/mpi/examples/ns3-dev-simple-distributed-mpi-comm-default.pdb"
+  "CMakeFiles/simple-distributed-mpi-comm.dir/mpi-test-fixtures.cc.o"
+  "CMakeFiles/simple-distributed-mpi-comm.dir/mpi-test-fixtures.cc.o.d"
+  "CMakeFiles/simple-distributed-mpi-comm.dir/simple-distributed-mpi-comm.cc.o"
+  "CMakeFiles/simple-distributed-mpi-comm.dir/simple-distributed-mpi-comm.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple-distributed-mpi-comm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
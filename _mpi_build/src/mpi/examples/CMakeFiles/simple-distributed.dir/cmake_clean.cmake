@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../out/src/mpi/examples/ns3-dev-simple-distributed-default"
+  "../../../out/src/mpi/examples/ns3-dev-simple-distributed-default.pdb"
+  "CMakeFiles/simple-distributed.dir/mpi-test-fixtures.cc.o"
+  "CMakeFiles/simple-distributed.dir/mpi-test-fixtures.cc.o.d"
+  "CMakeFiles/simple-distributed.dir/simple-distributed.cc.o"
+  "CMakeFiles/simple-distributed.dir/simple-distributed.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple-distributed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-network-test-default.pdb"
+  "../../out/lib/libns3-dev-network-test-default.so"
+  "CMakeFiles/network-test.dir/test/bit-serializer-test.cc.o"
+  "CMakeFiles/network-test.dir/test/bit-serializer-test.cc.o.d"
+  "CMakeFiles/network-test.dir/test/buffer-test.cc.o"
+  "CMakeFiles/network-test.dir/test/buffer-test.cc.o.d"
+  "CMakeFiles/network-test.dir/test/drop-tail-queue-test-suite.cc.o"
+  "CMakeFiles/network-test.dir/test/drop-tail-queue-test-suite.cc.o.d"
+  "CMakeFiles/network-test.dir/test/error-model-test-suite.cc.o"
+  "CMakeFiles/network-test.dir/test/error-model-test-suite.cc.o.d"
+  "CMakeFiles/network-test.dir/test/fluid-background-traffic-test-suite.cc.o"
+  "CMakeFiles/network-test.dir/test/fluid-background-traffic-test-suite.cc.o.d"
+  "CMakeFiles/network-test.dir/test/graph-partitioner-test-suite.cc.o"
+  "CMakeFiles/network-test.dir/test/graph-partitioner-test-suite.cc.o.d"
+  "CMakeFiles/network-test.dir/test/ipv6-address-test-suite.cc.o"
+  "CMakeFiles/network-test.dir/test/ipv6-address-test-suite.cc.o.d"
+  "CMakeFiles/network-test.dir/test/lollipop-counter-test.cc.o"
+  "CMakeFiles/network-test.dir/test/lollipop-counter-test.cc.o.d"
+  "CMakeFiles/network-test.dir/test/packet-metadata-test.cc.o"
+  "CMakeFiles/network-test.dir/test/packet-metadata-test.cc.o.d"
+  "CMakeFiles/network-test.dir/test/packet-socket-apps-test-suite.cc.o"
+  "CMakeFiles/network-test.dir/test/packet-socket-apps-test-suite.cc.o.d"
+  "CMakeFiles/network-test.dir/test/packet-test-suite.cc.o"
+  "CMakeFiles/network-test.dir/test/packet-test-suite.cc.o.d"
+  "CMakeFiles/network-test.dir/test/packetbb-test-suite.cc.o"
+  "CMakeFiles/network-test.dir/test/packetbb-test-suite.cc.o.d"
+  "CMakeFiles/network-test.dir/test/pcap-file-test-suite.cc.o"
+  "CMakeFiles/network-test.dir/test/pcap-file-test-suite.cc.o.d"
+  "CMakeFiles/network-test.dir/test/sequence-number-test-suite.cc.o"
+  "CMakeFiles/network-test.dir/test/sequence-number-test-suite.cc.o.d"
+  "CMakeFiles/network-test.dir/test/test-data-rate.cc.o"
+  "CMakeFiles/network-test.dir/test/test-data-rate.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/network-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
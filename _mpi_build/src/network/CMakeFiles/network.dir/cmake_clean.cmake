@@ -0,0 +1,155 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-network-default.pdb"
+  "../../out/lib/libns3-dev-network-default.so"
+  "CMakeFiles/network.dir/helper/application-container.cc.o"
+  "CMakeFiles/network.dir/helper/application-container.cc.o.d"
+  "CMakeFiles/network.dir/helper/application-helper.cc.o"
+  "CMakeFiles/network.dir/helper/application-helper.cc.o.d"
+  "CMakeFiles/network.dir/helper/delay-jitter-estimation.cc.o"
+  "CMakeFiles/network.dir/helper/delay-jitter-estimation.cc.o.d"
+  "CMakeFiles/network.dir/helper/graph-partitioner.cc.o"
+  "CMakeFiles/network.dir/helper/graph-partitioner.cc.o.d"
+  "CMakeFiles/network.dir/helper/net-device-container.cc.o"
+  "CMakeFiles/network.dir/helper/net-device-container.cc.o.d"
+  "CMakeFiles/network.dir/helper/node-container.cc.o"
+  "CMakeFiles/network.dir/helper/node-container.cc.o.d"
+  "CMakeFiles/network.dir/helper/packet-socket-helper.cc.o"
+  "CMakeFiles/network.dir/helper/packet-socket-helper.cc.o.d"
+  "CMakeFiles/network.dir/helper/simple-net-device-helper.cc.o"
+  "CMakeFiles/network.dir/helper/simple-net-device-helper.cc.o.d"
+  "CMakeFiles/network.dir/helper/trace-helper.cc.o"
+  "CMakeFiles/network.dir/helper/trace-helper.cc.o.d"
+  "CMakeFiles/network.dir/model/address.cc.o"
+  "CMakeFiles/network.dir/model/address.cc.o.d"
+  "CMakeFiles/network.dir/model/application.cc.o"
+  "CMakeFiles/network.dir/model/application.cc.o.d"
+  "CMakeFiles/network.dir/model/buffer.cc.o"
+  "CMakeFiles/network.dir/model/buffer.cc.o.d"
+  "CMakeFiles/network.dir/model/byte-tag-list.cc.o"
+  "CMakeFiles/network.dir/model/byte-tag-list.cc.o.d"
+  "CMakeFiles/network.dir/model/channel-list.cc.o"
+  "CMakeFiles/network.dir/model/channel-list.cc.o.d"
+  "CMakeFiles/network.dir/model/channel.cc.o"
+  "CMakeFiles/network.dir/model/channel.cc.o.d"
+  "CMakeFiles/network.dir/model/chunk.cc.o"
+  "CMakeFiles/network.dir/model/chunk.cc.o.d"
+  "CMakeFiles/network.dir/model/header.cc.o"
+  "CMakeFiles/network.dir/model/header.cc.o.d"
+  "CMakeFiles/network.dir/model/net-device.cc.o"
+  "CMakeFiles/network.dir/model/net-device.cc.o.d"
+  "CMakeFiles/network.dir/model/nix-vector.cc.o"
+  "CMakeFiles/network.dir/model/nix-vector.cc.o.d"
+  "CMakeFiles/network.dir/model/node-list.cc.o"
+  "CMakeFiles/network.dir/model/node-list.cc.o.d"
+  "CMakeFiles/network.dir/model/node.cc.o"
+  "CMakeFiles/network.dir/model/node.cc.o.d"
+  "CMakeFiles/network.dir/model/packet-metadata.cc.o"
+  "CMakeFiles/network.dir/model/packet-metadata.cc.o.d"
+  "CMakeFiles/network.dir/model/packet-tag-list.cc.o"
+  "CMakeFiles/network.dir/model/packet-tag-list.cc.o.d"
+  "CMakeFiles/network.dir/model/packet.cc.o"
+  "CMakeFiles/network.dir/model/packet.cc.o.d"
+  "CMakeFiles/network.dir/model/socket-factory.cc.o"
+  "CMakeFiles/network.dir/model/socket-factory.cc.o.d"
+  "CMakeFiles/network.dir/model/socket.cc.o"
+  "CMakeFiles/network.dir/model/socket.cc.o.d"
+  "CMakeFiles/network.dir/model/tag-buffer.cc.o"
+  "CMakeFiles/network.dir/model/tag-buffer.cc.o.d"
+  "CMakeFiles/network.dir/model/tag.cc.o"
+  "CMakeFiles/network.dir/model/tag.cc.o.d"
+  "CMakeFiles/network.dir/model/trailer.cc.o"
+  "CMakeFiles/network.dir/model/trailer.cc.o.d"
+  "CMakeFiles/network.dir/utils/address-utils.cc.o"
+  "CMakeFiles/network.dir/utils/address-utils.cc.o.d"
+  "CMakeFiles/network.dir/utils/bit-deserializer.cc.o"
+  "CMakeFiles/network.dir/utils/bit-deserializer.cc.o.d"
+  "CMakeFiles/network.dir/utils/bit-serializer.cc.o"
+  "CMakeFiles/network.dir/utils/bit-serializer.cc.o.d"
+  "CMakeFiles/network.dir/utils/crc32.cc.o"
+  "CMakeFiles/network.dir/utils/crc32.cc.o.d"
+  "CMakeFiles/network.dir/utils/data-rate.cc.o"
+  "CMakeFiles/network.dir/utils/data-rate.cc.o.d"
+  "CMakeFiles/network.dir/utils/drop-tail-queue.cc.o"
+  "CMakeFiles/network.dir/utils/drop-tail-queue.cc.o.d"
+  "CMakeFiles/network.dir/utils/dynamic-queue-limits.cc.o"
+  "CMakeFiles/network.dir/utils/dynamic-queue-limits.cc.o.d"
+  "CMakeFiles/network.dir/utils/error-channel.cc.o"
+  "CMakeFiles/network.dir/utils/error-channel.cc.o.d"
+  "CMakeFiles/network.dir/utils/error-model.cc.o"
+  "CMakeFiles/network.dir/utils/error-model.cc.o.d"
+  "CMakeFiles/network.dir/utils/ethernet-header.cc.o"
+  "CMakeFiles/network.dir/utils/ethernet-header.cc.o.d"
+  "CMakeFiles/network.dir/utils/ethernet-trailer.cc.o"
+  "CMakeFiles/network.dir/utils/ethernet-trailer.cc.o.d"
+  "CMakeFiles/network.dir/utils/flow-id-tag.cc.o"
+  "CMakeFiles/network.dir/utils/flow-id-tag.cc.o.d"
+  "CMakeFiles/network.dir/utils/fluid-background-traffic.cc.o"
+  "CMakeFiles/network.dir/utils/fluid-background-traffic.cc.o.d"
+  "CMakeFiles/network.dir/utils/inet-socket-address.cc.o"
+  "CMakeFiles/network.dir/utils/inet-socket-address.cc.o.d"
+  "CMakeFiles/network.dir/utils/inet6-socket-address.cc.o"
+  "CMakeFiles/network.dir/utils/inet6-socket-address.cc.o.d"
+  "CMakeFiles/network.dir/utils/ipv4-address.cc.o"
+  "CMakeFiles/network.dir/utils/ipv4-address.cc.o.d"
+  "CMakeFiles/network.dir/utils/ipv6-address.cc.o"
+  "CMakeFiles/network.dir/utils/ipv6-address.cc.o.d"
+  "CMakeFiles/network.dir/utils/llc-snap-header.cc.o"
+  "CMakeFiles/network.dir/utils/llc-snap-header.cc.o.d"
+  "CMakeFiles/network.dir/utils/mac16-address.cc.o"
+  "CMakeFiles/network.dir/utils/mac16-address.cc.o.d"
+  "CMakeFiles/network.dir/utils/mac48-address.cc.o"
+  "CMakeFiles/network.dir/utils/mac48-address.cc.o.d"
+  "CMakeFiles/network.dir/utils/mac64-address.cc.o"
+  "CMakeFiles/network.dir/utils/mac64-address.cc.o.d"
+  "CMakeFiles/network.dir/utils/mac8-address.cc.o"
+  "CMakeFiles/network.dir/utils/mac8-address.cc.o.d"
+  "CMakeFiles/network.dir/utils/net-device-queue-interface.cc.o"
+  "CMakeFiles/network.dir/utils/net-device-queue-interface.cc.o.d"
+  "CMakeFiles/network.dir/utils/output-stream-wrapper.cc.o"
+  "CMakeFiles/network.dir/utils/output-stream-wrapper.cc.o.d"
+  "CMakeFiles/network.dir/utils/packet-burst.cc.o"
+  "CMakeFiles/network.dir/utils/packet-burst.cc.o.d"
+  "CMakeFiles/network.dir/utils/packet-data-calculators.cc.o"
+  "CMakeFiles/network.dir/utils/packet-data-calculators.cc.o.d"
+  "CMakeFiles/network.dir/utils/packet-probe.cc.o"
+  "CMakeFiles/network.dir/utils/packet-probe.cc.o.d"
+  "CMakeFiles/network.dir/utils/packet-socket-address.cc.o"
+  "CMakeFiles/network.dir/utils/packet-socket-address.cc.o.d"
+  "CMakeFiles/network.dir/utils/packet-socket-client.cc.o"
+  "CMakeFiles/network.dir/utils/packet-socket-client.cc.o.d"
+  "CMakeFiles/network.dir/utils/packet-socket-factory.cc.o"
+  "CMakeFiles/network.dir/utils/packet-socket-factory.cc.o.d"
+  "CMakeFiles/network.dir/utils/packet-socket-server.cc.o"
+  "CMakeFiles/network.dir/utils/packet-socket-server.cc.o.d"
+  "CMakeFiles/network.dir/utils/packet-socket.cc.o"
+  "CMakeFiles/network.dir/utils/packet-socket.cc.o.d"
+  "CMakeFiles/network.dir/utils/packetbb.cc.o"
+  "CMakeFiles/network.dir/utils/packetbb.cc.o.d"
+  "CMakeFiles/network.dir/utils/pcap-file-wrapper.cc.o"
+  "CMakeFiles/network.dir/utils/pcap-file-wrapper.cc.o.d"
+  "CMakeFiles/network.dir/utils/pcap-file.cc.o"
+  "CMakeFiles/network.dir/utils/pcap-file.cc.o.d"
+  "CMakeFiles/network.dir/utils/queue-item.cc.o"
+  "CMakeFiles/network.dir/utils/queue-item.cc.o.d"
+  "CMakeFiles/network.dir/utils/queue-limits.cc.o"
+  "CMakeFiles/network.dir/utils/queue-limits.cc.o.d"
+  "CMakeFiles/network.dir/utils/queue-size.cc.o"
+  "CMakeFiles/network.dir/utils/queue-size.cc.o.d"
+  "CMakeFiles/network.dir/utils/queue.cc.o"
+  "CMakeFiles/network.dir/utils/queue.cc.o.d"
+  "CMakeFiles/network.dir/utils/radiotap-header.cc.o"
+  "CMakeFiles/network.dir/utils/radiotap-header.cc.o.d"
+  "CMakeFiles/network.dir/utils/simple-channel.cc.o"
+  "CMakeFiles/network.dir/utils/simple-channel.cc.o.d"
+  "CMakeFiles/network.dir/utils/simple-net-device.cc.o"
+  "CMakeFiles/network.dir/utils/simple-net-device.cc.o.d"
+  "CMakeFiles/network.dir/utils/sll-header.cc.o"
+  "CMakeFiles/network.dir/utils/sll-header.cc.o.d"
+  "CMakeFiles/network.dir/utils/timestamp-tag.cc.o"
+  "CMakeFiles/network.dir/utils/timestamp-tag.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/network.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
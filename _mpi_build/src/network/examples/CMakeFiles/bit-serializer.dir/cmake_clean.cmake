@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/network/examples/ns3-dev-bit-serializer-default"
+  "../../../out/src/network/examples/ns3-dev-bit-serializer-default.pdb"
+  "CMakeFiles/bit-serializer.dir/bit-serializer.cc.o"
+  "CMakeFiles/bit-serializer.dir/bit-serializer.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bit-serializer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/network/examples/ns3-dev-lollipop-comparisons-default"
+  "../../../out/src/network/examples/ns3-dev-lollipop-comparisons-default.pdb"
+  "CMakeFiles/lollipop-comparisons.dir/lollipop-comparisons.cc.o"
+  "CMakeFiles/lollipop-comparisons.dir/lollipop-comparisons.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lollipop-comparisons.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
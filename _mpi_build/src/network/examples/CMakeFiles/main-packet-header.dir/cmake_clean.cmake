@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/network/examples/ns3-dev-main-packet-header-default"
+  "../../../out/src/network/examples/ns3-dev-main-packet-header-default.pdb"
+  "CMakeFiles/main-packet-header.dir/main-packet-header.cc.o"
+  "CMakeFiles/main-packet-header.dir/main-packet-header.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main-packet-header.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
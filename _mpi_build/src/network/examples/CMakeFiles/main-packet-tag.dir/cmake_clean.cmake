@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/network/examples/ns3-dev-main-packet-tag-default"
+  "../../../out/src/network/examples/ns3-dev-main-packet-tag-default.pdb"
+  "CMakeFiles/main-packet-tag.dir/main-packet-tag.cc.o"
+  "CMakeFiles/main-packet-tag.dir/main-packet-tag.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main-packet-tag.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
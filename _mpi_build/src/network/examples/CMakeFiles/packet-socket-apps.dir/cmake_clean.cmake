@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/network/examples/ns3-dev-packet-socket-apps-default"
+  "../../../out/src/network/examples/ns3-dev-packet-socket-apps-default.pdb"
+  "CMakeFiles/packet-socket-apps.dir/packet-socket-apps.cc.o"
+  "CMakeFiles/packet-socket-apps.dir/packet-socket-apps.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/packet-socket-apps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
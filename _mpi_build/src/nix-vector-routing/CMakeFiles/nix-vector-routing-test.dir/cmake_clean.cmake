@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-nix-vector-routing-test-default.pdb"
+  "../../out/lib/libns3-dev-nix-vector-routing-test-default.so"
+  "CMakeFiles/nix-vector-routing-test.dir/test/nix-test.cc.o"
+  "CMakeFiles/nix-vector-routing-test.dir/test/nix-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nix-vector-routing-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
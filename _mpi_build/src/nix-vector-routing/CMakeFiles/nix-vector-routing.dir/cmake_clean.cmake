@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-nix-vector-routing-default.pdb"
+  "../../out/lib/libns3-dev-nix-vector-routing-default.so"
+  "CMakeFiles/nix-vector-routing.dir/helper/nix-vector-helper.cc.o"
+  "CMakeFiles/nix-vector-routing.dir/helper/nix-vector-helper.cc.o.d"
+  "CMakeFiles/nix-vector-routing.dir/model/nix-vector-routing.cc.o"
+  "CMakeFiles/nix-vector-routing.dir/model/nix-vector-routing.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nix-vector-routing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
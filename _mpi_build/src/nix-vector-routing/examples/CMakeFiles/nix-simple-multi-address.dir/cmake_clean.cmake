@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/nix-vector-routing/examples/ns3-dev-nix-simple-multi-address-default"
+  "../../../out/src/nix-vector-routing/examples/ns3-dev-nix-simple-multi-address-default.pdb"
+  "CMakeFiles/nix-simple-multi-address.dir/nix-simple-multi-address.cc.o"
+  "CMakeFiles/nix-simple-multi-address.dir/nix-simple-multi-address.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nix-simple-multi-address.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/nix-vector-routing/examples/ns3-dev-nix-simple-default"
+  "../../../out/src/nix-vector-routing/examples/ns3-dev-nix-simple-default.pdb"
+  "CMakeFiles/nix-simple.dir/nix-simple.cc.o"
+  "CMakeFiles/nix-simple.dir/nix-simple.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nix-simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/nix-vector-routing/examples/ns3-dev-nms-p2p-nix-default"
+  "../../../out/src/nix-vector-routing/examples/ns3-dev-nms-p2p-nix-default.pdb"
+  "CMakeFiles/nms-p2p-nix.dir/nms-p2p-nix.cc.o"
+  "CMakeFiles/nms-p2p-nix.dir/nms-p2p-nix.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nms-p2p-nix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
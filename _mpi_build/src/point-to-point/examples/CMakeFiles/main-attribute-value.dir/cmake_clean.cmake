@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/point-to-point/examples/ns3-dev-main-attribute-value-default"
+  "../../../out/src/point-to-point/examples/ns3-dev-main-attribute-value-default.pdb"
+  "CMakeFiles/main-attribute-value.dir/main-attribute-value.cc.o"
+  "CMakeFiles/main-attribute-value.dir/main-attribute-value.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main-attribute-value.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/stats/helper/file-helper.cc" "src/stats/CMakeFiles/stats.dir/helper/file-helper.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/helper/file-helper.cc.o.d"
+  "/root/repo/src/stats/helper/gnuplot-helper.cc" "src/stats/CMakeFiles/stats.dir/helper/gnuplot-helper.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/helper/gnuplot-helper.cc.o.d"
+  "/root/repo/src/stats/model/basic-data-calculators.cc" "src/stats/CMakeFiles/stats.dir/model/basic-data-calculators.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/basic-data-calculators.cc.o.d"
+  "/root/repo/src/stats/model/boolean-probe.cc" "src/stats/CMakeFiles/stats.dir/model/boolean-probe.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/boolean-probe.cc.o.d"
+  "/root/repo/src/stats/model/data-calculator.cc" "src/stats/CMakeFiles/stats.dir/model/data-calculator.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/data-calculator.cc.o.d"
+  "/root/repo/src/stats/model/data-collection-object.cc" "src/stats/CMakeFiles/stats.dir/model/data-collection-object.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/data-collection-object.cc.o.d"
+  "/root/repo/src/stats/model/data-collector.cc" "src/stats/CMakeFiles/stats.dir/model/data-collector.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/data-collector.cc.o.d"
+  "/root/repo/src/stats/model/data-output-interface.cc" "src/stats/CMakeFiles/stats.dir/model/data-output-interface.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/data-output-interface.cc.o.d"
+  "/root/repo/src/stats/model/double-probe.cc" "src/stats/CMakeFiles/stats.dir/model/double-probe.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/double-probe.cc.o.d"
+  "/root/repo/src/stats/model/file-aggregator.cc" "src/stats/CMakeFiles/stats.dir/model/file-aggregator.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/file-aggregator.cc.o.d"
+  "/root/repo/src/stats/model/get-wildcard-matches.cc" "src/stats/CMakeFiles/stats.dir/model/get-wildcard-matches.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/get-wildcard-matches.cc.o.d"
+  "/root/repo/src/stats/model/gnuplot-aggregator.cc" "src/stats/CMakeFiles/stats.dir/model/gnuplot-aggregator.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/gnuplot-aggregator.cc.o.d"
+  "/root/repo/src/stats/model/gnuplot.cc" "src/stats/CMakeFiles/stats.dir/model/gnuplot.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/gnuplot.cc.o.d"
+  "/root/repo/src/stats/model/histogram.cc" "src/stats/CMakeFiles/stats.dir/model/histogram.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/histogram.cc.o.d"
+  "/root/repo/src/stats/model/omnet-data-output.cc" "src/stats/CMakeFiles/stats.dir/model/omnet-data-output.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/omnet-data-output.cc.o.d"
+  "/root/repo/src/stats/model/probe.cc" "src/stats/CMakeFiles/stats.dir/model/probe.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/probe.cc.o.d"
+  "/root/repo/src/stats/model/sqlite-data-output.cc" "src/stats/CMakeFiles/stats.dir/model/sqlite-data-output.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/sqlite-data-output.cc.o.d"
+  "/root/repo/src/stats/model/sqlite-output.cc" "src/stats/CMakeFiles/stats.dir/model/sqlite-output.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/sqlite-output.cc.o.d"
+  "/root/repo/src/stats/model/time-data-calculators.cc" "src/stats/CMakeFiles/stats.dir/model/time-data-calculators.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/time-data-calculators.cc.o.d"
+  "/root/repo/src/stats/model/time-probe.cc" "src/stats/CMakeFiles/stats.dir/model/time-probe.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/time-probe.cc.o.d"
+  "/root/repo/src/stats/model/time-series-adaptor.cc" "src/stats/CMakeFiles/stats.dir/model/time-series-adaptor.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/time-series-adaptor.cc.o.d"
+  "/root/repo/src/stats/model/uinteger-16-probe.cc" "src/stats/CMakeFiles/stats.dir/model/uinteger-16-probe.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/uinteger-16-probe.cc.o.d"
+  "/root/repo/src/stats/model/uinteger-32-probe.cc" "src/stats/CMakeFiles/stats.dir/model/uinteger-32-probe.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/uinteger-32-probe.cc.o.d"
+  "/root/repo/src/stats/model/uinteger-8-probe.cc" "src/stats/CMakeFiles/stats.dir/model/uinteger-8-probe.cc.o" "gcc" "src/stats/CMakeFiles/stats.dir/model/uinteger-8-probe.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mpi_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/stats/examples/ns3-dev-double-probe-example-default"
+  "../../../out/src/stats/examples/ns3-dev-double-probe-example-default.pdb"
+  "CMakeFiles/double-probe-example.dir/double-probe-example.cc.o"
+  "CMakeFiles/double-probe-example.dir/double-probe-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/double-probe-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
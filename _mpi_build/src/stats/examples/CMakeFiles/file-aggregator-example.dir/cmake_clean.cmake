@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/stats/examples/ns3-dev-file-aggregator-example-default"
+  "../../../out/src/stats/examples/ns3-dev-file-aggregator-example-default.pdb"
+  "CMakeFiles/file-aggregator-example.dir/file-aggregator-example.cc.o"
+  "CMakeFiles/file-aggregator-example.dir/file-aggregator-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/file-aggregator-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/stats/examples/ns3-dev-file-helper-example-default"
+  "../../../out/src/stats/examples/ns3-dev-file-helper-example-default.pdb"
+  "CMakeFiles/file-helper-example.dir/file-helper-example.cc.o"
+  "CMakeFiles/file-helper-example.dir/file-helper-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/file-helper-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/stats/examples/ns3-dev-gnuplot-aggregator-example-default"
+  "../../../out/src/stats/examples/ns3-dev-gnuplot-aggregator-example-default.pdb"
+  "CMakeFiles/gnuplot-aggregator-example.dir/gnuplot-aggregator-example.cc.o"
+  "CMakeFiles/gnuplot-aggregator-example.dir/gnuplot-aggregator-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gnuplot-aggregator-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
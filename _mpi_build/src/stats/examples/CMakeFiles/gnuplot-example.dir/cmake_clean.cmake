@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/stats/examples/ns3-dev-gnuplot-example-default"
+  "../../../out/src/stats/examples/ns3-dev-gnuplot-example-default.pdb"
+  "CMakeFiles/gnuplot-example.dir/gnuplot-example.cc.o"
+  "CMakeFiles/gnuplot-example.dir/gnuplot-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gnuplot-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
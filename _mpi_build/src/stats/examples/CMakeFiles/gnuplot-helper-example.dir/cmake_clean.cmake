@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/stats/examples/ns3-dev-gnuplot-helper-example-default"
+  "../../../out/src/stats/examples/ns3-dev-gnuplot-helper-example-default.pdb"
+  "CMakeFiles/gnuplot-helper-example.dir/gnuplot-helper-example.cc.o"
+  "CMakeFiles/gnuplot-helper-example.dir/gnuplot-helper-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gnuplot-helper-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/stats/examples/ns3-dev-time-probe-example-default"
+  "../../../out/src/stats/examples/ns3-dev-time-probe-example-default.pdb"
+  "CMakeFiles/time-probe-example.dir/time-probe-example.cc.o"
+  "CMakeFiles/time-probe-example.dir/time-probe-example.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/time-probe-example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/traffic-control/test/adaptive-red-queue-disc-test-suite.cc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/adaptive-red-queue-disc-test-suite.cc.o" "gcc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/adaptive-red-queue-disc-test-suite.cc.o.d"
+  "/root/repo/src/traffic-control/test/cobalt-queue-disc-test-suite.cc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/cobalt-queue-disc-test-suite.cc.o" "gcc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/cobalt-queue-disc-test-suite.cc.o.d"
+  "/root/repo/src/traffic-control/test/codel-queue-disc-test-suite.cc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/codel-queue-disc-test-suite.cc.o" "gcc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/codel-queue-disc-test-suite.cc.o.d"
+  "/root/repo/src/traffic-control/test/fifo-queue-disc-test-suite.cc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/fifo-queue-disc-test-suite.cc.o" "gcc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/fifo-queue-disc-test-suite.cc.o.d"
+  "/root/repo/src/traffic-control/test/pie-queue-disc-test-suite.cc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/pie-queue-disc-test-suite.cc.o" "gcc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/pie-queue-disc-test-suite.cc.o.d"
+  "/root/repo/src/traffic-control/test/prio-queue-disc-test-suite.cc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/prio-queue-disc-test-suite.cc.o" "gcc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/prio-queue-disc-test-suite.cc.o.d"
+  "/root/repo/src/traffic-control/test/queue-disc-traces-test-suite.cc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/queue-disc-traces-test-suite.cc.o" "gcc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/queue-disc-traces-test-suite.cc.o.d"
+  "/root/repo/src/traffic-control/test/red-queue-disc-test-suite.cc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/red-queue-disc-test-suite.cc.o" "gcc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/red-queue-disc-test-suite.cc.o.d"
+  "/root/repo/src/traffic-control/test/tbf-queue-disc-test-suite.cc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/tbf-queue-disc-test-suite.cc.o" "gcc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/tbf-queue-disc-test-suite.cc.o.d"
+  "/root/repo/src/traffic-control/test/tc-flow-control-test-suite.cc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/tc-flow-control-test-suite.cc.o" "gcc" "src/traffic-control/CMakeFiles/traffic-control-test.dir/test/tc-flow-control-test-suite.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mpi_build/src/traffic-control/CMakeFiles/traffic-control.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mpi_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../out/src/traffic-control/examples/ns3-dev-codel-vs-pfifo-basic-test-default"
+  "../../../out/src/traffic-control/examples/ns3-dev-codel-vs-pfifo-basic-test-default.pdb"
+  "CMakeFiles/codel-vs-pfifo-basic-test.dir/codel-vs-pfifo-basic-test.cc.o"
+  "CMakeFiles/codel-vs-pfifo-basic-test.dir/codel-vs-pfifo-basic-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/codel-vs-pfifo-basic-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
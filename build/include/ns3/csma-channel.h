@@ -0,0 +1 @@
+#include "/root/repo/src/csma/model/csma-channel.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/csma-layout/model/csma-star-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/internet-apps/model/dhcp6-duid.h"
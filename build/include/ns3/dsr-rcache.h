@@ -0,0 +1 @@
+#include "/root/repo/src/dsr/model/dsr-rcache.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/eht/eht-frame-exchange-manager.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lte/model/epc-x2-header.h"
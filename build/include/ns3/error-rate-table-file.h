@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/error-rate-table-file.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/lte/model/fdtbfq-ff-mac-scheduler.h"
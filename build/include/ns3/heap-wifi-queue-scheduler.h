@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/heap-wifi-queue-scheduler.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/rate-control/ideal-wifi-manager.h"
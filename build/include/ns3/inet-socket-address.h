@@ -0,0 +1 @@
+#include "/root/repo/src/network/utils/inet-socket-address.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/internet/helper/internet-trace-helper.h"
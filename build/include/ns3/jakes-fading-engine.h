@@ -0,0 +1 @@
+#include "/root/repo/src/propagation/model/jakes-fading-engine.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/model/lru-cache-index.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/network/utils/net-device-queue-interface.h"
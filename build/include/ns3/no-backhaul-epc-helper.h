@@ -0,0 +1 @@
+#include "/root/repo/src/lte/helper/no-backhaul-epc-helper.h"
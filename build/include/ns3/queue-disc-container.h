@@ -0,0 +1 @@
+#include "/root/repo/src/traffic-control/helper/queue-disc-container.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/recipient-block-ack-agreement.h"
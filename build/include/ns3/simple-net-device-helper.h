@@ -0,0 +1 @@
+#include "/root/repo/src/network/helper/simple-net-device-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/sixlowpan/model/sixlowpan-net-device.h"
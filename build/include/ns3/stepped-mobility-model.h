@@ -0,0 +1 @@
+#include "/root/repo/src/mobility/model/stepped-mobility-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/tabulated-error-rate-model.h"
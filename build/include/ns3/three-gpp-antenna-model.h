@@ -0,0 +1 @@
+#include "/root/repo/src/antenna/model/three-gpp-antenna-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/propagation/model/three-gpp-v2v-propagation-loss-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/helper/tv-spectrum-transmitter-helper.h"
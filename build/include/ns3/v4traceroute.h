@@ -0,0 +1 @@
+#include "/root/repo/src/internet-apps/model/v4traceroute.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/wifi-default-ack-manager.h"
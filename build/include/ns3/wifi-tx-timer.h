@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/wifi-tx-timer.h"
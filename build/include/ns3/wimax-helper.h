@@ -0,0 +1 @@
+#include "/root/repo/src/wimax/helper/wimax-helper.h"
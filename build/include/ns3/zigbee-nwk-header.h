@@ -0,0 +1 @@
+#include "/root/repo/src/zigbee/model/zigbee-nwk-header.h"
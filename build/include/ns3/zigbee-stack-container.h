@@ -0,0 +1 @@
+#include "/root/repo/src/zigbee/helper/zigbee-stack-container.h"
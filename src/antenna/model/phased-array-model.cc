@@ -14,6 +14,8 @@
 #include "ns3/pointer.h"
 #include "ns3/uinteger.h"
 
+#include <mutex>
+
 namespace ns3
 {
 
@@ -22,6 +24,13 @@ SymmetricAdjacencyMatrix<bool> PhasedArrayModel::m_outOfDateAntennaPairChannel;
 
 NS_LOG_COMPONENT_DEFINE("PhasedArrayModel");
 
+namespace
+{
+/// Protects the cached element locations, which may be retrieved by multiple threads
+/// generating channel matrices
+std::mutex g_elementLocationsMutex;
+} // namespace
+
 NS_OBJECT_ENSURE_REGISTERED(PhasedArrayModel);
 
 PhasedArrayModel::PhasedArrayModel()
@@ -107,17 +116,88 @@ PhasedArrayModel::GetBeamformingVector(Angles a) const
 PhasedArrayModel::ComplexVector
 PhasedArrayModel::GetSteeringVector(Angles a) const
 {
-    ComplexVector steeringVector(GetNumElems());
-    for (size_t i = 0; i < GetNumElems(); i++)
+    return GetSteeringVectors({a});
+}
+
+ComplexMatrixArray
+PhasedArrayModel::GetSteeringVectors(const std::vector<Angles>& angles) const
+{
+    NS_LOG_FUNCTION(this << angles.size());
+
+    auto locations = GetElementLocations();
+    const size_t numElems = locations->x.size();
+    const double* x = locations->x.data();
+    const double* y = locations->y.data();
+    const double* z = locations->z.data();
+
+    ComplexMatrixArray steeringVectors(numElems, angles.size());
+    std::vector<double> phases(numElems);
+    for (size_t j = 0; j < angles.size(); j++)
+    {
+        const double sinIncl = sin(angles[j].GetInclination());
+        const double ux = -2 * M_PI * sinIncl * cos(angles[j].GetAzimuth());
+        const double uy = -2 * M_PI * sinIncl * sin(angles[j].GetAzimuth());
+        const double uz = -2 * M_PI * cos(angles[j].GetInclination());
+        // the elements of a column are contiguous, and the phases are computed in a
+        // separate loop without dependencies among iterations, which can be vectorized
+        for (size_t i = 0; i < numElems; i++)
+        {
+            phases[i] = ux * x[i] + uy * y[i] + uz * z[i];
+        }
+        std::complex<double>* column = steeringVectors.GetPagePtr(0) + j * numElems;
+        for (size_t i = 0; i < numElems; i++)
+        {
+            column[i] = std::complex<double>(cos(phases[i]), sin(phases[i]));
+        }
+    }
+    return steeringVectors;
+}
+
+std::vector<std::pair<double, double>>
+PhasedArrayModel::GetElementFieldPatterns(const std::vector<Angles>& angles,
+                                          uint8_t polIndex) const
+{
+    NS_LOG_FUNCTION(this << angles.size() << +polIndex);
+
+    std::vector<std::pair<double, double>> fieldPatterns;
+    fieldPatterns.reserve(angles.size());
+    for (const auto& a : angles)
+    {
+        fieldPatterns.push_back(GetElementFieldPattern(a, polIndex));
+    }
+    return fieldPatterns;
+}
+
+std::shared_ptr<const PhasedArrayModel::ElementLocations>
+PhasedArrayModel::GetElementLocations() const
+{
+    std::lock_guard lock(g_elementLocationsMutex);
+    if (!m_elementLocations)
+    {
+        m_elementLocations = DoGetElementLocations();
+        NS_ASSERT(m_elementLocations->x.size() == GetNumElems());
+    }
+    return m_elementLocations;
+}
+
+std::shared_ptr<const PhasedArrayModel::ElementLocations>
+PhasedArrayModel::DoGetElementLocations() const
+{
+    NS_LOG_FUNCTION(this);
+
+    auto locations = std::make_shared<ElementLocations>();
+    const size_t numElems = GetNumElems();
+    locations->x.resize(numElems);
+    locations->y.resize(numElems);
+    locations->z.resize(numElems);
+    for (size_t i = 0; i < numElems; i++)
     {
         Vector loc = GetElementLocation(i);
-        double phase = -2 * M_PI *
-                       (sin(a.GetInclination()) * cos(a.GetAzimuth()) * loc.x +
-                        sin(a.GetInclination()) * sin(a.GetAzimuth()) * loc.y +
-                        cos(a.GetInclination()) * loc.z);
-        steeringVector[i] = std::polar<double>(1.0, phase);
+        locations->x[i] = loc.x;
+        locations->y[i] = loc.y;
+        locations->z[i] = loc.z;
     }
-    return steeringVector;
+    return locations;
 }
 
 void
@@ -155,6 +235,8 @@ void
 PhasedArrayModel::InvalidateChannels() const
 {
     m_outOfDateAntennaPairChannel.SetValueAdjacent(m_id, true);
+    std::lock_guard lock(g_elementLocationsMutex);
+    m_elementLocations.reset();
 }
 
 } /* namespace ns3 */
@@ -15,6 +15,8 @@
 #include "ns3/symmetric-adjacency-matrix.h"
 
 #include <complex>
+#include <memory>
+#include <vector>
 
 namespace ns3
 {
@@ -76,6 +78,25 @@ class PhasedArrayModel : public Object
      */
     virtual size_t GetNumElems() const = 0;
 
+    /**
+     * The locations of the antenna elements, normalized with respect to the wavelength,
+     * stored as one array per coordinate.
+     */
+    struct ElementLocations
+    {
+        std::vector<double> x; //!< the x coordinates of the elements
+        std::vector<double> y; //!< the y coordinates of the elements
+        std::vector<double> z; //!< the z coordinates of the elements
+    };
+
+    /**
+     * @brief Returns the locations of all the antenna elements. The table is computed
+     * when first needed after a change of the array configuration, and it may be
+     * shared with other arrays having the same configuration.
+     * @return the locations of the antenna elements
+     */
+    std::shared_ptr<const ElementLocations> GetElementLocations() const;
+
     /**
      * @brief Returns the horizontal and vertical components of the antenna element field
      * pattern at the specified direction. Single polarization is considered.
@@ -88,6 +109,18 @@ class PhasedArrayModel : public Object
     virtual std::pair<double, double> GetElementFieldPattern(Angles a,
                                                              uint8_t polIndex = 0) const = 0;
 
+    /**
+     * @brief Returns the horizontal and vertical components of the antenna element field
+     * pattern at each of the specified directions. Single polarization is considered.
+     * @param angles the angles indicating the interested directions
+     * @param polIndex the index of the polarization for which will be retrieved the field
+     * patterns
+     * @return the pairs returned by GetElementFieldPattern for each direction
+     */
+    virtual std::vector<std::pair<double, double>> GetElementFieldPatterns(
+        const std::vector<Angles>& angles,
+        uint8_t polIndex = 0) const;
+
     /**
      * @brief Set the vertical number of ports
      * @param nPorts the vertical number of ports
@@ -226,6 +259,15 @@ class PhasedArrayModel : public Object
      */
     ComplexVector GetSteeringVector(Angles a) const;
 
+    /**
+     * Returns the steering vectors that point toward the specified directions. The
+     * steering vectors are computed together, using the cached locations of the elements.
+     * @param angles the steering angles
+     * @return a matrix with one row per antenna element and one column per angle,
+     *         whose columns are the steering vectors
+     */
+    ComplexMatrixArray GetSteeringVectors(const std::vector<Angles>& angles) const;
+
     /**
      * Sets the antenna model to be used
      * @param antennaElement the antenna model
@@ -258,12 +300,21 @@ class PhasedArrayModel : public Object
      */
     void InvalidateChannels() const;
 
+    /**
+     * Compute the locations of the antenna elements for the current array configuration.
+     * The default implementation calls GetElementLocation for each element.
+     * @return the locations of the antenna elements
+     */
+    virtual std::shared_ptr<const ElementLocations> DoGetElementLocations() const;
+
     ComplexVector m_beamformingVector;  //!< the beamforming vector in use
     Ptr<AntennaModel> m_antennaElement; //!< the model of the antenna element in use
     bool m_isBfVectorValid;             //!< ensures the validity of the beamforming vector
     static uint32_t
         m_idCounter;  //!< the ID counter that is used to determine the unique antenna array ID
     uint32_t m_id{0}; //!< the ID of this antenna array instance
+    mutable std::shared_ptr<const ElementLocations>
+        m_elementLocations; //!< the cached locations of the elements, reset by InvalidateChannels
     static SymmetricAdjacencyMatrix<bool>
         m_outOfDateAntennaPairChannel; //!< matrix indicating whether a channel matrix between a
                                        //!< pair of antennas needs to be updated after a change in
@@ -11,6 +11,10 @@
 #include "ns3/log.h"
 #include "ns3/uinteger.h"
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 namespace ns3
 {
 
@@ -18,6 +22,21 @@ NS_LOG_COMPONENT_DEFINE("UniformPlanarArray");
 
 NS_OBJECT_ENSURE_REGISTERED(UniformPlanarArray);
 
+namespace
+{
+/// The configuration determining the locations of the elements of a UniformPlanarArray,
+/// i.e., the number of rows and columns, the vertical and horizontal spacing, the bearing
+/// and downtilt angles and whether the array is dual-polarized
+using ElementLocationsKey = std::tuple<uint32_t, uint32_t, double, double, double, double, bool>;
+
+/// Protects the map of the shared element location tables
+std::mutex g_sharedElementLocationsMutex;
+
+/// The element location tables currently in use, indexed by array configuration
+std::map<ElementLocationsKey, std::weak_ptr<const PhasedArrayModel::ElementLocations>>
+    g_sharedElementLocations;
+} // namespace
+
 UniformPlanarArray::UniformPlanarArray()
     : PhasedArrayModel()
 {
@@ -277,6 +296,39 @@ UniformPlanarArray::GetElementLocation(uint64_t index) const
     return loc;
 }
 
+std::shared_ptr<const PhasedArrayModel::ElementLocations>
+UniformPlanarArray::DoGetElementLocations() const
+{
+    NS_LOG_FUNCTION(this);
+
+    ElementLocationsKey key{m_numRows,
+                            m_numColumns,
+                            m_disV,
+                            m_disH,
+                            m_alpha,
+                            m_beta,
+                            m_isDualPolarized};
+
+    std::lock_guard lock(g_sharedElementLocationsMutex);
+    if (auto it = g_sharedElementLocations.find(key); it != g_sharedElementLocations.end())
+    {
+        if (auto locations = it->second.lock())
+        {
+            NS_LOG_DEBUG("Sharing the element locations of an array with the same configuration");
+            return locations;
+        }
+    }
+
+    // remove the tables that are no longer used by any array
+    std::erase_if(g_sharedElementLocations, [](const auto& entry) {
+        return entry.second.expired();
+    });
+
+    auto locations = PhasedArrayModel::DoGetElementLocations();
+    g_sharedElementLocations[key] = locations;
+    return locations;
+}
+
 uint8_t
 UniformPlanarArray::GetNumPols() const
 {
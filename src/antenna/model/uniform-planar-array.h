@@ -261,6 +261,15 @@ class UniformPlanarArray : public PhasedArrayModel
      */
     uint8_t GetElemPol(size_t elemIndex) const override;
 
+  protected:
+    /**
+     * Compute the locations of the antenna elements. The tables are shared by all the
+     * arrays with the same number of rows and columns, spacing, bearing and downtilt
+     * angles and polarization, and are released when no array uses them.
+     * @return the locations of the antenna elements
+     */
+    std::shared_ptr<const ElementLocations> DoGetElementLocations() const override;
+
   private:
     uint32_t m_numColumns{1}; //!< number of columns
     uint32_t m_numRows{1};    //!< number of rows
@@ -9,6 +9,7 @@
 #include "sstream"
 #include "string"
 
+#include "ns3/boolean.h"
 #include "ns3/double.h"
 #include "ns3/isotropic-antenna-model.h"
 #include "ns3/log.h"
@@ -263,6 +264,110 @@ UpdateOnChangeTestCase::DoRun()
                           "Expecting update, antenna parameter changed");
 }
 
+/**
+ * @ingroup antenna-tests
+ *
+ * @brief Test the batched computation of the steering vectors and the sharing of the
+ * element locations among arrays with the same configuration
+ */
+class SteeringVectorsTestCase : public TestCase
+{
+  public:
+    SteeringVectorsTestCase()
+        : TestCase("Test the batched steering vectors and the shared element locations")
+    {
+    }
+
+  private:
+    /**
+     * Run the test
+     */
+    void DoRun() override;
+
+    /**
+     * Check the steering vectors computed together against the steering vectors
+     * computed from the locations returned by GetElementLocation.
+     * @param ant the antenna array
+     * @param angles the steering angles
+     */
+    void CheckSteeringVectors(Ptr<const UniformPlanarArray> ant, const std::vector<Angles>& angles);
+};
+
+void
+SteeringVectorsTestCase::CheckSteeringVectors(Ptr<const UniformPlanarArray> ant,
+                                              const std::vector<Angles>& angles)
+{
+    ComplexMatrixArray steeringVectors = ant->GetSteeringVectors(angles);
+    NS_TEST_ASSERT_MSG_EQ(steeringVectors.GetNumRows(), ant->GetNumElems(), "Unexpected rows");
+    NS_TEST_ASSERT_MSG_EQ(steeringVectors.GetNumCols(), angles.size(), "Unexpected columns");
+
+    for (size_t j = 0; j < angles.size(); j++)
+    {
+        const Angles& a = angles[j];
+        PhasedArrayModel::ComplexVector sv = ant->GetSteeringVector(a);
+        for (size_t i = 0; i < ant->GetNumElems(); i++)
+        {
+            Vector loc = ant->GetElementLocation(i);
+            double phase = -2 * M_PI *
+                           (sin(a.GetInclination()) * cos(a.GetAzimuth()) * loc.x +
+                            sin(a.GetInclination()) * sin(a.GetAzimuth()) * loc.y +
+                            cos(a.GetInclination()) * loc.z);
+            std::complex<double> expected = std::polar<double>(1.0, phase);
+            NS_TEST_EXPECT_MSG_LT(std::abs(steeringVectors(i, j) - expected),
+                                  1e-9,
+                                  "Unexpected steering vector element " << i << " for " << a);
+            NS_TEST_EXPECT_MSG_LT(std::abs(sv[i] - expected),
+                                  1e-9,
+                                  "Unexpected steering vector element " << i << " for " << a);
+        }
+    }
+}
+
+void
+SteeringVectorsTestCase::DoRun()
+{
+    auto createArray = [](double downtilt) {
+        Ptr<UniformPlanarArray> ant = CreateObject<UniformPlanarArray>();
+        ant->SetAttribute("NumRows", UintegerValue(4));
+        ant->SetAttribute("NumColumns", UintegerValue(8));
+        ant->SetAttribute("BearingAngle", DoubleValue(DegreesToRadians(30)));
+        ant->SetAttribute("DowntiltAngle", DoubleValue(downtilt));
+        ant->SetAttribute("IsDualPolarized", BooleanValue(true));
+        return ant;
+    };
+    Ptr<UniformPlanarArray> ant1 = createArray(DegreesToRadians(10));
+    Ptr<UniformPlanarArray> ant2 = createArray(DegreesToRadians(10));
+
+    std::vector<Angles> angles;
+    for (double azimuth = -180; azimuth < 180; azimuth += 45)
+    {
+        for (double inclination = 0; inclination <= 180; inclination += 30)
+        {
+            angles.emplace_back(DegreesToRadians(azimuth), DegreesToRadians(inclination));
+        }
+    }
+    CheckSteeringVectors(ant1, angles);
+
+    // arrays with the same configuration share the element locations
+    NS_TEST_EXPECT_MSG_EQ((ant1->GetElementLocations() == ant2->GetElementLocations()),
+                          true,
+                          "Arrays with the same configuration should share the element locations");
+
+    // a change of the configuration invalidates the element locations of the array only
+    ant2->SetAttribute("DowntiltAngle", DoubleValue(DegreesToRadians(20)));
+    NS_TEST_EXPECT_MSG_EQ((ant1->GetElementLocations() != ant2->GetElementLocations()),
+                          true,
+                          "Arrays with different configurations should not share the locations");
+    CheckSteeringVectors(ant1, angles);
+    CheckSteeringVectors(ant2, angles);
+
+    ant2->SetAttribute("NumColumns", UintegerValue(2));
+    NS_TEST_EXPECT_MSG_EQ(ant2->GetElementLocations()->x.size(),
+                          ant2->GetNumElems(),
+                          "The element locations should follow the size of the array");
+    CheckSteeringVectors(ant2, angles);
+}
+
 /**
  * @ingroup antenna-tests
  *
@@ -452,6 +557,7 @@ UniformPlanarArrayTestSuite::UniformPlanarArrayTestSuite()
                                            "Test IsChannelOutOfDate() and InvalidateChannels() for "
                                            "UniformPlanarArray with 3GPP antenna element"),
                 TestCase::Duration::QUICK);
+    AddTestCase(new SteeringVectorsTestCase, TestCase::Duration::QUICK);
 }
 
 static UniformPlanarArrayTestSuite staticUniformPlanarArrayTestSuiteInstance;
@@ -0,0 +1,168 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+/**
+ * @file
+ * @ingroup buildings
+ *
+ * Benchmark of the evaluation of the channel condition in an urban scenario with
+ * many buildings. The buildings are placed on a regular grid of blocks, the UEs
+ * are dropped at random positions, and the channel condition between every eNB
+ * and every UE is computed by the BuildingsChannelConditionModel, whose queries
+ * use the spatial index of the BuildingList. The same LOS and indoor/outdoor
+ * conditions are then computed by checking every building, and the running
+ * times of the two approaches are reported.
+ */
+
+#include "ns3/building-list.h"
+#include "ns3/building.h"
+#include "ns3/buildings-channel-condition-model.h"
+#include "ns3/buildings-helper.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/core-module.h"
+#include "ns3/mobility-building-info.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace ns3;
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nBlocksPerSide = 100;
+    double blockSize = 60.0;
+    double streetWidth = 20.0;
+    uint32_t nEnbs = 10;
+    uint32_t nUes = 500;
+    double hEnb = 30.0;
+    double hUe = 1.5;
+    bool exhaustive = true;
+    CommandLine cmd(__FILE__);
+
+    cmd.AddValue("nBlocksPerSide", "Number of buildings per side of the grid", nBlocksPerSide);
+    cmd.AddValue("blockSize", "Side of a building, in meters", blockSize);
+    cmd.AddValue("streetWidth", "Width of the streets, in meters", streetWidth);
+    cmd.AddValue("nEnbs", "Number of eNBs", nEnbs);
+    cmd.AddValue("nUes", "Number of UEs", nUes);
+    cmd.AddValue("hEnb", "Height of the eNBs", hEnb);
+    cmd.AddValue("hUe", "Height of the UEs", hUe);
+    cmd.AddValue("exhaustive", "Also check every building for each query", exhaustive);
+    cmd.Parse(argc, argv);
+
+    RngSeedManager::SetSeed(1);
+    Ptr<UniformRandomVariable> rv = CreateObject<UniformRandomVariable>();
+    rv->SetStream(1);
+
+    double gridSize = nBlocksPerSide * (blockSize + streetWidth);
+    for (uint32_t i = 0; i < nBlocksPerSide; ++i)
+    {
+        for (uint32_t j = 0; j < nBlocksPerSide; ++j)
+        {
+            double x = i * (blockSize + streetWidth);
+            double y = j * (blockSize + streetWidth);
+            Ptr<Building> building = CreateObject<Building>();
+            building->SetBoundaries(
+                Box(x, x + blockSize, y, y + blockSize, 0.0, rv->GetValue(10.0, 50.0)));
+            building->SetBuildingType(Building::Residential);
+            building->SetExtWallsType(Building::ConcreteWithWindows);
+        }
+    }
+
+    NodeContainer enbs;
+    enbs.Create(nEnbs);
+    NodeContainer ues;
+    ues.Create(nUes);
+    for (auto it = enbs.Begin(); it != enbs.End(); ++it)
+    {
+        Ptr<ConstantPositionMobilityModel> mm = CreateObject<ConstantPositionMobilityModel>();
+        mm->SetPosition(Vector(rv->GetValue(0.0, gridSize), rv->GetValue(0.0, gridSize), hEnb));
+        (*it)->AggregateObject(mm);
+    }
+    for (auto it = ues.Begin(); it != ues.End(); ++it)
+    {
+        Ptr<ConstantPositionMobilityModel> mm = CreateObject<ConstantPositionMobilityModel>();
+        mm->SetPosition(Vector(rv->GetValue(0.0, gridSize), rv->GetValue(0.0, gridSize), hUe));
+        (*it)->AggregateObject(mm);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    BuildingsHelper::Install(enbs);
+    BuildingsHelper::Install(ues);
+    Ptr<BuildingsChannelConditionModel> condModel = CreateObject<BuildingsChannelConditionModel>();
+    uint32_t nLos = 0;
+    for (auto enb = enbs.Begin(); enb != enbs.End(); ++enb)
+    {
+        Ptr<MobilityModel> enbMm = (*enb)->GetObject<MobilityModel>();
+        for (auto ue = ues.Begin(); ue != ues.End(); ++ue)
+        {
+            Ptr<ChannelCondition> cond =
+                condModel->GetChannelCondition(enbMm, (*ue)->GetObject<MobilityModel>());
+            // count the outdoor links in LOS
+            if (cond->GetO2iCondition() == ChannelCondition::O2iConditionValue::O2O &&
+                cond->IsLos())
+            {
+                nLos++;
+            }
+        }
+    }
+    std::chrono::duration<double> indexed = std::chrono::steady_clock::now() - start;
+
+    std::cout << BuildingList::GetNBuildings() << " buildings, " << nEnbs * nUes
+              << " links, of which " << nLos << " outdoor links in LOS" << std::endl;
+    std::cout << "Spatial index: " << indexed.count() << " s" << std::endl;
+
+    if (exhaustive)
+    {
+        start = std::chrono::steady_clock::now();
+        uint32_t nIndoor = 0;
+        for (auto ue = ues.Begin(); ue != ues.End(); ++ue)
+        {
+            Vector position = (*ue)->GetObject<MobilityModel>()->GetPosition();
+            for (auto bit = BuildingList::Begin(); bit != BuildingList::End(); ++bit)
+            {
+                if ((*bit)->IsInside(position))
+                {
+                    nIndoor++;
+                    break;
+                }
+            }
+        }
+        uint32_t nLosExhaustive = 0;
+        for (auto enb = enbs.Begin(); enb != enbs.End(); ++enb)
+        {
+            if ((*enb)->GetObject<MobilityBuildingInfo>()->IsIndoor())
+            {
+                continue;
+            }
+            Vector enbPosition = (*enb)->GetObject<MobilityModel>()->GetPosition();
+            for (auto ue = ues.Begin(); ue != ues.End(); ++ue)
+            {
+                if ((*ue)->GetObject<MobilityBuildingInfo>()->IsIndoor())
+                {
+                    continue;
+                }
+                Vector uePosition = (*ue)->GetObject<MobilityModel>()->GetPosition();
+                bool blocked = false;
+                for (auto bit = BuildingList::Begin(); bit != BuildingList::End() && !blocked;
+                     ++bit)
+                {
+                    blocked = (*bit)->IsIntersect(enbPosition, uePosition);
+                }
+                nLosExhaustive += blocked ? 0 : 1;
+            }
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << "Exhaustive search: " << elapsed.count() << " s (" << nIndoor
+                  << " indoor UEs, " << nLosExhaustive << " outdoor links in LOS)" << std::endl;
+        NS_ABORT_MSG_IF(nLosExhaustive != nLos, "The spatial index returned a different result");
+    }
+
+    Simulator::Destroy();
+
+    return 0;
+}
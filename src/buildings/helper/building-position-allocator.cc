@@ -176,20 +176,17 @@ OutdoorPositionAllocator::GetNext() const
 
         NS_LOG_INFO("Position " << position);
 
-        bool inside = false;
-        for (auto bit = BuildingList::Begin(); bit != BuildingList::End(); ++bit)
+        auto buildings = BuildingList::GetBuildingsContaining(position);
+        bool inside = !buildings.empty();
+        if (inside)
         {
-            if ((*bit)->IsInside(position))
-            {
-                NS_LOG_INFO("Position "
-                            << position << " is inside the building with boundaries "
-                            << (*bit)->GetBoundaries().xMin << " " << (*bit)->GetBoundaries().xMax
-                            << " " << (*bit)->GetBoundaries().yMin << " "
-                            << (*bit)->GetBoundaries().yMax << " " << (*bit)->GetBoundaries().zMin
-                            << " " << (*bit)->GetBoundaries().zMax);
-                inside = true;
-                break;
-            }
+            NS_LOG_INFO("Position " << position << " is inside the building with boundaries "
+                                    << buildings.front()->GetBoundaries().xMin << " "
+                                    << buildings.front()->GetBoundaries().xMax << " "
+                                    << buildings.front()->GetBoundaries().yMin << " "
+                                    << buildings.front()->GetBoundaries().yMax << " "
+                                    << buildings.front()->GetBoundaries().zMin << " "
+                                    << buildings.front()->GetBoundaries().zMax);
         }
 
         if (inside)
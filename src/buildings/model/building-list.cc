@@ -17,11 +17,56 @@
 #include "ns3/object-vector.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
+#include <array>
+#include <limits>
+
 namespace ns3
 {
 
 NS_LOG_COMPONENT_DEFINE("BuildingList");
 
+/**
+ * Check whether a line segment may intersect a box, by clipping the segment
+ * against the slabs of the box.
+ *
+ * @param box the box
+ * @param l1 the first end of the line segment
+ * @param l2 the second end of the line segment
+ * @returns true if the line segment intersects the box
+ */
+static bool
+SegmentIntersectsBox(const Box& box, const Vector& l1, const Vector& l2)
+{
+    const std::array<double, 3> origin{l1.x, l1.y, l1.z};
+    const std::array<double, 3> direction{l2.x - l1.x, l2.y - l1.y, l2.z - l1.z};
+    const std::array<double, 3> boxMin{box.xMin, box.yMin, box.zMin};
+    const std::array<double, 3> boxMax{box.xMax, box.yMax, box.zMax};
+
+    double tMin = 0;
+    double tMax = 1;
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        if (direction[axis] == 0)
+        {
+            if (origin[axis] < boxMin[axis] || origin[axis] > boxMax[axis])
+            {
+                return false;
+            }
+            continue;
+        }
+        double t1 = (boxMin[axis] - origin[axis]) / direction[axis];
+        double t2 = (boxMax[axis] - origin[axis]) / direction[axis];
+        tMin = std::max(tMin, std::min(t1, t2));
+        tMax = std::min(tMax, std::max(t1, t2));
+        if (tMin > tMax)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 /**
  * @brief private implementation detail of the BuildingList API.
  */
@@ -73,8 +118,65 @@ class BuildingListPriv : public Object
      */
     static Ptr<BuildingListPriv> Get();
 
+    /**
+     * Invalidate the spatial index of the buildings.
+     */
+    void NotifyBoundariesChanged();
+    /**
+     * @param position the position to check
+     * @returns the buildings containing the given position, in increasing order of id
+     */
+    std::vector<Ptr<Building>> GetBuildingsContaining(const Vector& position);
+    /**
+     * @param l1 the first end of the line segment
+     * @param l2 the second end of the line segment
+     * @returns the buildings intersected by the line segment, in increasing order of id
+     */
+    std::vector<Ptr<Building>> GetIntersectingBuildings(const Vector& l1, const Vector& l2);
+    /**
+     * @param l1 the first end of the line segment
+     * @param l2 the second end of the line segment
+     * @returns true if the line segment intersects at least one building
+     */
+    bool IntersectsAnyBuilding(const Vector& l1, const Vector& l2);
+
   private:
     void DoDispose() override;
+    /**
+     * Build the bounding volume hierarchy of the boundaries of the buildings.
+     */
+    void BuildIndex();
+    /**
+     * Build a node of the bounding volume hierarchy and, recursively, its children.
+     * @param node the index of the node in m_nodes
+     * @param first the index in m_indexed of the first building of the node
+     * @param last the index in m_indexed following the last building of the node
+     */
+    void BuildNode(uint32_t node, uint32_t first, uint32_t last);
+    /**
+     * Call a function on every building whose boundaries are contained in the nodes
+     * of the bounding volume hierarchy accepted by a filter.
+     * @tparam Filter \deduced the type of the filter
+     * @tparam Visitor \deduced the type of the function
+     * @param filter returns whether the buildings within a bounding box may be of interest
+     * @param visit called with the id of each building of interest; the visit stops if it
+     *              returns true
+     */
+    template <typename Filter, typename Visitor>
+    void Visit(Filter filter, Visitor visit);
+
+    /// A node of the bounding volume hierarchy
+    struct Node
+    {
+        Box bounds;     //!< bounding box of the buildings of the node
+        uint32_t first; //!< index of the first child, or of the first building of a leaf
+        uint32_t count; //!< number of buildings of a leaf, 0 if the node has children
+    };
+
+    static constexpr uint32_t MAX_LEAF_SIZE = 4; //!< maximum number of buildings of a leaf
+    /// Padding of the bounding boxes, to account for rounding errors in the queries
+    static constexpr double BOUNDS_PADDING = 1e-6;
+
     /**
      * Get the Singleton instance of BuildingListPriv (or create one)
      * @return the BuildingListPriv instance
@@ -88,6 +190,10 @@ class BuildingListPriv : public Object
      */
     static void Delete();
     std::vector<Ptr<Building>> m_buildings; //!< Container of Building
+    std::vector<Node> m_nodes;              //!< nodes of the bounding volume hierarchy
+    std::vector<uint32_t> m_indexed;        //!< ids of the buildings, sorted by leaf
+    std::vector<Box> m_boundaries;          //!< boundaries of the buildings when indexed
+    bool m_indexValid{false};               //!< whether the index is up to date
 };
 
 NS_OBJECT_ENSURE_REGISTERED(BuildingListPriv);
@@ -154,6 +260,10 @@ BuildingListPriv::DoDispose()
         *i = nullptr;
     }
     m_buildings.erase(m_buildings.begin(), m_buildings.end());
+    m_nodes.clear();
+    m_indexed.clear();
+    m_boundaries.clear();
+    m_indexValid = false;
     Object::DoDispose();
 }
 
@@ -162,6 +272,7 @@ BuildingListPriv::Add(Ptr<Building> building)
 {
     uint32_t index = m_buildings.size();
     m_buildings.push_back(building);
+    m_indexValid = false;
     Simulator::ScheduleWithContext(index, TimeStep(0), &Building::Initialize, building);
     return index;
 }
@@ -193,6 +304,210 @@ BuildingListPriv::GetBuilding(uint32_t n)
     return m_buildings.at(n);
 }
 
+void
+BuildingListPriv::NotifyBoundariesChanged()
+{
+    m_indexValid = false;
+}
+
+void
+BuildingListPriv::BuildIndex()
+{
+    NS_LOG_FUNCTION(this << m_buildings.size());
+
+    m_nodes.clear();
+    m_indexed.resize(m_buildings.size());
+    m_boundaries.resize(m_buildings.size());
+    for (uint32_t i = 0; i < m_buildings.size(); ++i)
+    {
+        m_indexed[i] = i;
+        m_boundaries[i] = m_buildings[i]->GetBoundaries();
+    }
+    if (!m_buildings.empty())
+    {
+        m_nodes.resize(1);
+        BuildNode(0, 0, m_indexed.size());
+    }
+    m_indexValid = true;
+}
+
+void
+BuildingListPriv::BuildNode(uint32_t node, uint32_t first, uint32_t last)
+{
+    Box bounds = m_boundaries[m_indexed[first]];
+    // bounding box of the centers of the buildings, to choose the split axis
+    Vector centerMin(std::numeric_limits<double>::max(),
+                     std::numeric_limits<double>::max(),
+                     std::numeric_limits<double>::max());
+    Vector centerMax(std::numeric_limits<double>::lowest(),
+                     std::numeric_limits<double>::lowest(),
+                     std::numeric_limits<double>::lowest());
+    for (uint32_t i = first; i < last; ++i)
+    {
+        const auto& box = m_boundaries[m_indexed[i]];
+        bounds.xMin = std::min(bounds.xMin, box.xMin);
+        bounds.xMax = std::max(bounds.xMax, box.xMax);
+        bounds.yMin = std::min(bounds.yMin, box.yMin);
+        bounds.yMax = std::max(bounds.yMax, box.yMax);
+        bounds.zMin = std::min(bounds.zMin, box.zMin);
+        bounds.zMax = std::max(bounds.zMax, box.zMax);
+        Vector center(0.5 * (box.xMin + box.xMax),
+                      0.5 * (box.yMin + box.yMax),
+                      0.5 * (box.zMin + box.zMax));
+        centerMin = Vector(std::min(centerMin.x, center.x),
+                           std::min(centerMin.y, center.y),
+                           std::min(centerMin.z, center.z));
+        centerMax = Vector(std::max(centerMax.x, center.x),
+                           std::max(centerMax.y, center.y),
+                           std::max(centerMax.z, center.z));
+    }
+    m_nodes[node].bounds = Box(bounds.xMin - BOUNDS_PADDING,
+                               bounds.xMax + BOUNDS_PADDING,
+                               bounds.yMin - BOUNDS_PADDING,
+                               bounds.yMax + BOUNDS_PADDING,
+                               bounds.zMin - BOUNDS_PADDING,
+                               bounds.zMax + BOUNDS_PADDING);
+
+    if (last - first <= MAX_LEAF_SIZE)
+    {
+        m_nodes[node].first = first;
+        m_nodes[node].count = last - first;
+        return;
+    }
+
+    // split the buildings at the median of their centers along the axis of largest spread
+    Vector spread = centerMax - centerMin;
+    auto center = [this](uint32_t id) {
+        const auto& box = m_boundaries[id];
+        return Vector(box.xMin + box.xMax, box.yMin + box.yMax, box.zMin + box.zMax);
+    };
+    auto mid = first + (last - first) / 2;
+    auto begin = m_indexed.begin();
+    if (spread.x >= spread.y && spread.x >= spread.z)
+    {
+        std::nth_element(begin + first, begin + mid, begin + last, [&](uint32_t a, uint32_t b) {
+            return center(a).x < center(b).x;
+        });
+    }
+    else if (spread.y >= spread.z)
+    {
+        std::nth_element(begin + first, begin + mid, begin + last, [&](uint32_t a, uint32_t b) {
+            return center(a).y < center(b).y;
+        });
+    }
+    else
+    {
+        std::nth_element(begin + first, begin + mid, begin + last, [&](uint32_t a, uint32_t b) {
+            return center(a).z < center(b).z;
+        });
+    }
+
+    uint32_t left = m_nodes.size();
+    m_nodes.resize(left + 2);
+    m_nodes[node].first = left;
+    m_nodes[node].count = 0;
+    BuildNode(left, first, mid);
+    BuildNode(left + 1, mid, last);
+}
+
+template <typename Filter, typename Visitor>
+void
+BuildingListPriv::Visit(Filter filter, Visitor visit)
+{
+    if (!m_indexValid)
+    {
+        BuildIndex();
+    }
+    if (m_nodes.empty())
+    {
+        return;
+    }
+
+    // the tree is balanced, hence its depth is logarithmic in the number of buildings
+    std::array<uint32_t, 64> stack;
+    std::size_t stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0)
+    {
+        const auto& node = m_nodes[stack[--stackSize]];
+        if (!filter(node.bounds))
+        {
+            continue;
+        }
+        if (node.count == 0)
+        {
+            stack[stackSize++] = node.first + 1;
+            stack[stackSize++] = node.first;
+            continue;
+        }
+        for (uint32_t i = node.first; i < node.first + node.count; ++i)
+        {
+            if (visit(m_indexed[i]))
+            {
+                return;
+            }
+        }
+    }
+}
+
+std::vector<Ptr<Building>>
+BuildingListPriv::GetBuildingsContaining(const Vector& position)
+{
+    std::vector<uint32_t> ids;
+    Visit([&position](const Box& bounds) { return bounds.IsInside(position); },
+          [&](uint32_t id) {
+              if (m_buildings[id]->IsInside(position))
+              {
+                  ids.push_back(id);
+              }
+              return false;
+          });
+    std::sort(ids.begin(), ids.end());
+
+    std::vector<Ptr<Building>> buildings;
+    buildings.reserve(ids.size());
+    for (auto id : ids)
+    {
+        buildings.push_back(m_buildings[id]);
+    }
+    return buildings;
+}
+
+std::vector<Ptr<Building>>
+BuildingListPriv::GetIntersectingBuildings(const Vector& l1, const Vector& l2)
+{
+    std::vector<uint32_t> ids;
+    Visit([&](const Box& bounds) { return SegmentIntersectsBox(bounds, l1, l2); },
+          [&](uint32_t id) {
+              if (m_buildings[id]->IsIntersect(l1, l2))
+              {
+                  ids.push_back(id);
+              }
+              return false;
+          });
+    std::sort(ids.begin(), ids.end());
+
+    std::vector<Ptr<Building>> buildings;
+    buildings.reserve(ids.size());
+    for (auto id : ids)
+    {
+        buildings.push_back(m_buildings[id]);
+    }
+    return buildings;
+}
+
+bool
+BuildingListPriv::IntersectsAnyBuilding(const Vector& l1, const Vector& l2)
+{
+    bool found = false;
+    Visit([&](const Box& bounds) { return SegmentIntersectsBox(bounds, l1, l2); },
+          [&](uint32_t id) {
+              found = m_buildings[id]->IsIntersect(l1, l2);
+              return found;
+          });
+    return found;
+}
+
 } // namespace ns3
 
 /**
@@ -233,4 +548,28 @@ BuildingList::GetNBuildings()
     return BuildingListPriv::Get()->GetNBuildings();
 }
 
+void
+BuildingList::NotifyBoundariesChanged()
+{
+    BuildingListPriv::Get()->NotifyBoundariesChanged();
+}
+
+std::vector<Ptr<Building>>
+BuildingList::GetBuildingsContaining(const Vector& position)
+{
+    return BuildingListPriv::Get()->GetBuildingsContaining(position);
+}
+
+std::vector<Ptr<Building>>
+BuildingList::GetIntersectingBuildings(const Vector& l1, const Vector& l2)
+{
+    return BuildingListPriv::Get()->GetIntersectingBuildings(l1, l2);
+}
+
+bool
+BuildingList::IntersectsAnyBuilding(const Vector& l1, const Vector& l2)
+{
+    return BuildingListPriv::Get()->IntersectsAnyBuilding(l1, l2);
+}
+
 } // namespace ns3
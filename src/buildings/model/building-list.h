@@ -12,6 +12,7 @@
 #define BUILDING_LIST_H_
 
 #include "ns3/ptr.h"
+#include "ns3/vector.h"
 
 #include <vector>
 
@@ -24,6 +25,11 @@ class Building;
  * @ingroup buildings
  *
  * Container for Building class
+ *
+ * The spatial queries (GetBuildingsContaining, GetIntersectingBuildings and
+ * IntersectsAnyBuilding) use a bounding volume hierarchy of the boundaries of the
+ * buildings, which is built at the first query after a building is added or the
+ * boundaries of a building change, so that they do not need to check every building.
  */
 class BuildingList
 {
@@ -58,6 +64,32 @@ class BuildingList
      * @returns the number of buildings currently in the list.
      */
     static uint32_t GetNBuildings();
+    /**
+     * Notify that the boundaries of a building changed, so that the spatial index
+     * of the buildings is rebuilt at the next query.
+     *
+     * This method is called automatically from Building::SetBoundaries so
+     * the user has little reason to call it himself.
+     */
+    static void NotifyBoundariesChanged();
+    /**
+     * @param position the position to check
+     * @returns the buildings containing the given position, in increasing order of id
+     */
+    static std::vector<Ptr<Building>> GetBuildingsContaining(const Vector& position);
+    /**
+     * @param l1 the first end of the line segment
+     * @param l2 the second end of the line segment
+     * @returns the buildings intersected by the line segment, in increasing order of id
+     */
+    static std::vector<Ptr<Building>> GetIntersectingBuildings(const Vector& l1,
+                                                               const Vector& l2);
+    /**
+     * @param l1 the first end of the line segment
+     * @param l2 the second end of the line segment
+     * @returns true if the line segment intersects at least one building
+     */
+    static bool IntersectsAnyBuilding(const Vector& l1, const Vector& l2);
 };
 
 } // namespace ns3
@@ -11,6 +11,8 @@
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
 #include "ns3/log.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
 
@@ -134,6 +136,120 @@ BuildingsChannelConditionModelTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup building-test
+ *
+ * Test case for the spatial queries of the BuildingList, used by the
+ * BuildingsChannelConditionModel and by the MobilityBuildingInfo. It checks that
+ * the queries return the same buildings as an exhaustive search, for random
+ * positions and line segments, including segments lying on the walls of the
+ * buildings, and after the boundaries of a building change.
+ */
+class BuildingListSpatialQueryTestCase : public TestCase
+{
+  public:
+    BuildingListSpatialQueryTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the results of the queries for a position and a line segment
+     * @param l1 the position, and the first end of the line segment
+     * @param l2 the second end of the line segment
+     */
+    void CheckQueries(const Vector& l1, const Vector& l2);
+};
+
+BuildingListSpatialQueryTestCase::BuildingListSpatialQueryTestCase()
+    : TestCase("Test case for the spatial queries of the BuildingList")
+{
+}
+
+void
+BuildingListSpatialQueryTestCase::CheckQueries(const Vector& l1, const Vector& l2)
+{
+    std::vector<Ptr<Building>> inside;
+    std::vector<Ptr<Building>> intersecting;
+    for (auto bit = BuildingList::Begin(); bit != BuildingList::End(); ++bit)
+    {
+        if ((*bit)->IsInside(l1))
+        {
+            inside.push_back(*bit);
+        }
+        if ((*bit)->IsIntersect(l1, l2))
+        {
+            intersecting.push_back(*bit);
+        }
+    }
+
+    NS_TEST_EXPECT_MSG_EQ((BuildingList::GetBuildingsContaining(l1) == inside),
+                          true,
+                          "Unexpected buildings containing " << l1);
+    NS_TEST_EXPECT_MSG_EQ((BuildingList::GetIntersectingBuildings(l1, l2) == intersecting),
+                          true,
+                          "Unexpected buildings intersecting " << l1 << " - " << l2);
+    NS_TEST_EXPECT_MSG_EQ(BuildingList::IntersectsAnyBuilding(l1, l2),
+                          !intersecting.empty(),
+                          "Unexpected intersection of " << l1 << " - " << l2);
+}
+
+void
+BuildingListSpatialQueryTestCase::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    auto rv = CreateObject<UniformRandomVariable>();
+    rv->SetStream(1);
+
+    // a grid of blocks with random sizes and heights
+    for (uint32_t i = 0; i < 20; ++i)
+    {
+        for (uint32_t j = 0; j < 20; ++j)
+        {
+            auto building = CreateObject<Building>();
+            double x = 50.0 * i;
+            double y = 50.0 * j;
+            building->SetBoundaries(Box(x,
+                                        x + rv->GetValue(10, 50),
+                                        y,
+                                        y + rv->GetValue(10, 50),
+                                        0.0,
+                                        rv->GetValue(5, 60)));
+        }
+    }
+
+    for (uint32_t n = 0; n < 2000; ++n)
+    {
+        Vector l1(rv->GetValue(-100, 1100), rv->GetValue(-100, 1100), rv->GetValue(0, 70));
+        Vector l2(rv->GetValue(-100, 1100), rv->GetValue(-100, 1100), rv->GetValue(0, 70));
+        CheckQueries(l1, l2);
+    }
+
+    // segments and positions lying on the walls of the buildings
+    for (uint32_t n = 0; n < 200; ++n)
+    {
+        auto box = BuildingList::GetBuilding(rv->GetInteger(0, BuildingList::GetNBuildings() - 1))
+                       ->GetBoundaries();
+        double z = rv->GetValue(0, 70);
+        CheckQueries(Vector(box.xMin, -100, z), Vector(box.xMin, 1100, z));
+        CheckQueries(Vector(box.xMax, box.yMax, z), Vector(1100, box.yMax, z));
+        CheckQueries(Vector(box.xMin, box.yMin, box.zMax), Vector(box.xMax, box.yMax, box.zMax));
+    }
+
+    // the index is rebuilt when a building moves
+    auto building = BuildingList::GetBuilding(0);
+    CheckQueries(Vector(2000, 2000, 1), Vector(2010, 2000, 1));
+    building->SetBoundaries(Box(2000, 2010, 1990, 2010, 0, 10));
+    CheckQueries(Vector(2000, 2000, 1), Vector(2010, 2000, 1));
+    NS_TEST_EXPECT_MSG_EQ(BuildingList::IntersectsAnyBuilding(Vector(1990, 2000, 1),
+                                                              Vector(2020, 2000, 1)),
+                          true,
+                          "The moved building was not found");
+
+    Simulator::Destroy();
+}
+
 /**
  * @ingroup building-test
  * Test suite for the buildings channel condition model
@@ -148,6 +264,7 @@ BuildingsChannelConditionModelsTestSuite::BuildingsChannelConditionModelsTestSui
     : TestSuite("buildings-channel-condition-model", Type::UNIT)
 {
     AddTestCase(new BuildingsChannelConditionModelTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new BuildingListSpatialQueryTestCase, TestCase::Duration::QUICK);
 }
 
 /// Static variable for test initialization
@@ -8,6 +8,7 @@
 # See test.py for more information.
 cpp_examples = [
     ("buildings-pathloss-profiler", "True", "True"),
+    ("buildings-channel-condition-profiler --nBlocksPerSide=10 --nUes=50", "True", "False"),
     ("outdoor-group-mobility-example --useHelper=0", "True", "True"),
     ("outdoor-group-mobility-example --useHelper=1", "True", "True"),
 ]
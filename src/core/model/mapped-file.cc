@@ -0,0 +1,134 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "mapped-file.h"
+
+#include "log.h"
+
+#include <fstream>
+#include <iterator>
+
+#ifndef __WIN32__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file
+ * @ingroup core
+ * ns3::MappedFile implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("MappedFile");
+
+MappedFile::MappedFile(const std::string& filename)
+{
+    NS_LOG_FUNCTION(this << filename);
+    Open(filename);
+}
+
+MappedFile::~MappedFile()
+{
+    NS_LOG_FUNCTION(this);
+    Close();
+}
+
+bool
+MappedFile::Open(const std::string& filename)
+{
+    NS_LOG_FUNCTION(this << filename);
+    Close();
+
+#ifndef __WIN32__
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        NS_LOG_LOGIC("Could not open " << filename);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+    {
+        m_size = st.st_size;
+        m_open = true;
+        if (m_size == 0)
+        {
+            close(fd);
+            return true;
+        }
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (data != MAP_FAILED)
+        {
+            // the files are usually read from the beginning to the end
+            madvise(data, m_size, MADV_SEQUENTIAL);
+            m_data = static_cast<const uint8_t*>(data);
+            m_mapped = true;
+            NS_LOG_LOGIC("Mapped " << m_size << " bytes of " << filename);
+            return true;
+        }
+        m_open = false;
+        m_size = 0;
+    }
+    else
+    {
+        close(fd);
+    }
+    NS_LOG_LOGIC("Could not map " << filename << ", reading it");
+#endif
+
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_size = m_buffer.size();
+    m_data = m_size ? m_buffer.data() : nullptr;
+    m_open = true;
+    return true;
+}
+
+void
+MappedFile::Close()
+{
+    NS_LOG_FUNCTION(this);
+#ifndef __WIN32__
+    if (m_mapped)
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+    m_buffer.clear();
+    m_buffer.shrink_to_fit();
+    m_data = nullptr;
+    m_size = 0;
+    m_open = false;
+    m_mapped = false;
+}
+
+bool
+MappedFile::IsOpen() const
+{
+    return m_open;
+}
+
+const uint8_t*
+MappedFile::GetData() const
+{
+    return m_data;
+}
+
+std::size_t
+MappedFile::GetSize() const
+{
+    return m_size;
+}
+
+} // namespace ns3
@@ -0,0 +1,90 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef NS3_MAPPED_FILE_H
+#define NS3_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup core
+ * ns3::MappedFile declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup core
+ * @brief A read-only view of the whole content of a file.
+ *
+ * On POSIX systems the file is mapped in memory, hence its content is loaded by the
+ * operating system when it is accessed and the pages are shared by all the processes
+ * mapping the same file. This is convenient to read large input files (such as traces)
+ * once, sequentially, without copying them into memory. On the other systems, the content
+ * of the file is read into a buffer owned by this object.
+ *
+ * The data remain valid until the file is closed or this object is destroyed.
+ */
+class MappedFile
+{
+  public:
+    MappedFile() = default;
+
+    /**
+     * Constructor opening a file. Use IsOpen() to check whether it succeeded.
+     * @param filename the name of the file
+     */
+    explicit MappedFile(const std::string& filename);
+
+    /// Destructor. Closes the file.
+    ~MappedFile();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * Open a file, closing the currently open one, if any.
+     * @param filename the name of the file
+     * @return true if the file has been opened
+     */
+    bool Open(const std::string& filename);
+
+    /**
+     * Close the file, if open. The data previously returned by GetData() become invalid.
+     */
+    void Close();
+
+    /**
+     * @return true if a file is open
+     */
+    bool IsOpen() const;
+
+    /**
+     * @return a pointer to the content of the file, or nullptr if no file is open or the
+     *         file is empty
+     */
+    const uint8_t* GetData() const;
+
+    /**
+     * @return the size of the file, in bytes
+     */
+    std::size_t GetSize() const;
+
+  private:
+    const uint8_t* m_data{nullptr}; //!< the content of the file
+    std::size_t m_size{0};          //!< the size of the file, in bytes
+    bool m_open{false};             //!< whether a file is open
+    bool m_mapped{false};           //!< whether m_data points to a memory mapping
+    std::vector<uint8_t> m_buffer;  //!< the content of the file, if it could not be mapped
+};
+
+} // namespace ns3
+
+#endif /* NS3_MAPPED_FILE_H */
@@ -0,0 +1,115 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "thread-pool.h"
+
+#include "log.h"
+
+/**
+ * @file
+ * @ingroup core
+ * ns3::ThreadPool implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ThreadPool");
+
+ThreadPool::ThreadPool(std::size_t nThreads)
+{
+    NS_LOG_FUNCTION(this << nThreads);
+    for (std::size_t i = 1; i < nThreads; ++i)
+    {
+        m_workers.emplace_back(&ThreadPool::Work, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    NS_LOG_FUNCTION(this);
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop = true;
+    }
+    m_startCv.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+std::size_t
+ThreadPool::GetNThreads() const
+{
+    return m_workers.size() + 1;
+}
+
+void
+ThreadPool::ParallelFor(std::size_t nTasks, const std::function<void(std::size_t)>& task)
+{
+    NS_LOG_FUNCTION(this << nTasks);
+
+    if (m_workers.empty() || nTasks <= 1)
+    {
+        for (std::size_t i = 0; i < nTasks; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_task = &task;
+        m_nTasks = nTasks;
+        m_nextTask = 0;
+        m_nBusyWorkers = m_workers.size();
+        ++m_batch;
+    }
+    m_startCv.notify_all();
+
+    RunTasks();
+
+    std::unique_lock lock(m_mutex);
+    m_doneCv.wait(lock, [this] { return m_nBusyWorkers == 0; });
+    m_task = nullptr;
+}
+
+void
+ThreadPool::RunTasks()
+{
+    for (auto i = m_nextTask++; i < m_nTasks; i = m_nextTask++)
+    {
+        (*m_task)(i);
+    }
+}
+
+void
+ThreadPool::Work()
+{
+    uint64_t lastBatch = 0;
+    while (true)
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_startCv.wait(lock, [this, lastBatch] { return m_stop || m_batch != lastBatch; });
+            if (m_stop)
+            {
+                return;
+            }
+            lastBatch = m_batch;
+        }
+
+        RunTasks();
+
+        {
+            std::lock_guard lock(m_mutex);
+            --m_nBusyWorkers;
+        }
+        m_doneCv.notify_one();
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef NS3_THREAD_POOL_H
+#define NS3_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup core
+ * ns3::ThreadPool declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup core
+ * @brief A fixed-size pool of threads running independent tasks in parallel.
+ *
+ * The pool is meant to speed up loops whose iterations are independent of each
+ * other, such as computations performed for each receiver of a signal. The
+ * calling thread takes part in the computation and ParallelFor() returns once
+ * all the tasks have been completed, hence the effects of the tasks are visible
+ * to the caller when ParallelFor() returns.
+ *
+ * @warning Most ns-3 objects are not thread-safe: tasks must not schedule
+ * events, draw random numbers, copy or release Ptr to objects shared with other
+ * tasks or modify state that is accessed by other tasks.
+ */
+class ThreadPool
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * @param nThreads the number of threads running the tasks, including the thread
+     *                 calling ParallelFor() (a value of 0 or 1 means that the tasks are
+     *                 run by the calling thread only)
+     */
+    explicit ThreadPool(std::size_t nThreads);
+
+    /// Destructor. Stops and joins the worker threads.
+    ~ThreadPool();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @return the number of threads running the tasks, including the calling thread
+     */
+    std::size_t GetNThreads() const;
+
+    /**
+     * Run task(i) for every i in [0, nTasks) and return when all the tasks are done.
+     * Tasks are distributed among the threads in no particular order.
+     *
+     * @param nTasks the number of tasks
+     * @param task the function running the task whose index is given as argument
+     */
+    void ParallelFor(std::size_t nTasks, const std::function<void(std::size_t)>& task);
+
+  private:
+    /// Function run by the worker threads
+    void Work();
+
+    /**
+     * Run the tasks of the current batch until none is left.
+     */
+    void RunTasks();
+
+    std::vector<std::thread> m_workers;                      //!< worker threads
+    std::mutex m_mutex;                                      //!< protects the members below
+    std::condition_variable m_startCv;                       //!< signals a new batch or stop
+    std::condition_variable m_doneCv;                        //!< signals the end of a batch
+    const std::function<void(std::size_t)>* m_task{nullptr}; //!< task of the current batch
+    std::size_t m_nTasks{0};                                 //!< number of tasks of the batch
+    std::atomic<std::size_t> m_nextTask{0};                  //!< index of the next task to run
+    std::size_t m_nBusyWorkers{0};                           //!< workers running the batch
+    uint64_t m_batch{0};                                     //!< sequence number of the batch
+    bool m_stop{false};                                      //!< whether the workers must stop
+};
+
+} // namespace ns3
+
+#endif /* NS3_THREAD_POOL_H */
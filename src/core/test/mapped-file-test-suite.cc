@@ -0,0 +1,109 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/mapped-file.h"
+#include "ns3/test.h"
+
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * @file
+ * @ingroup mapped-file-tests
+ * MappedFile test suite
+ */
+
+/**
+ * @ingroup core-tests
+ * @defgroup mapped-file-tests MappedFile tests
+ */
+
+/**
+ * @ingroup mapped-file-tests
+ *
+ * Check the content and the size of mapped files, including empty and missing files.
+ */
+class MappedFileTestCase : public TestCase
+{
+  public:
+    MappedFileTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+MappedFileTestCase::MappedFileTestCase()
+    : TestCase("Check the content of mapped files")
+{
+}
+
+void
+MappedFileTestCase::DoRun()
+{
+    std::string content("line 1\nline 2\n");
+    content.push_back('\0');
+    content.append("binary data");
+    std::string filename = CreateTempDirFilename("mapped-file-test.bin");
+    {
+        std::ofstream file(filename, std::ios::out | std::ios::binary);
+        file.write(content.data(), content.size());
+    }
+
+    MappedFile mapped(filename);
+    NS_TEST_ASSERT_MSG_EQ(mapped.IsOpen(), true, "Could not open " << filename);
+    NS_TEST_ASSERT_MSG_EQ(mapped.GetSize(), content.size(), "Unexpected size");
+    NS_TEST_EXPECT_MSG_EQ(std::memcmp(mapped.GetData(), content.data(), content.size()),
+                          0,
+                          "Unexpected content");
+    mapped.Close();
+    NS_TEST_EXPECT_MSG_EQ(mapped.IsOpen(), false, "The file should be closed");
+    NS_TEST_EXPECT_MSG_EQ(mapped.GetSize(), 0, "A closed file has no content");
+
+    std::string empty = CreateTempDirFilename("mapped-file-test-empty.bin");
+    {
+        std::ofstream file(empty, std::ios::out | std::ios::binary);
+    }
+    NS_TEST_EXPECT_MSG_EQ(mapped.Open(empty), true, "Could not open " << empty);
+    NS_TEST_EXPECT_MSG_EQ(mapped.GetSize(), 0, "Unexpected size of an empty file");
+    NS_TEST_EXPECT_MSG_EQ((mapped.GetData() == nullptr), true, "An empty file has no content");
+
+    NS_TEST_EXPECT_MSG_EQ(mapped.Open(CreateTempDirFilename("mapped-file-test-missing.bin")),
+                          false,
+                          "A missing file cannot be opened");
+    NS_TEST_EXPECT_MSG_EQ(mapped.IsOpen(), false, "A missing file cannot be opened");
+}
+
+/**
+ * @ingroup mapped-file-tests
+ *
+ * MappedFile test suite.
+ */
+class MappedFileTestSuite : public TestSuite
+{
+  public:
+    MappedFileTestSuite();
+};
+
+MappedFileTestSuite::MappedFileTestSuite()
+    : TestSuite("mapped-file", Type::UNIT)
+{
+    AddTestCase(new MappedFileTestCase, TestCase::Duration::QUICK);
+}
+
+/**
+ * @ingroup mapped-file-tests
+ * Static variable for test initialization.
+ */
+static MappedFileTestSuite g_mappedFileTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/test.h"
+#include "ns3/thread-pool.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * @file
+ * @ingroup thread-pool-tests
+ * ThreadPool test suite
+ */
+
+/**
+ * @ingroup core-tests
+ * @defgroup thread-pool-tests ThreadPool tests
+ */
+
+/**
+ * @ingroup thread-pool-tests
+ *
+ * Check that every task is run exactly once and that the results of all the tasks
+ * are available when ParallelFor returns, for several numbers of threads and tasks.
+ */
+class ThreadPoolTestCase : public TestCase
+{
+  public:
+    ThreadPoolTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+ThreadPoolTestCase::ThreadPoolTestCase()
+    : TestCase("Check that ParallelFor runs every task exactly once")
+{
+}
+
+void
+ThreadPoolTestCase::DoRun()
+{
+    for (std::size_t nThreads : {0, 1, 2, 4, 7})
+    {
+        ThreadPool pool(nThreads);
+        NS_TEST_EXPECT_MSG_EQ(pool.GetNThreads(),
+                              std::max<std::size_t>(nThreads, 1),
+                              "Unexpected number of threads");
+
+        // run several batches to check that the pool can be reused
+        for (std::size_t nTasks : {0, 1, 3, 100, 1000, 5})
+        {
+            std::vector<std::size_t> runs(nTasks, 0);
+            std::vector<std::size_t> results(nTasks, 0);
+            pool.ParallelFor(nTasks, [&](std::size_t i) {
+                ++runs[i];
+                results[i] = i * i;
+            });
+
+            for (std::size_t i = 0; i < nTasks; ++i)
+            {
+                NS_TEST_EXPECT_MSG_EQ(runs[i],
+                                      1,
+                                      "Task " << i << " out of " << nTasks << " run " << runs[i]
+                                              << " times with " << nThreads << " threads");
+                NS_TEST_EXPECT_MSG_EQ(results[i], i * i, "Unexpected result for task " << i);
+            }
+        }
+    }
+}
+
+/**
+ * @ingroup thread-pool-tests
+ *
+ * ThreadPool test suite.
+ */
+class ThreadPoolTestSuite : public TestSuite
+{
+  public:
+    ThreadPoolTestSuite();
+};
+
+ThreadPoolTestSuite::ThreadPoolTestSuite()
+    : TestSuite("thread-pool", Type::UNIT)
+{
+    AddTestCase(new ThreadPoolTestCase, TestCase::Duration::QUICK);
+}
+
+/**
+ * @ingroup thread-pool-tests
+ * Static variable for test initialization.
+ */
+static ThreadPoolTestSuite g_threadPoolTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
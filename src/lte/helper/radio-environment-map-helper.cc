@@ -9,25 +9,43 @@
 #include "radio-environment-map-helper.h"
 
 #include "ns3/abort.h"
+#include "ns3/angles.h"
+#include "ns3/antenna-model.h"
 #include "ns3/boolean.h"
+#include "ns3/building-list.h"
 #include "ns3/buildings-helper.h"
+#include "ns3/component-carrier-enb.h"
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
 #include "ns3/double.h"
 #include "ns3/integer.h"
 #include "ns3/log.h"
+#include "ns3/lte-enb-net-device.h"
+#include "ns3/lte-enb-phy.h"
+#include "ns3/lte-spectrum-phy.h"
+#include "ns3/lte-spectrum-signal-parameters.h"
 #include "ns3/lte-spectrum-value-helper.h"
 #include "ns3/mobility-building-info.h"
+#include "ns3/node-list.h"
 #include "ns3/node.h"
 #include "ns3/pointer.h"
+#include "ns3/propagation-loss-model.h"
 #include "ns3/rem-spectrum-phy.h"
 #include "ns3/simulator.h"
 #include "ns3/spectrum-channel.h"
+#include "ns3/spectrum-converter.h"
+#include "ns3/spectrum-propagation-loss-model.h"
 #include "ns3/string.h"
+#include "ns3/thread-pool.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <limits>
+#include <numeric>
+#include <set>
+#include <string>
 
 namespace ns3
 {
@@ -158,7 +176,27 @@ RadioEnvironmentMapHelper::GetTypeId()
                           "default value is -1, what means REM will be averaged from all RBs",
                           IntegerValue(-1),
                           MakeIntegerAccessor(&RadioEnvironmentMapHelper::m_rbId),
-                          MakeIntegerChecker<int32_t>());
+                          MakeIntegerChecker<int32_t>())
+            .AddAttribute("Direct",
+                          "If true, the REM is computed in a single event from the propagation "
+                          "models of the channel and the transmission power of the eNBs, "
+                          "assuming that all the RBs are used, instead of deploying listeners "
+                          "and running the simulation",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&RadioEnvironmentMapHelper::m_direct),
+                          MakeBooleanChecker())
+            .AddAttribute("WorkerThreads",
+                          "Number of threads computing the REM if Direct is true. A single "
+                          "thread is used unless all the propagation loss models of the "
+                          "channel are Friis, TwoRayGround, LogDistance, ThreeLogDistance, "
+                          "FixedRss, Range, Cost231, OkumuraHata, ItuR1411Los, "
+                          "ItuR1411NlosOverRooftop or Kun2600Mhz propagation loss models, all "
+                          "the antennas of the eNBs are Isotropic, Cosine, Parabolic or "
+                          "ThreeGpp antenna models, there are no buildings and the channel "
+                          "has no SpectrumPropagationLossModel.",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&RadioEnvironmentMapHelper::m_workerThreads),
+                          MakeUintegerChecker<uint32_t>(1, 1024));
     return tid;
 }
 
@@ -216,6 +254,12 @@ RadioEnvironmentMapHelper::Install()
         return;
     }
 
+    if (m_direct)
+    {
+        Simulator::ScheduleNow(&RadioEnvironmentMapHelper::DirectInstall, this);
+        return;
+    }
+
     double startDelay = 0.0026;
 
     if (m_useDataChannel)
@@ -348,6 +392,241 @@ RadioEnvironmentMapHelper::PrintAndReset()
     }
 }
 
+/**
+ * Check whether a chain of propagation loss models can be evaluated by several threads
+ * at once, i.e., whether all its models are known not to draw random numbers, not to
+ * modify their state and not to depend on the identity of the mobility models.
+ *
+ * @param model the first propagation loss model of the chain
+ * @return true if the chain can be evaluated by several threads at once
+ */
+static bool
+IsStatelessPropagationLoss(Ptr<PropagationLossModel> model)
+{
+    static const std::set<std::string> stateless{"ns3::FriisPropagationLossModel",
+                                                 "ns3::TwoRayGroundPropagationLossModel",
+                                                 "ns3::LogDistancePropagationLossModel",
+                                                 "ns3::ThreeLogDistancePropagationLossModel",
+                                                 "ns3::FixedRssLossModel",
+                                                 "ns3::RangePropagationLossModel",
+                                                 "ns3::Cost231PropagationLossModel",
+                                                 "ns3::OkumuraHataPropagationLossModel",
+                                                 "ns3::ItuR1411LosPropagationLossModel",
+                                                 "ns3::ItuR1411NlosOverRooftopPropagationLossModel",
+                                                 "ns3::Kun2600MhzPropagationLossModel"};
+    for (; model; model = model->GetNext())
+    {
+        if (!stateless.contains(model->GetInstanceTypeId().GetName()))
+        {
+            NS_LOG_LOGIC(model->GetInstanceTypeId().GetName() << " is not known to be stateless");
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Check whether an antenna model can be evaluated by several threads at once.
+ *
+ * @param antenna the antenna model
+ * @return true if the antenna model can be evaluated by several threads at once
+ */
+static bool
+IsStatelessAntenna(Ptr<AntennaModel> antenna)
+{
+    static const std::set<std::string> stateless{"ns3::IsotropicAntennaModel",
+                                                 "ns3::CosineAntennaModel",
+                                                 "ns3::ParabolicAntennaModel",
+                                                 "ns3::ThreeGppAntennaModel"};
+    return !antenna || stateless.contains(antenna->GetInstanceTypeId().GetName());
+}
+
+/// A DL transmitter, as seen by the direct computation of the REM
+struct RemTransmitter
+{
+    Ptr<LteSpectrumPhy> phy;      ///< The DL spectrum PHY of the eNB.
+    Ptr<MobilityModel> mobility;  ///< The mobility model of the eNB.
+    Ptr<AntennaModel> antenna;    ///< The antenna of the eNB, if any.
+    Ptr<SpectrumValue> psd;       ///< The tx PSD, in the spectrum model of the REM.
+    double power;                 ///< The received power with no loss, in Watts.
+};
+
+/// The mobility models used by a thread computing the REM
+struct RemWorker
+{
+    Ptr<MobilityModel> rx;              ///< The mobility model of the REM points.
+    std::vector<Ptr<MobilityModel>> tx; ///< The mobility models of the transmitters.
+};
+
+void
+RadioEnvironmentMapHelper::DirectInstall()
+{
+    NS_LOG_FUNCTION(this);
+    m_xStep = (m_xMax - m_xMin) / (m_xRes - 1);
+    m_yStep = (m_yMax - m_yMin) / (m_yRes - 1);
+
+    // the points, in the order of the output
+    std::vector<Vector> points;
+    points.reserve(static_cast<std::size_t>(m_xRes) * m_yRes);
+    for (double x = m_xMin; x < m_xMax + 0.5 * m_xStep; x += m_xStep)
+    {
+        for (double y = m_yMin; y < m_yMax + 0.5 * m_yStep; y += m_yStep)
+        {
+            points.emplace_back(x, y, m_z);
+        }
+    }
+
+    // the eNBs transmitting the DL control channel (the full bandwidth) on the channel
+    Ptr<const SpectrumModel> rxModel =
+        LteSpectrumValueHelper::GetSpectrumModel(m_earfcn, m_bandwidth);
+    std::vector<RemTransmitter> transmitters;
+    for (auto node = NodeList::Begin(); node != NodeList::End(); ++node)
+    {
+        for (uint32_t i = 0; i < (*node)->GetNDevices(); ++i)
+        {
+            Ptr<LteEnbNetDevice> enbDev = DynamicCast<LteEnbNetDevice>((*node)->GetDevice(i));
+            if (!enbDev)
+            {
+                continue;
+            }
+            for (const auto& [ccId, cc] : enbDev->GetCcMap())
+            {
+                Ptr<LteEnbPhy> phy = DynamicCast<ComponentCarrierEnb>(cc)->GetPhy();
+                Ptr<LteSpectrumPhy> dlPhy = phy->GetDownlinkSpectrumPhy();
+                if (dlPhy->GetChannel() != m_channel)
+                {
+                    continue;
+                }
+                std::vector<int> dlRb(cc->GetDlBandwidth());
+                std::iota(dlRb.begin(), dlRb.end(), 0);
+                RemTransmitter tx;
+                tx.phy = dlPhy;
+                tx.mobility = dlPhy->GetMobility();
+                tx.antenna = DynamicCast<AntennaModel>(dlPhy->GetAntenna());
+                tx.psd = LteSpectrumValueHelper::CreateTxPowerSpectralDensity(cc->GetDlEarfcn(),
+                                                                              cc->GetDlBandwidth(),
+                                                                              phy->GetTxPower(),
+                                                                              dlRb);
+                if (tx.psd->GetSpectrumModelUid() != rxModel->GetUid())
+                {
+                    tx.psd = SpectrumConverter(tx.psd->GetSpectrumModel(), rxModel).Convert(tx.psd);
+                }
+                tx.power = (m_rbId >= 0) ? (*tx.psd)[m_rbId] * 180000 : Integral(*tx.psd);
+                transmitters.push_back(tx);
+            }
+        }
+    }
+    NS_LOG_LOGIC(transmitters.size() << " transmitters, " << points.size() << " points");
+
+    Ptr<PropagationLossModel> propagationLoss = m_channel->GetPropagationLossModel();
+    Ptr<SpectrumPropagationLossModel> spectrumLoss = m_channel->GetSpectrumPropagationLossModel();
+    if (m_channel->GetPhasedArraySpectrumPropagationLossModel())
+    {
+        NS_LOG_WARN("The PhasedArraySpectrumPropagationLossModel of the channel is ignored");
+    }
+    DoubleValue maxLossDb;
+    m_channel->GetAttribute("MaxLossDb", maxLossDb);
+
+    // only the models known not to share state among the points are evaluated by several
+    // threads; the buildings and the spectrum propagation loss models always do
+    bool buildings = BuildingList::GetNBuildings() > 0;
+    bool stateless = !buildings && !spectrumLoss && IsStatelessPropagationLoss(propagationLoss);
+    for (const auto& tx : transmitters)
+    {
+        stateless = stateless && IsStatelessAntenna(tx.antenna);
+    }
+    std::size_t nThreads = m_workerThreads;
+    if (nThreads > 1 && !stateless)
+    {
+        NS_LOG_WARN("The REM is computed by a single thread because the models of the "
+                    "channel or of the eNBs are not known to be stateless");
+        nThreads = 1;
+    }
+
+    // each thread has its own mobility models, since the reference counts of the objects
+    // are not thread-safe
+    std::vector<RemWorker> workers(nThreads);
+    for (auto& worker : workers)
+    {
+        worker.rx = CreateObject<ConstantPositionMobilityModel>();
+        worker.rx->AggregateObject(CreateObject<MobilityBuildingInfo>());
+        for (const auto& tx : transmitters)
+        {
+            if (nThreads == 1)
+            {
+                worker.tx.push_back(tx.mobility);
+                continue;
+            }
+            Ptr<MobilityModel> mobility = CreateObject<ConstantPositionMobilityModel>();
+            mobility->SetPosition(tx.mobility->GetPosition());
+            worker.tx.push_back(mobility);
+        }
+    }
+
+    std::vector<double> sinr(points.size());
+    auto computePoint = [&](std::size_t i, RemWorker& worker) {
+        worker.rx->SetPosition(points[i]);
+        if (buildings)
+        {
+            worker.rx->GetObject<MobilityBuildingInfo>()->MakeConsistent(worker.rx);
+        }
+        double sumPower = 0;
+        double referenceSignalPower = 0;
+        for (std::size_t k = 0; k < transmitters.size(); ++k)
+        {
+            const RemTransmitter& tx = transmitters[k];
+            const Ptr<MobilityModel>& txMobility = worker.tx[k];
+            double pathLossDb = 0;
+            if (tx.antenna)
+            {
+                pathLossDb -= tx.antenna->GetGainDb(Angles(points[i], txMobility->GetPosition()));
+            }
+            if (propagationLoss && txMobility->GetPosition() != points[i])
+            {
+                pathLossDb -= propagationLoss->CalcRxPower(0, txMobility, worker.rx);
+            }
+            if (pathLossDb > maxLossDb.Get())
+            {
+                continue;
+            }
+            double pathGain = std::pow(10.0, -pathLossDb / 10.0);
+            double power = pathGain * tx.power;
+            if (spectrumLoss)
+            {
+                Ptr<SpectrumSignalParameters> params =
+                    Create<LteSpectrumSignalParametersDlCtrlFrame>();
+                params->psd = Copy<SpectrumValue>(tx.psd);
+                *(params->psd) *= pathGain;
+                params->txPhy = tx.phy;
+                params->txAntenna = tx.antenna;
+                Ptr<SpectrumValue> psd =
+                    spectrumLoss->CalcRxPowerSpectralDensity(params, txMobility, worker.rx);
+                power = (m_rbId >= 0) ? (*psd)[m_rbId] * 180000 : Integral(*psd);
+            }
+            sumPower += power;
+            referenceSignalPower = std::max(referenceSignalPower, power);
+        }
+        sinr[i] = referenceSignalPower / (sumPower - referenceSignalPower + m_noisePower);
+    };
+
+    ThreadPool pool(nThreads);
+    pool.ParallelFor(nThreads, [&](std::size_t t) {
+        for (std::size_t i = points.size() * t / nThreads;
+             i < points.size() * (t + 1) / nThreads;
+             ++i)
+        {
+            computePoint(i, workers[t]);
+        }
+    });
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        m_outFile << points[i].x << "\t" << points[i].y << "\t" << points[i].z << "\t" << sinr[i]
+                  << "\n";
+    }
+    Finalize();
+}
+
 void
 RadioEnvironmentMapHelper::Finalize()
 {
@@ -29,6 +29,13 @@ class MobilityModel;
  * Generates a 2D map of the SINR from the strongest transmitter in the
  * downlink of an LTE FDD system. For instructions on usage, please refer to
  * the User Documentation.
+ *
+ * By default, the map is generated by deploying RemSpectrumPhy listeners on
+ * the grid and running the simulation until they have received the signals of
+ * the eNBs. If the `Direct` attribute is true, the map is instead computed in
+ * a single event from the propagation models of the channel, the antennas and
+ * the transmission power of the eNBs, optionally by several threads (see the
+ * `WorkerThreads` attribute).
  */
 class RadioEnvironmentMapHelper : public Object
 {
@@ -93,6 +100,13 @@ class RadioEnvironmentMapHelper : public Object
     /// Called when the map generation procedure has been completed.
     void Finalize();
 
+    /**
+     * Scheduled by Install() if the `Direct` attribute is true to compute the
+     * SINR at every point of the map from the propagation models of the
+     * channel, without deploying listeners, and write the map.
+     */
+    void DirectInstall();
+
     /// A complete Radio Environment Map is composed of many of this structure.
     struct RemPoint
     {
@@ -145,8 +159,10 @@ class RadioEnvironmentMapHelper : public Object
 
     std::ofstream m_outFile; ///< Stream the output to a file.
 
-    bool m_useDataChannel; ///< The `UseDataChannel` attribute.
-    int32_t m_rbId;        ///< The `RbId` attribute.
+    bool m_useDataChannel;    ///< The `UseDataChannel` attribute.
+    int32_t m_rbId;           ///< The `RbId` attribute.
+    bool m_direct;            ///< The `Direct` attribute.
+    uint32_t m_workerThreads; ///< The `WorkerThreads` attribute.
 };
 
 } // namespace ns3
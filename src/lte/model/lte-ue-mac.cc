@@ -176,6 +176,8 @@ class UeMemberLteUePhySapUser : public LteUePhySapUser
     void ReceivePhyPdu(Ptr<Packet> p) override;
     void SubframeIndication(uint32_t frameNo, uint32_t subframeNo) override;
     void ReceiveLteControlMessage(Ptr<LteControlMessage> msg) override;
+    bool IsIdle() override;
+    void SkipSubframes(uint32_t frameNo, uint32_t subframeNo, uint32_t count) override;
 
   private:
     LteUeMac* m_mac; ///< the UE MAC
@@ -204,6 +206,18 @@ UeMemberLteUePhySapUser::ReceiveLteControlMessage(Ptr<LteControlMessage> msg)
     m_mac->DoReceiveLteControlMessage(msg);
 }
 
+bool
+UeMemberLteUePhySapUser::IsIdle()
+{
+    return m_mac->DoIsIdle();
+}
+
+void
+UeMemberLteUePhySapUser::SkipSubframes(uint32_t frameNo, uint32_t subframeNo, uint32_t count)
+{
+    m_mac->DoSkipSubframes(frameNo, subframeNo, count);
+}
+
 //////////////////////////////////////////////////////////
 // LteUeMac methods
 ///////////////////////////////////////////////////////////
@@ -321,6 +335,9 @@ LteUeMac::DoReportBufferStatus(LteMacSapProvider::ReportBufferStatusParameters p
 {
     NS_LOG_FUNCTION(this << (uint32_t)params.lcid);
 
+    // the BSR is sent in a subframe indication
+    m_uePhySapProvider->ResumeSubframeIndications();
+
     auto it = m_ulBsrReceived.find(params.lcid);
     if (it != m_ulBsrReceived.end())
     {
@@ -516,6 +533,8 @@ LteUeMac::DoStartContentionBasedRandomAccessProcedure()
 
     // 3GPP 36.321 5.1.1
     NS_ASSERT_MSG(m_rachConfigured, "RACH not configured");
+    // the RA-RNTI depends on the current subframe number
+    m_uePhySapProvider->ResumeSubframeIndications();
     m_preambleTransmissionCounter = 0;
     m_backoffParameter = 0;
     RandomlySelectAndSendRaPreamble();
@@ -544,6 +563,8 @@ LteUeMac::DoStartNonContentionBasedRandomAccessProcedure(uint16_t rnti,
     NS_ASSERT_MSG(prachMask == 0,
                   "requested PRACH MASK = " << (uint32_t)prachMask
                                             << ", but only PRACH MASK = 0 is supported");
+    // the RA-RNTI depends on the current subframe number
+    m_uePhySapProvider->ResumeSubframeIndications();
     m_rnti = rnti;
     m_raPreambleId = preambleId;
     m_preambleTransmissionCounter = 0;
@@ -911,6 +932,40 @@ LteUeMac::DoSubframeIndication(uint32_t frameNo, uint32_t subframeNo)
     m_harqProcessId = (m_harqProcessId + 1) % HARQ_PERIOD;
 }
 
+bool
+LteUeMac::DoIsIdle()
+{
+    return !m_freshUlBsr && !m_noRaResponseReceivedEvent.IsPending();
+}
+
+void
+LteUeMac::DoSkipSubframes(uint32_t frameNo, uint32_t subframeNo, uint32_t count)
+{
+    NS_LOG_FUNCTION(this << frameNo << subframeNo << count);
+    NS_ASSERT(DoIsIdle());
+    m_frameNo = frameNo;
+    m_subframeNo = subframeNo;
+    // same as calling RefreshHarqProcessesPacketBuffer count times: a timer reaching zero
+    // in the skipped subframes makes its buffer expire in the next one
+    for (std::size_t i = 0; i < m_miUlHarqProcessesPacketTimer.size(); i++)
+    {
+        if (m_miUlHarqProcessesPacketTimer.at(i) < count)
+        {
+            if (m_miUlHarqProcessesPacket.at(i)->GetSize() > 0)
+            {
+                NS_LOG_INFO(this << " HARQ Proc Id " << i << " packets buffer expired");
+                m_miUlHarqProcessesPacket.at(i) = CreateObject<PacketBurst>();
+            }
+            m_miUlHarqProcessesPacketTimer.at(i) = 0;
+        }
+        else
+        {
+            m_miUlHarqProcessesPacketTimer.at(i) -= count;
+        }
+    }
+    m_harqProcessId = (m_harqProcessId + count) % HARQ_PERIOD;
+}
+
 int64_t
 LteUeMac::AssignStreams(int64_t stream)
 {
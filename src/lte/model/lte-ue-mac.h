@@ -203,6 +203,22 @@ class LteUeMac : public Object
      * @param msg the LTE control message
      */
     void DoReceiveLteControlMessage(Ptr<LteControlMessage> msg);
+    /**
+     * Check whether the MAC is idle, i.e., it has no fresh BSR to send and no ongoing
+     * random access procedure
+     *
+     * @return true if the MAC is idle
+     */
+    bool DoIsIdle();
+    /**
+     * Apply the effect of the subframe indications of consecutive subframes skipped by
+     * the PHY, i.e., advance the HARQ process ID and the HARQ buffer timers
+     *
+     * @param frameNo frame number of the last skipped subframe
+     * @param subframeNo subframe number of the last skipped subframe
+     * @param count number of skipped subframes
+     */
+    void DoSkipSubframes(uint32_t frameNo, uint32_t subframeNo, uint32_t count);
 
     // internal methods
     /// Randomly select and send RA preamble function
@@ -54,6 +54,15 @@ class LteUePhySapProvider
      * establishment.
      */
     virtual void NotifyConnectionSuccessful() = 0;
+
+    /**
+     * @brief Notify the PHY that the MAC has new work to do, so that the PHY resumes
+     * the subframe indications if it was skipping idle subframes.
+     *
+     * The subframes skipped until now are reported to the MAC, through
+     * LteUePhySapUser::SkipSubframes, before this method returns.
+     */
+    virtual void ResumeSubframeIndications() = 0;
 };
 
 /**
@@ -91,6 +100,24 @@ class LteUePhySapUser
      * @param msg the Ideal Control Message to receive
      */
     virtual void ReceiveLteControlMessage(Ptr<LteControlMessage> msg) = 0;
+
+    /**
+     * @brief Check whether the MAC has nothing to do in the next subframes, unless it
+     * receives new data or new control messages
+     *
+     * @return true if the MAC is idle
+     */
+    virtual bool IsIdle() = 0;
+
+    /**
+     * @brief Notify the MAC of consecutive subframes skipped by the PHY, whose effect is
+     * the same as the subframe indications of these subframes for an idle MAC
+     *
+     * @param frameNo frame number of the last skipped subframe
+     * @param subframeNo subframe number of the last skipped subframe
+     * @param count number of skipped subframes
+     */
+    virtual void SkipSubframes(uint32_t frameNo, uint32_t subframeNo, uint32_t count) = 0;
 };
 
 } // namespace ns3
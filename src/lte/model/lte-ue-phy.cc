@@ -73,6 +73,7 @@ class UeMemberLteUePhySapProvider : public LteUePhySapProvider
     void SendLteControlMessage(Ptr<LteControlMessage> msg) override;
     void SendRachPreamble(uint32_t prachId, uint32_t raRnti) override;
     void NotifyConnectionSuccessful() override;
+    void ResumeSubframeIndications() override;
 
   private:
     LteUePhy* m_phy; ///< the Phy
@@ -107,6 +108,12 @@ UeMemberLteUePhySapProvider::NotifyConnectionSuccessful()
     m_phy->DoNotifyConnectionSuccessful();
 }
 
+void
+UeMemberLteUePhySapProvider::ResumeSubframeIndications()
+{
+    m_phy->DoResumeSubframeIndications();
+}
+
 ////////////////////////////////////////
 // LteUePhy methods
 ////////////////////////////////////////
@@ -132,6 +139,8 @@ LteUePhy::LteUePhy(Ptr<LteSpectrumPhy> dlPhy, Ptr<LteSpectrumPhy> ulPhy)
       m_ueMeasurementsFilterPeriod(MilliSeconds(200)),
       m_ueMeasurementsFilterLast(),
       m_rsrpSinrSampleCounter(0),
+      m_skippingSubframes(false),
+      m_lastSubframeIndex(0),
       m_imsi(0)
 {
     m_amc = CreateObject<LteAmc>();
@@ -316,6 +325,16 @@ LteUePhy::GetTypeId()
                           "If true, RLF detection will be enabled.",
                           BooleanValue(true),
                           MakeBooleanAccessor(&LteUePhy::m_enableRlfDetection),
+                          MakeBooleanChecker())
+            .AddAttribute("IdleSubframeSkipping",
+                          "If true, the subframe indications are skipped while nothing is "
+                          "queued for transmission and the MAC is idle, until the next SRS "
+                          "occasion or until data or control messages have to be sent. The "
+                          "skipped subframes are accounted for when the indications resume, "
+                          "so that the frame numbers, the HARQ processes and the SRS "
+                          "occasions are the same as without skipping.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LteUePhy::m_idleSubframeSkipping),
                           MakeBooleanChecker());
     return tid;
 }
@@ -459,6 +478,7 @@ LteUePhy::DoSendMacPdu(Ptr<Packet> p)
 {
     NS_LOG_FUNCTION(this);
 
+    DoResumeSubframeIndications();
     SetMacPdu(p);
 }
 
@@ -955,6 +975,7 @@ LteUePhy::DoSendLteControlMessage(Ptr<LteControlMessage> msg)
 {
     NS_LOG_FUNCTION(this << msg);
 
+    DoResumeSubframeIndications();
     SetControlMessages(msg);
 }
 
@@ -963,6 +984,7 @@ LteUePhy::DoSendRachPreamble(uint32_t raPreambleId, uint32_t raRnti)
 {
     NS_LOG_FUNCTION(this << raPreambleId);
 
+    DoResumeSubframeIndications();
     // unlike other control messages, RACH preamble is sent ASAP
     Ptr<RachPreambleLteControlMessage> msg = Create<RachPreambleLteControlMessage>();
     msg->SetRapId(raPreambleId);
@@ -1198,6 +1220,7 @@ LteUePhy::ReceivePss(uint16_t cellId, Ptr<SpectrumValue> p)
 void
 LteUePhy::QueueSubChannelsForTransmission(std::vector<int> rbMap)
 {
+    DoResumeSubframeIndications();
     m_subChannelsForTransmissionQueue.at(m_macChTtiDelay - 1) = rbMap;
 }
 
@@ -1208,6 +1231,14 @@ LteUePhy::SubframeIndication(uint32_t frameNo, uint32_t subframeNo)
 
     NS_ASSERT_MSG(frameNo > 0, "the SRS index check code assumes that frameNo starts at 1");
 
+    if (m_skippingSubframes)
+    {
+        // all the subframes since the last indication but this one have been skipped
+        Time elapsed = Simulator::Now() - m_lastSubframeTime;
+        SkipSubframes(elapsed.GetTimeStep() / Seconds(GetTti()).GetTimeStep() - 1);
+        m_skippingSubframes = false;
+    }
+
     // refresh internal variables
     m_rsReceivedPowerUpdated = false;
     m_rsInterferencePowerUpdated = false;
@@ -1282,19 +1313,112 @@ LteUePhy::SubframeIndication(uint32_t frameNo, uint32_t subframeNo)
     m_uePhySapUser->SubframeIndication(frameNo, subframeNo);
 
     m_subframeNo = subframeNo;
-    ++subframeNo;
-    if (subframeNo > 10)
+    m_lastSubframeTime = Simulator::Now();
+    m_lastSubframeIndex = (frameNo - 1) * 10 + (subframeNo - 1);
+
+    // schedule next subframe indication, skipping the idle subframes until the next SRS
+    uint32_t nextSubframeIndex = m_lastSubframeIndex + 1;
+    if (m_idleSubframeSkipping && IsIdle())
+    {
+        if (!m_ulConfigured || !m_srsConfigured)
+        {
+            // resumed by the next transmission or by the configuration of the uplink
+            NS_LOG_LOGIC(this << " UE - skipping idle subframes");
+            m_skippingSubframes = true;
+            return;
+        }
+        if (m_srsStartTime <= Simulator::Now())
+        {
+            nextSubframeIndex +=
+                (m_srsPeriodicity + m_srsSubframeOffset - nextSubframeIndex % m_srsPeriodicity) %
+                m_srsPeriodicity;
+            m_skippingSubframes = nextSubframeIndex > m_lastSubframeIndex + 1;
+            NS_LOG_LOGIC(this << " UE - skipping idle subframes until SRS subframe "
+                              << nextSubframeIndex);
+        }
+    }
+    ScheduleSubframeIndication(nextSubframeIndex);
+}
+
+bool
+LteUePhy::IsIdle()
+{
+    if (!m_uePhySapUser->IsIdle())
+    {
+        return false;
+    }
+    for (const auto& pb : m_packetBurstQueue)
+    {
+        if (pb->GetNPackets() > 0)
+        {
+            return false;
+        }
+    }
+    for (const auto& ctrlMsgList : m_controlMessagesQueue)
+    {
+        if (!ctrlMsgList.empty())
+        {
+            return false;
+        }
+    }
+    for (const auto& rbMap : m_subChannelsForTransmissionQueue)
     {
-        ++frameNo;
-        subframeNo = 1;
+        if (!rbMap.empty())
+        {
+            return false;
+        }
     }
+    return true;
+}
+
+void
+LteUePhy::SkipSubframes(uint32_t count)
+{
+    NS_LOG_FUNCTION(this << count);
+    if (count == 0)
+    {
+        return;
+    }
+    // the queues are empty, so that shifting them is not needed
+    m_lastSubframeIndex += count;
+    m_lastSubframeTime += Seconds(GetTti()) * count;
+    m_subframeNo = m_lastSubframeIndex % 10 + 1;
+    m_uePhySapUser->SkipSubframes(m_lastSubframeIndex / 10 + 1, m_subframeNo, count);
+}
 
-    // schedule next subframe indication
-    Simulator::Schedule(Seconds(GetTti()),
-                        &LteUePhy::SubframeIndication,
-                        this,
-                        frameNo,
-                        subframeNo);
+void
+LteUePhy::ScheduleSubframeIndication(uint32_t subframeIndex)
+{
+    NS_ASSERT(subframeIndex > m_lastSubframeIndex);
+    Time delay = m_lastSubframeTime + Seconds(GetTti()) * (subframeIndex - m_lastSubframeIndex) -
+                 Simulator::Now();
+    m_subframeIndicationEvent = Simulator::Schedule(delay,
+                                                    &LteUePhy::SubframeIndication,
+                                                    this,
+                                                    subframeIndex / 10 + 1,
+                                                    subframeIndex % 10 + 1);
+}
+
+void
+LteUePhy::DoResumeSubframeIndications()
+{
+    if (!m_skippingSubframes)
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this);
+    m_skippingSubframes = false;
+    // the indication of a subframe starting now is still to come, as it would be without
+    // skipping for the events scheduled before the previous subframe
+    Time elapsed = Simulator::Now() - m_lastSubframeTime;
+    SkipSubframes((elapsed.GetTimeStep() - 1) / Seconds(GetTti()).GetTimeStep());
+    Time delay = m_lastSubframeTime + Seconds(GetTti()) - Simulator::Now();
+    if (!m_subframeIndicationEvent.IsPending() ||
+        Simulator::GetDelayLeft(m_subframeIndicationEvent) != delay)
+    {
+        m_subframeIndicationEvent.Cancel();
+        ScheduleSubframeIndication(m_lastSubframeIndex + 1);
+    }
 }
 
 void
@@ -1456,6 +1580,7 @@ LteUePhy::DoSetDlBandwidth(uint16_t dlBandwidth)
 void
 LteUePhy::DoConfigureUplink(uint32_t ulEarfcn, uint16_t ulBandwidth)
 {
+    DoResumeSubframeIndications();
     m_ulEarfcn = ulEarfcn;
     m_ulBandwidth = ulBandwidth;
     m_ulConfigured = true;
@@ -1490,6 +1615,7 @@ void
 LteUePhy::DoSetSrsConfigurationIndex(uint16_t srcCi)
 {
     NS_LOG_FUNCTION(this << srcCi);
+    DoResumeSubframeIndications();
     m_srsPeriodicity = GetSrsPeriodicity(srcCi);
     m_srsSubframeOffset = GetSrsSubframeOffset(srcCi);
     m_srsConfigured = true;
@@ -1715,6 +1841,7 @@ LteUePhy::EnqueueDlHarqFeedback(DlInfoListElement_s m)
     // get the feedback from LteSpectrumPhy and send it through ideal PUCCH to eNB
     Ptr<DlHarqFeedbackLteControlMessage> msg = Create<DlHarqFeedbackLteControlMessage>();
     msg->SetDlHarqFeedback(m);
+    DoResumeSubframeIndications();
     SetControlMessages(msg);
 }
 
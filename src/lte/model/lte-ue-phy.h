@@ -643,6 +643,32 @@ class LteUePhy : public LtePhy
      * establishment.
      */
     virtual void DoNotifyConnectionSuccessful();
+    /**
+     * @brief Resume the subframe indications if the idle subframes are being skipped
+     */
+    void DoResumeSubframeIndications();
+
+    /**
+     * @brief Check whether the next subframes are idle, i.e., nothing is queued for
+     * transmission and the MAC is idle
+     *
+     * @return true if the next subframes are idle
+     */
+    bool IsIdle();
+    /**
+     * @brief Apply the effect of the indications of subframes which have been skipped
+     * after the last subframe indication
+     *
+     * @param count the number of skipped subframes
+     */
+    void SkipSubframes(uint32_t count);
+    /**
+     * @brief Schedule a subframe indication
+     *
+     * @param subframeIndex the index of the subframe since frame 1, subframe 1, which is
+     *        later than the last subframe indication
+     */
+    void ScheduleSubframeIndication(uint32_t subframeIndex);
 
     /// A list of sub channels to use in TX.
     std::vector<int> m_subChannelsForTransmission;
@@ -787,6 +813,16 @@ class LteUePhy : public LtePhy
 
     EventId m_sendSrsEvent; ///< send SRS event
 
+    /**
+     * The `IdleSubframeSkipping` attribute. If true, the indications of idle
+     * subframes are skipped.
+     */
+    bool m_idleSubframeSkipping;
+    bool m_skippingSubframes;          ///< true if idle subframes are being skipped
+    EventId m_subframeIndicationEvent; ///< next subframe indication event
+    Time m_lastSubframeTime;           ///< start time of the last indicated or skipped subframe
+    uint32_t m_lastSubframeIndex;      ///< index of that subframe since frame 1, subframe 1
+
     /**
      * The `UlPhyTransmission` trace source. Contains trace information regarding
      * PHY stats from UL Tx perspective. Exporting a structure with type
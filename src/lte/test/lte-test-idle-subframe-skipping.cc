@@ -0,0 +1,225 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/config.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4-static-routing-helper.h"
+#include "ns3/ipv4-static-routing.h"
+#include "ns3/log.h"
+#include "ns3/lte-helper.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/packet-sink-helper.h"
+#include "ns3/packet-sink.h"
+#include "ns3/point-to-point-epc-helper.h"
+#include "ns3/point-to-point-helper.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/udp-client-server-helper.h"
+#include "ns3/uinteger.h"
+
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LteIdleSubframeSkippingTest");
+
+/**
+ * @ingroup lte-test
+ *
+ * @brief Check that skipping the idle subframes of the UE PHYs reduces the number of
+ * simulated events without changing the reception time of the packets sent in the
+ * uplink and in the downlink by UEs which are mostly idle.
+ */
+class LteIdleSubframeSkippingTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * @param useIdealRrc if true, use the ideal RRC
+     */
+    LteIdleSubframeSkippingTestCase(bool useIdealRrc);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the scenario
+     *
+     * @param idleSubframeSkipping the value of the IdleSubframeSkipping attribute
+     * @param rxTimes the reception times of the packets, per sink application
+     * @return the number of executed events
+     */
+    uint64_t RunScenario(bool idleSubframeSkipping, std::vector<std::vector<Time>>& rxTimes);
+
+    bool m_useIdealRrc; ///< whether to use the ideal RRC
+};
+
+LteIdleSubframeSkippingTestCase::LteIdleSubframeSkippingTestCase(bool useIdealRrc)
+    : TestCase(std::string("Check the skipping of idle subframes with ") +
+               (useIdealRrc ? "ideal" : "real") + " RRC"),
+      m_useIdealRrc(useIdealRrc)
+{
+}
+
+uint64_t
+LteIdleSubframeSkippingTestCase::RunScenario(bool idleSubframeSkipping,
+                                             std::vector<std::vector<Time>>& rxTimes)
+{
+    Config::SetDefault("ns3::LteUePhy::IdleSubframeSkipping", BooleanValue(idleSubframeSkipping));
+    Config::SetDefault("ns3::LteUePhy::DownlinkCqiPeriodicity", TimeValue(MilliSeconds(40)));
+    Config::SetDefault("ns3::LteEnbRrc::SrsPeriodicity", UintegerValue(80));
+    // same random streams in all the runs
+    RngSeedManager::ResetNextStreamIndex();
+
+    Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
+    Ptr<PointToPointEpcHelper> epcHelper = CreateObject<PointToPointEpcHelper>();
+    lteHelper->SetEpcHelper(epcHelper);
+    lteHelper->SetAttribute("UseIdealRrc", BooleanValue(m_useIdealRrc));
+
+    NodeContainer remoteHostContainer;
+    remoteHostContainer.Create(1);
+    Ptr<Node> remoteHost = remoteHostContainer.Get(0);
+    InternetStackHelper internet;
+    internet.Install(remoteHostContainer);
+
+    PointToPointHelper p2ph;
+    p2ph.SetDeviceAttribute("DataRate", DataRateValue(DataRate("100Gb/s")));
+    p2ph.SetChannelAttribute("Delay", TimeValue(MilliSeconds(10)));
+    NetDeviceContainer internetDevices = p2ph.Install(epcHelper->GetPgwNode(), remoteHost);
+    Ipv4AddressHelper ipv4h;
+    ipv4h.SetBase("1.0.0.0", "255.0.0.0");
+    Ipv4InterfaceContainer internetIpIfaces = ipv4h.Assign(internetDevices);
+    Ipv4Address remoteHostAddr = internetIpIfaces.GetAddress(1);
+    Ipv4StaticRoutingHelper ipv4RoutingHelper;
+    Ptr<Ipv4StaticRouting> remoteHostStaticRouting =
+        ipv4RoutingHelper.GetStaticRouting(remoteHost->GetObject<Ipv4>());
+    remoteHostStaticRouting->AddNetworkRouteTo(Ipv4Address("7.0.0.0"), Ipv4Mask("255.0.0.0"), 1);
+
+    NodeContainer enbNodes;
+    enbNodes.Create(1);
+    NodeContainer ueNodes;
+    ueNodes.Create(4);
+    Ptr<ListPositionAllocator> positions = CreateObject<ListPositionAllocator>();
+    positions->Add(Vector(0, 0, 0));
+    positions->Add(Vector(100, 0, 0));
+    positions->Add(Vector(0, 200, 0));
+    positions->Add(Vector(-300, 0, 0));
+    positions->Add(Vector(0, -400, 0));
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.SetPositionAllocator(positions);
+    mobility.Install(enbNodes);
+    mobility.Install(ueNodes);
+
+    NetDeviceContainer enbDevs = lteHelper->InstallEnbDevice(enbNodes);
+    NetDeviceContainer ueDevs = lteHelper->InstallUeDevice(ueNodes);
+    internet.Install(ueNodes);
+    Ipv4InterfaceContainer ueIpIfaces = epcHelper->AssignUeIpv4Address(ueDevs);
+    lteHelper->Attach(ueDevs, enbDevs.Get(0));
+
+    std::vector<Ptr<PacketSink>> sinks;
+    for (uint32_t u = 0; u < ueNodes.GetN(); ++u)
+    {
+        Ptr<Node> ue = ueNodes.Get(u);
+        ipv4RoutingHelper.GetStaticRouting(ue->GetObject<Ipv4>())
+            ->SetDefaultRoute(epcHelper->GetUeDefaultGatewayAddress(), 1);
+
+        // sparse traffic, starting at different times for the different UEs, which are not
+        // the start of a subframe, where the order of simultaneous events may change
+        uint16_t dlPort = 2000 + u;
+        uint16_t ulPort = 3000 + u;
+        PacketSinkHelper dlSink("ns3::UdpSocketFactory",
+                                InetSocketAddress(Ipv4Address::GetAny(), dlPort));
+        PacketSinkHelper ulSink("ns3::UdpSocketFactory",
+                                InetSocketAddress(Ipv4Address::GetAny(), ulPort));
+        ApplicationContainer sinkApps = dlSink.Install(ue);
+        sinkApps.Add(ulSink.Install(remoteHost));
+        sinks.push_back(sinkApps.Get(0)->GetObject<PacketSink>());
+        sinks.push_back(sinkApps.Get(1)->GetObject<PacketSink>());
+
+        UdpClientHelper dlClient(ueIpIfaces.GetAddress(u), dlPort);
+        dlClient.SetAttribute("Interval", TimeValue(MilliSeconds(230)));
+        dlClient.SetAttribute("PacketSize", UintegerValue(100));
+        UdpClientHelper ulClient(remoteHostAddr, ulPort);
+        ulClient.SetAttribute("Interval", TimeValue(MilliSeconds(170)));
+        ulClient.SetAttribute("PacketSize", UintegerValue(200));
+        ApplicationContainer clientApps = dlClient.Install(remoteHost);
+        clientApps.Add(ulClient.Install(ue));
+        clientApps.Start(MilliSeconds(300 + 37 * u) + MicroSeconds(250));
+    }
+
+    rxTimes.assign(sinks.size(), std::vector<Time>());
+    for (std::size_t i = 0; i < sinks.size(); ++i)
+    {
+        sinks[i]->TraceConnectWithoutContext(
+            "Rx",
+            Callback<void, Ptr<const Packet>, const Address&>(
+                [&rxTimes, i](Ptr<const Packet>, const Address&) {
+                    rxTimes[i].push_back(Simulator::Now());
+                }));
+    }
+
+    Simulator::Stop(Seconds(2));
+    Simulator::Run();
+    uint64_t events = Simulator::GetEventCount();
+    Simulator::Destroy();
+    Config::Reset();
+    return events;
+}
+
+void
+LteIdleSubframeSkippingTestCase::DoRun()
+{
+    std::vector<std::vector<Time>> expected;
+    uint64_t expectedEvents = RunScenario(false, expected);
+    std::vector<std::vector<Time>> rxTimes;
+    uint64_t events = RunScenario(true, rxTimes);
+
+    NS_LOG_INFO("events without skipping " << expectedEvents << ", with skipping " << events);
+    NS_TEST_EXPECT_MSG_LT(events, expectedEvents, "Skipping idle subframes saves no event");
+    NS_TEST_ASSERT_MSG_EQ(rxTimes.size(), expected.size(), "Unexpected number of sinks");
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_GT(expected[i].size(), 0, "No packet received by sink " << i);
+        NS_TEST_ASSERT_MSG_EQ(rxTimes[i].size(),
+                              expected[i].size(),
+                              "Unexpected number of packets received by sink " << i);
+        for (std::size_t p = 0; p < expected[i].size(); ++p)
+        {
+            NS_TEST_EXPECT_MSG_EQ(rxTimes[i][p],
+                                  expected[i][p],
+                                  "Unexpected reception time of packet " << p << " by sink "
+                                                                         << i);
+        }
+    }
+}
+
+/**
+ * @ingroup lte-test
+ *
+ * @brief Test suite for the skipping of the idle subframes of the UE PHY
+ */
+class LteIdleSubframeSkippingTestSuite : public TestSuite
+{
+  public:
+    LteIdleSubframeSkippingTestSuite();
+};
+
+LteIdleSubframeSkippingTestSuite::LteIdleSubframeSkippingTestSuite()
+    : TestSuite("lte-idle-subframe-skipping", Type::SYSTEM)
+{
+    AddTestCase(new LteIdleSubframeSkippingTestCase(true), TestCase::Duration::QUICK);
+    AddTestCase(new LteIdleSubframeSkippingTestCase(false), TestCase::Duration::QUICK);
+}
+
+/**
+ * @ingroup lte-test
+ * Static variable for test initialization
+ */
+static LteIdleSubframeSkippingTestSuite g_lteIdleSubframeSkippingTestSuite;
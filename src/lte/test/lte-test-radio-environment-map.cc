@@ -0,0 +1,177 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/lte-helper.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/radio-environment-map-helper.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("LteRadioEnvironmentMapTest");
+
+/**
+ * @ingroup lte-test
+ *
+ * @brief Check that the REM computed directly from the propagation models, with one or
+ * more threads, matches the REM measured by listening to the DL control channel, and that
+ * the REMs computed by one and by several threads are identical.
+ */
+class LteDirectRemTestCase : public TestCase
+{
+  public:
+    LteDirectRemTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Create a REM of the DL channel of the eNBs
+     * @param filename the name of the output file
+     * @param direct the value of the Direct attribute
+     * @param threads the value of the WorkerThreads attribute
+     * @return the REM helper
+     */
+    Ptr<RadioEnvironmentMapHelper> CreateRem(std::string filename, bool direct, uint32_t threads);
+
+    /**
+     * Read the points of a REM
+     * @param filename the name of the REM file
+     * @return the x, y, z and SINR values of the points, in the order of the file
+     */
+    std::vector<double> ReadRem(std::string filename);
+};
+
+LteDirectRemTestCase::LteDirectRemTestCase()
+    : TestCase("Check the REM computed without simulating the DL control channel")
+{
+}
+
+Ptr<RadioEnvironmentMapHelper>
+LteDirectRemTestCase::CreateRem(std::string filename, bool direct, uint32_t threads)
+{
+    Ptr<RadioEnvironmentMapHelper> rem = CreateObject<RadioEnvironmentMapHelper>();
+    rem->SetAttribute("ChannelPath", StringValue("/ChannelList/0"));
+    rem->SetAttribute("OutputFile", StringValue(filename));
+    rem->SetAttribute("XMin", DoubleValue(-400.0));
+    rem->SetAttribute("XMax", DoubleValue(600.0));
+    rem->SetAttribute("XRes", UintegerValue(21));
+    rem->SetAttribute("YMin", DoubleValue(-300.0));
+    rem->SetAttribute("YMax", DoubleValue(300.0));
+    rem->SetAttribute("YRes", UintegerValue(13));
+    rem->SetAttribute("Z", DoubleValue(1.5));
+    rem->SetAttribute("Direct", BooleanValue(direct));
+    rem->SetAttribute("WorkerThreads", UintegerValue(threads));
+    rem->SetAttribute("StopWhenDone", BooleanValue(!direct));
+    rem->Install();
+    return rem;
+}
+
+std::vector<double>
+LteDirectRemTestCase::ReadRem(std::string filename)
+{
+    std::vector<double> values;
+    std::ifstream file(filename);
+    double value;
+    while (file >> value)
+    {
+        values.push_back(value);
+    }
+    return values;
+}
+
+void
+LteDirectRemTestCase::DoRun()
+{
+    Ptr<LteHelper> lteHelper = CreateObject<LteHelper>();
+    lteHelper->SetAttribute("PathlossModel", StringValue("ns3::FriisPropagationLossModel"));
+
+    NodeContainer enbNodes;
+    enbNodes.Create(2);
+    Ptr<ListPositionAllocator> positions = CreateObject<ListPositionAllocator>();
+    positions->Add(Vector(0, 0, 30));
+    positions->Add(Vector(250, 50, 30));
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator(positions);
+    mobility.Install(enbNodes);
+
+    lteHelper->SetEnbAntennaModelType("ns3::CosineAntennaModel");
+    lteHelper->SetEnbAntennaModelAttribute("Orientation", DoubleValue(90));
+    lteHelper->SetEnbAntennaModelAttribute("HorizontalBeamwidth", DoubleValue(120));
+    lteHelper->InstallEnbDevice(enbNodes.Get(0));
+    lteHelper->SetEnbAntennaModelType("ns3::IsotropicAntennaModel");
+    lteHelper->InstallEnbDevice(enbNodes.Get(1));
+
+    std::string measured = CreateTempDirFilename("lte-rem-measured.out");
+    std::string direct = CreateTempDirFilename("lte-rem-direct.out");
+    std::string parallel = CreateTempDirFilename("lte-rem-parallel.out");
+    Ptr<RadioEnvironmentMapHelper> measuredRem = CreateRem(measured, false, 1);
+    Ptr<RadioEnvironmentMapHelper> directRem = CreateRem(direct, true, 1);
+    Ptr<RadioEnvironmentMapHelper> parallelRem = CreateRem(parallel, true, 4);
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    std::vector<double> expected = ReadRem(measured);
+    NS_TEST_ASSERT_MSG_EQ(expected.size(), 21 * 13 * 4, "Unexpected size of " << measured);
+    for (const auto& filename : {direct, parallel})
+    {
+        std::vector<double> values = ReadRem(filename);
+        NS_TEST_ASSERT_MSG_EQ(values.size(), expected.size(), "Unexpected size of " << filename);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            NS_TEST_EXPECT_MSG_EQ_TOL(values[i],
+                                      expected[i],
+                                      std::abs(expected[i]) * 1e-5,
+                                      "Unexpected value at line " << i / 4 << " of " << filename);
+        }
+    }
+
+    // the points are evaluated with the same operations by any thread, hence the REMs
+    // computed by one and by several threads are identical
+    std::vector<double> singleThread = ReadRem(direct);
+    std::vector<double> multiThread = ReadRem(parallel);
+    NS_TEST_ASSERT_MSG_EQ(multiThread.size(),
+                          singleThread.size(),
+                          "Unexpected size of " << parallel);
+    for (std::size_t i = 0; i < multiThread.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(multiThread[i],
+                              singleThread[i],
+                              "Unexpected value at line " << i / 4 << " of " << parallel);
+    }
+}
+
+/**
+ * @ingroup lte-test
+ *
+ * @brief Test suite for the RadioEnvironmentMapHelper
+ */
+class LteRadioEnvironmentMapTestSuite : public TestSuite
+{
+  public:
+    LteRadioEnvironmentMapTestSuite();
+};
+
+LteRadioEnvironmentMapTestSuite::LteRadioEnvironmentMapTestSuite()
+    : TestSuite("lte-radio-environment-map", Type::UNIT)
+{
+    AddTestCase(new LteDirectRemTestCase, TestCase::Duration::QUICK);
+}
+
+/**
+ * @ingroup lte-test
+ * Static variable for test initialization
+ */
+static LteRadioEnvironmentMapTestSuite g_lteRadioEnvironmentMapTestSuite;
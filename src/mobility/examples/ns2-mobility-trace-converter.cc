@@ -0,0 +1,62 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+/**
+ * @file
+ * @ingroup mobility
+ *
+ * Convert an ns-2 movement trace (such as those exported by BonnMotion or SUMO) to the
+ * binary trace format read by Ns2MobilityHelper. The binary trace does not need to be
+ * parsed and its statements are sorted by time, hence it can be read in the streaming mode
+ * by the simulations using the same trace repeatedly.
+ *
+ * Usage:
+ *
+ *  ./ns3 run "ns2-mobility-trace-converter
+ *        --input=src/mobility/examples/default.ns_movements
+ *        --output=default.ns_movements.bin"
+ *
+ * The binary trace can then be used in place of the text trace, e.g.:
+ *
+ *  ./ns3 run "ns2-mobility-trace --traceFile=default.ns_movements.bin
+ *        --nodeNum=2 --duration=100.0 --logFile=ns2-mobility-trace.log"
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/ns2-mobility-helper.h"
+
+#include <iostream>
+
+using namespace ns3;
+
+int
+main(int argc, char* argv[])
+{
+    std::string input;
+    std::string output;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("input", "The ns-2 movement trace to convert", input);
+    cmd.AddValue("output", "The binary trace to write (default: the input file + .bin)", output);
+    cmd.Parse(argc, argv);
+
+    if (input.empty())
+    {
+        std::cout << "Usage of " << argv[0]
+                  << " :\n\n"
+                     "./ns3 run \"ns2-mobility-trace-converter"
+                     " --input=src/mobility/examples/default.ns_movements"
+                     " --output=default.ns_movements.bin\"\n";
+        return 0;
+    }
+    if (output.empty())
+    {
+        output = input + ".bin";
+    }
+
+    uint64_t nStatements = Ns2MobilityHelper::ConvertToBinary(input, output);
+    std::cout << "Wrote " << nStatements << " statements of " << input << " to " << output
+              << std::endl;
+    return 0;
+}
@@ -68,6 +68,7 @@ main(int argc, char* argv[])
 
     int nodeNum;
     double duration;
+    bool streaming = false;
 
     // Enable logging from the ns2 helper
     LogComponentEnable("Ns2MobilityHelper", LOG_LEVEL_DEBUG);
@@ -78,6 +79,7 @@ main(int argc, char* argv[])
     cmd.AddValue("nodeNum", "Number of nodes", nodeNum);
     cmd.AddValue("duration", "Duration of Simulation", duration);
     cmd.AddValue("logFile", "Log file", logFile);
+    cmd.AddValue("streaming", "Read the trace while the simulation runs", streaming);
     cmd.Parse(argc, argv);
 
     // Check command line arguments
@@ -103,6 +105,7 @@ main(int argc, char* argv[])
 
     // Create Ns2MobilityHelper with the specified trace log file as parameter
     Ns2MobilityHelper ns2 = Ns2MobilityHelper(traceFile);
+    ns2.SetStreaming(streaming);
 
     // open log file for output
     std::ofstream os;
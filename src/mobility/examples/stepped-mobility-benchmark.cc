@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+/**
+ * @file
+ * @ingroup mobility
+ *
+ * Benchmark of the SteppedMobilityEngine. A population of nodes moves according to the
+ * random waypoint model, implemented either by RandomWaypointMobilityModel instances, each
+ * scheduling its own events, or by SteppedMobilityModel instances sharing an engine. The
+ * positions of all the nodes are periodically retrieved, as a channel model would do, and
+ * the running time and the number of events executed are reported.
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * Retrieve the positions of all the mobility models and reschedule the next query.
+ * @param models the mobility models
+ * @param interval the interval between two queries
+ * @param sum the sum of the x coordinates of the positions, updated by the queries
+ */
+static void
+QueryPositions(const std::vector<Ptr<MobilityModel>>* models, Time interval, double* sum)
+{
+    for (const auto& model : *models)
+    {
+        *sum += model->GetPosition().x;
+    }
+    Simulator::Schedule(interval, &QueryPositions, models, interval, sum);
+}
+
+/**
+ * Retrieve the positions of all the models of an engine and reschedule the next query.
+ * @param engine the engine
+ * @param interval the interval between two queries
+ * @param sum the sum of the x coordinates of the positions, updated by the queries
+ */
+static void
+QueryEnginePositions(Ptr<SteppedMobilityEngine> engine, Time interval, double* sum)
+{
+    static std::vector<Vector> positions;
+    engine->GetPositions(positions);
+    for (const auto& position : positions)
+    {
+        *sum += position.x;
+    }
+    Simulator::Schedule(interval, &QueryEnginePositions, engine, interval, sum);
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nNodes = 10000;
+    double simTime = 60;
+    double side = 5000;
+    Time timeStep = MilliSeconds(100);
+    Time queryInterval = MilliSeconds(100);
+    bool stepped = true;
+    bool bulk = true;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nNodes", "Number of nodes", nNodes);
+    cmd.AddValue("simTime", "Simulation time, in seconds", simTime);
+    cmd.AddValue("side", "Side of the square area, in meters", side);
+    cmd.AddValue("timeStep", "Time step of the engine", timeStep);
+    cmd.AddValue("queryInterval", "Interval between two queries of the positions", queryInterval);
+    cmd.AddValue("stepped", "Use the SteppedMobilityEngine", stepped);
+    cmd.AddValue("bulk", "Query the positions from the engine in bulk", bulk);
+    cmd.Parse(argc, argv);
+
+    std::string area = "ns3::UniformRandomVariable[Min=0.0|Max=" + std::to_string(side) + "]";
+    ObjectFactory waypoints;
+    waypoints.SetTypeId("ns3::RandomRectanglePositionAllocator");
+    waypoints.Set("X", StringValue(area));
+    waypoints.Set("Y", StringValue(area));
+    Ptr<PositionAllocator> allocator = waypoints.Create<PositionAllocator>();
+
+    Ptr<SteppedMobilityEngine> engine = CreateObject<SteppedMobilityEngine>();
+    engine->SetAttribute("TimeStep", TimeValue(timeStep));
+
+    ObjectFactory factory;
+    factory.SetTypeId(stepped ? "ns3::SteppedMobilityModel" : "ns3::RandomWaypointMobilityModel");
+    factory.Set("PositionAllocator", PointerValue(allocator));
+    factory.Set("Speed", StringValue("ns3::UniformRandomVariable[Min=5.0|Max=30.0]"));
+    factory.Set("Pause", StringValue("ns3::UniformRandomVariable[Min=0.0|Max=5.0]"));
+    if (stepped)
+    {
+        factory.Set("Engine", PointerValue(engine));
+    }
+
+    std::vector<Ptr<MobilityModel>> models;
+    for (uint32_t i = 0; i < nNodes; i++)
+    {
+        Ptr<MobilityModel> model = factory.Create<MobilityModel>();
+        model->SetPosition(allocator->GetNext());
+        model->Initialize();
+        models.push_back(model);
+    }
+
+    double sum = 0;
+    if (stepped && bulk)
+    {
+        Simulator::Schedule(queryInterval, &QueryEnginePositions, engine, queryInterval, &sum);
+    }
+    else
+    {
+        Simulator::Schedule(queryInterval, &QueryPositions, &models, queryInterval, &sum);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    Simulator::Stop(Seconds(simTime));
+    Simulator::Run();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << (stepped ? "SteppedMobilityModel" : "RandomWaypointMobilityModel") << ", "
+              << nNodes << " nodes: " << elapsed.count() << " s, "
+              << Simulator::GetEventCount() << " events (checksum " << sum << ")" << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -29,13 +29,22 @@
 
 #include "ns3/constant-velocity-mobility-model.h"
 #include "ns3/log.h"
+#include "ns3/mapped-file.h"
 #include "ns3/node-list.h"
 #include "ns3/node.h"
+#include "ns3/simple-ref-count.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstring>
 #include <fstream>
 #include <map>
+#include <memory>
 #include <sstream>
+#include <string_view>
 
 namespace ns3
 {
@@ -222,6 +231,517 @@ static Vector SetSchedPosition(Ptr<ConstantVelocityMobilityModel> model,
                                std::string coord,
                                double coordVal);
 
+/**
+ * Type of a statement of an ns-2 movement trace
+ */
+enum class Ns2StatementType : uint8_t
+{
+    INITIAL_POSITION = 0, //!< $node_(0) set X_ 1
+    SET_POSITION = 1,     //!< $ns_ at 1 "$node_(0) set X_ 2"
+    SETDEST = 2,          //!< $ns_ at 1 "$node_(0) setdest 2 3 4"
+};
+
+/**
+ * A statement of an ns-2 movement trace, as read by the streaming mode
+ */
+struct Ns2Statement
+{
+    double time{0};          //!< time of the statement, in seconds (0 for initial positions)
+    uint32_t nodeId{0};      //!< the node id
+    Ns2StatementType type{}; //!< the type of the statement
+    uint8_t coord{0};        //!< coordinate (0, 1 or 2 for X_, Y_ or Z_) of a set statement
+    double values[3]{};      //!< coordinate value, or x, y and speed of a setdest statement
+};
+
+/// Magic string at the beginning of the binary traces
+static constexpr char NS2_BINARY_MAGIC[8] = {'N', 'S', '2', 'M', 'O', 'B', 'I', 'N'};
+/// Version of the binary trace format
+static constexpr uint32_t NS2_BINARY_VERSION = 1;
+/// Size of the header of the binary traces: magic, version, record size, number of records
+static constexpr std::size_t NS2_BINARY_HEADER_SIZE = 24;
+/// Size of a record: time, node id, type, coordinate, 2 reserved bytes, 3 values
+static constexpr std::size_t NS2_BINARY_RECORD_SIZE = 40;
+
+/**
+ * Sequential reader of the statements of an ns-2 movement trace, either text or binary,
+ * mapped in memory. The text lines are parsed without allocations.
+ */
+class Ns2TraceReader
+{
+  public:
+    /**
+     * Open a trace
+     * @param filename the filename of the trace
+     * @return true if the trace has been opened
+     */
+    bool Open(const std::string& filename);
+
+    /**
+     * @return true if the trace is in the binary format
+     */
+    bool IsBinary() const;
+
+    /**
+     * Read the next valid statement of the trace, skipping the malformed ones
+     * @param statement the statement read
+     * @return false if the end of the trace has been reached
+     */
+    bool Next(Ns2Statement& statement);
+
+  private:
+    /**
+     * Parse a line of a text trace
+     * @param line the line, without the end of line characters
+     * @param statement the statement read
+     * @return true if the line contains a valid statement
+     */
+    static bool ParseLine(std::string_view line, Ns2Statement& statement);
+
+    MappedFile m_file;       //!< the trace
+    std::size_t m_offset{0}; //!< offset of the next line, or index of the next record
+    uint64_t m_nRecords{0};  //!< number of records of a binary trace
+    bool m_binary{false};    //!< whether the trace is in the binary format
+};
+
+/**
+ * Parse a number, which must span the whole token
+ * @param token the token
+ * @param value the number
+ * @return true if the token is a number
+ */
+template <class T>
+static bool
+ParseNs2Number(std::string_view token, T& value)
+{
+    if (!token.empty() && token.front() == '+')
+    {
+        token.remove_prefix(1);
+    }
+    const char* end = token.data() + token.size();
+    auto [ptr, ec] = std::from_chars(token.data(), end, value);
+    return !token.empty() && ec == std::errc() && ptr == end;
+}
+
+/**
+ * Parse the id of a node from a token like $node_(4)
+ * @param token the token
+ * @param id the node id
+ * @return true if the token contains a node id
+ */
+static bool
+ParseNs2NodeId(std::string_view token, uint32_t& id)
+{
+    std::size_t start = token.find('(');
+    std::size_t end = token.find(')');
+    if (start == std::string_view::npos || end == std::string_view::npos || end < start)
+    {
+        return false;
+    }
+    return ParseNs2Number(token.substr(start + 1, end - start - 1), id);
+}
+
+/**
+ * Parse the name of a coordinate
+ * @param token the token
+ * @param coord the coordinate (0, 1 or 2 for X_, Y_ or Z_)
+ * @return true if the token is the name of a coordinate
+ */
+static bool
+ParseNs2Coord(std::string_view token, uint8_t& coord)
+{
+    if (token == NS2_X_COORD)
+    {
+        coord = 0;
+    }
+    else if (token == NS2_Y_COORD)
+    {
+        coord = 1;
+    }
+    else if (token == NS2_Z_COORD)
+    {
+        coord = 2;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+bool
+Ns2TraceReader::Open(const std::string& filename)
+{
+    if (!m_file.Open(filename))
+    {
+        return false;
+    }
+    m_binary = m_file.GetSize() >= NS2_BINARY_HEADER_SIZE &&
+               std::memcmp(m_file.GetData(), NS2_BINARY_MAGIC, sizeof(NS2_BINARY_MAGIC)) == 0;
+    if (m_binary)
+    {
+        uint32_t version;
+        uint32_t recordSize;
+        std::memcpy(&version, m_file.GetData() + 8, sizeof(version));
+        std::memcpy(&recordSize, m_file.GetData() + 12, sizeof(recordSize));
+        std::memcpy(&m_nRecords, m_file.GetData() + 16, sizeof(m_nRecords));
+        NS_ABORT_MSG_IF(version != NS2_BINARY_VERSION || recordSize != NS2_BINARY_RECORD_SIZE,
+                        "Unsupported version of the binary trace " << filename);
+        NS_ABORT_MSG_IF((m_file.GetSize() - NS2_BINARY_HEADER_SIZE) / NS2_BINARY_RECORD_SIZE <
+                            m_nRecords,
+                        "Truncated binary trace " << filename);
+    }
+    m_offset = 0;
+    return true;
+}
+
+bool
+Ns2TraceReader::IsBinary() const
+{
+    return m_binary;
+}
+
+bool
+Ns2TraceReader::Next(Ns2Statement& statement)
+{
+    if (m_binary)
+    {
+        if (m_offset >= m_nRecords)
+        {
+            return false;
+        }
+        // the records are copied field by field since they may not be aligned
+        const uint8_t* record =
+            m_file.GetData() + NS2_BINARY_HEADER_SIZE + m_offset++ * NS2_BINARY_RECORD_SIZE;
+        std::memcpy(&statement.time, record, sizeof(statement.time));
+        std::memcpy(&statement.nodeId, record + 8, sizeof(statement.nodeId));
+        statement.type = static_cast<Ns2StatementType>(record[12]);
+        statement.coord = record[13];
+        std::memcpy(statement.values, record + 16, sizeof(statement.values));
+        return true;
+    }
+
+    const char* data = reinterpret_cast<const char*>(m_file.GetData());
+    const std::size_t size = m_file.GetSize();
+    while (m_offset < size)
+    {
+        const char* begin = data + m_offset;
+        const char* end = static_cast<const char*>(std::memchr(begin, '\n', size - m_offset));
+        if (!end)
+        {
+            end = data + size;
+        }
+        m_offset = end - data + 1;
+        std::string_view line(begin, end - begin);
+        if (ParseLine(line, statement))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+Ns2TraceReader::ParseLine(std::string_view line, Ns2Statement& statement)
+{
+    // ignore comments (#)
+    line = line.substr(0, line.find('#'));
+
+    // split the line in tokens, dropping the quotes and the final semicolon
+    std::array<std::string_view, 8> tokens;
+    std::size_t nTokens = 0;
+    std::size_t pos = 0;
+    while (pos < line.size())
+    {
+        std::size_t start = line.find_first_not_of(" \t\r\v\f", pos);
+        if (start == std::string_view::npos)
+        {
+            break;
+        }
+        pos = line.find_first_of(" \t\r\v\f", start);
+        std::string_view token = line.substr(start, pos - start);
+        while (!token.empty() && (token.front() == '"'))
+        {
+            token.remove_prefix(1);
+        }
+        while (!token.empty() && (token.back() == '"' || token.back() == ';'))
+        {
+            token.remove_suffix(1);
+        }
+        if (token.empty())
+        {
+            continue;
+        }
+        if (nTokens == tokens.size())
+        {
+            NS_LOG_WARN("Line has too many tokens: " << line);
+            return false;
+        }
+        tokens[nTokens++] = token;
+    }
+
+    if (nTokens == 0)
+    {
+        return false;
+    }
+    bool valid = false;
+    if (nTokens == 4)
+    {
+        // line like $node_(0) set X_ 151.05190721688197
+        statement.type = Ns2StatementType::INITIAL_POSITION;
+        statement.time = 0;
+        valid = ParseNs2NodeId(tokens[0], statement.nodeId) && tokens[1] == NS2_SET &&
+                ParseNs2Coord(tokens[2], statement.coord) &&
+                ParseNs2Number(tokens[3], statement.values[0]);
+    }
+    else if ((nTokens == 7 || nTokens == 8) && tokens[0] == NS2_NS_SCH && tokens[1] == NS2_AT &&
+             ParseNs2Number(tokens[2], statement.time) &&
+             ParseNs2NodeId(tokens[3], statement.nodeId))
+    {
+        if (nTokens == 7)
+        {
+            // line like $ns_ at 4.634906291962 "$node_(0) set X_ 28.675920486450"
+            statement.type = Ns2StatementType::SET_POSITION;
+            valid = tokens[4] == NS2_SET && ParseNs2Coord(tokens[5], statement.coord) &&
+                    ParseNs2Number(tokens[6], statement.values[0]);
+        }
+        else
+        {
+            // line like $ns_ at 1 "$node_(0) setdest 2 3 4"
+            statement.type = Ns2StatementType::SETDEST;
+            valid = tokens[4] == NS2_SETDEST && ParseNs2Number(tokens[5], statement.values[0]) &&
+                    ParseNs2Number(tokens[6], statement.values[1]) &&
+                    ParseNs2Number(tokens[7], statement.values[2]);
+        }
+        if (valid && statement.time < 0)
+        {
+            NS_LOG_WARN("Time is less than zero: " << line);
+            valid = false;
+        }
+        if (valid && statement.type == Ns2StatementType::SETDEST && statement.values[2] < 0)
+        {
+            NS_LOG_WARN("Speed is less than zero: " << line);
+            valid = false;
+        }
+    }
+    if (!valid)
+    {
+        NS_LOG_WARN("Format Line is not correct: " << line);
+    }
+    return valid;
+}
+
+/**
+ * Applies the timed statements of a trace while the simulation runs. A single event is
+ * pending for the next statement of the trace, which holds a reference to this object.
+ * The movements are computed as when the whole trace is parsed by Install(), provided
+ * that the initial positions precede the timed statements and that the timed statements
+ * are sorted by time; otherwise, the simulation is aborted.
+ */
+class Ns2TraceStreamer : public SimpleRefCount<Ns2TraceStreamer>
+{
+  public:
+    /**
+     * Constructor
+     * @param reader the reader of the trace, positioned at the first statement
+     * @param models the mobility models, indexed by node id (null for the unknown nodes)
+     */
+    Ns2TraceStreamer(std::unique_ptr<Ns2TraceReader> reader,
+                     std::vector<Ptr<ConstantVelocityMobilityModel>> models);
+
+    /**
+     * Set the initial positions found at the beginning of the trace, then read the first
+     * timed statement and schedule its application
+     */
+    void Start();
+
+  private:
+    /**
+     * Apply the statements whose time has come and schedule the next one
+     */
+    void Pump();
+
+    /**
+     * Read the next timed statement of a known node into m_next. The simulation is aborted
+     * if the statement is an initial position or precedes the previous timed statement.
+     * @return false if the end of the trace has been reached
+     */
+    bool ReadNext();
+
+    /**
+     * Apply a timed statement
+     * @param statement the statement
+     */
+    void Apply(const Ns2Statement& statement);
+
+    std::unique_ptr<Ns2TraceReader> m_reader;                 //!< the reader of the trace
+    std::vector<Ptr<ConstantVelocityMobilityModel>> m_models; //!< models indexed by node id
+    std::vector<DestinationPoint> m_lastPos;                  //!< last movement of each node
+    Ns2Statement m_next;                                      //!< the next statement to apply
+    double m_lastTime{0}; //!< the time of the last timed statement read, in seconds
+};
+
+Ns2TraceStreamer::Ns2TraceStreamer(std::unique_ptr<Ns2TraceReader> reader,
+                                   std::vector<Ptr<ConstantVelocityMobilityModel>> models)
+    : m_reader(std::move(reader)),
+      m_models(std::move(models)),
+      m_lastPos(m_models.size())
+{
+}
+
+void
+Ns2TraceStreamer::Start()
+{
+    // the reading stops at the first timed statement
+    bool more = false;
+    while (m_reader->Next(m_next))
+    {
+        if (m_next.type != Ns2StatementType::INITIAL_POSITION)
+        {
+            more = true;
+            break;
+        }
+        if (m_next.nodeId >= m_models.size() || !m_models[m_next.nodeId])
+        {
+            NS_LOG_ERROR("Unknown node ID (corrupted file?): " << m_next.nodeId);
+            continue;
+        }
+        Ptr<ConstantVelocityMobilityModel> model = m_models[m_next.nodeId];
+        Vector position = model->GetPosition();
+        double* coords[] = {&position.x, &position.y, &position.z};
+        *coords[m_next.coord] = m_next.values[0];
+        model->SetPosition(position);
+        NS_LOG_DEBUG("Initial position of node " << m_next.nodeId << " = " << position);
+    }
+    for (std::size_t i = 0; i < m_models.size(); i++)
+    {
+        if (m_models[i])
+        {
+            m_lastPos[i].m_finalPosition = m_models[i]->GetPosition();
+        }
+    }
+
+    m_lastTime = m_next.time;
+    if (more && (m_next.nodeId >= m_models.size() || !m_models[m_next.nodeId]))
+    {
+        NS_LOG_ERROR("Unknown node ID (corrupted file?): " << m_next.nodeId);
+        more = ReadNext();
+    }
+    if (more)
+    {
+        Simulator::Schedule(Seconds(m_next.time) - Simulator::Now(),
+                            &Ns2TraceStreamer::Pump,
+                            Ptr<Ns2TraceStreamer>(this));
+    }
+}
+
+bool
+Ns2TraceStreamer::ReadNext()
+{
+    while (m_reader->Next(m_next))
+    {
+        NS_ABORT_MSG_IF(m_next.type == Ns2StatementType::INITIAL_POSITION,
+                        "The initial position of node "
+                            << m_next.nodeId << " follows timed statements, which is not "
+                            << "supported by the streaming mode; disable it or convert the "
+                            << "trace with Ns2MobilityHelper::ConvertToBinary");
+        NS_ABORT_MSG_IF(m_next.time < m_lastTime,
+                        "The statement at " << m_next.time << " s for node " << m_next.nodeId
+                                            << " follows a statement at " << m_lastTime
+                                            << " s, which is not supported by the streaming "
+                                            << "mode; disable it or convert the trace with "
+                                            << "Ns2MobilityHelper::ConvertToBinary");
+        m_lastTime = m_next.time;
+        if (m_next.nodeId < m_models.size() && m_models[m_next.nodeId])
+        {
+            return true;
+        }
+        NS_LOG_ERROR("Unknown node ID (corrupted file?): " << m_next.nodeId);
+    }
+    return false;
+}
+
+void
+Ns2TraceStreamer::Pump()
+{
+    bool more = true;
+    while (more && Seconds(m_next.time) <= Simulator::Now())
+    {
+        Apply(m_next);
+        more = ReadNext();
+    }
+    if (more)
+    {
+        Simulator::Schedule(Seconds(m_next.time) - Simulator::Now(),
+                            &Ns2TraceStreamer::Pump,
+                            Ptr<Ns2TraceStreamer>(this));
+    }
+}
+
+void
+Ns2TraceStreamer::Apply(const Ns2Statement& statement)
+{
+    Ptr<ConstantVelocityMobilityModel> model = m_models[statement.nodeId];
+    DestinationPoint& last = m_lastPos[statement.nodeId];
+    double at = statement.time;
+
+    if (statement.type == Ns2StatementType::SET_POSITION)
+    {
+        Vector position = model->GetPosition();
+        double* coords[] = {&position.x, &position.y, &position.z};
+        *coords[statement.coord] = statement.values[0];
+        model->SetPosition(position);
+        last.m_finalPosition = position;
+        if (last.m_targetArrivalTime > at)
+        {
+            last.m_stopEvent.Cancel();
+        }
+        last.m_targetArrivalTime = at;
+        last.m_travelStartTime = at;
+        NS_LOG_DEBUG("Position of node " << statement.nodeId << " set to " << position);
+        return;
+    }
+
+    if (last.m_targetArrivalTime > at)
+    {
+        double actuallyTraveled = at - last.m_travelStartTime;
+        last.m_finalPosition =
+            Vector(last.m_startPosition.x + last.m_speed.x * actuallyTraveled,
+                   last.m_startPosition.y + last.m_speed.y * actuallyTraveled,
+                   0);
+        last.m_stopEvent.Cancel();
+        NS_LOG_LOGIC("Did not reach a destination, actually reached " << last.m_finalPosition);
+    }
+    last.m_startPosition = last.m_finalPosition;
+    last.m_speed = Vector(0, 0, 0);
+    last.m_travelStartTime = at;
+    last.m_targetArrivalTime = at;
+
+    double speed = statement.values[2];
+    if (speed == 0)
+    {
+        model->SetVelocity(Vector(0, 0, 0));
+        return;
+    }
+    double xDistance = statement.values[0] - last.m_finalPosition.x;
+    double yDistance = statement.values[1] - last.m_finalPosition.y;
+    double time = std::sqrt(std::pow(xDistance, 2) + std::pow(yDistance, 2)) / speed;
+    if (time == 0)
+    {
+        return;
+    }
+    last.m_speed = Vector(xDistance / time, yDistance / time, 0);
+    NS_LOG_DEBUG("Node " << statement.nodeId << " moves at " << last.m_speed << " for " << time
+                         << " s");
+    model->SetVelocity(last.m_speed);
+    last.m_stopEvent = Simulator::Schedule(Seconds(at + time) - Simulator::Now(),
+                                           &ConstantVelocityMobilityModel::SetVelocity,
+                                           model,
+                                           Vector(0, 0, 0));
+    last.m_finalPosition.x += last.m_speed.x * time;
+    last.m_finalPosition.y += last.m_speed.y * time;
+    last.m_targetArrivalTime += time;
+}
+
 Ns2MobilityHelper::Ns2MobilityHelper(std::string filename)
     : m_filename(filename)
 {
@@ -233,6 +753,12 @@ Ns2MobilityHelper::Ns2MobilityHelper(std::string filename)
     }
 }
 
+void
+Ns2MobilityHelper::SetStreaming(bool streaming)
+{
+    m_streaming = streaming;
+}
+
 Ptr<ConstantVelocityMobilityModel>
 Ns2MobilityHelper::GetMobilityModel(std::string idString, const ObjectStore& store) const
 {
@@ -240,6 +766,12 @@ Ns2MobilityHelper::GetMobilityModel(std::string idString, const ObjectStore& sto
     iss.str(idString);
     uint32_t id(0);
     iss >> id;
+    return GetMobilityModel(id, store);
+}
+
+Ptr<ConstantVelocityMobilityModel>
+Ns2MobilityHelper::GetMobilityModel(uint32_t id, const ObjectStore& store) const
+{
     Ptr<Object> object = store.Get(id);
     if (!object)
     {
@@ -257,6 +789,15 @@ Ns2MobilityHelper::GetMobilityModel(std::string idString, const ObjectStore& sto
 void
 Ns2MobilityHelper::ConfigNodesMovements(const ObjectStore& store) const
 {
+    std::ifstream magic(m_filename, std::ios::in | std::ios::binary);
+    char header[sizeof(NS2_BINARY_MAGIC)] = {};
+    magic.read(header, sizeof(header));
+    if (m_streaming || std::memcmp(header, NS2_BINARY_MAGIC, sizeof(header)) == 0)
+    {
+        ConfigNodesMovementsStreaming(store);
+        return;
+    }
+
     std::map<int, DestinationPoint> last_pos; // Stores previous movement scheduled for each node
 
     //*****************************************************************
@@ -850,6 +1391,104 @@ SetSchedPosition(Ptr<ConstantVelocityMobilityModel> model,
     return position;
 }
 
+void
+Ns2MobilityHelper::ConfigNodesMovementsStreaming(const ObjectStore& store) const
+{
+    auto reader = std::make_unique<Ns2TraceReader>();
+    if (!reader->Open(m_filename))
+    {
+        NS_FATAL_ERROR("Could not open trace file " << m_filename << " for reading");
+    }
+
+    // The models have to exist before the timed statements are read, hence a first pass over the
+    // trace collects the nodes it names; like the default mode, only those nodes get a
+    // ConstantVelocityMobilityModel.
+    std::vector<bool> traced;
+    {
+        Ns2TraceReader scanner;
+        scanner.Open(m_filename);
+        Ns2Statement statement;
+        while (scanner.Next(statement))
+        {
+            if (statement.nodeId >= traced.size())
+            {
+                traced.resize(statement.nodeId + 1, false);
+            }
+            traced[statement.nodeId] = true;
+        }
+    }
+
+    std::vector<Ptr<ConstantVelocityMobilityModel>> models;
+    for (uint32_t id = 0; Ptr<Object> object = store.Get(id); id++)
+    {
+        if (id >= traced.size() || !traced[id])
+        {
+            models.push_back(nullptr);
+            continue;
+        }
+        Ptr<ConstantVelocityMobilityModel> model =
+            object->GetObject<ConstantVelocityMobilityModel>();
+        if (!model && !object->GetObject<MobilityModel>())
+        {
+            model = CreateObject<ConstantVelocityMobilityModel>();
+            object->AggregateObject(model);
+        }
+        models.push_back(model);
+    }
+
+    Create<Ns2TraceStreamer>(std::move(reader), std::move(models))->Start();
+}
+
+uint64_t
+Ns2MobilityHelper::ConvertToBinary(const std::string& input, const std::string& output)
+{
+    NS_LOG_FUNCTION(input << output);
+    Ns2TraceReader reader;
+    if (!reader.Open(input))
+    {
+        NS_FATAL_ERROR("Could not open trace file " << input << " for reading");
+    }
+    NS_ABORT_MSG_IF(reader.IsBinary(), input << " is already a binary trace");
+
+    std::vector<Ns2Statement> statements;
+    Ns2Statement statement;
+    while (reader.Next(statement))
+    {
+        statements.push_back(statement);
+    }
+    // the initial positions come first, since their time is 0
+    std::stable_sort(statements.begin(),
+                     statements.end(),
+                     [](const Ns2Statement& a, const Ns2Statement& b) {
+                         bool aInitial = a.type == Ns2StatementType::INITIAL_POSITION;
+                         bool bInitial = b.type == Ns2StatementType::INITIAL_POSITION;
+                         return aInitial != bInitial ? aInitial : a.time < b.time;
+                     });
+
+    std::ofstream file(output, std::ios::out | std::ios::binary | std::ios::trunc);
+    NS_ABORT_MSG_IF(!file.is_open(), "Could not open " << output << " for writing");
+    uint8_t header[NS2_BINARY_HEADER_SIZE] = {};
+    uint32_t recordSize = NS2_BINARY_RECORD_SIZE;
+    uint64_t nRecords = statements.size();
+    std::memcpy(header, NS2_BINARY_MAGIC, sizeof(NS2_BINARY_MAGIC));
+    std::memcpy(header + 8, &NS2_BINARY_VERSION, sizeof(NS2_BINARY_VERSION));
+    std::memcpy(header + 12, &recordSize, sizeof(recordSize));
+    std::memcpy(header + 16, &nRecords, sizeof(nRecords));
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    for (const auto& s : statements)
+    {
+        uint8_t record[NS2_BINARY_RECORD_SIZE] = {};
+        std::memcpy(record, &s.time, sizeof(s.time));
+        std::memcpy(record + 8, &s.nodeId, sizeof(s.nodeId));
+        record[12] = static_cast<uint8_t>(s.type);
+        record[13] = s.coord;
+        std::memcpy(record + 16, s.values, sizeof(s.values));
+        file.write(reinterpret_cast<const char*>(record), sizeof(record));
+    }
+    NS_ABORT_MSG_IF(!file, "Could not write " << output);
+    return nRecords;
+}
+
 void
 Ns2MobilityHelper::Install() const
 {
@@ -59,6 +59,22 @@ class ConstantVelocityMobilityModel;
  *
  *  See usage example in examples/mobility/ns2-mobility-trace.cc
  *
+ * By default, the whole trace is parsed by Install() and all its statements are
+ * scheduled as events. For large traces (such as those exported by SUMO), the streaming
+ * mode (see SetStreaming()) maps the file in memory and parses the timed statements while
+ * the simulation runs: a single event is pending at any time for the next statement of the
+ * trace, in addition to at most one event per node stopping its current movement. In this
+ * mode, Install() only reads the initial positions at the beginning of the trace and
+ * aggregates a ConstantVelocityMobilityModel to the nodes without a mobility model. The
+ * simulation is aborted if an initial position follows a timed statement or if the timed
+ * statements are not sorted by time.
+ *
+ * Traces can also be converted once (see ConvertToBinary() and the
+ * ns2-mobility-trace-converter program) to a compact binary format, whose statements are
+ * sorted by time and do not need to be parsed. Binary traces are always read in the
+ * streaming mode. The binary format uses the byte order of the host.
+ *
+ *
  * @bug Rounding errors may cause movement to diverge from the mobility
  * pattern in ns-2 (using the same trace).
  * See https://www.nsnam.org/bugzilla/show_bug.cgi?id=1316
@@ -94,6 +110,24 @@ class Ns2MobilityHelper
     template <typename T>
     void Install(T begin, T end) const;
 
+    /**
+     * Enable or disable the streaming mode, which is disabled by default. Binary traces are
+     * read in the streaming mode regardless of this setting.
+     * @param streaming whether the statements of the trace are parsed and applied while
+     *        the simulation runs
+     */
+    void SetStreaming(bool streaming);
+
+    /**
+     * Convert an ns-2 movement trace to the binary trace format read by this helper.
+     * The timed statements are sorted by time, preserving the order of the statements
+     * with the same time, and the malformed statements are discarded.
+     * @param input filename of the ns-2 movement trace
+     * @param output filename of the binary trace
+     * @return the number of statements written to the binary trace
+     */
+    static uint64_t ConvertToBinary(const std::string& input, const std::string& output);
+
   private:
     /**
      * @brief a class to hold input objects internally
@@ -118,6 +152,12 @@ class Ns2MobilityHelper
      * @param store Object store containing ns-3 mobility models
      */
     void ConfigNodesMovements(const ObjectStore& store) const;
+    /**
+     * Read the initial positions at the beginning of the trace and schedule the streaming
+     * of its timed statements
+     * @param store Object store containing ns-3 mobility models
+     */
+    void ConfigNodesMovementsStreaming(const ObjectStore& store) const;
     /**
      * Get or create a ConstantVelocityMobilityModel corresponding to idString
      * @param idString string name for a node
@@ -126,7 +166,16 @@ class Ns2MobilityHelper
      */
     Ptr<ConstantVelocityMobilityModel> GetMobilityModel(std::string idString,
                                                         const ObjectStore& store) const;
-    std::string m_filename; //!< filename of file containing ns-2 mobility trace
+    /**
+     * Get or create a ConstantVelocityMobilityModel corresponding to a node id
+     * @param id the node id
+     * @param store Object store containing ns-3 mobility models
+     * @return pointer to a ConstantVelocityMobilityModel
+     */
+    Ptr<ConstantVelocityMobilityModel> GetMobilityModel(uint32_t id,
+                                                        const ObjectStore& store) const;
+    std::string m_filename;  //!< filename of file containing ns-2 mobility trace
+    bool m_streaming{false}; //!< whether the trace is read in the streaming mode
 };
 
 } // namespace ns3
@@ -0,0 +1,301 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include "stepped-mobility-engine.h"
+
+#include "stepped-mobility-model.h"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SteppedMobilityEngine");
+
+NS_OBJECT_ENSURE_REGISTERED(SteppedMobilityEngine);
+
+TypeId
+SteppedMobilityEngine::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::SteppedMobilityEngine")
+            .SetParent<Object>()
+            .SetGroupName("Mobility")
+            .AddConstructor<SteppedMobilityEngine>()
+            .AddAttribute("TimeStep",
+                          "The interval between two updates of the positions of the models.",
+                          TimeValue(MilliSeconds(100)),
+                          MakeTimeAccessor(&SteppedMobilityEngine::m_timeStep),
+                          MakeTimeChecker(TimeStep(1)))
+            .AddTraceSource("Step",
+                            "The positions of the models have been advanced by a time step.",
+                            MakeTraceSourceAccessor(&SteppedMobilityEngine::m_stepTrace),
+                            "ns3::SteppedMobilityEngine::StepTracedCallback");
+    return tid;
+}
+
+SteppedMobilityEngine::SteppedMobilityEngine()
+    : m_lastStep(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+SteppedMobilityEngine::~SteppedMobilityEngine()
+{
+    NS_LOG_FUNCTION(this);
+    m_event.Cancel();
+}
+
+void
+SteppedMobilityEngine::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    // the models may still be used after the engine has been disposed, hence only the
+    // updates of the positions are stopped
+    m_event.Cancel();
+    Object::DoDispose();
+}
+
+Ptr<SteppedMobilityEngine>
+SteppedMobilityEngine::GetDefault()
+{
+    return *DoGetDefault();
+}
+
+Ptr<SteppedMobilityEngine>*
+SteppedMobilityEngine::DoGetDefault()
+{
+    static Ptr<SteppedMobilityEngine> ptr = nullptr;
+    if (!ptr)
+    {
+        ptr = CreateObject<SteppedMobilityEngine>();
+        Simulator::ScheduleDestroy(&SteppedMobilityEngine::DeleteDefault);
+    }
+    return &ptr;
+}
+
+void
+SteppedMobilityEngine::DeleteDefault()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    Ptr<SteppedMobilityEngine>* ptr = DoGetDefault();
+    (*ptr)->Dispose();
+    *ptr = nullptr;
+}
+
+uint32_t
+SteppedMobilityEngine::Add(SteppedMobilityModel* model, const Vector& position)
+{
+    NS_LOG_FUNCTION(this << model << position);
+
+    uint32_t index;
+    if (!m_freeIndices.empty())
+    {
+        index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+    }
+    else
+    {
+        index = m_models.size();
+        m_x.push_back(0);
+        m_y.push_back(0);
+        m_z.push_back(0);
+        m_vx.push_back(0);
+        m_vy.push_back(0);
+        m_vz.push_back(0);
+        m_legEnd.push_back(0);
+        m_models.push_back(nullptr);
+    }
+    m_models[index] = model;
+    m_x[index] = position.x;
+    m_y[index] = position.y;
+    m_z[index] = position.z;
+    m_vx[index] = 0;
+    m_vy[index] = 0;
+    m_vz[index] = 0;
+    m_legEnd[index] = std::numeric_limits<double>::infinity();
+    return index;
+}
+
+void
+SteppedMobilityEngine::Remove(uint32_t index)
+{
+    NS_LOG_FUNCTION(this << index);
+    NS_ASSERT_MSG(index < m_models.size() && m_models[index], "Invalid index " << index);
+
+    m_models[index] = nullptr;
+    // a free index does not move and does not take part in the steps
+    m_vx[index] = 0;
+    m_vy[index] = 0;
+    m_vz[index] = 0;
+    m_legEnd[index] = std::numeric_limits<double>::infinity();
+    m_freeIndices.push_back(index);
+    if (GetNModels() == 0)
+    {
+        m_event.Cancel();
+    }
+}
+
+uint32_t
+SteppedMobilityEngine::GetNModels() const
+{
+    return m_models.size() - m_freeIndices.size();
+}
+
+double
+SteppedMobilityEngine::GetElapsed(uint32_t index, double now) const
+{
+    return std::max(std::min(now, m_legEnd[index]) - m_lastStep, 0.0);
+}
+
+Vector
+SteppedMobilityEngine::GetPosition(uint32_t index) const
+{
+    NS_ASSERT(index < m_models.size());
+    double elapsed = GetElapsed(index, Simulator::Now().GetSeconds());
+    return Vector(m_x[index] + m_vx[index] * elapsed,
+                  m_y[index] + m_vy[index] * elapsed,
+                  m_z[index] + m_vz[index] * elapsed);
+}
+
+void
+SteppedMobilityEngine::SetPosition(uint32_t index, const Vector& position)
+{
+    NS_LOG_FUNCTION(this << index << position);
+    NS_ASSERT(index < m_models.size());
+
+    // the positions refer to the time of the last step
+    double elapsed = GetElapsed(index, Simulator::Now().GetSeconds());
+    m_x[index] = position.x - m_vx[index] * elapsed;
+    m_y[index] = position.y - m_vy[index] * elapsed;
+    m_z[index] = position.z - m_vz[index] * elapsed;
+}
+
+Vector
+SteppedMobilityEngine::GetVelocity(uint32_t index) const
+{
+    NS_ASSERT(index < m_models.size());
+    if (Simulator::Now().GetSeconds() >= m_legEnd[index])
+    {
+        return Vector(0, 0, 0);
+    }
+    return Vector(m_vx[index], m_vy[index], m_vz[index]);
+}
+
+void
+SteppedMobilityEngine::SetVelocity(uint32_t index, const Vector& velocity, Time duration)
+{
+    NS_LOG_FUNCTION(this << index << velocity << duration);
+    NS_ASSERT(index < m_models.size());
+
+    Vector position = GetPosition(index);
+    double now = Simulator::Now().GetSeconds();
+    m_vx[index] = velocity.x;
+    m_vy[index] = velocity.y;
+    m_vz[index] = velocity.z;
+    m_legEnd[index] = duration == Time::Max() ? std::numeric_limits<double>::infinity()
+                                              : now + duration.GetSeconds();
+    SetPosition(index, position);
+
+    // the positions are interpolated between the steps, hence the steps are only needed to
+    // notify the models whose leg ends
+    if (duration != Time::Max() && !m_event.IsPending())
+    {
+        m_event = Simulator::Schedule(m_timeStep, &SteppedMobilityEngine::Step, this);
+    }
+}
+
+void
+SteppedMobilityEngine::GetPositions(std::vector<Vector>& positions) const
+{
+    NS_LOG_FUNCTION(this);
+
+    const double now = Simulator::Now().GetSeconds();
+    const size_t n = m_models.size();
+    positions.resize(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        double elapsed = std::max(std::min(now, m_legEnd[i]) - m_lastStep, 0.0);
+        positions[i] = Vector(m_x[i] + m_vx[i] * elapsed,
+                              m_y[i] + m_vy[i] * elapsed,
+                              m_z[i] + m_vz[i] * elapsed);
+    }
+}
+
+Time
+SteppedMobilityEngine::GetTimeStep() const
+{
+    return m_timeStep;
+}
+
+void
+SteppedMobilityEngine::Step()
+{
+    NS_LOG_FUNCTION(this);
+
+    const double now = Simulator::Now().GetSeconds();
+    const size_t n = m_models.size();
+    double* x = m_x.data();
+    double* y = m_y.data();
+    double* z = m_z.data();
+    const double* vx = m_vx.data();
+    const double* vy = m_vy.data();
+    const double* vz = m_vz.data();
+    const double* legEnd = m_legEnd.data();
+    const double lastStep = m_lastStep;
+
+    // advance all the models, stopping those whose leg ended at the end of the leg
+    for (size_t i = 0; i < n; i++)
+    {
+        double elapsed = std::max(std::min(now, legEnd[i]) - lastStep, 0.0);
+        x[i] += vx[i] * elapsed;
+        y[i] += vy[i] * elapsed;
+        z[i] += vz[i] * elapsed;
+    }
+    m_lastStep = now;
+
+    // collect the models whose leg ended before notifying them, since they may start a new leg
+    m_legsEnded.clear();
+    bool pending = false;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (legEnd[i] <= now)
+        {
+            m_legsEnded.push_back(i);
+        }
+        else if (legEnd[i] != std::numeric_limits<double>::infinity())
+        {
+            pending = true;
+        }
+    }
+    for (auto index : m_legsEnded)
+    {
+        m_vx[index] = 0;
+        m_vy[index] = 0;
+        m_vz[index] = 0;
+        m_legEnd[index] = std::numeric_limits<double>::infinity();
+    }
+    for (auto index : m_legsEnded)
+    {
+        // a model may be removed by the notification of another model
+        if (m_models[index])
+        {
+            m_models[index]->NotifyLegEnd();
+        }
+    }
+    NS_LOG_DEBUG("Advanced " << GetNModels() << " models, " << m_legsEnded.size()
+                             << " legs ended");
+    m_stepTrace(GetNModels(), m_legsEnded.size());
+
+    // the legs started by the notified models have scheduled the next step already
+    if (pending && !m_event.IsPending())
+    {
+        m_event = Simulator::Schedule(m_timeStep, &SteppedMobilityEngine::Step, this);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,176 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef STEPPED_MOBILITY_ENGINE_H
+#define STEPPED_MOBILITY_ENGINE_H
+
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/traced-callback.h"
+#include "ns3/vector.h"
+
+#include <vector>
+
+namespace ns3
+{
+
+class SteppedMobilityModel;
+
+/**
+ * @ingroup mobility
+ * @brief Engine advancing the positions of many SteppedMobilityModel instances in fixed
+ * time steps.
+ *
+ * The engine stores the positions, the velocities and the end times of the current legs
+ * of all the registered models in contiguous arrays, one per coordinate, and updates all of
+ * them with a single event every "TimeStep", in a loop without dependencies among the
+ * models, which the compiler can vectorize. The steps are only scheduled while the leg of
+ * some model has a finite duration, hence a simulation whose models are all at rest or
+ * moving indefinitely runs out of events. Each model moves at constant velocity during a
+ * leg and stops at the end of the leg; models whose leg ended are notified at the end of the
+ * step, hence the next leg starts up to a time step after the end of the previous one (e.g.,
+ * pauses are rounded up to the time step). Between two steps, the positions are interpolated
+ * from the velocities, hence they are exact for the models moving at constant velocity.
+ *
+ * Positions can be retrieved through the MobilityModel interface of each model or, for all
+ * the models at once, through GetPositions.
+ */
+class SteppedMobilityEngine : public Object
+{
+  public:
+    /**
+     * Register this type with the TypeId system.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    SteppedMobilityEngine();
+    ~SteppedMobilityEngine() override;
+
+    /**
+     * Get the engine used by the SteppedMobilityModel instances whose "Engine" attribute
+     * is not set. The engine is created when first needed and released when the simulator
+     * is destroyed.
+     * @return the default engine
+     */
+    static Ptr<SteppedMobilityEngine> GetDefault();
+
+    /**
+     * TracedCallback signature for the completion of a time step.
+     *
+     * @param [in] nModels the number of models advanced by the step
+     * @param [in] nLegsEnded the number of models whose leg ended during the step
+     */
+    typedef void (*StepTracedCallback)(uint32_t nModels, uint32_t nLegsEnded);
+
+    /**
+     * Register a model, initially at rest.
+     * @param model the model
+     * @param position the initial position of the model
+     * @return the index of the model in the arrays of the engine
+     */
+    uint32_t Add(SteppedMobilityModel* model, const Vector& position);
+
+    /**
+     * Unregister a model. The index may be reused by a model added later.
+     * @param index the index of the model
+     */
+    void Remove(uint32_t index);
+
+    /**
+     * @return the number of registered models
+     */
+    uint32_t GetNModels() const;
+
+    /**
+     * @param index the index of a model
+     * @return the current position of the model
+     */
+    Vector GetPosition(uint32_t index) const;
+
+    /**
+     * Set the position of a model, without changing its velocity.
+     * @param index the index of a model
+     * @param position the new position of the model
+     */
+    void SetPosition(uint32_t index, const Vector& position);
+
+    /**
+     * @param index the index of a model
+     * @return the current velocity of the model, which is null if the leg of the model ended
+     */
+    Vector GetVelocity(uint32_t index) const;
+
+    /**
+     * Start a new leg for a model, from its current position.
+     * @param index the index of a model
+     * @param velocity the velocity of the model during the leg
+     * @param duration the duration of the leg, or Time::Max () for a leg that only ends
+     *        when a new one is started
+     */
+    void SetVelocity(uint32_t index, const Vector& velocity, Time duration = Time::Max());
+
+    /**
+     * Get the current positions of all the models. The positions are indexed as the models;
+     * the entries of the indices that are not used by any model are unspecified.
+     * @param positions the vector to fill with the positions, which is resized if needed
+     */
+    void GetPositions(std::vector<Vector>& positions) const;
+
+    /**
+     * @return the time step of the engine
+     */
+    Time GetTimeStep() const;
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /**
+     * Advance the positions of all the models to the current time and notify the models
+     * whose leg ended.
+     */
+    void Step();
+
+    /**
+     * Compute the time elapsed since the last step that a model spent moving.
+     * @param index the index of the model
+     * @param now the current time, in seconds
+     * @return the time spent moving since the last step, in seconds
+     */
+    double GetElapsed(uint32_t index, double now) const;
+
+    /**
+     * Release the default engine.
+     */
+    static void DeleteDefault();
+
+    /**
+     * @return a pointer to the default engine
+     */
+    static Ptr<SteppedMobilityEngine>* DoGetDefault();
+
+    Time m_timeStep;   //!< the time step
+    EventId m_event;   //!< the event of the next step
+    double m_lastStep; //!< the time of the last step, in seconds
+
+    std::vector<double> m_x;      //!< the x coordinates at the time of the last step
+    std::vector<double> m_y;      //!< the y coordinates at the time of the last step
+    std::vector<double> m_z;      //!< the z coordinates at the time of the last step
+    std::vector<double> m_vx;     //!< the x components of the velocities
+    std::vector<double> m_vy;     //!< the y components of the velocities
+    std::vector<double> m_vz;     //!< the z components of the velocities
+    std::vector<double> m_legEnd; //!< the end times of the current legs, in seconds
+
+    std::vector<SteppedMobilityModel*> m_models; //!< the models, null for the unused indices
+    std::vector<uint32_t> m_freeIndices;         //!< the indices not used by any model
+    std::vector<uint32_t> m_legsEnded;           //!< the models whose leg ended in a step
+
+    /// The trace fired at the end of each time step
+    TracedCallback<uint32_t, uint32_t> m_stepTrace;
+};
+
+} // namespace ns3
+
+#endif /* STEPPED_MOBILITY_ENGINE_H */
@@ -0,0 +1,224 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include "stepped-mobility-model.h"
+
+#include "ns3/log.h"
+#include "ns3/pointer.h"
+#include "ns3/string.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SteppedMobilityModel");
+
+NS_OBJECT_ENSURE_REGISTERED(SteppedMobilityModel);
+
+TypeId
+SteppedMobilityModel::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::SteppedMobilityModel")
+            .SetParent<MobilityModel>()
+            .SetGroupName("Mobility")
+            .AddConstructor<SteppedMobilityModel>()
+            .AddAttribute("Engine",
+                          "The engine storing and advancing the state of the model. If not set, "
+                          "the default engine is used.",
+                          PointerValue(),
+                          MakePointerAccessor(&SteppedMobilityModel::SetEngine,
+                                              &SteppedMobilityModel::GetEngine),
+                          MakePointerChecker<SteppedMobilityEngine>())
+            .AddAttribute("Speed",
+                          "A random variable used to pick the speed towards a waypoint.",
+                          StringValue("ns3::UniformRandomVariable[Min=0.3|Max=0.7]"),
+                          MakePointerAccessor(&SteppedMobilityModel::m_speed),
+                          MakePointerChecker<RandomVariableStream>())
+            .AddAttribute("Pause",
+                          "A random variable used to pick the pause at a waypoint.",
+                          StringValue("ns3::ConstantRandomVariable[Constant=2.0]"),
+                          MakePointerAccessor(&SteppedMobilityModel::m_pause),
+                          MakePointerChecker<RandomVariableStream>())
+            .AddAttribute("PositionAllocator",
+                          "The position model used to pick the waypoints. If not set, the "
+                          "model moves at the velocity set by SetVelocity.",
+                          PointerValue(),
+                          MakePointerAccessor(&SteppedMobilityModel::m_position),
+                          MakePointerChecker<PositionAllocator>());
+    return tid;
+}
+
+SteppedMobilityModel::SteppedMobilityModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+SteppedMobilityModel::~SteppedMobilityModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+SteppedMobilityModel::NotifyConstructionCompleted()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_engine)
+    {
+        m_engine = SteppedMobilityEngine::GetDefault();
+    }
+    m_index = m_engine->Add(this, Vector(0, 0, 0));
+    m_registered = true;
+    MobilityModel::NotifyConstructionCompleted();
+}
+
+void
+SteppedMobilityModel::DoInitialize()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_position)
+    {
+        BeginPause();
+    }
+    MobilityModel::DoInitialize();
+}
+
+void
+SteppedMobilityModel::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_registered)
+    {
+        m_engine->Remove(m_index);
+        m_registered = false;
+    }
+    m_engine = nullptr;
+    MobilityModel::DoDispose();
+}
+
+void
+SteppedMobilityModel::SetEngine(Ptr<SteppedMobilityEngine> engine)
+{
+    NS_LOG_FUNCTION(this << engine);
+    if (m_registered && engine != m_engine)
+    {
+        NS_ABORT_MSG_IF(!engine, "The engine of a registered model cannot be unset");
+        Vector position = m_engine->GetPosition(m_index);
+        Vector velocity = m_engine->GetVelocity(m_index);
+        m_engine->Remove(m_index);
+        m_index = engine->Add(this, position);
+        // the remaining duration of the current leg is not preserved
+        engine->SetVelocity(m_index, velocity);
+    }
+    m_engine = engine;
+}
+
+Ptr<SteppedMobilityEngine>
+SteppedMobilityModel::GetEngine() const
+{
+    return m_engine;
+}
+
+uint32_t
+SteppedMobilityModel::GetIndex() const
+{
+    return m_index;
+}
+
+void
+SteppedMobilityModel::SetVelocity(const Vector& velocity)
+{
+    NS_LOG_FUNCTION(this << velocity);
+    m_engine->SetVelocity(m_index, velocity);
+    NotifyCourseChange();
+}
+
+void
+SteppedMobilityModel::NotifyLegEnd()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_position)
+    {
+        return;
+    }
+    if (m_walking)
+    {
+        BeginPause();
+    }
+    else
+    {
+        BeginWalk();
+    }
+}
+
+void
+SteppedMobilityModel::BeginWalk()
+{
+    NS_LOG_FUNCTION(this);
+    Vector current = m_engine->GetPosition(m_index);
+    Vector destination = m_position->GetNext();
+    Vector delta = destination - current;
+    double distance = delta.GetLength();
+    double speed = m_speed->GetValue();
+
+    NS_ASSERT_MSG(speed > 0, "Speed must be strictly positive.");
+
+    // prevent corner cases where the distance is null (and the velocity is undefined)
+    double k = distance ? speed / distance : 0;
+    Time travelDelay = distance ? Seconds(distance / speed) : Time(0);
+
+    m_walking = true;
+    m_engine->SetVelocity(m_index, k * delta, travelDelay);
+    NotifyCourseChange();
+}
+
+void
+SteppedMobilityModel::BeginPause()
+{
+    NS_LOG_FUNCTION(this);
+    m_walking = false;
+    m_engine->SetVelocity(m_index, Vector(0, 0, 0), Seconds(m_pause->GetValue()));
+    NotifyCourseChange();
+}
+
+Vector
+SteppedMobilityModel::DoGetPosition() const
+{
+    return m_engine->GetPosition(m_index);
+}
+
+void
+SteppedMobilityModel::DoSetPosition(const Vector& position)
+{
+    NS_LOG_FUNCTION(this << position);
+    m_engine->SetPosition(m_index, position);
+    if (m_position && IsInitialized())
+    {
+        // restart the random waypoint process from the new position
+        BeginPause();
+    }
+    else
+    {
+        NotifyCourseChange();
+    }
+}
+
+Vector
+SteppedMobilityModel::DoGetVelocity() const
+{
+    return m_engine->GetVelocity(m_index);
+}
+
+int64_t
+SteppedMobilityModel::DoAssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    m_speed->SetStream(stream);
+    m_pause->SetStream(stream + 1);
+    if (!m_position)
+    {
+        return 2;
+    }
+    return 2 + m_position->AssignStreams(stream + 2);
+}
+
+} // namespace ns3
@@ -0,0 +1,110 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef STEPPED_MOBILITY_MODEL_H
+#define STEPPED_MOBILITY_MODEL_H
+
+#include "mobility-model.h"
+#include "position-allocator.h"
+#include "stepped-mobility-engine.h"
+
+#include "ns3/ptr.h"
+#include "ns3/random-variable-stream.h"
+
+namespace ns3
+{
+
+/**
+ * @ingroup mobility
+ * @brief Mobility model whose state is stored and advanced by a SteppedMobilityEngine.
+ *
+ * The model does not schedule any event: its position and velocity are stored in the arrays
+ * of the engine set through the "Engine" attribute (or of the default engine, if the
+ * attribute is not set), which advances all its models with a single event per time step.
+ *
+ * If the "PositionAllocator" attribute is set, the model moves as the
+ * RandomWaypointMobilityModel: it starts by pausing for a duration given by the "Pause"
+ * random variable, then it moves towards a waypoint picked by the PositionAllocator at a
+ * speed given by the "Speed" random variable, and it pauses again when it reaches the
+ * waypoint. Since the legs start at the steps of the engine, the pauses are rounded up to
+ * the time step of the engine. Otherwise, the model moves at the constant velocity set by
+ * SetVelocity.
+ */
+class SteppedMobilityModel : public MobilityModel
+{
+  public:
+    /**
+     * Register this type with the TypeId system.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    SteppedMobilityModel();
+    ~SteppedMobilityModel() override;
+
+    /**
+     * Set the velocity of the model, which does not change until it is set again.
+     * This method should not be used if the "PositionAllocator" attribute is set.
+     * @param velocity the new velocity, in m/s
+     */
+    void SetVelocity(const Vector& velocity);
+
+    /**
+     * @return the engine storing the state of the model
+     */
+    Ptr<SteppedMobilityEngine> GetEngine() const;
+
+    /**
+     * @return the index of the model in the arrays of the engine, which can be used to
+     *         retrieve the position of the model from the vector filled by
+     *         SteppedMobilityEngine::GetPositions
+     */
+    uint32_t GetIndex() const;
+
+  protected:
+    void NotifyConstructionCompleted() override;
+    void DoInitialize() override;
+    void DoDispose() override;
+
+  private:
+    friend class SteppedMobilityEngine;
+
+    /**
+     * Set the engine storing the state of the model, moving the model to the new engine
+     * if it is already registered with another one.
+     * @param engine the engine
+     */
+    void SetEngine(Ptr<SteppedMobilityEngine> engine);
+
+    /**
+     * Called by the engine when the current leg of the model ended.
+     */
+    void NotifyLegEnd();
+
+    /**
+     * Pick a waypoint and begin moving towards it
+     */
+    void BeginWalk();
+
+    /**
+     * Begin a pause
+     */
+    void BeginPause();
+
+    Vector DoGetPosition() const override;
+    void DoSetPosition(const Vector& position) override;
+    Vector DoGetVelocity() const override;
+    int64_t DoAssignStreams(int64_t) override;
+
+    Ptr<SteppedMobilityEngine> m_engine; //!< the engine storing the state of the model
+    uint32_t m_index{0};                 //!< the index of the model in the engine
+    bool m_registered{false};            //!< whether the model is registered with the engine
+    bool m_walking{false};               //!< whether the model is moving towards a waypoint
+    Ptr<PositionAllocator> m_position;   //!< pointer to position allocator
+    Ptr<RandomVariableStream> m_speed;   //!< random variable to generate speeds
+    Ptr<RandomVariableStream> m_pause;   //!< random variable to generate pauses
+};
+
+} // namespace ns3
+
+#endif /* STEPPED_MOBILITY_MODEL_H */
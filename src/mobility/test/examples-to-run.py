@@ -10,8 +10,16 @@ cpp_examples = [
     ("main-grid-topology", "True", "True"),
     ("main-random-topology", "True", "True"),
     ("main-random-walk", "True", "True"),
+    (
+        "ns2-mobility-trace-converter --input=../../src/mobility/examples/default.ns_movements "
+        "--output=default.ns_movements.bin",
+        "True",
+        "True",
+    ),
     ("reference-point-group-mobility-example --useHelper=0", "True", "True"),
     ("reference-point-group-mobility-example --useHelper=1", "True", "True"),
+    ("stepped-mobility-benchmark --nNodes=100 --simTime=10", "True", "False"),
+    ("stepped-mobility-benchmark --nNodes=100 --simTime=10 --stepped=0", "True", "False"),
 ]
 
 # A list of Python examples to run in order to ensure that they remain
@@ -111,21 +111,51 @@ class Ns2MobilityHelperTest : public TestCase
         }
     };
 
+    /// How the trace is read
+    enum class Mode
+    {
+        TEXT,      //!< parsed at once by Install ()
+        STREAMING, //!< parsed while the simulation runs
+        BINARY,    //!< converted to the binary format, then streamed
+    };
+
     /**
      * Create new test case. To make it useful SetTrace () and AddReferencePoint () must be called
      *
      * @param name        Short description
      * @param timeLimit   Test time limit
      * @param nodes       Number of nodes used in the test trace, 1 by default
+     * @param mode        How the trace is read, parsed at once by default
      */
-    Ns2MobilityHelperTest(const std::string& name, Time timeLimit, uint32_t nodes = 1)
+    Ns2MobilityHelperTest(const std::string& name,
+                          Time timeLimit,
+                          uint32_t nodes = 1,
+                          Mode mode = Mode::TEXT)
         : TestCase(name),
           m_timeLimit(timeLimit),
           m_nodeCount(nodes),
+          m_mode(mode),
           m_nextRefPoint(0)
     {
     }
 
+    /**
+     * Create a test case with the same trace and reference, read in another mode
+     * @param mode how the trace is read
+     * @return the new test case
+     */
+    Ns2MobilityHelperTest* Copy(Mode mode) const
+    {
+        auto t = new Ns2MobilityHelperTest(
+            GetName() + (mode == Mode::STREAMING ? " (streaming)" : " (binary)"),
+            m_timeLimit,
+            m_nodeCount,
+            mode);
+        t->m_trace = m_trace;
+        t->m_reference = m_reference;
+        return t;
+    }
+
     /// Empty
     ~Ns2MobilityHelperTest() override
     {
@@ -166,6 +196,8 @@ class Ns2MobilityHelperTest : public TestCase
     Time m_timeLimit;
     /// Number of nodes used in the test
     uint32_t m_nodeCount;
+    /// How the trace is read
+    Mode m_mode;
     /// Trace as string
     std::string m_trace;
     /// Reference mobility
@@ -294,7 +326,14 @@ class Ns2MobilityHelperTest : public TestCase
         {
             return;
         }
-        Ns2MobilityHelper mobility(m_traceFile);
+        std::string traceFile = m_traceFile;
+        if (m_mode == Mode::BINARY)
+        {
+            traceFile = CreateTempDirFilename("Ns2MobilityHelperTest.bin");
+            Ns2MobilityHelper::ConvertToBinary(m_traceFile, traceFile);
+        }
+        Ns2MobilityHelper mobility(traceFile);
+        mobility.SetStreaming(m_mode == Mode::STREAMING);
         mobility.Install();
         if (CheckInitialPositions())
         {
@@ -314,6 +353,24 @@ class Ns2MobilityHelperTest : public TestCase
  */
 class Ns2MobilityHelperTestSuite : public TestSuite
 {
+    /**
+     * Add a test case, and copies of it reading the trace in the streaming mode and in the
+     * binary format
+     * @param t the test case
+     * @param streaming whether the trace can be read in the streaming mode, i.e., whether
+     *        its initial positions precede its timed statements, sorted by time
+     */
+    void AddTestCases(Ns2MobilityHelperTest* t, bool streaming = true)
+    {
+        AddTestCase(t, TestCase::Duration::QUICK);
+        if (streaming)
+        {
+            AddTestCase(t->Copy(Ns2MobilityHelperTest::Mode::STREAMING),
+                        TestCase::Duration::QUICK);
+        }
+        AddTestCase(t->Copy(Ns2MobilityHelperTest::Mode::BINARY), TestCase::Duration::QUICK);
+    }
+
   public:
     Ns2MobilityHelperTestSuite()
         : TestSuite("mobility-ns2-trace-helper", Type::UNIT)
@@ -330,7 +387,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
                     "$node_(0) set Y_ 2.0\n"
                     "$node_(0) set Z_ 3.0\n");
         t->AddReferencePoint("0", 0, Vector(1, 2, 3), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
 
         // Check parsing comments, empty lines and no EOF at the end of file
         t = new Ns2MobilityHelperTest("comments", Seconds(1));
@@ -341,7 +398,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
                     "$node_(0) set Z_ 3.0 # $node_(0) set Z_ 3.0\n"
                     "#$node_(0) set Z_ 100 #");
         t->AddReferencePoint("0", 0, Vector(1, 2, 3), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
 
         // Simple setdest. Arguments are interpreted as x, y, speed by default
         t = new Ns2MobilityHelperTest("simple setdest", Seconds(10));
@@ -350,7 +407,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
         t->AddReferencePoint("0", 0, Vector(0, 0, 0), Vector(0, 0, 0));
         t->AddReferencePoint("0", 1, Vector(0, 0, 0), Vector(5, 0, 0));
         t->AddReferencePoint("0", 6, Vector(25, 0, 0), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
 
         // Several set and setdest. Arguments are interpreted as x, y, speed by default
         t = new Ns2MobilityHelperTest("square setdest", Seconds(6));
@@ -370,7 +427,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
         t->AddReferencePoint("0", 4, Vector(0, 5, 0), Vector(0, 0, 0));
         t->AddReferencePoint("0", 4, Vector(0, 5, 0), Vector(0, -5, 0));
         t->AddReferencePoint("0", 5, Vector(0, 0, 0), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
 
         // Copy of previous test case but with the initial positions at
         // the end of the trace rather than at the beginning.
@@ -393,7 +450,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
         t->AddReferencePoint("0", 4, Vector(10, 15, 0), Vector(0, 0, 0));
         t->AddReferencePoint("0", 4, Vector(10, 15, 0), Vector(0, -5, 0));
         t->AddReferencePoint("0", 5, Vector(10, 10, 0), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t, false);
 
         // Scheduled set position
         t = new Ns2MobilityHelperTest("scheduled set position", Seconds(2));
@@ -404,7 +461,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
         t->AddReferencePoint("0", 1, Vector(10, 0, 0), Vector(0, 0, 0));
         t->AddReferencePoint("0", 1, Vector(10, 0, 10), Vector(0, 0, 0));
         t->AddReferencePoint("0", 1, Vector(10, 10, 10), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
 
         // Malformed lines
         t = new Ns2MobilityHelperTest("malformed lines", Seconds(2));
@@ -420,7 +477,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
         t->AddReferencePoint("0", 0, Vector(1, 2, 3), Vector(0, 0, 0));
         t->AddReferencePoint("0", 1, Vector(1, 2, 3), Vector(1, 0, 0));
         t->AddReferencePoint("0", 2, Vector(2, 2, 3), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
 
         // Non possible values
         t = new Ns2MobilityHelperTest("non possible values", Seconds(2));
@@ -441,7 +498,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
         t->AddReferencePoint("0", 0, Vector(1, 2, 3), Vector(0, 0, 0));
         t->AddReferencePoint("0", 1, Vector(1, 2, 3), Vector(1, 0, 0));
         t->AddReferencePoint("0", 2, Vector(2, 2, 3), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
 
         // More than one node
         t = new Ns2MobilityHelperTest("few nodes, combinations of set and setdest", Seconds(10), 3);
@@ -469,7 +526,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
         t->AddReferencePoint("2", 4, Vector(0, 5, 0), Vector(0, 0, 0));
         t->AddReferencePoint("2", 4, Vector(0, 5, 0), Vector(0, -5, 0));
         t->AddReferencePoint("2", 5, Vector(0, 0, 0), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t, false);
 
         // Test for Speed == 0, that acts as stop the node.
         t = new Ns2MobilityHelperTest("setdest with speed cero", Seconds(10));
@@ -480,7 +537,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
         t->AddReferencePoint("0", 1, Vector(0, 0, 0), Vector(5, 0, 0));
         t->AddReferencePoint("0", 6, Vector(25, 0, 0), Vector(0, 0, 0));
         t->AddReferencePoint("0", 7, Vector(25, 0, 0), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
 
         // Test negative positions
         t = new Ns2MobilityHelperTest("test negative positions", Seconds(10));
@@ -494,7 +551,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
         t->AddReferencePoint("0", 2, Vector(0, 0, 0), Vector(0, 0, 0));
         t->AddReferencePoint("0", 2, Vector(0, 0, 0), Vector(0, -1, 0));
         t->AddReferencePoint("0", 3, Vector(0, -1, 0), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
 
         // Square setdest with values in the form 1.0e+2
         t = new Ns2MobilityHelperTest("Foalt numbers in 1.0e+2 format", Seconds(6));
@@ -514,7 +571,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
         t->AddReferencePoint("0", 4, Vector(0, 100, 0), Vector(0, 0, 0));
         t->AddReferencePoint("0", 4, Vector(0, 100, 0), Vector(0, -100, 0));
         t->AddReferencePoint("0", 5, Vector(0, 0, 0), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
         t = new Ns2MobilityHelperTest("Bug 1219 testcase", Seconds(16));
         t->SetTrace("$node_(0) set X_ 0.0\n"
                     "$node_(0) set Y_ 0.0\n"
@@ -525,13 +582,13 @@ class Ns2MobilityHelperTestSuite : public TestSuite
         t->AddReferencePoint("0", 1, Vector(0, 0, 0), Vector(0, 1, 0));
         t->AddReferencePoint("0", 6, Vector(0, 5, 0), Vector(0, -1, 0));
         t->AddReferencePoint("0", 16, Vector(0, -10, 0), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
         t = new Ns2MobilityHelperTest("Bug 1059 testcase", Seconds(16));
         t->SetTrace("$node_(0) set X_ 10.0\r\n"
                     "$node_(0) set Y_ 0.0\r\n");
         //                     id  t  position         velocity
         t->AddReferencePoint("0", 0, Vector(10, 0, 0), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
         t = new Ns2MobilityHelperTest("Bug 1301 testcase", Seconds(16));
         t->SetTrace("$node_(0) set X_ 10.0\n"
                     "$node_(0) set Y_ 0.0\n"
@@ -540,7 +597,7 @@ class Ns2MobilityHelperTestSuite : public TestSuite
         // Moving to the current position must change nothing. No NaN
         // speed must be.
         t->AddReferencePoint("0", 0, Vector(10, 0, 0), Vector(0, 0, 0));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
 
         t = new Ns2MobilityHelperTest("Bug 1316 testcase", Seconds(1000));
         t->SetTrace("$node_(0) set X_ 350.00000000000000\n"
@@ -605,6 +662,6 @@ class Ns2MobilityHelperTestSuite : public TestSuite
                              920.000,
                              Vector(300.000, 650.000, 0.000),
                              Vector(0.000, 0.000, 0.000));
-        AddTestCase(t, TestCase::Duration::QUICK);
+        AddTestCases(t);
     }
 } g_ns2TransmobilityHelperTestSuite; ///< the test suite
@@ -0,0 +1,365 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/double.h"
+#include "ns3/pointer.h"
+#include "ns3/position-allocator.h"
+#include "ns3/simulator.h"
+#include "ns3/stepped-mobility-engine.h"
+#include "ns3/stepped-mobility-model.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * @ingroup mobility-test
+ *
+ * @brief Check that SteppedMobilityModel instances moving at constant velocity are at the
+ * same positions as ConstantVelocityMobilityModel instances, both between and at the steps
+ * of the engine, and that the bulk positions match those of each model.
+ */
+class SteppedMobilityConstantVelocityTestCase : public TestCase
+{
+  public:
+    SteppedMobilityConstantVelocityTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the positions and the velocities of the models
+     */
+    void CheckPositions();
+
+    /**
+     * Change the position and the velocity of the models
+     * @param index the index of the models in the vectors
+     * @param position the new position
+     * @param velocity the new velocity
+     */
+    void Move(size_t index, const Vector& position, const Vector& velocity);
+
+    Ptr<SteppedMobilityEngine> m_engine;                   //!< the engine
+    std::vector<Ptr<SteppedMobilityModel>> m_stepped;      //!< the models under test
+    std::vector<Ptr<ConstantVelocityMobilityModel>> m_ref; //!< the reference models
+};
+
+SteppedMobilityConstantVelocityTestCase::SteppedMobilityConstantVelocityTestCase()
+    : TestCase("Check the SteppedMobilityModel moving at constant velocity")
+{
+}
+
+void
+SteppedMobilityConstantVelocityTestCase::CheckPositions()
+{
+    std::vector<Vector> positions;
+    m_engine->GetPositions(positions);
+    for (size_t i = 0; i < m_stepped.size(); i++)
+    {
+        Vector expected = m_ref[i]->GetPosition();
+        Vector position = m_stepped[i]->GetPosition();
+        NS_TEST_EXPECT_MSG_LT(CalculateDistance(position, expected),
+                              1e-9,
+                              "Unexpected position of model " << i << " at "
+                                                              << Simulator::Now().As(Time::S));
+        NS_TEST_EXPECT_MSG_LT(CalculateDistance(positions[m_stepped[i]->GetIndex()], expected),
+                              1e-9,
+                              "Unexpected bulk position of model " << i);
+        NS_TEST_EXPECT_MSG_LT(
+            CalculateDistance(m_stepped[i]->GetVelocity(), m_ref[i]->GetVelocity()),
+            1e-9,
+            "Unexpected velocity of model " << i);
+    }
+}
+
+void
+SteppedMobilityConstantVelocityTestCase::Move(size_t index,
+                                              const Vector& position,
+                                              const Vector& velocity)
+{
+    m_stepped[index]->SetPosition(position);
+    m_stepped[index]->SetVelocity(velocity);
+    m_ref[index]->SetPosition(position);
+    m_ref[index]->SetVelocity(velocity);
+}
+
+void
+SteppedMobilityConstantVelocityTestCase::DoRun()
+{
+    m_engine = CreateObject<SteppedMobilityEngine>();
+    m_engine->SetAttribute("TimeStep", TimeValue(MilliSeconds(100)));
+
+    std::vector<std::pair<Vector, Vector>> initial{{Vector(0, 0, 0), Vector(1, 0, 0)},
+                                                   {Vector(10, -5, 1.5), Vector(-3, 4, 0)},
+                                                   {Vector(2, 2, 2), Vector(0, 0, 0)},
+                                                   {Vector(-1, 7, 0), Vector(0.3, -0.7, 0.1)}};
+    for (const auto& [position, velocity] : initial)
+    {
+        m_stepped.push_back(CreateObjectWithAttributes<SteppedMobilityModel>(
+            "Engine",
+            PointerValue(m_engine)));
+        m_ref.push_back(CreateObject<ConstantVelocityMobilityModel>());
+        Move(m_stepped.size() - 1, position, velocity);
+    }
+    NS_TEST_ASSERT_MSG_EQ(m_engine->GetNModels(), initial.size(), "Unexpected number of models");
+
+    for (double t : {0.0, 0.05, 0.1, 0.33, 1.0, 1.26, 2.57, 3.0})
+    {
+        Simulator::Schedule(Seconds(t),
+                            &SteppedMobilityConstantVelocityTestCase::CheckPositions,
+                            this);
+    }
+    // change the course of a model between two steps and of another model at a step
+    Simulator::Schedule(Seconds(1.25),
+                        &SteppedMobilityConstantVelocityTestCase::Move,
+                        this,
+                        1,
+                        Vector(3, 3, 3),
+                        Vector(0, 2, -1));
+    Simulator::Schedule(Seconds(2),
+                        &SteppedMobilityConstantVelocityTestCase::Move,
+                        this,
+                        2,
+                        Vector(2, 2, 2),
+                        Vector(5, 0, 0));
+    Simulator::Stop(Seconds(3.5));
+    Simulator::Run();
+
+    // the index of a disposed model is reused
+    uint32_t index = m_stepped[1]->GetIndex();
+    m_stepped[1]->Dispose();
+    NS_TEST_EXPECT_MSG_EQ(m_engine->GetNModels(), initial.size() - 1, "Model not removed");
+    Ptr<SteppedMobilityModel> model =
+        CreateObjectWithAttributes<SteppedMobilityModel>("Engine", PointerValue(m_engine));
+    NS_TEST_EXPECT_MSG_EQ(model->GetIndex(), index, "The free index should be reused");
+    NS_TEST_EXPECT_MSG_EQ(model->GetVelocity(), Vector(0, 0, 0), "A new model is at rest");
+
+    Simulator::Destroy();
+    m_stepped.clear();
+    m_ref.clear();
+    m_engine = nullptr;
+}
+
+/**
+ * @ingroup mobility-test
+ *
+ * @brief Check the waypoints, the pauses and the course changes of a SteppedMobilityModel
+ * moving as a random waypoint model, with the legs starting at the steps of the engine.
+ */
+class SteppedMobilityWaypointTestCase : public TestCase
+{
+  public:
+    SteppedMobilityWaypointTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the position and the velocity of the model
+     * @param position the expected position
+     * @param velocity the expected velocity
+     */
+    void Check(Vector position, Vector velocity);
+
+    /**
+     * Course change callback
+     * @param model the mobility model
+     */
+    void CourseChange(Ptr<const MobilityModel> model);
+
+    Ptr<SteppedMobilityModel> m_model; //!< the model under test
+    uint32_t m_courseChanges{0};       //!< the number of course changes
+};
+
+SteppedMobilityWaypointTestCase::SteppedMobilityWaypointTestCase()
+    : TestCase("Check the SteppedMobilityModel moving through waypoints")
+{
+}
+
+void
+SteppedMobilityWaypointTestCase::Check(Vector position, Vector velocity)
+{
+    NS_TEST_EXPECT_MSG_LT(CalculateDistance(m_model->GetPosition(), position),
+                          1e-9,
+                          "Unexpected position at " << Simulator::Now().As(Time::S));
+    NS_TEST_EXPECT_MSG_LT(CalculateDistance(m_model->GetVelocity(), velocity),
+                          1e-9,
+                          "Unexpected velocity at " << Simulator::Now().As(Time::S));
+}
+
+void
+SteppedMobilityWaypointTestCase::CourseChange(Ptr<const MobilityModel> model)
+{
+    m_courseChanges++;
+}
+
+void
+SteppedMobilityWaypointTestCase::DoRun()
+{
+    Ptr<SteppedMobilityEngine> engine = CreateObject<SteppedMobilityEngine>();
+    engine->SetAttribute("TimeStep", TimeValue(MilliSeconds(100)));
+
+    Ptr<ListPositionAllocator> waypoints = CreateObject<ListPositionAllocator>();
+    waypoints->Add(Vector(10, 0, 0));
+    waypoints->Add(Vector(10, 10, 0));
+
+    m_model = CreateObjectWithAttributes<SteppedMobilityModel>(
+        "Engine",
+        PointerValue(engine),
+        "PositionAllocator",
+        PointerValue(waypoints),
+        "Speed",
+        StringValue("ns3::ConstantRandomVariable[Constant=10.0]"),
+        "Pause",
+        StringValue("ns3::ConstantRandomVariable[Constant=0.95]"));
+    m_model->TraceConnectWithoutContext(
+        "CourseChange",
+        MakeCallback(&SteppedMobilityWaypointTestCase::CourseChange, this));
+    m_model->SetPosition(Vector(0, 0, 0));
+    m_model->Initialize();
+
+    // the pauses of 0.95 s end at the next step, hence the model walks in [1, 2] s and
+    // in [3, 4] s
+    Simulator::Schedule(Seconds(0.5),
+                        &SteppedMobilityWaypointTestCase::Check,
+                        this,
+                        Vector(0, 0, 0),
+                        Vector(0, 0, 0));
+    Simulator::Schedule(Seconds(0.97),
+                        &SteppedMobilityWaypointTestCase::Check,
+                        this,
+                        Vector(0, 0, 0),
+                        Vector(0, 0, 0));
+    Simulator::Schedule(Seconds(1.5),
+                        &SteppedMobilityWaypointTestCase::Check,
+                        this,
+                        Vector(5, 0, 0),
+                        Vector(10, 0, 0));
+    Simulator::Schedule(Seconds(2.5),
+                        &SteppedMobilityWaypointTestCase::Check,
+                        this,
+                        Vector(10, 0, 0),
+                        Vector(0, 0, 0));
+    Simulator::Schedule(Seconds(3.25),
+                        &SteppedMobilityWaypointTestCase::Check,
+                        this,
+                        Vector(10, 2.5, 0),
+                        Vector(0, 10, 0));
+    Simulator::Schedule(Seconds(4.5),
+                        &SteppedMobilityWaypointTestCase::Check,
+                        this,
+                        Vector(10, 10, 0),
+                        Vector(0, 0, 0));
+    Simulator::Stop(Seconds(4.5));
+    Simulator::Run();
+
+    // position set, initial pause, walk, pause, walk, pause
+    NS_TEST_EXPECT_MSG_EQ(m_courseChanges, 6, "Unexpected number of course changes");
+
+    Simulator::Destroy();
+    m_model = nullptr;
+}
+
+/**
+ * @ingroup mobility-test
+ *
+ * @brief Check that the SteppedMobilityEngine only schedules time steps while the leg of a
+ * model has to end, so that the simulation ends when all the models are at rest
+ */
+class SteppedMobilityIdleTestCase : public TestCase
+{
+  public:
+    SteppedMobilityIdleTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Record a time step.
+     * @param nModels the number of models advanced by the step
+     * @param nLegsEnded the number of models whose leg ended during the step
+     */
+    void Step(uint32_t nModels, uint32_t nLegsEnded);
+
+    uint32_t m_steps{0};     //!< the number of time steps
+    uint32_t m_legsEnded{0}; //!< the number of legs that ended
+};
+
+SteppedMobilityIdleTestCase::SteppedMobilityIdleTestCase()
+    : TestCase("Check that the SteppedMobilityEngine stops stepping when no leg has to end")
+{
+}
+
+void
+SteppedMobilityIdleTestCase::Step(uint32_t nModels, uint32_t nLegsEnded)
+{
+    m_steps++;
+    m_legsEnded += nLegsEnded;
+}
+
+void
+SteppedMobilityIdleTestCase::DoRun()
+{
+    Ptr<SteppedMobilityEngine> engine = CreateObject<SteppedMobilityEngine>();
+    engine->SetAttribute("TimeStep", TimeValue(MilliSeconds(100)));
+    engine->TraceConnectWithoutContext("Step",
+                                       MakeCallback(&SteppedMobilityIdleTestCase::Step, this));
+
+    std::vector<Ptr<SteppedMobilityModel>> models;
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        models.push_back(
+            CreateObjectWithAttributes<SteppedMobilityModel>("Engine", PointerValue(engine)));
+    }
+    // a model moving indefinitely does not need any step
+    models[1]->SetVelocity(Vector(1, 0, 0));
+
+    // models at rest or moving indefinitely do not keep the simulation running
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(m_steps, 0, "No step expected without legs ending");
+
+    // a leg ending schedules the steps until it ends, and the steps resume with the next leg
+    Simulator::Schedule(Seconds(1), [engine, &models]() {
+        engine->SetVelocity(models[0]->GetIndex(), Vector(0, 2, 0), MilliSeconds(250));
+    });
+    Simulator::Schedule(Seconds(2), [engine, &models]() {
+        engine->SetVelocity(models[2]->GetIndex(), Vector(0, 0, 0), MilliSeconds(100));
+    });
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), Seconds(2.1), "Unexpected end of the simulation");
+    NS_TEST_EXPECT_MSG_EQ(m_steps, 4, "Unexpected number of steps");
+    NS_TEST_EXPECT_MSG_EQ(m_legsEnded, 2, "Unexpected number of legs ended");
+    NS_TEST_EXPECT_MSG_LT(CalculateDistance(models[0]->GetPosition(), Vector(0, 0.5, 0)),
+                          1e-9,
+                          "Unexpected position at the end of the leg");
+    NS_TEST_EXPECT_MSG_LT(CalculateDistance(models[1]->GetPosition(), Vector(2.1, 0, 0)),
+                          1e-9,
+                          "Unexpected position of the model moving indefinitely");
+
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup mobility-test
+ *
+ * @brief SteppedMobilityEngine Test Suite
+ */
+class SteppedMobilityEngineTestSuite : public TestSuite
+{
+  public:
+    SteppedMobilityEngineTestSuite();
+};
+
+SteppedMobilityEngineTestSuite::SteppedMobilityEngineTestSuite()
+    : TestSuite("stepped-mobility-engine", Type::UNIT)
+{
+    AddTestCase(new SteppedMobilityConstantVelocityTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new SteppedMobilityWaypointTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new SteppedMobilityIdleTestCase, TestCase::Duration::QUICK);
+}
+
+static SteppedMobilityEngineTestSuite g_steppedMobilityEngineTestSuite; //!< the test suite
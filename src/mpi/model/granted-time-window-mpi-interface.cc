@@ -18,6 +18,7 @@
 #include "mpi-interface.h"
 #include "mpi-receiver.h"
 
+#include "ns3/abort.h"
 #include "ns3/log.h"
 #include "ns3/net-device.h"
 #include "ns3/node-list.h"
@@ -26,6 +27,7 @@
 #include "ns3/simulator-impl.h"
 #include "ns3/simulator.h"
 
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <list>
@@ -38,6 +40,14 @@ NS_LOG_COMPONENT_DEFINE("GrantedTimeWindowMpiInterface");
 
 NS_OBJECT_ENSURE_REGISTERED(GrantedTimeWindowMpiInterface);
 
+/**
+ * Size of the header preceding each packet in an MPI message: the size of the
+ * serialized packet, the receive time, the destination node and the
+ * destination device.
+ */
+const uint32_t MPI_PACKET_HEADER_SIZE =
+    sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uint32_t);
+
 SentBuffer::SentBuffer()
 {
     m_buffer = nullptr;
@@ -74,6 +84,9 @@ bool GrantedTimeWindowMpiInterface::g_mpiInitCalled = false;
 uint32_t GrantedTimeWindowMpiInterface::g_rxCount = 0;
 uint32_t GrantedTimeWindowMpiInterface::g_txCount = 0;
 std::list<SentBuffer> GrantedTimeWindowMpiInterface::g_pendingTx;
+std::vector<uint8_t*> GrantedTimeWindowMpiInterface::g_aggregateBuffers;
+std::vector<uint32_t> GrantedTimeWindowMpiInterface::g_aggregateSizes;
+std::vector<uint8_t*> GrantedTimeWindowMpiInterface::g_freeBuffers;
 
 MPI_Request* GrantedTimeWindowMpiInterface::g_requests;
 char** GrantedTimeWindowMpiInterface::g_pRxBuffers;
@@ -101,6 +114,18 @@ GrantedTimeWindowMpiInterface::Destroy()
     delete[] g_requests;
 
     g_pendingTx.clear();
+
+    for (auto buffer : g_aggregateBuffers)
+    {
+        delete[] buffer;
+    }
+    g_aggregateBuffers.clear();
+    g_aggregateSizes.clear();
+    for (auto buffer : g_freeBuffers)
+    {
+        delete[] buffer;
+    }
+    g_freeBuffers.clear();
 }
 
 uint32_t
@@ -181,6 +206,8 @@ GrantedTimeWindowMpiInterface::Enable(MPI_Comm communicator)
     g_size = mpiSize;
 
     g_enabled = true;
+    g_aggregateBuffers.assign(g_size, nullptr);
+    g_aggregateSizes.assign(g_size, 0);
     // Post a non-blocking receive for all peers
     g_pRxBuffers = new char*[g_size];
     g_requests = new MPI_Request[g_size];
@@ -205,35 +232,91 @@ GrantedTimeWindowMpiInterface::SendPacket(Ptr<Packet> p,
 {
     NS_LOG_FUNCTION(this << p << rxTime.GetTimeStep() << node << dev);
 
-    SentBuffer sendBuf;
-    g_pendingTx.push_back(sendBuf);
-    auto i = g_pendingTx.rbegin(); // Points to the last element
-
     uint32_t serializedSize = p->GetSerializedSize();
-    auto buffer = new uint8_t[serializedSize + 16];
-    i->SetBuffer(buffer);
-    // Add the time, dest node and dest device
-    uint64_t t = rxTime.GetInteger();
-    auto pTime = reinterpret_cast<uint64_t*>(buffer);
-    *pTime++ = t;
-    auto pData = reinterpret_cast<uint32_t*>(pTime);
-    *pData++ = node;
-    *pData++ = dev;
-    // Serialize the packet
-    p->Serialize(reinterpret_cast<uint8_t*>(pData), serializedSize);
+    uint32_t recordSize = MPI_PACKET_HEADER_SIZE + serializedSize;
+    NS_ABORT_MSG_IF(recordSize > MAX_MPI_MSG_SIZE,
+                    "Packet of " << serializedSize << " bytes exceeds the MPI message size");
 
     // Find the system id for the destination node
     Ptr<Node> destNode = NodeList::GetNode(node);
     uint32_t nodeSysId = destNode->GetSystemId();
 
+    // Packets are aggregated per destination task and sent at the end of the
+    // granted time window, or as soon as the message would exceed the max size
+    if (g_aggregateSizes[nodeSysId] + recordSize > MAX_MPI_MSG_SIZE)
+    {
+        FlushSendBuffer(nodeSysId);
+    }
+    if (g_aggregateBuffers[nodeSysId] == nullptr)
+    {
+        g_aggregateBuffers[nodeSysId] = AllocateSendBuffer();
+    }
+
+    // Add the size, time, dest node and dest device
+    uint8_t* buffer = g_aggregateBuffers[nodeSysId] + g_aggregateSizes[nodeSysId];
+    uint64_t t = rxTime.GetInteger();
+    std::memcpy(buffer, &serializedSize, sizeof(serializedSize));
+    buffer += sizeof(serializedSize);
+    std::memcpy(buffer, &t, sizeof(t));
+    buffer += sizeof(t);
+    std::memcpy(buffer, &node, sizeof(node));
+    buffer += sizeof(node);
+    std::memcpy(buffer, &dev, sizeof(dev));
+    buffer += sizeof(dev);
+    // Serialize the packet straight into the message
+    p->Serialize(buffer, serializedSize);
+
+    g_aggregateSizes[nodeSysId] += recordSize;
+}
+
+uint8_t*
+GrantedTimeWindowMpiInterface::AllocateSendBuffer()
+{
+    if (g_freeBuffers.empty())
+    {
+        return new uint8_t[MAX_MPI_MSG_SIZE];
+    }
+    uint8_t* buffer = g_freeBuffers.back();
+    g_freeBuffers.pop_back();
+    return buffer;
+}
+
+void
+GrantedTimeWindowMpiInterface::FlushSendBuffer(uint32_t sid)
+{
+    NS_LOG_FUNCTION(sid);
+
+    if (g_aggregateSizes[sid] == 0)
+    {
+        return;
+    }
+
+    g_pendingTx.emplace_back();
+    auto i = g_pendingTx.rbegin(); // Points to the last element
+    i->SetBuffer(g_aggregateBuffers[sid]);
+
     MPI_Isend(reinterpret_cast<void*>(i->GetBuffer()),
-              serializedSize + 16,
+              g_aggregateSizes[sid],
               MPI_CHAR,
-              nodeSysId,
+              sid,
               0,
               g_communicator,
               (i->GetRequest()));
     g_txCount++;
+
+    g_aggregateBuffers[sid] = nullptr;
+    g_aggregateSizes[sid] = 0;
+}
+
+void
+GrantedTimeWindowMpiInterface::FlushSendBuffers()
+{
+    NS_LOG_FUNCTION_NOARGS();
+
+    for (uint32_t sid = 0; sid < g_aggregateSizes.size(); ++sid)
+    {
+        FlushSendBuffer(sid);
+    }
 }
 
 void
@@ -257,41 +340,53 @@ GrantedTimeWindowMpiInterface::ReceiveMessages()
         MPI_Get_count(&status, MPI_CHAR, &count);
         g_rxCount++; // Count this receive
 
-        // Get the meta data first
-        auto pTime = reinterpret_cast<uint64_t*>(g_pRxBuffers[index]);
-        uint64_t time = *pTime++;
-        auto pData = reinterpret_cast<uint32_t*>(pTime);
-        uint32_t node = *pData++;
-        uint32_t dev = *pData++;
-
-        Time rxTime(time);
-
-        count -= sizeof(time) + sizeof(node) + sizeof(dev);
-
-        Ptr<Packet> p = Create<Packet>(reinterpret_cast<uint8_t*>(pData), count, true);
-
-        // Find the correct node/device to schedule receive event
-        Ptr<Node> pNode = NodeList::GetNode(node);
-        Ptr<MpiReceiver> pMpiRec = nullptr;
-        uint32_t nDevices = pNode->GetNDevices();
-        for (uint32_t i = 0; i < nDevices; ++i)
+        // A message carries one or more packets, each preceded by its meta data
+        auto pData = reinterpret_cast<uint8_t*>(g_pRxBuffers[index]);
+        auto pEnd = pData + count;
+        while (pData < pEnd)
         {
-            Ptr<NetDevice> pThisDev = pNode->GetDevice(i);
-            if (pThisDev->GetIfIndex() == dev)
+            uint32_t size;
+            uint64_t time;
+            uint32_t node;
+            uint32_t dev;
+            std::memcpy(&size, pData, sizeof(size));
+            pData += sizeof(size);
+            std::memcpy(&time, pData, sizeof(time));
+            pData += sizeof(time);
+            std::memcpy(&node, pData, sizeof(node));
+            pData += sizeof(node);
+            std::memcpy(&dev, pData, sizeof(dev));
+            pData += sizeof(dev);
+
+            Time rxTime(time);
+
+            Ptr<Packet> p = Create<Packet>(pData, size, true);
+            pData += size;
+
+            // Find the correct node/device to schedule receive event
+            Ptr<Node> pNode = NodeList::GetNode(node);
+            Ptr<MpiReceiver> pMpiRec = nullptr;
+            uint32_t nDevices = pNode->GetNDevices();
+            for (uint32_t i = 0; i < nDevices; ++i)
             {
-                pMpiRec = pThisDev->GetObject<MpiReceiver>();
-                break;
+                Ptr<NetDevice> pThisDev = pNode->GetDevice(i);
+                if (pThisDev->GetIfIndex() == dev)
+                {
+                    pMpiRec = pThisDev->GetObject<MpiReceiver>();
+                    break;
+                }
             }
-        }
 
-        NS_ASSERT(pNode && pMpiRec);
+            NS_ASSERT(pNode && pMpiRec);
 
-        // Schedule the rx event
-        Simulator::ScheduleWithContext(pNode->GetId(),
-                                       rxTime - Simulator::Now(),
-                                       &MpiReceiver::Receive,
-                                       pMpiRec,
-                                       p);
+            // Schedule the rx event
+            Simulator::ScheduleWithContext(pNode->GetId(),
+                                           rxTime - Simulator::Now(),
+                                           &MpiReceiver::Receive,
+                                           pMpiRec,
+                                           p);
+        }
+        NS_ASSERT(pData == pEnd);
 
         // Re-queue the next read
         MPI_Irecv(g_pRxBuffers[index],
@@ -318,7 +413,9 @@ GrantedTimeWindowMpiInterface::TestSendComplete()
         auto current = i; // Save current for erasing
         i++;              // Advance to next
         if (flag)
-        { // This message is complete
+        { // This message is complete, recycle its buffer
+            g_freeBuffers.push_back(current->GetBuffer());
+            current->SetBuffer(nullptr);
             g_pendingTx.erase(current);
         }
     }
@@ -24,15 +24,17 @@
 #include <list>
 #include <mpi.h>
 #include <stdint.h>
+#include <vector>
 
 namespace ns3
 {
 
 /**
  * maximum MPI message size for easy
- * buffer creation
+ * buffer creation.  Packets sent to the same task within a granted
+ * time window are aggregated in messages of up to this size.
  */
-const uint32_t MAX_MPI_MSG_SIZE = 2000;
+const uint32_t MAX_MPI_MSG_SIZE = 16384;
 
 /**
  * @ingroup mpi
@@ -116,11 +118,26 @@ class GrantedTimeWindowMpiInterface : public ParallelCommunicationInterface, Obj
      */
     static void TestSendComplete();
     /**
-     * @return received count in packets
+     * Send the packets aggregated for every task.  Must be called before
+     * the tx count is used to compute a new granted time window.
+     */
+    static void FlushSendBuffers();
+    /**
+     * Send the packets aggregated for the given task, if any
+     * @param sid the system id of the destination task
+     */
+    static void FlushSendBuffer(uint32_t sid);
+    /**
+     * @return a send buffer of MAX_MPI_MSG_SIZE bytes, taken from the
+     * pool of the buffers of completed sends if possible
+     */
+    static uint8_t* AllocateSendBuffer();
+    /**
+     * @return received count in messages
      */
     static uint32_t GetRxCount();
     /**
-     * @return transmitted count in packets
+     * @return transmitted count in messages
      */
     static uint32_t GetTxCount();
 
@@ -129,10 +146,10 @@ class GrantedTimeWindowMpiInterface : public ParallelCommunicationInterface, Obj
     /** Size of the MPI COM_WORLD group. */
     static uint32_t g_size;
 
-    /** Total packets received. */
+    /** Total messages received. */
     static uint32_t g_rxCount;
 
-    /** Total packets sent. */
+    /** Total messages sent. */
     static uint32_t g_txCount;
 
     /** Has this interface been enabled. */
@@ -153,6 +170,15 @@ class GrantedTimeWindowMpiInterface : public ParallelCommunicationInterface, Obj
     /** List of pending non-blocking sends. */
     static std::list<SentBuffer> g_pendingTx;
 
+    /** Buffer where the packets for each task are being aggregated. */
+    static std::vector<uint8_t*> g_aggregateBuffers;
+
+    /** Number of bytes used in the aggregation buffer of each task. */
+    static std::vector<uint32_t> g_aggregateSizes;
+
+    /** Buffers of completed sends, available for reuse. */
+    static std::vector<uint8_t*> g_freeBuffers;
+
     /** MPI communicator being used for ns-3 tasks. */
     static MPI_Comm g_communicator;
 
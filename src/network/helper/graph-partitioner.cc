@@ -0,0 +1,586 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "graph-partitioner.h"
+
+#include "ns3/abort.h"
+#include "ns3/channel-list.h"
+#include "ns3/channel.h"
+#include "ns3/log.h"
+#include "ns3/net-device.h"
+#include "ns3/node-list.h"
+#include "ns3/node.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <queue>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("GraphPartitioner");
+
+/// Size below which graphs are no further coarsened
+static const uint32_t COARSEST_GRAPH_SIZE = 32;
+/// Cost of cutting an edge that must not be cut
+static const double UNCUTTABLE_COST = 1e12;
+/// Allowed imbalance of a bisection, as a fraction of the target weight of the smaller part
+static const double BALANCE_TOLERANCE = 0.01;
+/// Max number of refinement passes per level
+static const uint32_t MAX_REFINEMENT_PASSES = 8;
+
+GraphPartitioner::GraphPartitioner()
+    : m_minLookahead(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+uint32_t
+GraphPartitioner::AddVertex(double weight)
+{
+    NS_LOG_FUNCTION(this << weight);
+    NS_ABORT_MSG_IF(weight < 0, "Vertex weights cannot be negative");
+    m_vertexWeights.push_back(weight);
+    return m_vertexWeights.size() - 1;
+}
+
+void
+GraphPartitioner::AddEdge(uint32_t a, uint32_t b, Time delay, double weight)
+{
+    NS_LOG_FUNCTION(this << a << b << delay << weight);
+    NS_ABORT_MSG_IF(a >= m_vertexWeights.size() || b >= m_vertexWeights.size(),
+                    "Invalid vertex index");
+    NS_ABORT_MSG_IF(weight < 0, "Edge weights cannot be negative");
+    if (a != b)
+    {
+        m_edges.push_back({a, b, delay, weight});
+    }
+}
+
+void
+GraphPartitioner::AddUncuttableEdge(uint32_t a, uint32_t b)
+{
+    NS_LOG_FUNCTION(this << a << b);
+    NS_ABORT_MSG_IF(a >= m_vertexWeights.size() || b >= m_vertexWeights.size(),
+                    "Invalid vertex index");
+    if (a != b)
+    {
+        m_edges.push_back({a, b, Time(0), -1});
+    }
+}
+
+void
+GraphPartitioner::AddNodeList()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ABORT_MSG_IF(!m_vertexWeights.empty(),
+                    "The NodeList must be added to an empty graph, so that vertex indices "
+                    "match node IDs");
+
+    for (uint32_t i = 0; i < NodeList::GetNNodes(); ++i)
+    {
+        AddVertex();
+    }
+
+    for (auto it = ChannelList::Begin(); it != ChannelList::End(); ++it)
+    {
+        Ptr<Channel> channel = *it;
+        std::vector<uint32_t> nodes;
+        for (std::size_t i = 0; i < channel->GetNDevices(); ++i)
+        {
+            Ptr<NetDevice> device = channel->GetDevice(i);
+            if (device && device->GetNode())
+            {
+                nodes.push_back(device->GetNode()->GetId());
+            }
+        }
+
+        TimeValue delay;
+        if (nodes.size() == 2 && channel->GetAttributeFailSafe("Delay", delay))
+        {
+            AddEdge(nodes[0], nodes[1], delay.Get());
+            continue;
+        }
+        for (std::size_t i = 1; i < nodes.size(); ++i)
+        {
+            AddUncuttableEdge(nodes[0], nodes[i]);
+        }
+    }
+}
+
+void
+GraphPartitioner::SetVertexWeight(uint32_t v, double weight)
+{
+    NS_LOG_FUNCTION(this << v << weight);
+    NS_ABORT_MSG_IF(v >= m_vertexWeights.size(), "Invalid vertex index " << v);
+    NS_ABORT_MSG_IF(weight < 0, "Vertex weights cannot be negative");
+    m_vertexWeights[v] = weight;
+}
+
+void
+GraphPartitioner::LoadVertexWeights(const std::string& filename)
+{
+    NS_LOG_FUNCTION(this << filename);
+
+    std::ifstream is(filename);
+    NS_ABORT_MSG_IF(!is.is_open(), "Cannot open file " << filename);
+
+    uint32_t v;
+    double weight;
+    while (is >> v >> weight)
+    {
+        SetVertexWeight(v, weight);
+    }
+    NS_ABORT_MSG_IF(!is.eof(), "Malformed vertex weights file " << filename);
+}
+
+void
+GraphPartitioner::SetMinLookahead(Time lookahead)
+{
+    NS_LOG_FUNCTION(this << lookahead);
+    m_minLookahead = lookahead;
+}
+
+uint32_t
+GraphPartitioner::GetNVertices() const
+{
+    return m_vertexWeights.size();
+}
+
+GraphPartitioner::Graph
+GraphPartitioner::BuildGraph() const
+{
+    Time maxDelay(0);
+    for (const auto& edge : m_edges)
+    {
+        maxDelay = std::max(maxDelay, edge.delay);
+    }
+
+    Graph g;
+    g.vertexWeights = m_vertexWeights;
+    g.adjacency.resize(m_vertexWeights.size());
+    for (const auto& edge : m_edges)
+    {
+        double cost = UNCUTTABLE_COST;
+        if (edge.weight >= 0 && edge.delay.IsStrictlyPositive() && edge.delay >= m_minLookahead)
+        {
+            // short links are more expensive to cut, as they reduce the lookahead
+            cost = edge.weight * maxDelay.GetDouble() / edge.delay.GetDouble();
+        }
+        g.adjacency[edge.a].emplace_back(edge.b, cost);
+        g.adjacency[edge.b].emplace_back(edge.a, cost);
+    }
+    return g;
+}
+
+std::vector<uint32_t>
+GraphPartitioner::Partition(uint32_t nParts) const
+{
+    NS_LOG_FUNCTION(this << nParts);
+    NS_ABORT_MSG_IF(nParts == 0, "The number of partitions must be strictly positive");
+
+    Graph g = BuildGraph();
+    std::vector<uint32_t> vertices(g.vertexWeights.size());
+    std::iota(vertices.begin(), vertices.end(), 0);
+    std::vector<uint32_t> partition(g.vertexWeights.size(), 0);
+    RecursiveBisection(g, nParts, 0, vertices, partition);
+    return partition;
+}
+
+void
+GraphPartitioner::RecursiveBisection(const Graph& g,
+                                     uint32_t nParts,
+                                     uint32_t firstPart,
+                                     const std::vector<uint32_t>& vertices,
+                                     std::vector<uint32_t>& partition)
+{
+    if (nParts == 1 || g.vertexWeights.size() <= 1)
+    {
+        for (auto v : vertices)
+        {
+            partition[v] = firstPart;
+        }
+        return;
+    }
+
+    uint32_t nParts0 = nParts / 2;
+    auto side = Bisect(g, static_cast<double>(nParts0) / nParts);
+
+    // build the subgraphs induced by the two parts
+    Graph sub[2];
+    std::vector<uint32_t> subVertices[2];
+    std::vector<uint32_t> index(g.vertexWeights.size());
+    for (uint32_t v = 0; v < g.vertexWeights.size(); ++v)
+    {
+        index[v] = sub[side[v]].vertexWeights.size();
+        sub[side[v]].vertexWeights.push_back(g.vertexWeights[v]);
+        subVertices[side[v]].push_back(vertices[v]);
+    }
+    for (uint8_t s = 0; s < 2; ++s)
+    {
+        sub[s].adjacency.resize(sub[s].vertexWeights.size());
+    }
+    for (uint32_t v = 0; v < g.vertexWeights.size(); ++v)
+    {
+        for (const auto& [u, cost] : g.adjacency[v])
+        {
+            if (side[u] == side[v])
+            {
+                sub[side[v]].adjacency[index[v]].emplace_back(index[u], cost);
+            }
+        }
+    }
+
+    RecursiveBisection(sub[0], nParts0, firstPart, subVertices[0], partition);
+    RecursiveBisection(sub[1], nParts - nParts0, firstPart + nParts0, subVertices[1], partition);
+}
+
+std::vector<uint8_t>
+GraphPartitioner::Bisect(const Graph& g, double fraction)
+{
+    std::vector<uint8_t> side;
+    Graph coarse;
+    std::vector<uint32_t> map;
+
+    if (g.vertexWeights.size() <= COARSEST_GRAPH_SIZE || !Coarsen(g, coarse, map))
+    {
+        side = InitialBisection(g, fraction);
+    }
+    else
+    {
+        // bisect the coarse graph and project the bisection back
+        auto coarseSide = Bisect(coarse, fraction);
+        side.resize(g.vertexWeights.size());
+        for (uint32_t v = 0; v < g.vertexWeights.size(); ++v)
+        {
+            side[v] = coarseSide[map[v]];
+        }
+    }
+    Refine(g, fraction, side);
+    return side;
+}
+
+bool
+GraphPartitioner::Coarsen(const Graph& g, Graph& coarse, std::vector<uint32_t>& map)
+{
+    const uint32_t n = g.vertexWeights.size();
+    const uint32_t unmatched = std::numeric_limits<uint32_t>::max();
+    double total = std::accumulate(g.vertexWeights.begin(), g.vertexWeights.end(), 0.0);
+    // prevent the creation of vertices too heavy to be balanced
+    double maxWeight = 1.5 * total / COARSEST_GRAPH_SIZE;
+
+    // visit the vertices with fewer neighbors first, as they have fewer matching options
+    std::vector<uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&g](uint32_t a, uint32_t b) {
+        return g.adjacency[a].size() < g.adjacency[b].size();
+    });
+
+    // heavy-edge matching
+    std::vector<uint32_t> match(n, unmatched);
+    for (auto u : order)
+    {
+        if (match[u] != unmatched)
+        {
+            continue;
+        }
+        uint32_t best = u;
+        double bestCost = -1;
+        for (const auto& [v, cost] : g.adjacency[u])
+        {
+            if (match[v] == unmatched && v != u && cost > bestCost &&
+                g.vertexWeights[u] + g.vertexWeights[v] <= maxWeight)
+            {
+                best = v;
+                bestCost = cost;
+            }
+        }
+        match[u] = best;
+        match[best] = u;
+    }
+
+    map.assign(n, unmatched);
+    uint32_t nCoarse = 0;
+    for (uint32_t u = 0; u < n; ++u)
+    {
+        if (map[u] == unmatched)
+        {
+            map[u] = map[match[u]] = nCoarse++;
+        }
+    }
+    if (nCoarse > 0.9 * n)
+    {
+        return false;
+    }
+
+    coarse.vertexWeights.assign(nCoarse, 0);
+    coarse.adjacency.assign(nCoarse, {});
+    std::vector<int64_t> position(nCoarse, -1);
+    for (uint32_t u = 0; u < n; ++u)
+    {
+        uint32_t c = map[u];
+        coarse.vertexWeights[c] += g.vertexWeights[u];
+        if (match[u] < u)
+        {
+            continue; // edges already merged when visiting the matched vertex
+        }
+        // merge the edges of u and of its matched vertex
+        auto& adjacency = coarse.adjacency[c];
+        std::vector<uint32_t> members{u};
+        if (match[u] != u)
+        {
+            members.push_back(match[u]);
+        }
+        for (auto w : members)
+        {
+            for (const auto& [v, cost] : g.adjacency[w])
+            {
+                uint32_t cv = map[v];
+                if (cv == c)
+                {
+                    continue;
+                }
+                if (position[cv] < 0)
+                {
+                    position[cv] = adjacency.size();
+                    adjacency.emplace_back(cv, cost);
+                }
+                else
+                {
+                    adjacency[position[cv]].second += cost;
+                }
+            }
+        }
+        for (const auto& adj : adjacency)
+        {
+            position[adj.first] = -1;
+        }
+    }
+    return true;
+}
+
+std::vector<uint8_t>
+GraphPartitioner::InitialBisection(const Graph& g, double fraction)
+{
+    const uint32_t n = g.vertexWeights.size();
+    double total = std::accumulate(g.vertexWeights.begin(), g.vertexWeights.end(), 0.0);
+    double target = fraction * total;
+
+    std::vector<uint8_t> best;
+    double bestCut = std::numeric_limits<double>::infinity();
+
+    // grow part 0 from a few seeds and keep the best bisection
+    for (uint32_t seed : {0U, n / 4, n / 2, 3 * n / 4})
+    {
+        std::vector<uint8_t> side(n, 1);
+        // cost of the edges towards part 0 minus cost of the edges towards part 1
+        std::vector<double> gain(n, 0);
+        for (uint32_t v = 0; v < n; ++v)
+        {
+            for (const auto& adj : g.adjacency[v])
+            {
+                gain[v] -= adj.second;
+            }
+        }
+        std::priority_queue<std::pair<double, uint32_t>> frontier;
+        frontier.emplace(gain[seed], seed);
+        uint32_t nextUnreached = 0;
+        double weight = 0;
+
+        while (weight < target)
+        {
+            uint32_t v = n;
+            while (!frontier.empty() && v == n)
+            {
+                auto [vGain, candidate] = frontier.top();
+                frontier.pop();
+                if (side[candidate] == 1 && vGain == gain[candidate])
+                {
+                    v = candidate;
+                }
+            }
+            if (v == n)
+            {
+                // disconnected graph: start from a vertex not reached yet
+                while (nextUnreached < n && side[nextUnreached] == 0)
+                {
+                    ++nextUnreached;
+                }
+                if (nextUnreached == n)
+                {
+                    break;
+                }
+                v = nextUnreached;
+            }
+            if (weight > 0 && weight + g.vertexWeights[v] - target > target - weight)
+            {
+                break; // moving v would worsen the balance
+            }
+            side[v] = 0;
+            weight += g.vertexWeights[v];
+            for (const auto& [u, cost] : g.adjacency[v])
+            {
+                if (side[u] == 1)
+                {
+                    gain[u] += 2 * cost;
+                    frontier.emplace(gain[u], u);
+                }
+            }
+        }
+
+        Refine(g, fraction, side);
+        double cut = CutCost(g, side);
+        if (cut < bestCut)
+        {
+            bestCut = cut;
+            best = std::move(side);
+        }
+    }
+    return best;
+}
+
+void
+GraphPartitioner::Refine(const Graph& g, double fraction, std::vector<uint8_t>& side)
+{
+    const uint32_t n = g.vertexWeights.size();
+    double total = std::accumulate(g.vertexWeights.begin(), g.vertexWeights.end(), 0.0);
+    double target = fraction * total;
+    double maxVertexWeight = *std::max_element(g.vertexWeights.begin(), g.vertexWeights.end());
+    double tolerance =
+        std::max(BALANCE_TOLERANCE * std::min(target, total - target), maxVertexWeight / 2);
+
+    double weight = 0; // weight of part 0
+    for (uint32_t v = 0; v < n; ++v)
+    {
+        weight += (side[v] == 0 ? g.vertexWeights[v] : 0);
+    }
+
+    // the reduction of the cut cost obtained by moving v to the other part
+    auto getGain = [&g, &side](uint32_t v) {
+        double gain = 0;
+        for (const auto& [u, cost] : g.adjacency[v])
+        {
+            gain += (side[u] != side[v] ? cost : -cost);
+        }
+        return gain;
+    };
+    // the weight of part 0 after moving v to the other part
+    auto weightAfterMove = [&g, &side, &weight](uint32_t v) {
+        return weight + (side[v] == 0 ? -g.vertexWeights[v] : g.vertexWeights[v]);
+    };
+
+    // first restore the balance by moving the best vertices out of the heavier part
+    if (std::abs(weight - target) > tolerance)
+    {
+        uint8_t heavy = (weight > target ? 0 : 1);
+        std::priority_queue<std::pair<double, uint32_t>> candidates;
+        for (uint32_t v = 0; v < n; ++v)
+        {
+            if (side[v] == heavy)
+            {
+                candidates.emplace(getGain(v), v);
+            }
+        }
+        while (std::abs(weight - target) > tolerance && !candidates.empty())
+        {
+            uint32_t v = candidates.top().second;
+            candidates.pop();
+            double newWeight = weightAfterMove(v);
+            // balance is not worth cutting an edge that must not be cut
+            if (std::abs(newWeight - target) < std::abs(weight - target) &&
+                getGain(v) > -UNCUTTABLE_COST / 2)
+            {
+                side[v] = 1 - heavy;
+                weight = newWeight;
+            }
+        }
+    }
+
+    // then greedily move the vertices that reduce the cut cost without
+    // breaking the balance
+    for (uint32_t pass = 0; pass < MAX_REFINEMENT_PASSES; ++pass)
+    {
+        bool moved = false;
+        for (uint32_t v = 0; v < n; ++v)
+        {
+            double gain = getGain(v);
+            if (gain <= 0)
+            {
+                continue;
+            }
+            double newWeight = weightAfterMove(v);
+            if (std::abs(newWeight - target) <= tolerance ||
+                std::abs(newWeight - target) < std::abs(weight - target))
+            {
+                side[v] = 1 - side[v];
+                weight = newWeight;
+                moved = true;
+            }
+        }
+        if (!moved)
+        {
+            break;
+        }
+    }
+}
+
+double
+GraphPartitioner::CutCost(const Graph& g, const std::vector<uint8_t>& side)
+{
+    double cut = 0;
+    for (uint32_t v = 0; v < g.vertexWeights.size(); ++v)
+    {
+        for (const auto& [u, cost] : g.adjacency[v])
+        {
+            cut += (side[u] != side[v] ? cost : 0);
+        }
+    }
+    return cut / 2;
+}
+
+uint32_t
+GraphPartitioner::GetCutSize(const std::vector<uint32_t>& partition) const
+{
+    NS_ABORT_MSG_IF(partition.size() != m_vertexWeights.size(), "Invalid partition size");
+    uint32_t cut = 0;
+    for (const auto& edge : m_edges)
+    {
+        cut += (partition[edge.a] != partition[edge.b] ? 1 : 0);
+    }
+    return cut;
+}
+
+Time
+GraphPartitioner::GetLookahead(const std::vector<uint32_t>& partition) const
+{
+    NS_ABORT_MSG_IF(partition.size() != m_vertexWeights.size(), "Invalid partition size");
+    Time lookahead = Time::Max();
+    for (const auto& edge : m_edges)
+    {
+        if (partition[edge.a] != partition[edge.b])
+        {
+            lookahead = std::min(lookahead, edge.delay);
+        }
+    }
+    return lookahead;
+}
+
+std::vector<double>
+GraphPartitioner::GetPartitionWeights(const std::vector<uint32_t>& partition,
+                                      uint32_t nParts) const
+{
+    NS_ABORT_MSG_IF(partition.size() != m_vertexWeights.size(), "Invalid partition size");
+    std::vector<double> weights(nParts, 0);
+    for (uint32_t v = 0; v < partition.size(); ++v)
+    {
+        NS_ABORT_MSG_IF(partition[v] >= nParts, "Invalid partition " << partition[v]);
+        weights[partition[v]] += m_vertexWeights[v];
+    }
+    return weights;
+}
+
+} // namespace ns3
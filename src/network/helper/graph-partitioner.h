@@ -0,0 +1,245 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef GRAPH_PARTITIONER_H
+#define GRAPH_PARTITIONER_H
+
+#include "ns3/nstime.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @brief Partition the nodes of a topology among the tasks of a distributed simulation.
+ *
+ * The speedup of a distributed simulation depends on the assignment of the
+ * nodes to the logical processes (the system id of the nodes): the processes
+ * should carry the same load, exchange as few packets as possible and the
+ * links crossing partitions should have the largest possible delay, since
+ * the minimum delay of such links is the lookahead of the synchronization
+ * algorithm.
+ *
+ * This class computes such an assignment on a graph whose vertices are the
+ * nodes and whose edges are the links between them, by means of a multilevel
+ * recursive bisection (in the style of METIS):
+ *
+ * - the graph is repeatedly coarsened by collapsing the vertices joined by the
+ *   heaviest edges (heavy-edge matching);
+ * - the coarsest graph is bisected by greedily growing one of the two parts;
+ * - the bisection is projected back to finer and finer graphs and refined at
+ *   each level by moving boundary vertices that reduce the cut weight while
+ *   keeping the two parts balanced;
+ * - k-way partitions are obtained by recursive bisection.
+ *
+ * The weight of a vertex is the load of the node (one by default, or e.g. the
+ * number of events processed by the node in a previous, profiling, run). The
+ * cost of cutting an edge is its weight (one by default, or e.g. the number of
+ * packets carried in a profiling run) multiplied by the ratio between the
+ * largest link delay in the graph and the delay of the link, so that short
+ * links are preferentially kept within a partition. Links shorter than the
+ * minimum lookahead (see SetMinLookahead()) and links with more than two
+ * devices (e.g., CSMA) are never cut.
+ *
+ * Typical usage is to build the topology in a sequential (profiling) run,
+ * compute the partition and save it, then use it to assign the system id of
+ * the nodes created in the distributed run:
+ *
+ * @code
+ *   GraphPartitioner partitioner;
+ *   partitioner.AddNodeList();
+ *   partitioner.LoadVertexWeights("node-events.txt");
+ *   std::vector<uint32_t> systemIds = partitioner.Partition(nRanks);
+ * @endcode
+ */
+class GraphPartitioner
+{
+  public:
+    GraphPartitioner();
+
+    /**
+     * Add a vertex to the graph.
+     *
+     * @param weight the weight (load) of the vertex
+     * @return the index of the vertex
+     */
+    uint32_t AddVertex(double weight = 1);
+
+    /**
+     * Add an edge to the graph.
+     *
+     * @param a the index of the first vertex
+     * @param b the index of the second vertex
+     * @param delay the delay of the link
+     * @param weight the weight (traffic) of the link
+     */
+    void AddEdge(uint32_t a, uint32_t b, Time delay, double weight = 1);
+
+    /**
+     * Add an edge that must not be cut (e.g., a shared medium link).
+     *
+     * @param a the index of the first vertex
+     * @param b the index of the second vertex
+     */
+    void AddUncuttableEdge(uint32_t a, uint32_t b);
+
+    /**
+     * Add a vertex for every node in the NodeList (the index of the vertex is
+     * the node ID) and an edge for every channel connecting them. The delay
+     * of an edge is the value of the "Delay" attribute of the channel, if any.
+     * Channels connecting more than two devices are never cut.
+     */
+    void AddNodeList();
+
+    /**
+     * @param v the index of the vertex
+     * @param weight the weight (load) of the vertex
+     */
+    void SetVertexWeight(uint32_t v, double weight);
+
+    /**
+     * Load the weights of the vertices from a file, e.g., produced by a
+     * profiling run. Each line of the file holds the index of a vertex and
+     * its weight, separated by blanks. Vertices not listed keep their weight.
+     *
+     * @param filename the name of the file
+     */
+    void LoadVertexWeights(const std::string& filename);
+
+    /**
+     * Set the minimum lookahead: links whose delay is smaller are never cut.
+     *
+     * @param lookahead the minimum lookahead
+     */
+    void SetMinLookahead(Time lookahead);
+
+    /**
+     * @return the number of vertices of the graph
+     */
+    uint32_t GetNVertices() const;
+
+    /**
+     * Compute a partition of the graph.
+     *
+     * @param nParts the number of partitions
+     * @return the partition assigned to each vertex
+     */
+    std::vector<uint32_t> Partition(uint32_t nParts) const;
+
+    /**
+     * @param partition the partition assigned to each vertex
+     * @return the number of edges crossing partitions
+     */
+    uint32_t GetCutSize(const std::vector<uint32_t>& partition) const;
+
+    /**
+     * @param partition the partition assigned to each vertex
+     * @return the minimum delay of the edges crossing partitions (i.e., the
+     * lookahead), or Time::Max() if no edge crosses partitions
+     */
+    Time GetLookahead(const std::vector<uint32_t>& partition) const;
+
+    /**
+     * @param partition the partition assigned to each vertex
+     * @param nParts the number of partitions
+     * @return the sum of the weights of the vertices of each partition
+     */
+    std::vector<double> GetPartitionWeights(const std::vector<uint32_t>& partition,
+                                            uint32_t nParts) const;
+
+  private:
+    /// An edge as seen from one endpoint: the other endpoint and the cost of cutting it
+    using Adjacency = std::pair<uint32_t, double>;
+
+    /// A weighted graph
+    struct Graph
+    {
+        std::vector<double> vertexWeights;             //!< weight of each vertex
+        std::vector<std::vector<Adjacency>> adjacency; //!< adjacency list of each vertex
+    };
+
+    /// An edge of the input graph
+    struct Edge
+    {
+        uint32_t a;    //!< first vertex
+        uint32_t b;    //!< second vertex
+        Time delay;    //!< delay of the link
+        double weight; //!< weight of the link (negative if uncuttable)
+    };
+
+    /**
+     * @return the graph to partition, with the cut costs of the edges
+     */
+    Graph BuildGraph() const;
+
+    /**
+     * Partition a graph by recursive bisection.
+     *
+     * @param g the graph
+     * @param nParts the number of partitions
+     * @param firstPart the index of the first partition
+     * @param vertices the index of the vertices of g in the original graph
+     * @param partition the partition assigned to each vertex of the original graph
+     */
+    static void RecursiveBisection(const Graph& g,
+                                   uint32_t nParts,
+                                   uint32_t firstPart,
+                                   const std::vector<uint32_t>& vertices,
+                                   std::vector<uint32_t>& partition);
+
+    /**
+     * Multilevel bisection of a graph.
+     *
+     * @param g the graph
+     * @param fraction the target fraction of the total weight in part 0
+     * @return the part (0 or 1) assigned to each vertex
+     */
+    static std::vector<uint8_t> Bisect(const Graph& g, double fraction);
+
+    /**
+     * Coarsen a graph by heavy-edge matching.
+     *
+     * @param g the graph
+     * @param coarse the coarse graph
+     * @param map the vertex of the coarse graph each vertex of g is collapsed into
+     * @return false if the graph could not be coarsened significantly
+     */
+    static bool Coarsen(const Graph& g, Graph& coarse, std::vector<uint32_t>& map);
+
+    /**
+     * Bisect a (small) graph by greedy graph growing.
+     *
+     * @param g the graph
+     * @param fraction the target fraction of the total weight in part 0
+     * @return the part (0 or 1) assigned to each vertex
+     */
+    static std::vector<uint8_t> InitialBisection(const Graph& g, double fraction);
+
+    /**
+     * Refine a bisection by moving boundary vertices.
+     *
+     * @param g the graph
+     * @param fraction the target fraction of the total weight in part 0
+     * @param side the part (0 or 1) assigned to each vertex
+     */
+    static void Refine(const Graph& g, double fraction, std::vector<uint8_t>& side);
+
+    /**
+     * @param g the graph
+     * @param side the part (0 or 1) assigned to each vertex
+     * @return the total cost of the edges crossing the two parts
+     */
+    static double CutCost(const Graph& g, const std::vector<uint8_t>& side);
+
+    std::vector<double> m_vertexWeights; //!< weight of each vertex
+    std::vector<Edge> m_edges;           //!< edges of the graph
+    Time m_minLookahead;                 //!< links shorter than this are never cut
+};
+
+} // namespace ns3
+
+#endif /* GRAPH_PARTITIONER_H */
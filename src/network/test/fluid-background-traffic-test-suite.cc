@@ -0,0 +1,115 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/data-rate.h"
+#include "ns3/fluid-background-traffic.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+using namespace ns3;
+
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * @brief FluidBackgroundTraffic Test Case
+ *
+ * Checks the analytic M/M/1/K quantities computed by the model against
+ * hand-computed values, for an offered load below and above the link rate,
+ * and checks that the drawn drops and waiting times match them.
+ */
+class FluidBackgroundTrafficTestCase : public TestCase
+{
+  public:
+    FluidBackgroundTrafficTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+FluidBackgroundTrafficTestCase::FluidBackgroundTrafficTestCase()
+    : TestCase("Check the analytic and sampled quantities of FluidBackgroundTraffic")
+{
+}
+
+void
+FluidBackgroundTrafficTestCase::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    auto bg = CreateObject<FluidBackgroundTraffic>();
+    bg->SetAttribute("MaxPackets", UintegerValue(2));
+    bg->SetAttribute("MeanPacketSize", UintegerValue(1000));
+    bg->SetLinkRate(DataRate("8Mb/s")); // 1 ms per packet
+    bg->AssignStreams(0);
+
+    // no background traffic
+    NS_TEST_EXPECT_MSG_EQ(bg->GetDropProbability(), 0, "Unexpected drop probability");
+    NS_TEST_EXPECT_MSG_EQ(bg->GetWaitingTime(), Time(0), "Unexpected waiting time");
+    NS_TEST_EXPECT_MSG_EQ(bg->IsDropped(), false, "Unexpected drop");
+
+    // rho = 0.5: pi = (4/7, 2/7, 1/7)
+    bg->SetRate(DataRate("4Mb/s"));
+    NS_TEST_EXPECT_MSG_EQ_TOL(bg->GetUtilization(), 0.5, 1e-9, "Unexpected utilization");
+    NS_TEST_EXPECT_MSG_EQ_TOL(bg->GetOccupancyProbability(0), 4. / 7, 1e-9, "Unexpected pi_0");
+    NS_TEST_EXPECT_MSG_EQ_TOL(bg->GetOccupancyProbability(1), 2. / 7, 1e-9, "Unexpected pi_1");
+    NS_TEST_EXPECT_MSG_EQ_TOL(bg->GetDropProbability(), 1. / 7, 1e-9, "Unexpected pi_K");
+    NS_TEST_EXPECT_MSG_EQ_TOL(bg->GetMeanBacklog(), 4. / 7, 1e-9, "Unexpected mean backlog");
+    NS_TEST_EXPECT_MSG_EQ_TOL(bg->GetMeanWaitingTime().GetSeconds(),
+                              1e-3 / 3,
+                              1e-9,
+                              "Unexpected mean waiting time");
+
+    // rho = 2: pi = (1/7, 2/7, 4/7)
+    bg->SetRate(DataRate("16Mb/s"));
+    NS_TEST_EXPECT_MSG_EQ_TOL(bg->GetOccupancyProbability(0), 1. / 7, 1e-9, "Unexpected pi_0");
+    NS_TEST_EXPECT_MSG_EQ_TOL(bg->GetOccupancyProbability(1), 2. / 7, 1e-9, "Unexpected pi_1");
+    NS_TEST_EXPECT_MSG_EQ_TOL(bg->GetDropProbability(), 4. / 7, 1e-9, "Unexpected pi_K");
+    NS_TEST_EXPECT_MSG_EQ_TOL(bg->GetMeanBacklog(), 10. / 7, 1e-9, "Unexpected mean backlog");
+    NS_TEST_EXPECT_MSG_EQ_TOL(bg->GetMeanWaitingTime().GetSeconds(),
+                              2e-3 / 3,
+                              1e-9,
+                              "Unexpected mean waiting time");
+
+    // check the drawn values against the analytic ones
+    const uint32_t nSamples = 100000;
+    uint32_t nDropped = 0;
+    double waitingTime = 0;
+    for (uint32_t i = 0; i < nSamples; i++)
+    {
+        nDropped += (bg->IsDropped() ? 1 : 0);
+        waitingTime += bg->GetWaitingTime().GetSeconds();
+    }
+    NS_TEST_EXPECT_MSG_EQ_TOL(static_cast<double>(nDropped) / nSamples,
+                              bg->GetDropProbability(),
+                              0.01,
+                              "Unexpected fraction of dropped packets");
+    NS_TEST_EXPECT_MSG_EQ_TOL(waitingTime / nSamples,
+                              bg->GetMeanWaitingTime().GetSeconds(),
+                              1e-5,
+                              "Unexpected average waiting time");
+}
+
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * @brief FluidBackgroundTraffic TestSuite
+ */
+class FluidBackgroundTrafficTestSuite : public TestSuite
+{
+  public:
+    FluidBackgroundTrafficTestSuite();
+};
+
+FluidBackgroundTrafficTestSuite::FluidBackgroundTrafficTestSuite()
+    : TestSuite("fluid-background-traffic", Type::UNIT)
+{
+    AddTestCase(new FluidBackgroundTrafficTestCase, TestCase::Duration::QUICK);
+}
+
+static FluidBackgroundTrafficTestSuite
+    g_fluidBackgroundTrafficTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,219 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/graph-partitioner.h"
+#include "ns3/node-container.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * @brief GraphPartitioner Test Case on synthetic graphs
+ *
+ * - two clusters of vertices connected by short links and joined by a single
+ *   long link must be split along the long link;
+ * - a grid must be split in balanced partitions;
+ * - uncuttable edges and links shorter than the minimum lookahead must not be cut.
+ */
+class GraphPartitionerTestCase : public TestCase
+{
+  public:
+    GraphPartitionerTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+GraphPartitionerTestCase::GraphPartitionerTestCase()
+    : TestCase("Check the partitions computed by GraphPartitioner")
+{
+}
+
+void
+GraphPartitionerTestCase::DoRun()
+{
+    // two rings of 40 vertices (with chords), joined by a long link
+    {
+        GraphPartitioner partitioner;
+        const uint32_t clusterSize = 40;
+        for (uint32_t i = 0; i < 2 * clusterSize; ++i)
+        {
+            partitioner.AddVertex();
+        }
+        for (uint32_t c = 0; c < 2; ++c)
+        {
+            uint32_t first = c * clusterSize;
+            for (uint32_t i = 0; i < clusterSize; ++i)
+            {
+                partitioner.AddEdge(first + i, first + (i + 1) % clusterSize, MilliSeconds(1));
+                partitioner.AddEdge(first + i, first + (i + 7) % clusterSize, MilliSeconds(2));
+            }
+        }
+        partitioner.AddEdge(3, clusterSize + 5, MilliSeconds(50));
+
+        auto partition = partitioner.Partition(2);
+        NS_TEST_EXPECT_MSG_EQ(partitioner.GetCutSize(partition), 1, "Unexpected cut size");
+        NS_TEST_EXPECT_MSG_EQ(partitioner.GetLookahead(partition),
+                              MilliSeconds(50),
+                              "Unexpected lookahead");
+        auto weights = partitioner.GetPartitionWeights(partition, 2);
+        NS_TEST_EXPECT_MSG_EQ(weights[0], clusterSize, "Unbalanced partitions");
+        NS_TEST_EXPECT_MSG_EQ(weights[1], clusterSize, "Unbalanced partitions");
+    }
+
+    // 16x16 grid in 4 partitions
+    {
+        GraphPartitioner partitioner;
+        const uint32_t side = 16;
+        for (uint32_t i = 0; i < side * side; ++i)
+        {
+            partitioner.AddVertex();
+        }
+        for (uint32_t r = 0; r < side; ++r)
+        {
+            for (uint32_t c = 0; c < side; ++c)
+            {
+                if (c + 1 < side)
+                {
+                    partitioner.AddEdge(r * side + c, r * side + c + 1, MilliSeconds(1));
+                }
+                if (r + 1 < side)
+                {
+                    partitioner.AddEdge(r * side + c, (r + 1) * side + c, MilliSeconds(1));
+                }
+            }
+        }
+
+        auto partition = partitioner.Partition(4);
+        for (auto w : partitioner.GetPartitionWeights(partition, 4))
+        {
+            NS_TEST_EXPECT_MSG_EQ_TOL(w, side * side / 4, 0.05 * side * side / 4, "Unbalanced");
+        }
+        // the optimal cut (quadrants) has 2 * side edges
+        NS_TEST_EXPECT_MSG_LT_OR_EQ(partitioner.GetCutSize(partition),
+                                    3 * side,
+                                    "Cut size too large");
+    }
+
+    // weighted vertices, uncuttable edges and min lookahead: in a chain of
+    // 8 vertices, only the links 2-3 and 5-6 are long enough to be cut, and
+    // cutting 5-6 gives the best balance (6 vs 5)
+    {
+        GraphPartitioner partitioner;
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            partitioner.AddVertex();
+        }
+        partitioner.SetVertexWeight(6, 2);
+        partitioner.SetVertexWeight(7, 3);
+        partitioner.AddUncuttableEdge(0, 1);
+        partitioner.AddUncuttableEdge(1, 2);
+        partitioner.AddEdge(2, 3, MilliSeconds(1));
+        partitioner.AddEdge(3, 4, MicroSeconds(1));
+        partitioner.AddEdge(4, 5, MicroSeconds(2));
+        partitioner.AddEdge(5, 6, MilliSeconds(1));
+        partitioner.AddEdge(6, 7, MicroSeconds(5));
+        partitioner.SetMinLookahead(MilliSeconds(1));
+
+        auto partition = partitioner.Partition(2);
+        NS_TEST_EXPECT_MSG_EQ(partitioner.GetCutSize(partition), 1, "Unexpected cut size");
+        for (uint32_t i = 1; i < 6; ++i)
+        {
+            NS_TEST_EXPECT_MSG_EQ(partition[i], partition[0], "Unexpected partition");
+        }
+        NS_TEST_EXPECT_MSG_EQ(partition[7], partition[6], "Unexpected partition");
+        NS_TEST_EXPECT_MSG_NE(partition[6], partition[0], "Unexpected partition");
+    }
+}
+
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * @brief GraphPartitioner Test Case on the NodeList
+ *
+ * Nodes connected by SimpleChannels: the vertex weights are loaded from the
+ * NodeList and the channel delays are used as link delays.
+ */
+class GraphPartitionerNodeListTestCase : public TestCase
+{
+  public:
+    GraphPartitionerNodeListTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+GraphPartitionerNodeListTestCase::GraphPartitionerNodeListTestCase()
+    : TestCase("Check GraphPartitioner on the NodeList")
+{
+}
+
+void
+GraphPartitionerNodeListTestCase::DoRun()
+{
+    // two stars of 5 nodes, whose centers are connected by a long link
+    NodeContainer nodes;
+    nodes.Create(10);
+    auto connect = [&nodes](uint32_t a, uint32_t b, Time delay) {
+        auto channel = CreateObject<SimpleChannel>();
+        channel->SetAttribute("Delay", TimeValue(delay));
+        for (uint32_t n : {a, b})
+        {
+            auto device = CreateObject<SimpleNetDevice>();
+            nodes.Get(n)->AddDevice(device);
+            device->SetChannel(channel);
+        }
+    };
+    for (uint32_t i = 1; i < 5; ++i)
+    {
+        connect(0, i, MicroSeconds(100));
+        connect(5, 5 + i, MicroSeconds(100));
+    }
+    connect(0, 5, MilliSeconds(10));
+
+    GraphPartitioner partitioner;
+    partitioner.AddNodeList();
+    NS_TEST_ASSERT_MSG_EQ(partitioner.GetNVertices(), nodes.GetN(), "Unexpected number of vertices");
+
+    auto partition = partitioner.Partition(2);
+    NS_TEST_EXPECT_MSG_EQ(partitioner.GetCutSize(partition), 1, "Unexpected cut size");
+    NS_TEST_EXPECT_MSG_EQ(partitioner.GetLookahead(partition),
+                          MilliSeconds(10),
+                          "Unexpected lookahead");
+    for (uint32_t i = 1; i < 5; ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(partition[i], partition[0], "Star split across partitions");
+        NS_TEST_EXPECT_MSG_EQ(partition[5 + i], partition[5], "Star split across partitions");
+    }
+
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * @brief GraphPartitioner TestSuite
+ */
+class GraphPartitionerTestSuite : public TestSuite
+{
+  public:
+    GraphPartitionerTestSuite();
+};
+
+GraphPartitionerTestSuite::GraphPartitionerTestSuite()
+    : TestSuite("graph-partitioner", Type::UNIT)
+{
+    AddTestCase(new GraphPartitionerTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new GraphPartitionerNodeListTestCase, TestCase::Duration::QUICK);
+}
+
+static GraphPartitionerTestSuite g_graphPartitionerTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,236 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "fluid-background-traffic.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("FluidBackgroundTraffic");
+
+NS_OBJECT_ENSURE_REGISTERED(FluidBackgroundTraffic);
+
+TypeId
+FluidBackgroundTraffic::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::FluidBackgroundTraffic")
+            .SetParent<Object>()
+            .SetGroupName("Network")
+            .AddConstructor<FluidBackgroundTraffic>()
+            .AddAttribute("Rate",
+                          "The aggregate rate of the background traffic",
+                          DataRateValue(DataRate(0)),
+                          MakeDataRateAccessor(&FluidBackgroundTraffic::SetRate,
+                                               &FluidBackgroundTraffic::GetRate),
+                          MakeDataRateChecker())
+            .AddAttribute("LinkRate",
+                          "The rate of the link the background traffic is offered to. "
+                          "Overwritten by the PointToPointNetDevice this model is attached to.",
+                          DataRateValue(DataRate("1Gb/s")),
+                          MakeDataRateAccessor(&FluidBackgroundTraffic::SetLinkRate,
+                                               &FluidBackgroundTraffic::GetLinkRate),
+                          MakeDataRateChecker())
+            .AddAttribute("MeanPacketSize",
+                          "The mean size (in bytes) of the background packets",
+                          UintegerValue(1000),
+                          MakeUintegerAccessor(&FluidBackgroundTraffic::m_meanPacketSize),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("MaxPackets",
+                          "The size (in packets) of the buffer in front of the link",
+                          UintegerValue(100),
+                          MakeUintegerAccessor(&FluidBackgroundTraffic::m_maxPackets),
+                          MakeUintegerChecker<uint32_t>(1));
+    return tid;
+}
+
+FluidBackgroundTraffic::FluidBackgroundTraffic()
+{
+    NS_LOG_FUNCTION(this);
+    m_uniform = CreateObject<UniformRandomVariable>();
+    m_gamma = CreateObject<GammaRandomVariable>();
+}
+
+FluidBackgroundTraffic::~FluidBackgroundTraffic()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+FluidBackgroundTraffic::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_uniform = nullptr;
+    m_gamma = nullptr;
+    Object::DoDispose();
+}
+
+void
+FluidBackgroundTraffic::SetRate(DataRate rate)
+{
+    NS_LOG_FUNCTION(this << rate);
+    m_rate = rate;
+}
+
+DataRate
+FluidBackgroundTraffic::GetRate() const
+{
+    return m_rate;
+}
+
+void
+FluidBackgroundTraffic::SetLinkRate(DataRate rate)
+{
+    NS_LOG_FUNCTION(this << rate);
+    NS_ABORT_MSG_IF(rate.GetBitRate() == 0, "The link rate must be strictly positive");
+    m_linkRate = rate;
+}
+
+DataRate
+FluidBackgroundTraffic::GetLinkRate() const
+{
+    return m_linkRate;
+}
+
+double
+FluidBackgroundTraffic::GetUtilization() const
+{
+    return static_cast<double>(m_rate.GetBitRate()) / m_linkRate.GetBitRate();
+}
+
+double
+FluidBackgroundTraffic::GetOccupancyProbability(uint32_t n) const
+{
+    if (n > m_maxPackets)
+    {
+        return 0;
+    }
+
+    double rho = GetUtilization();
+    if (rho == 0)
+    {
+        return (n == 0 ? 1 : 0);
+    }
+    if (std::abs(rho - 1) < 1e-9)
+    {
+        return 1.0 / (m_maxPackets + 1);
+    }
+    if (rho > 1)
+    {
+        // same expression, rewritten to avoid overflows
+        double k1 = m_maxPackets + 1.0;
+        return (rho - 1) * std::pow(rho, n - k1) / (1 - std::pow(rho, -k1));
+    }
+    return (1 - rho) * std::pow(rho, n) / (1 - std::pow(rho, m_maxPackets + 1));
+}
+
+double
+FluidBackgroundTraffic::GetDropProbability() const
+{
+    return GetOccupancyProbability(m_maxPackets);
+}
+
+double
+FluidBackgroundTraffic::GetMeanBacklog() const
+{
+    double rho = GetUtilization();
+    double k = m_maxPackets;
+    if (rho == 0)
+    {
+        return 0;
+    }
+    if (std::abs(rho - 1) < 1e-9)
+    {
+        return k / 2;
+    }
+    return rho / (1 - rho) - (k + 1) / (std::pow(rho, -(k + 1)) - 1);
+}
+
+Time
+FluidBackgroundTraffic::GetMeanPacketTxTime() const
+{
+    return m_linkRate.CalculateBytesTxTime(m_meanPacketSize);
+}
+
+Time
+FluidBackgroundTraffic::GetMeanWaitingTime() const
+{
+    // mean number of packets found in the buffer by an admitted packet
+    double pDrop = GetDropProbability();
+    if (pDrop >= 1)
+    {
+        return Time(0);
+    }
+    double n = (GetMeanBacklog() - m_maxPackets * pDrop) / (1 - pDrop);
+    return GetMeanPacketTxTime() * n;
+}
+
+bool
+FluidBackgroundTraffic::IsDropped()
+{
+    if (m_rate.GetBitRate() == 0)
+    {
+        return false;
+    }
+    return m_uniform->GetValue() < GetDropProbability();
+}
+
+Time
+FluidBackgroundTraffic::GetWaitingTime()
+{
+    NS_LOG_FUNCTION(this);
+
+    double rho = GetUtilization();
+    if (rho == 0)
+    {
+        return Time(0);
+    }
+
+    // draw the number of packets found in the buffer, conditioned on the buffer
+    // not being full, by inverting the CDF of the truncated geometric distribution
+    // P(n) ~ rho^n, n = 0, ..., K-1. If rho > 1, K-1-n is drawn (P(K-1-n) ~ rho^-n)
+    // so as to avoid overflows
+    double u = m_uniform->GetValue();
+    uint32_t n;
+    if (std::abs(rho - 1) < 1e-9)
+    {
+        n = static_cast<uint32_t>(u * m_maxPackets);
+    }
+    else
+    {
+        double r = (rho < 1 ? rho : 1 / rho);
+        double x = 1 - u * (1 - std::pow(r, m_maxPackets));
+        n = static_cast<uint32_t>(std::floor(std::log(x) / std::log(r)));
+    }
+    n = std::min(n, m_maxPackets - 1);
+    if (rho > 1 + 1e-9)
+    {
+        n = m_maxPackets - 1 - n;
+    }
+    NS_LOG_LOGIC("Background packets ahead: " << n);
+
+    if (n == 0)
+    {
+        return Time(0);
+    }
+    // the service of n packets with exponentially distributed sizes is Erlang(n)
+    return Seconds(m_gamma->GetValue(n, GetMeanPacketTxTime().GetSeconds()));
+}
+
+int64_t
+FluidBackgroundTraffic::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    m_uniform->SetStream(stream);
+    m_gamma->SetStream(stream + 1);
+    return 2;
+}
+
+} // namespace ns3
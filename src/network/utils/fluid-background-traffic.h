@@ -0,0 +1,146 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef FLUID_BACKGROUND_TRAFFIC_H
+#define FLUID_BACKGROUND_TRAFFIC_H
+
+#include "data-rate.h"
+
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/random-variable-stream.h"
+
+namespace ns3
+{
+
+/**
+ * @ingroup network
+ * @brief Analytic (fluid) model of the background traffic sharing a link
+ *
+ * This class models an aggregate of background traffic offered to a link
+ * without generating any packet or event. The background load is described
+ * by its aggregate rate and mean packet size; the link by its rate and by the
+ * size (in packets) of the buffer in front of it. The link is modeled as an
+ * M/M/1/K queue, whose stationary distribution gives the probability that the
+ * buffer holds n packets:
+ *
+ * \f$\pi_n = \frac{(1-\rho)\rho^n}{1-\rho^{K+1}}\f$, with \f$\rho\f$ = Rate / LinkRate
+ *
+ * Foreground packets (i.e., the packets actually simulated) arriving at the
+ * link see the stationary distribution (PASTA property), hence:
+ *
+ * - they are dropped with probability \f$\pi_K\f$ (see IsDropped());
+ * - if admitted, they wait for the service of the n background packets found
+ *   in the buffer, i.e., an Erlang(n) distributed time (see GetWaitingTime()).
+ *
+ * The model is meant for large-scale studies where most of the load is made
+ * of background packets that are not of interest individually. It can be
+ * attached to a PointToPointNetDevice (BackgroundTraffic attribute), which
+ * sets the link rate to its own data rate, or to a queue disc, in which case
+ * the LinkRate attribute has to be set by the user. The rate of the background
+ * traffic can be changed at any time (e.g., to follow a traffic matrix).
+ */
+class FluidBackgroundTraffic : public Object
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    FluidBackgroundTraffic();
+    ~FluidBackgroundTraffic() override;
+
+    /**
+     * @param rate the aggregate rate of the background traffic
+     */
+    void SetRate(DataRate rate);
+    /**
+     * @return the aggregate rate of the background traffic
+     */
+    DataRate GetRate() const;
+
+    /**
+     * @param rate the rate of the link the background traffic is offered to
+     */
+    void SetLinkRate(DataRate rate);
+    /**
+     * @return the rate of the link the background traffic is offered to
+     */
+    DataRate GetLinkRate() const;
+
+    /**
+     * @return the offered load, i.e., the ratio between the background traffic
+     * rate and the link rate (may exceed 1)
+     */
+    double GetUtilization() const;
+
+    /**
+     * @param n the number of packets
+     * @return the stationary probability that the buffer holds n background packets
+     */
+    double GetOccupancyProbability(uint32_t n) const;
+
+    /**
+     * @return the probability that a packet arriving at the link is dropped
+     */
+    double GetDropProbability() const;
+
+    /**
+     * @return the mean number of background packets in the buffer
+     */
+    double GetMeanBacklog() const;
+
+    /**
+     * @return the mean time a packet admitted in the buffer waits for the
+     * background packets ahead of it to be transmitted
+     */
+    Time GetMeanWaitingTime() const;
+
+    /**
+     * Draw whether a foreground packet arriving now is dropped because the
+     * buffer is full of background packets.
+     *
+     * @return true if the packet has to be dropped
+     */
+    bool IsDropped();
+
+    /**
+     * Draw the time a foreground packet admitted now has to wait for the
+     * background packets ahead of it to be transmitted.
+     *
+     * @return the waiting time
+     */
+    Time GetWaitingTime();
+
+    /**
+     * Assign a fixed random variable stream number to the random variables
+     * used by this model.  Return the number of streams (possibly zero) that
+     * have been assigned.
+     *
+     * @param stream first stream index to use
+     * @return the number of stream indices assigned by this model
+     */
+    int64_t AssignStreams(int64_t stream);
+
+  private:
+    void DoDispose() override;
+
+    /**
+     * @return the mean time needed to transmit a background packet on the link
+     */
+    Time GetMeanPacketTxTime() const;
+
+    DataRate m_rate;                      //!< aggregate rate of the background traffic
+    DataRate m_linkRate;                  //!< rate of the link
+    uint32_t m_meanPacketSize;            //!< mean size of the background packets (bytes)
+    uint32_t m_maxPackets;                //!< size of the buffer (packets)
+    Ptr<UniformRandomVariable> m_uniform; //!< used to draw drops and buffer occupancy
+    Ptr<GammaRandomVariable> m_gamma;     //!< used to draw waiting times
+};
+
+} // namespace ns3
+
+#endif /* FLUID_BACKGROUND_TRAFFIC_H */
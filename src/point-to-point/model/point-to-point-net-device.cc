@@ -10,6 +10,7 @@
 #include "ppp-header.h"
 
 #include "ns3/error-model.h"
+#include "ns3/fluid-background-traffic.h"
 #include "ns3/llc-snap-header.h"
 #include "ns3/log.h"
 #include "ns3/mac48-address.h"
@@ -60,6 +61,12 @@ PointToPointNetDevice::GetTypeId()
                           TimeValue(Seconds(0)),
                           MakeTimeAccessor(&PointToPointNetDevice::m_tInterframeGap),
                           MakeTimeChecker())
+            .AddAttribute("BackgroundTraffic",
+                          "An analytic model of the background traffic sharing the link with "
+                          "the simulated packets. Its link rate is set to the device data rate.",
+                          PointerValue(),
+                          MakePointerAccessor(&PointToPointNetDevice::m_backgroundTraffic),
+                          MakePointerChecker<FluidBackgroundTraffic>())
 
             //
             // Transmit queueing discipline for the device which includes its own set
@@ -203,6 +210,7 @@ PointToPointNetDevice::DoDispose()
     m_node = nullptr;
     m_channel = nullptr;
     m_receiveErrorModel = nullptr;
+    m_backgroundTraffic = nullptr;
     m_currentPkt = nullptr;
     m_queue = nullptr;
     NetDevice::DoDispose();
@@ -239,6 +247,22 @@ PointToPointNetDevice::TransmitStart(Ptr<Packet> p)
     m_phyTxBeginTrace(m_currentPkt);
 
     Time txTime = m_bps.CalculateBytesTxTime(p->GetSize());
+
+    if (m_backgroundTraffic)
+    {
+        //
+        // The wire is first busy transmitting the background packets that are
+        // ahead of this packet in the (analytic) buffer.
+        //
+        if (m_backgroundTraffic->GetLinkRate() != m_bps)
+        {
+            m_backgroundTraffic->SetLinkRate(m_bps);
+        }
+        Time wait = m_backgroundTraffic->GetWaitingTime();
+        NS_LOG_LOGIC("Waiting for background traffic for " << wait.As(Time::S));
+        txTime += wait;
+    }
+
     Time txCompleteTime = txTime + m_tInterframeGap;
 
     NS_LOG_LOGIC("Schedule TransmitCompleteEvent in " << txCompleteTime.As(Time::S));
@@ -523,6 +547,17 @@ PointToPointNetDevice::Send(Ptr<Packet> packet, const Address& dest, uint16_t pr
 
     m_macTxTrace(packet);
 
+    //
+    // The buffer may be full of background packets, in which case this packet
+    // is lost as if the queue overflowed.
+    //
+    if (m_backgroundTraffic && m_backgroundTraffic->IsDropped())
+    {
+        NS_LOG_LOGIC("Packet dropped due to background traffic");
+        m_macTxDropTrace(packet);
+        return false;
+    }
+
     //
     // We should enqueue and dequeue the packet to hit the tracing hooks.
     //
@@ -26,6 +26,7 @@ namespace ns3
 
 class PointToPointChannel;
 class ErrorModel;
+class FluidBackgroundTraffic;
 
 /**
  * @defgroup point-to-point Point-To-Point Network Device
@@ -302,6 +303,14 @@ class PointToPointNetDevice : public NetDevice
      */
     Ptr<ErrorModel> m_receiveErrorModel;
 
+    /**
+     * Analytic model of the background traffic sharing the link, if any.
+     * Foreground packets are dropped with the probability that the buffer is
+     * full of background packets and wait for the background packets ahead of
+     * them to be transmitted before being transmitted in turn.
+     */
+    Ptr<FluidBackgroundTraffic> m_backgroundTraffic;
+
     /**
      * The trace source fired when packets come into the "top" of the device
      * at the L3/L2 transition, before being queued for transmission.
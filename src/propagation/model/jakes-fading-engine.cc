@@ -0,0 +1,223 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "jakes-fading-engine.h"
+
+#include "ns3/abort.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+
+#include <bit>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("JakesFadingEngine");
+
+NS_OBJECT_ENSURE_REGISTERED(JakesFadingEngine);
+
+namespace
+{
+
+/**
+ * Compute the cosine of an angle without branches, so that the loops calling this function
+ * can be vectorized. The angle is reduced to [-pi/4, pi/4] by subtracting the nearest
+ * multiple of pi/2 (in three parts, exactly for multiples up to 2^20), and the sine or the
+ * cosine of the reduced angle is evaluated with the polynomials of fdlibm.
+ *
+ * @param x the angle [rad], whose magnitude must be lower than 2^51
+ * @return the cosine of the angle
+ */
+inline double
+FastCos(double x)
+{
+    constexpr double twoOverPi = 6.36619772367581382433e-01;
+    constexpr double pio2_1 = 1.57079632673412561417e+00; // first 33 bits of pi/2
+    constexpr double pio2_2 = 6.07710050630396597660e-11; // next 33 bits of pi/2
+    constexpr double pio2_3 = 2.02226624871116645580e-21; // pi/2 - (pio2_1 + pio2_2)
+    constexpr double roundingShift = 6755399441055744.0;  // 1.5 * 2^52
+
+    // the quadrant, rounded to the nearest integer by the addition; its two least
+    // significant bits are also the two least significant bits of the sum
+    double shifted = x * twoOverPi + roundingShift;
+    double n = shifted - roundingShift;
+    uint64_t quadrant = std::bit_cast<uint64_t>(shifted);
+    double r = ((x - n * pio2_1) - n * pio2_2) - n * pio2_3;
+
+    double z = r * r;
+    double sinR = r + r * z *
+                          (-1.66666666666666324348e-01 +
+                           z * (8.33333333332248946124e-03 +
+                                z * (-1.98412698298579493134e-04 +
+                                     z * (2.75573137070700676789e-06 +
+                                          z * (-2.50507602534068634195e-08 +
+                                               z * 1.58969099521155010221e-10)))));
+    double cosR = 1.0 - 0.5 * z +
+                  z * z *
+                      (4.16666666666666019037e-02 +
+                       z * (-1.38888888888741095749e-03 +
+                            z * (2.48015872894767294178e-05 +
+                                 z * (-2.75573143513906633035e-07 +
+                                      z * (2.08757232129817482790e-09 +
+                                           z * -1.13596475577881948265e-11)))));
+
+    // cos(r + n pi/2) is cos(r), -sin(r), -cos(r) and sin(r) for the quadrants 0 to 3
+    uint64_t useSin = -(quadrant & 1);
+    uint64_t sign = ((quadrant + 1) & 2) << 62;
+    uint64_t value =
+        (std::bit_cast<uint64_t>(sinR) & useSin) | (std::bit_cast<uint64_t>(cosR) & ~useSin);
+    return std::bit_cast<double>(value ^ sign);
+}
+
+} // namespace
+
+TypeId
+JakesFadingEngine::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::JakesFadingEngine")
+            .SetParent<Object>()
+            .SetGroupName("Propagation")
+            .AddConstructor<JakesFadingEngine>()
+            .AddAttribute("DopplerFrequencyHz",
+                          "Corresponding doppler frequency[Hz]",
+                          DoubleValue(80),
+                          MakeDoubleAccessor(&JakesFadingEngine::SetDopplerFrequencyHz),
+                          MakeDoubleChecker<double>(0.0, 1e4))
+            .AddAttribute("NumberOfOscillators",
+                          "The number of oscillators of each process. It cannot be changed "
+                          "once processes have been added.",
+                          UintegerValue(20),
+                          MakeUintegerAccessor(&JakesFadingEngine::SetNOscillators),
+                          MakeUintegerChecker<uint32_t>(4, 1000));
+    return tid;
+}
+
+JakesFadingEngine::JakesFadingEngine()
+    : m_omegaDopplerMax(0),
+      m_nOscillators(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+JakesFadingEngine::~JakesFadingEngine()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+JakesFadingEngine::SetNOscillators(uint32_t nOscillators)
+{
+    NS_LOG_FUNCTION(this << nOscillators);
+    NS_ABORT_MSG_IF(!m_omega.empty() && nOscillators != m_nOscillators,
+                    "The number of oscillators cannot be changed once processes have been added");
+    m_nOscillators = nOscillators;
+}
+
+void
+JakesFadingEngine::SetDopplerFrequencyHz(double dopplerFrequencyHz)
+{
+    NS_LOG_FUNCTION(this << dopplerFrequencyHz);
+    m_omegaDopplerMax = 2 * dopplerFrequencyHz * M_PI;
+}
+
+uint32_t
+JakesFadingEngine::AddProcess(Ptr<UniformRandomVariable> uniformVariable)
+{
+    NS_LOG_FUNCTION(this << uniformVariable);
+    NS_ASSERT(m_nOscillators != 0);
+    NS_ASSERT(m_omegaDopplerMax != 0);
+
+    uint32_t index = GetNProcesses();
+    // Initial phase is common for all oscillators:
+    double phi = uniformVariable->GetValue();
+    // Theta is common for all oscillators:
+    double theta = uniformVariable->GetValue();
+    for (uint32_t i = 0; i < m_nOscillators; i++)
+    {
+        uint32_t n = i + 1;
+        double alpha = (2.0 * M_PI * n - M_PI + theta) / (4.0 * m_nOscillators);
+        double psi = uniformVariable->GetValue();
+        std::complex<double> amplitude =
+            std::complex<double>(std::cos(psi), std::sin(psi)) * 2.0 / std::sqrt(m_nOscillators);
+        m_amplitudeRe.push_back(amplitude.real());
+        m_amplitudeIm.push_back(amplitude.imag());
+        m_omega.push_back(m_omegaDopplerMax * std::cos(alpha));
+        m_phase.push_back(phi);
+    }
+    m_cosines.resize(m_omega.size());
+    return index;
+}
+
+uint32_t
+JakesFadingEngine::GetNProcesses() const
+{
+    return m_nOscillators ? m_omega.size() / m_nOscillators : 0;
+}
+
+uint32_t
+JakesFadingEngine::GetNOscillators() const
+{
+    return m_nOscillators;
+}
+
+void
+JakesFadingEngine::EvaluateOscillators(std::size_t first, std::size_t count) const
+{
+    const double t = Simulator::Now().GetSeconds();
+    const double* omega = m_omega.data() + first;
+    const double* phase = m_phase.data() + first;
+    double* cosines = m_cosines.data() + first;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        cosines[i] = FastCos(t * omega[i] + phase[i]);
+    }
+}
+
+std::complex<double>
+JakesFadingEngine::GetComplexGain(uint32_t index) const
+{
+    NS_ASSERT_MSG(index < GetNProcesses(), "Unknown process " << index);
+    std::size_t first = static_cast<std::size_t>(index) * m_nOscillators;
+    EvaluateOscillators(first, m_nOscillators);
+    double re = 0;
+    double im = 0;
+    for (std::size_t i = first; i < first + m_nOscillators; i++)
+    {
+        re += m_amplitudeRe[i] * m_cosines[i];
+        im += m_amplitudeIm[i] * m_cosines[i];
+    }
+    return {re, im};
+}
+
+double
+JakesFadingEngine::GetChannelGainDb(uint32_t index) const
+{
+    std::complex<double> complexGain = GetComplexGain(index);
+    return 10 * std::log10(std::norm(complexGain) / 2);
+}
+
+void
+JakesFadingEngine::GetChannelGainsDb(std::vector<double>& gains) const
+{
+    NS_LOG_FUNCTION(this);
+    EvaluateOscillators(0, m_omega.size());
+    gains.resize(GetNProcesses());
+    for (std::size_t p = 0; p < gains.size(); p++)
+    {
+        double re = 0;
+        double im = 0;
+        for (std::size_t i = p * m_nOscillators; i < (p + 1) * m_nOscillators; i++)
+        {
+            re += m_amplitudeRe[i] * m_cosines[i];
+            im += m_amplitudeIm[i] * m_cosines[i];
+        }
+        gains[p] = 10 * std::log10((re * re + im * im) / 2);
+    }
+}
+
+} // namespace ns3
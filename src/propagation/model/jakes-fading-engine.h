@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef JAKES_FADING_ENGINE_H
+#define JAKES_FADING_ENGINE_H
+
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/random-variable-stream.h"
+
+#include <complex>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup propagation
+ * @brief Engine generating many independent Jakes fading processes at once.
+ *
+ * Each process is the sum of oscillators described in JakesProcess, with the same random
+ * parameters, drawn in the same order. Instead of an object per process, the engine stores
+ * the amplitudes, the rotation speeds and the initial phases of the oscillators of all the
+ * processes in contiguous arrays, and evaluates the oscillators with a branch-free cosine
+ * approximation in loops without dependencies among the oscillators, which the compiler
+ * can vectorize. The approximation matches std::cos within one unit in the last place for
+ * phases up to about 1e6 rad (i.e., for more than an hour of simulated time with a Doppler
+ * frequency of 80 Hz), with an error growing as 1e-16 times the phase beyond, which is the
+ * magnitude of the rounding error of the phase itself.
+ *
+ * The gain of a process can be retrieved with GetChannelGainDb and the gains of all the
+ * processes at once with GetChannelGainsDb. A JakesPropagationLossModel uses an engine
+ * to store the processes of its node pairs if its "Engine" attribute is set.
+ */
+class JakesFadingEngine : public Object
+{
+  public:
+    /**
+     * Register this type with the TypeId system.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    JakesFadingEngine();
+    ~JakesFadingEngine() override;
+
+    /**
+     * Add a process. The initial phase and the angle of arrival common to all the
+     * oscillators, then the phase of the amplitude of each oscillator, are drawn from the
+     * given random variable, which must be uniform in [-pi, pi).
+     * @param uniformVariable the random variable
+     * @return the index of the process
+     */
+    uint32_t AddProcess(Ptr<UniformRandomVariable> uniformVariable);
+
+    /**
+     * @return the number of processes
+     */
+    uint32_t GetNProcesses() const;
+
+    /**
+     * @return the number of oscillators of each process
+     */
+    uint32_t GetNOscillators() const;
+
+    /**
+     * @param index the index of a process
+     * @return the current complex gain of the process
+     */
+    std::complex<double> GetComplexGain(uint32_t index) const;
+
+    /**
+     * @param index the index of a process
+     * @return the current gain of the process [dB]
+     */
+    double GetChannelGainDb(uint32_t index) const;
+
+    /**
+     * Get the current gains of all the processes.
+     * @param gains the vector to fill with the gains [dB], indexed as the processes, which
+     *        is resized if needed
+     */
+    void GetChannelGainsDb(std::vector<double>& gains) const;
+
+  private:
+    /**
+     * Set the number of oscillators of each process.
+     * @param nOscillators the number of oscillators
+     */
+    void SetNOscillators(uint32_t nOscillators);
+
+    /**
+     * Set the Doppler frequency
+     * @param dopplerFrequencyHz the Doppler frequency [Hz]
+     */
+    void SetDopplerFrequencyHz(double dopplerFrequencyHz);
+
+    /**
+     * Evaluate the cosines of the phases of consecutive oscillators at the current time.
+     * @param first the index of the first oscillator
+     * @param count the number of oscillators
+     */
+    void EvaluateOscillators(std::size_t first, std::size_t count) const;
+
+    double m_omegaDopplerMax; //!< the maximum rotation speed of the oscillators
+    uint32_t m_nOscillators;  //!< the number of oscillators of each process
+
+    std::vector<double> m_amplitudeRe; //!< the real parts of the amplitudes of the oscillators
+    std::vector<double> m_amplitudeIm; //!< the imaginary parts of the amplitudes
+    std::vector<double> m_omega;       //!< the rotation speeds of the oscillators
+    std::vector<double> m_phase;       //!< the initial phases of the oscillators
+
+    mutable std::vector<double> m_cosines; //!< the cosines of the phases of the oscillators
+};
+
+} // namespace ns3
+
+#endif /* JAKES_FADING_ENGINE_H */
@@ -10,6 +10,7 @@
 
 #include "ns3/double.h"
 #include "ns3/log.h"
+#include "ns3/pointer.h"
 
 namespace ns3
 {
@@ -35,7 +36,14 @@ JakesPropagationLossModel::GetTypeId()
     static TypeId tid = TypeId("ns3::JakesPropagationLossModel")
                             .SetParent<PropagationLossModel>()
                             .SetGroupName("Propagation")
-                            .AddConstructor<JakesPropagationLossModel>();
+                            .AddConstructor<JakesPropagationLossModel>()
+                            .AddAttribute("Engine",
+                                          "The engine storing and evaluating the fading "
+                                          "processes of the node pairs. If not set, each "
+                                          "node pair has its own JakesProcess.",
+                                          PointerValue(),
+                                          MakePointerAccessor(&JakesPropagationLossModel::m_engine),
+                                          MakePointerChecker<JakesFadingEngine>());
     return tid;
 }
 
@@ -44,6 +52,8 @@ JakesPropagationLossModel::DoDispose()
 {
     m_uniformVariable = nullptr;
     m_propagationCache.Cleanup();
+    m_engine = nullptr;
+    m_engineProcesses.clear();
 }
 
 double
@@ -51,6 +61,18 @@ JakesPropagationLossModel::DoCalcRxPower(double txPowerDbm,
                                          Ptr<MobilityModel> a,
                                          Ptr<MobilityModel> b) const
 {
+    if (m_engine)
+    {
+        // links are symmetrical
+        NodePair_t pair = (a < b) ? NodePair_t(a, b) : NodePair_t(b, a);
+        auto it = m_engineProcesses.find(pair);
+        if (it == m_engineProcesses.end())
+        {
+            it = m_engineProcesses.emplace(pair, m_engine->AddProcess(m_uniformVariable)).first;
+        }
+        return txPowerDbm + m_engine->GetChannelGainDb(it->second);
+    }
+
     Ptr<JakesProcess> pathData = m_propagationCache.GetPathData(
         a,
         b,
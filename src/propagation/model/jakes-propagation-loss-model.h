@@ -8,10 +8,13 @@
 #ifndef JAKES_STATIONARY_LOSS_MODEL_H
 #define JAKES_STATIONARY_LOSS_MODEL_H
 
+#include "jakes-fading-engine.h"
 #include "jakes-process.h"
 #include "propagation-cache.h"
 #include "propagation-loss-model.h"
 
+#include <map>
+
 namespace ns3
 {
 /**
@@ -19,6 +22,10 @@ namespace ns3
  *
  * @brief a  Jakes narrowband propagation model.
  * Symmetrical cache for JakesProcess
+ *
+ * If the "Engine" attribute is set, the processes of the node pairs are stored and
+ * evaluated by the JakesFadingEngine, with the attributes of the engine, instead of being
+ * JakesProcess objects.
  */
 
 class JakesPropagationLossModel : public PropagationLossModel
@@ -56,6 +63,14 @@ class JakesPropagationLossModel : public PropagationLossModel
 
     Ptr<UniformRandomVariable> m_uniformVariable;              //!< random stream
     mutable PropagationCache<JakesProcess> m_propagationCache; //!< Propagation cache
+
+    Ptr<JakesFadingEngine> m_engine; //!< the engine storing the processes, if any
+
+    /// The mobility models of a node pair, the lower pointer first
+    typedef std::pair<Ptr<const MobilityModel>, Ptr<const MobilityModel>> NodePair_t;
+
+    /// The indices of the processes of the node pairs in the engine
+    mutable std::map<NodePair_t, uint32_t> m_engineProcesses;
 };
 
 } // namespace ns3
@@ -8,10 +8,14 @@
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
 #include "ns3/double.h"
+#include "ns3/jakes-fading-engine.h"
+#include "ns3/jakes-propagation-loss-model.h"
 #include "ns3/log.h"
+#include "ns3/pointer.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
+#include "ns3/uinteger.h"
 
 using namespace ns3;
 
@@ -478,6 +482,102 @@ RangePropagationLossModelTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup propagation-tests
+ *
+ * @brief Check that the JakesPropagationLossModel yields the same fading with and without
+ * a JakesFadingEngine, and that the gains computed by the engine for all the processes at
+ * once match those computed for each process.
+ */
+class JakesFadingEngineTestCase : public TestCase
+{
+  public:
+    JakesFadingEngineTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// Check the received powers of all the node pairs
+    void Check();
+
+    Ptr<JakesPropagationLossModel> m_processes; //!< the model with a JakesProcess per pair
+    Ptr<JakesPropagationLossModel> m_batched;   //!< the model using the engine
+    Ptr<JakesFadingEngine> m_engine;            //!< the engine
+    std::vector<Ptr<MobilityModel>> m_nodes;    //!< the mobility models of the nodes
+};
+
+JakesFadingEngineTestCase::JakesFadingEngineTestCase()
+    : TestCase("Test JakesFadingEngine")
+{
+}
+
+void
+JakesFadingEngineTestCase::Check()
+{
+    for (std::size_t i = 0; i < m_nodes.size(); i++)
+    {
+        for (std::size_t j = 0; j < m_nodes.size(); j++)
+        {
+            if (i == j)
+            {
+                continue;
+            }
+            double expected = m_processes->CalcRxPower(10, m_nodes[i], m_nodes[j]);
+            double rxPower = m_batched->CalcRxPower(10, m_nodes[i], m_nodes[j]);
+            NS_TEST_EXPECT_MSG_EQ_TOL(rxPower,
+                                      expected,
+                                      1e-9,
+                                      "Unexpected power from " << i << " to " << j << " at "
+                                                               << Simulator::Now().As(Time::S));
+        }
+    }
+
+    std::vector<double> gains;
+    m_engine->GetChannelGainsDb(gains);
+    NS_TEST_ASSERT_MSG_EQ(gains.size(), m_engine->GetNProcesses(), "Unexpected number of gains");
+    NS_TEST_EXPECT_MSG_EQ(gains.size(),
+                          m_nodes.size() * (m_nodes.size() - 1) / 2,
+                          "The links should be symmetrical");
+    for (uint32_t p = 0; p < gains.size(); p++)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(gains[p],
+                                  m_engine->GetChannelGainDb(p),
+                                  1e-12,
+                                  "Unexpected gain of process " << p);
+    }
+}
+
+void
+JakesFadingEngineTestCase::DoRun()
+{
+    m_engine = CreateObjectWithAttributes<JakesFadingEngine>("DopplerFrequencyHz",
+                                                             DoubleValue(80),
+                                                             "NumberOfOscillators",
+                                                             UintegerValue(20));
+    m_processes = CreateObject<JakesPropagationLossModel>();
+    m_processes->AssignStreams(1);
+    m_batched =
+        CreateObjectWithAttributes<JakesPropagationLossModel>("Engine", PointerValue(m_engine));
+    m_batched->AssignStreams(1);
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        m_nodes.push_back(CreateObject<ConstantPositionMobilityModel>());
+        m_nodes.back()->SetPosition(Vector(10.0 * i, 0, 0));
+    }
+
+    for (double t : {0.0, 0.001, 0.0123, 0.5, 2.0, 37.5, 1000.0})
+    {
+        Simulator::Schedule(Seconds(t), &JakesFadingEngineTestCase::Check, this);
+    }
+    Simulator::Run();
+    Simulator::Destroy();
+
+    m_processes = nullptr;
+    m_batched = nullptr;
+    m_engine = nullptr;
+    m_nodes.clear();
+}
+
 /**
  * @ingroup propagation-tests
  *
@@ -489,6 +589,7 @@ RangePropagationLossModelTestCase::DoRun()
  *   - LogDistancePropagationLossModel
  *   - MatrixPropagationLossModel
  *   - RangePropagationLossModel
+ *   - JakesPropagationLossModel with a JakesFadingEngine
  */
 class PropagationLossModelsTestSuite : public TestSuite
 {
@@ -504,6 +605,7 @@ PropagationLossModelsTestSuite::PropagationLossModelsTestSuite()
     AddTestCase(new LogDistancePropagationLossModelTestCase, TestCase::Duration::QUICK);
     AddTestCase(new MatrixPropagationLossModelTestCase, TestCase::Duration::QUICK);
     AddTestCase(new RangePropagationLossModelTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new JakesFadingEngineTestCase, TestCase::Duration::QUICK);
 }
 
 /// Static variable for test initialization
@@ -0,0 +1,66 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+/**
+ * @file
+ * @ingroup spectrum
+ *
+ * Convert a fading trace (such as those generated by the fading_trace_generator.m script
+ * of the lte module) to the binary format read by TraceFadingLossModel. The binary trace
+ * is mapped in memory instead of being loaded, hence the simulations running on the same
+ * machine share a single copy of it.
+ *
+ * Usage:
+ *
+ *  ./ns3 run "fading-trace-converter
+ *        --input=src/lte/model/fading-traces/fading_trace_EPA_3kmph.fad
+ *        --output=fading_trace_EPA_3kmph.fad.bin"
+ *
+ * The binary trace can then be used in place of the text trace, e.g.:
+ *
+ *  ./ns3 run "lena-fading
+ *        --ns3::TraceFadingLossModel::TraceFilename=fading_trace_EPA_3kmph.fad.bin"
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/trace-fading-loss-model.h"
+
+#include <iostream>
+
+using namespace ns3;
+
+int
+main(int argc, char* argv[])
+{
+    std::string input;
+    std::string output;
+    uint32_t rbNum = 100;
+    uint32_t samplesNum = 10000;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("input", "The text fading trace to convert", input);
+    cmd.AddValue("output", "The binary trace to write (default: the input file + .bin)", output);
+    cmd.AddValue("rbNum", "The number of RBs of the trace", rbNum);
+    cmd.AddValue("samplesNum", "The number of samples of the trace", samplesNum);
+    cmd.Parse(argc, argv);
+
+    if (input.empty())
+    {
+        std::cout << "Usage of " << argv[0]
+                  << " :\n\n"
+                     "./ns3 run \"fading-trace-converter"
+                     " --input=src/lte/model/fading-traces/fading_trace_EPA_3kmph.fad"
+                     " --output=fading_trace_EPA_3kmph.fad.bin\"\n";
+        return 0;
+    }
+    if (output.empty())
+    {
+        output = input + ".bin";
+    }
+
+    TraceFadingLossModel::ConvertToBinary(input, output, rbNum, samplesNum);
+    std::cout << "Wrote " << rbNum << " RBs of " << samplesNum << " samples of " << input
+              << " to " << output << std::endl;
+    return 0;
+}
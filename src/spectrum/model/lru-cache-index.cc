@@ -0,0 +1,123 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "lru-cache-index.h"
+
+#include "ns3/log.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LruCacheIndex");
+
+bool
+LruCacheIndex::Touch(uint64_t key, std::size_t bytes, Time now)
+{
+    NS_LOG_FUNCTION(this << key << bytes << now);
+
+    bool wasCold = false;
+    if (auto it = m_positions.find(key); it != m_positions.end())
+    {
+        auto& entry = *it->second;
+        wasCold = entry.cold;
+        m_bytes -= entry.bytes;
+        entry.bytes = bytes;
+        entry.lastAccess = now;
+        entry.cold = false;
+        m_hot.splice(m_hot.begin(), wasCold ? m_cold : m_hot, it->second);
+    }
+    else
+    {
+        m_hot.push_front({key, bytes, now, false});
+        m_positions[key] = m_hot.begin();
+    }
+    m_bytes += bytes;
+    return wasCold;
+}
+
+void
+LruCacheIndex::Erase(uint64_t key)
+{
+    NS_LOG_FUNCTION(this << key);
+
+    if (auto it = m_positions.find(key); it != m_positions.end())
+    {
+        m_bytes -= it->second->bytes;
+        (it->second->cold ? m_cold : m_hot).erase(it->second);
+        m_positions.erase(it);
+    }
+}
+
+void
+LruCacheIndex::Clear()
+{
+    NS_LOG_FUNCTION(this);
+    m_hot.clear();
+    m_cold.clear();
+    m_positions.clear();
+    m_bytes = 0;
+}
+
+std::vector<uint64_t>
+LruCacheIndex::Age(Time threshold)
+{
+    NS_LOG_FUNCTION(this << threshold);
+
+    std::vector<uint64_t> keys;
+    while (!m_hot.empty() && m_hot.back().lastAccess < threshold)
+    {
+        m_hot.back().cold = true;
+        keys.push_back(m_hot.back().key);
+        m_cold.splice(m_cold.begin(), m_hot, std::prev(m_hot.end()));
+    }
+    return keys;
+}
+
+void
+LruCacheIndex::SetBytes(uint64_t key, std::size_t bytes)
+{
+    NS_LOG_FUNCTION(this << key << bytes);
+
+    if (auto it = m_positions.find(key); it != m_positions.end())
+    {
+        m_bytes -= it->second->bytes;
+        it->second->bytes = bytes;
+        m_bytes += bytes;
+    }
+}
+
+std::vector<uint64_t>
+LruCacheIndex::Evict(std::size_t budget)
+{
+    NS_LOG_FUNCTION(this << budget);
+
+    std::vector<uint64_t> keys;
+    while (m_bytes > budget && m_positions.size() > 1)
+    {
+        // since there are at least two entries, the last entry of the list is not
+        // the most recently used entry
+        auto& list = m_cold.empty() ? m_hot : m_cold;
+        const auto& entry = list.back();
+        NS_LOG_DEBUG("Evicting entry " << entry.key << " using " << entry.bytes << " bytes");
+        keys.push_back(entry.key);
+        m_bytes -= entry.bytes;
+        m_positions.erase(entry.key);
+        list.pop_back();
+    }
+    return keys;
+}
+
+std::size_t
+LruCacheIndex::GetBytes() const
+{
+    return m_bytes;
+}
+
+std::size_t
+LruCacheIndex::GetNEntries() const
+{
+    return m_positions.size();
+}
+
+} // namespace ns3
@@ -0,0 +1,112 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef LRU_CACHE_INDEX_H
+#define LRU_CACHE_INDEX_H
+
+#include "ns3/nstime.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup spectrum
+ *
+ * Bookkeeping of the entries of a cache, identified by a key, in least recently
+ * used order. The index keeps track of the memory used by each entry and splits
+ * the entries in hot entries, which have been accessed recently, and cold entries,
+ * which have not been accessed for some time and may be stored in a compact form
+ * by the owner of the cache. The index does not store the entries themselves:
+ * the owner of the cache notifies the index of the accesses to the entries and
+ * removes the entries returned by Age() and Evict() from the cache.
+ */
+class LruCacheIndex
+{
+  public:
+    /**
+     * Record an access to an entry, which becomes the most recently used one.
+     * The entry is added to the index if not present.
+     *
+     * @param key the key of the entry
+     * @param bytes the memory used by the entry
+     * @param now the time of the access
+     * @return true if the entry was cold
+     */
+    bool Touch(uint64_t key, std::size_t bytes, Time now);
+
+    /**
+     * Remove an entry from the index, if present.
+     *
+     * @param key the key of the entry
+     */
+    void Erase(uint64_t key);
+
+    /**
+     * Remove all the entries from the index.
+     */
+    void Clear();
+
+    /**
+     * Mark as cold the hot entries that have not been accessed since the given time.
+     *
+     * @param threshold the time of the last access of the entries to mark as cold
+     * @return the keys of the entries that have been marked as cold
+     */
+    std::vector<uint64_t> Age(Time threshold);
+
+    /**
+     * Update the memory used by an entry, e.g., after the entry has been compacted.
+     *
+     * @param key the key of the entry
+     * @param bytes the memory used by the entry
+     */
+    void SetBytes(uint64_t key, std::size_t bytes);
+
+    /**
+     * Remove entries from the index until the memory used by the entries does not
+     * exceed the given budget. Cold entries are removed first, then hot entries,
+     * in least recently used order. The most recently used entry is never removed.
+     *
+     * @param budget the memory budget in bytes
+     * @return the keys of the removed entries
+     */
+    std::vector<uint64_t> Evict(std::size_t budget);
+
+    /**
+     * @return the memory used by the entries of the index
+     */
+    std::size_t GetBytes() const;
+
+    /**
+     * @return the number of entries of the index
+     */
+    std::size_t GetNEntries() const;
+
+  private:
+    /// An entry of the index
+    struct Entry
+    {
+        uint64_t key;      //!< the key of the entry
+        std::size_t bytes; //!< the memory used by the entry
+        Time lastAccess;   //!< the time of the last access to the entry
+        bool cold;         //!< whether the entry is cold
+    };
+
+    using EntryList = std::list<Entry>; //!< entries, most recently used first
+
+    EntryList m_hot;                                               //!< hot entries
+    EntryList m_cold;                                              //!< cold entries
+    std::unordered_map<uint64_t, EntryList::iterator> m_positions; //!< entries by key
+    std::size_t m_bytes{0}; //!< memory used by the entries
+};
+
+} // namespace ns3
+
+#endif /* LRU_CACHE_INDEX_H */
@@ -9,6 +9,8 @@
 
 #include "matrix-based-channel-model.h"
 
+#include "ns3/mobility-model.h"
+
 namespace ns3
 {
 
@@ -16,4 +18,23 @@ MatrixBasedChannelModel::~MatrixBasedChannelModel()
 {
 }
 
+std::vector<Ptr<const MatrixBasedChannelModel::ChannelMatrix>>
+MatrixBasedChannelModel::GetChannels(const std::vector<ChannelRequest>& requests)
+{
+    std::vector<Ptr<const ChannelMatrix>> channels;
+    channels.reserve(requests.size());
+    for (const auto& request : requests)
+    {
+        channels.push_back(
+            GetChannel(request.aMob, request.bMob, request.aAntenna, request.bAntenna));
+    }
+    return channels;
+}
+
+void
+MatrixBasedChannelModel::NotifyChannelParamsUpdated(Ptr<const MobilityModel> aMob,
+                                                    Ptr<const MobilityModel> bMob)
+{
+}
+
 } // namespace ns3
@@ -18,6 +18,7 @@
 #include "ns3/vector.h"
 
 #include <tuple>
+#include <vector>
 
 namespace ns3
 {
@@ -189,6 +190,29 @@ class MatrixBasedChannelModel : public Object
                                                 Ptr<const PhasedArrayModel> aAntenna,
                                                 Ptr<const PhasedArrayModel> bAntenna) = 0;
 
+    /**
+     * Pair of devices whose channel is requested through GetChannels
+     */
+    struct ChannelRequest
+    {
+        Ptr<const MobilityModel> aMob;        //!< mobility model of the a device
+        Ptr<const MobilityModel> bMob;        //!< mobility model of the b device
+        Ptr<const PhasedArrayModel> aAntenna; //!< antenna of the a device
+        Ptr<const PhasedArrayModel> bAntenna; //!< antenna of the b device
+    };
+
+    /**
+     * Returns the channel matrices of the given pairs of devices, as if GetChannel
+     * were called for each pair in turn. Subclasses may generate the channel
+     * matrices more efficiently than one at a time; the default implementation
+     * calls GetChannel for each pair.
+     *
+     * @param requests the pairs of devices
+     * @return the channel matrices, in the order of the requests
+     */
+    virtual std::vector<Ptr<const ChannelMatrix>> GetChannels(
+        const std::vector<ChannelRequest>& requests);
+
     /**
      * Returns a channel parameters structure used to obtain the channel between
      * the nodes with mobility objects passed as input parameters.
@@ -200,6 +224,17 @@ class MatrixBasedChannelModel : public Object
     virtual Ptr<const ChannelParams> GetParams(Ptr<const MobilityModel> aMob,
                                                Ptr<const MobilityModel> bMob) const = 0;
 
+    /**
+     * Notify that the auxiliary variables cached in the channel parameters between the
+     * nodes with the given mobility objects (e.g., m_cachedDelaySincos) have been filled
+     * by the user of the channel parameters. The default implementation does nothing.
+     *
+     * @param aMob mobility model of the a device
+     * @param bMob mobility model of the b device
+     */
+    virtual void NotifyChannelParamsUpdated(Ptr<const MobilityModel> aMob,
+                                            Ptr<const MobilityModel> bMob);
+
     /**
      * Generate a unique value for the pair of unsigned integer of 32 bits,
      * where the order does not matter, i.e., the same value will be returned for (a,b) and (b,a).
@@ -26,6 +26,7 @@
 #include "ns3/propagation-delay-model.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
+#include "ns3/uinteger.h"
 
 #include <algorithm>
 #include <iostream>
@@ -81,6 +82,7 @@ MultiModelSpectrumChannel::DoDispose()
     NS_LOG_FUNCTION(this);
     m_txSpectrumModelInfoMap.clear();
     m_rxSpectrumModelInfoMap.clear();
+    m_rxThreadPool.reset();
     SpectrumChannel::DoDispose();
 }
 
@@ -91,11 +93,43 @@ MultiModelSpectrumChannel::GetTypeId()
                             .SetParent<SpectrumChannel>()
                             .SetGroupName("Spectrum")
                             .AddConstructor<MultiModelSpectrumChannel>()
-
-        ;
+                            .AddAttribute("RxWorkerThreads",
+                                          "Number of threads (including the simulation thread) "
+                                          "computing the signals received from a transmission. "
+                                          "If null, the signal received by each receiver is "
+                                          "computed separately when the signal reaches it. "
+                                          "Otherwise, the signals received at the same time "
+                                          "(e.g., by all the receivers, without propagation "
+                                          "delay model) are computed together when the first "
+                                          "receiver is reached and the computations deferred by "
+                                          "the PhasedArraySpectrumPropagationLossModel are "
+                                          "performed in parallel.",
+                                          UintegerValue(0),
+                                          MakeUintegerAccessor(
+                                              &MultiModelSpectrumChannel::SetRxWorkerThreads,
+                                              &MultiModelSpectrumChannel::GetRxWorkerThreads),
+                                          MakeUintegerChecker<uint32_t>());
     return tid;
 }
 
+void
+MultiModelSpectrumChannel::SetRxWorkerThreads(uint32_t nThreads)
+{
+    NS_LOG_FUNCTION(this << nThreads);
+    m_rxWorkerThreads = nThreads;
+    m_rxThreadPool.reset();
+    if (nThreads > 0)
+    {
+        m_rxThreadPool = std::make_unique<ThreadPool>(nThreads);
+    }
+}
+
+uint32_t
+MultiModelSpectrumChannel::GetRxWorkerThreads() const
+{
+    return m_rxWorkerThreads;
+}
+
 void
 MultiModelSpectrumChannel::RemoveRx(Ptr<SpectrumPhy> phy)
 {
@@ -239,6 +273,7 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                  << txInfoIterator->second.m_spectrumConverterMap.begin()->first);
 
     std::map<SpectrumModelUid_t, Ptr<SpectrumValue>> convertedPsds{};
+    std::map<Time, std::shared_ptr<RxBatch>> batches;
     for (auto rxInfoIterator = m_rxSpectrumModelInfoMap.begin();
          rxInfoIterator != m_rxSpectrumModelInfoMap.end();
          ++rxInfoIterator)
@@ -333,7 +368,41 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                     }
                 }
 
-                if (rxNetDevice)
+                std::shared_ptr<RxBatch> batch;
+                if (m_rxThreadPool)
+                {
+                    // the signals received at the same time are computed together
+                    batch = batches[delay];
+                    if (!batch)
+                    {
+                        batch = std::make_shared<RxBatch>();
+                        batch->txPsd = txParams->psd;
+                        batch->convertedPsds = convertedPsds;
+                        batches[delay] = batch;
+                    }
+                    PendingRx pendingRx{*rxPhyIterator, rxParams};
+                    pendingRx.gains.txAntennaGain = txAntennaGain;
+                    batch->rxs.push_back(std::move(pendingRx));
+                }
+
+                if (batch && rxNetDevice)
+                {
+                    Simulator::ScheduleWithContext(rxNetDevice->GetNode()->GetId(),
+                                                   delay,
+                                                   &MultiModelSpectrumChannel::StartBatchRx,
+                                                   this,
+                                                   batch,
+                                                   batch->rxs.size() - 1);
+                }
+                else if (batch)
+                {
+                    Simulator::Schedule(delay,
+                                        &MultiModelSpectrumChannel::StartBatchRx,
+                                        this,
+                                        batch,
+                                        batch->rxs.size() - 1);
+                }
+                else if (rxNetDevice)
                 {
                     // the receiver has a NetDevice, so we expect that it is attached to a Node
                     auto dstNode = rxNetDevice->GetNode()->GetId();
@@ -365,6 +434,192 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
     }
 }
 
+void
+MultiModelSpectrumChannel::StartBatchRx(std::shared_ptr<RxBatch> batch, std::size_t index)
+{
+    NS_LOG_FUNCTION(this << index);
+
+    if (!batch->evaluated)
+    {
+        EvaluateRxBatch(*batch);
+    }
+    const auto& pendingRx = batch->rxs[index];
+    DeliverRx(batch->txPsd,
+              pendingRx.gains,
+              pendingRx.params,
+              pendingRx.receiver,
+              batch->convertedPsds);
+}
+
+void
+MultiModelSpectrumChannel::EvaluateRxBatch(RxBatch& batch)
+{
+    NS_LOG_FUNCTION(this << batch.rxs.size());
+
+    // Everything that may modify state shared among receivers (channel realizations,
+    // random variables, caches, reference counts, ...) is done by the simulation thread,
+    // in the order of the receivers. The deferred computations of the receivers of a
+    // same node may share the state of the link with the transmitter, hence they are
+    // performed by the same thread.
+    auto& pendingRxs = batch.rxs;
+    std::vector<std::vector<std::size_t>> groups;
+    std::map<uint32_t, std::size_t> nodeGroups;
+    for (std::size_t i = 0; i < pendingRxs.size(); ++i)
+    {
+        PrepareRx(pendingRxs[i]);
+        if (!pendingRxs[i].deferred)
+        {
+            continue;
+        }
+        if (auto device = pendingRxs[i].receiver->GetDevice())
+        {
+            auto [it, inserted] = nodeGroups.emplace(device->GetNode()->GetId(), groups.size());
+            if (inserted)
+            {
+                groups.emplace_back();
+            }
+            groups[it->second].push_back(i);
+        }
+        else
+        {
+            groups.push_back({i});
+        }
+    }
+
+    auto runGroup = [&groups, &pendingRxs](std::size_t group) {
+        for (auto i : groups[group])
+        {
+            pendingRxs[i].deferred();
+        }
+    };
+    if (m_rxThreadPool)
+    {
+        NS_LOG_LOGIC("Running " << groups.size() << " groups of deferred computations on "
+                                << m_rxThreadPool->GetNThreads() << " threads");
+        m_rxThreadPool->ParallelFor(groups.size(), runGroup);
+    }
+    else
+    {
+        // the worker threads have been disabled since the transmission started
+        for (std::size_t group = 0; group < groups.size(); ++group)
+        {
+            runGroup(group);
+        }
+    }
+
+    for (auto& pendingRx : pendingRxs)
+    {
+        // release the objects held by the deferred computation in the simulation thread
+        pendingRx.deferred = nullptr;
+    }
+    batch.evaluated = true;
+}
+
+void
+MultiModelSpectrumChannel::PrepareRx(PendingRx& pendingRx)
+{
+    NS_LOG_FUNCTION(this << pendingRx.receiver);
+
+    auto& params = pendingRx.params;
+    auto& gains = pendingRx.gains;
+    auto txMobility = params->txPhy->GetMobility();
+    auto rxMobility = pendingRx.receiver->GetMobility();
+    if (!txMobility || !rxMobility)
+    {
+        return;
+    }
+
+    gains.computed = true;
+    gains.pathLossDb = -gains.txAntennaGain;
+
+    if (auto rxAntenna = DynamicCast<AntennaModel>(pendingRx.receiver->GetAntenna()))
+    {
+        Angles rxAngles(txMobility->GetPosition(), rxMobility->GetPosition());
+        gains.rxAntennaGain = rxAntenna->GetGainDb(rxAngles);
+        NS_LOG_LOGIC("rxAntennaGain = " << gains.rxAntennaGain << " dB");
+        gains.pathLossDb -= gains.rxAntennaGain;
+    }
+
+    if (m_propagationLoss && (txMobility->GetPosition() != rxMobility->GetPosition()))
+    {
+        gains.propagationGainDb = m_propagationLoss->CalcRxPower(0, txMobility, rxMobility);
+        NS_LOG_LOGIC("propagationGainDb = " << gains.propagationGainDb << " dB");
+        gains.pathLossDb -= gains.propagationGainDb;
+    }
+
+    NS_LOG_LOGIC("total pathLoss = " << gains.pathLossDb << " dB");
+
+    if (gains.pathLossDb > m_maxLossDb)
+    {
+        // beyond range, the signal is discarded when it is delivered
+        return;
+    }
+
+    const auto pathLossLinear = std::pow(10.0, (-gains.pathLossDb) / 10.0);
+    *(params->psd) *= pathLossLinear;
+
+    if (m_spectrumPropagationLoss)
+    {
+        params->psd =
+            m_spectrumPropagationLoss->CalcRxPowerSpectralDensity(params, txMobility, rxMobility);
+    }
+    else if (m_phasedArraySpectrumPropagationLoss)
+    {
+        auto txPhasedArrayModel = DynamicCast<PhasedArrayModel>(params->txPhy->GetAntenna());
+        auto rxPhasedArrayModel = DynamicCast<PhasedArrayModel>(pendingRx.receiver->GetAntenna());
+
+        NS_ASSERT_MSG(txPhasedArrayModel && rxPhasedArrayModel,
+                      "PhasedArrayModel instances should be installed at both TX and RX "
+                      "SpectrumPhy in order to use PhasedArraySpectrumPropagationLoss.");
+
+        params = m_phasedArraySpectrumPropagationLoss->PrepareRxPowerSpectralDensity(
+            params,
+            txMobility,
+            rxMobility,
+            txPhasedArrayModel,
+            rxPhasedArrayModel,
+            pendingRx.deferred);
+    }
+}
+
+void
+MultiModelSpectrumChannel::DeliverRx(
+    Ptr<SpectrumValue> txPsd,
+    const RxGains& gains,
+    Ptr<SpectrumSignalParameters> params,
+    Ptr<SpectrumPhy> receiver,
+    const std::map<SpectrumModelUid_t, Ptr<SpectrumValue>>& availableConvertedPsds)
+{
+    NS_LOG_FUNCTION(this);
+
+    if (params->psd->GetSpectrumModelUid() != receiver->GetRxSpectrumModel()->GetUid())
+    {
+        NS_LOG_LOGIC("SpectrumModelUid changed since TX started, compute the received signal "
+                     "again");
+        StartRx(txPsd, gains.txAntennaGain, params, receiver, availableConvertedPsds);
+        return;
+    }
+
+    if (gains.computed)
+    {
+        m_gainTrace(params->txPhy->GetMobility(),
+                    receiver->GetMobility(),
+                    gains.txAntennaGain,
+                    gains.rxAntennaGain,
+                    gains.propagationGainDb,
+                    gains.pathLossDb);
+        m_pathLossTrace(params->txPhy, receiver, gains.pathLossDb);
+
+        if (gains.pathLossDb > m_maxLossDb)
+        {
+            // beyond range
+            return;
+        }
+    }
+
+    receiver->StartRx(params);
+}
+
 void
 MultiModelSpectrumChannel::StartRx(
     Ptr<SpectrumValue> txPsd,
@@ -388,7 +643,9 @@ MultiModelSpectrumChannel::StartRx(
         if (itConvertedPsd != availableConvertedPsds.cend())
         {
             NS_LOG_LOGIC("converted PSD already exists for " << phySpectrumModelUid);
-            params->psd = itConvertedPsd->second;
+            // the converted PSD is shared by all the receivers, hence copy it before
+            // applying the propagation loss
+            params->psd = Copy<SpectrumValue>(itConvertedPsd->second);
         }
         else
         {
@@ -404,7 +661,7 @@ MultiModelSpectrumChannel::StartRx(
             if (rxConverterIterator == txInfoIterator->second.m_spectrumConverterMap.cend())
             {
                 // No converter means TX SpectrumModel is orthogonal to current PHY SpectrumModel
-                params->psd = txPsd;
+                params->psd = Copy<SpectrumValue>(txPsd);
             }
             else
             {
@@ -14,10 +14,15 @@
 #include "spectrum-propagation-loss-model.h"
 #include "spectrum-value.h"
 
+#include "ns3/nstime.h"
 #include "ns3/propagation-delay-model.h"
+#include "ns3/thread-pool.h"
 
+#include <functional>
 #include <map>
+#include <memory>
 #include <set>
+#include <vector>
 
 namespace ns3
 {
@@ -88,6 +93,18 @@ typedef std::map<SpectrumModelUid_t, RxSpectrumModelInfo> RxSpectrumModelInfoMap
  * for this to work is that, after the SpectrumPhy switched its
  * SpectrumModel,  MultiModelSpectrumChannel::AddRx () is
  * called again passing the pointer to that SpectrumPhy.
+ *
+ * The signal received by each SpectrumPhy is computed when the signal reaches
+ * it, i.e., after the propagation delay. If the RxWorkerThreads attribute is
+ * set to a non-null value, the signals received by the SpectrumPhy instances
+ * that a transmission reaches at the same time (e.g., all of them in the
+ * absence of propagation delay model) are computed together when the first
+ * of them is reached, so that the computations that the
+ * PhasedArraySpectrumPropagationLossModel defers (see
+ * PhasedArraySpectrumPropagationLossModel::PrepareRxPowerSpectralDensity) can
+ * be performed in parallel by a pool of threads. Receptions are scheduled in
+ * the same order as usual, hence results do not depend on the number of
+ * threads.
  */
 class MultiModelSpectrumChannel : public SpectrumChannel
 {
@@ -113,6 +130,56 @@ class MultiModelSpectrumChannel : public SpectrumChannel
     void DoDispose() override;
 
   private:
+    /**
+     * Gains computed for a receiver of a signal
+     */
+    struct RxGains
+    {
+        bool computed{false};        //!< whether the gains have been computed
+        double txAntennaGain{0};     //!< the antenna gain at the transmitter (dB)
+        double rxAntennaGain{0};     //!< the antenna gain at the receiver (dB)
+        double propagationGainDb{0}; //!< the propagation gain (dB)
+        double pathLossDb{0};        //!< the total path loss (dB)
+    };
+
+    /**
+     * Receiver of a signal evaluated together with the other receivers reached at the
+     * same time
+     */
+    struct PendingRx
+    {
+        Ptr<SpectrumPhy> receiver;            //!< the receiver
+        Ptr<SpectrumSignalParameters> params; //!< the parameters of the received signal
+        RxGains gains;                        //!< the gains
+        std::function<void()> deferred;       //!< computation left to the worker threads
+    };
+
+    /**
+     * Receivers of a transmission reached at the same time, whose received signals are
+     * computed when the first of them is reached
+     */
+    struct RxBatch
+    {
+        Ptr<SpectrumValue> txPsd;   //!< the transmitted PSD
+        std::vector<PendingRx> rxs; //!< the receivers, in the order of their reception
+        /// the transmitted PSD converted to the spectrum models of the receivers
+        std::map<SpectrumModelUid_t, Ptr<SpectrumValue>> convertedPsds;
+        bool evaluated{false}; //!< whether the received signals have been computed
+    };
+
+    /**
+     * Set the number of threads computing the received signals.
+     *
+     * @param nThreads the number of threads (0 to compute the signal received by each
+     *                 receiver separately)
+     */
+    void SetRxWorkerThreads(uint32_t nThreads);
+
+    /**
+     * @return the number of threads computing the received signals
+     */
+    uint32_t GetRxWorkerThreads() const;
+
     /**
      * This method checks if m_rxSpectrumModelInfoMap contains an entry
      * for the given TX SpectrumModel. If such entry exists, it returns
@@ -142,6 +209,49 @@ class MultiModelSpectrumChannel : public SpectrumChannel
         Ptr<SpectrumPhy> receiver,
         const std::map<SpectrumModelUid_t, Ptr<SpectrumValue>>& availableConvertedPsds);
 
+    /**
+     * Used internally to deliver, after the propagation delay, the signal received by
+     * a receiver of a batch. The signals received by all the receivers of the batch are
+     * computed first, possibly in parallel, if this is the first receiver of the batch
+     * to be reached.
+     *
+     * @param batch the receivers reached at the same time
+     * @param index the index of the receiver in the batch
+     */
+    void StartBatchRx(std::shared_ptr<RxBatch> batch, std::size_t index);
+
+    /**
+     * Compute the signals received by the receivers of a batch, possibly in parallel.
+     *
+     * @param batch the receivers reached at the same time
+     */
+    void EvaluateRxBatch(RxBatch& batch);
+
+    /**
+     * Compute the gains of the given receiver and apply them to the received
+     * signal. The computation that can be performed outside of the simulation
+     * thread is stored in the deferred member of the given receiver.
+     *
+     * @param pendingRx the receiver
+     */
+    void PrepareRx(PendingRx& pendingRx);
+
+    /**
+     * Used internally to deliver a signal that has been computed together with the
+     * signals received at the same time by other receivers.
+     *
+     * @param txPsd The transmitted PSD.
+     * @param gains the gains computed for the receiver
+     * @param params The signal parameters.
+     * @param receiver A pointer to the receiver SpectrumPhy.
+     * @param availableConvertedPsds available converted PSDs from the TX PSD.
+     */
+    void DeliverRx(Ptr<SpectrumValue> txPsd,
+                   const RxGains& gains,
+                   Ptr<SpectrumSignalParameters> params,
+                   Ptr<SpectrumPhy> receiver,
+                   const std::map<SpectrumModelUid_t, Ptr<SpectrumValue>>& availableConvertedPsds);
+
     /**
      * Data structure holding, for each TX SpectrumModel,  all the
      * converters to any RX SpectrumModel, and all the corresponding
@@ -160,6 +270,9 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      * Number of devices connected to the channel.
      */
     std::size_t m_numDevices;
+
+    uint32_t m_rxWorkerThreads{0};              //!< number of threads computing received signals
+    std::unique_ptr<ThreadPool> m_rxThreadPool; //!< the pool of threads (if enabled)
 };
 
 } // namespace ns3
@@ -77,6 +77,42 @@ PhasedArraySpectrumPropagationLossModel::CalcRxPowerSpectralDensity(
     return rxParams;
 }
 
+Ptr<SpectrumSignalParameters>
+PhasedArraySpectrumPropagationLossModel::PrepareRxPowerSpectralDensity(
+    Ptr<const SpectrumSignalParameters> params,
+    Ptr<const MobilityModel> a,
+    Ptr<const MobilityModel> b,
+    Ptr<const PhasedArrayModel> aPhasedArrayModel,
+    Ptr<const PhasedArrayModel> bPhasedArrayModel,
+    std::function<void()>& deferred) const
+{
+    if (m_next)
+    {
+        // chained models need the complete result of this model
+        deferred = nullptr;
+        return CalcRxPowerSpectralDensity(params, a, b, aPhasedArrayModel, bPhasedArrayModel);
+    }
+    return DoPrepareRxPowerSpectralDensity(params,
+                                           a,
+                                           b,
+                                           aPhasedArrayModel,
+                                           bPhasedArrayModel,
+                                           deferred);
+}
+
+Ptr<SpectrumSignalParameters>
+PhasedArraySpectrumPropagationLossModel::DoPrepareRxPowerSpectralDensity(
+    Ptr<const SpectrumSignalParameters> params,
+    Ptr<const MobilityModel> a,
+    Ptr<const MobilityModel> b,
+    Ptr<const PhasedArrayModel> aPhasedArrayModel,
+    Ptr<const PhasedArrayModel> bPhasedArrayModel,
+    std::function<void()>& deferred) const
+{
+    deferred = nullptr;
+    return DoCalcRxPowerSpectralDensity(params, a, b, aPhasedArrayModel, bPhasedArrayModel);
+}
+
 int64_t
 PhasedArraySpectrumPropagationLossModel::AssignStreams(int64_t stream)
 {
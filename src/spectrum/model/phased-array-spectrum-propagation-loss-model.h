@@ -14,6 +14,8 @@
 #include "ns3/object.h"
 #include "ns3/phased-array-model.h"
 
+#include <functional>
+
 namespace ns3
 {
 
@@ -78,6 +80,32 @@ class PhasedArraySpectrumPropagationLossModel : public Object
         Ptr<const PhasedArrayModel> aPhasedArrayModel,
         Ptr<const PhasedArrayModel> bPhasedArrayModel) const;
 
+    /**
+     * Same as CalcRxPowerSpectralDensity, except that the model may defer a part of
+     * the computation to the returned callable, which only depends on the state
+     * associated with the link between the sender and the receiver. The returned
+     * parameters are complete only after the callable (if not empty) has been
+     * called. The callable can be called by a thread other than the simulation
+     * thread, provided that no other computation involving the same pair of nodes
+     * is performed in the meantime; it must be released by the simulation thread.
+     *
+     * @param txPsd the spectrum signal parameters.
+     * @param a sender mobility
+     * @param b receiver mobility
+     * @param aPhasedArrayModel the instance of the phased antenna array of the sender
+     * @param bPhasedArrayModel the instance of the phased antenna array of the receiver
+     * @param deferred the deferred part of the computation (empty if none)
+     *
+     * @return the SpectrumSignalParameters that are updated when calling deferred
+     */
+    Ptr<SpectrumSignalParameters> PrepareRxPowerSpectralDensity(
+        Ptr<const SpectrumSignalParameters> txPsd,
+        Ptr<const MobilityModel> a,
+        Ptr<const MobilityModel> b,
+        Ptr<const PhasedArrayModel> aPhasedArrayModel,
+        Ptr<const PhasedArrayModel> bPhasedArrayModel,
+        std::function<void()>& deferred) const;
+
     /**
      * If this loss model uses objects of type RandomVariableStream,
      * set the stream numbers to the integers starting with the offset
@@ -124,6 +152,27 @@ class PhasedArraySpectrumPropagationLossModel : public Object
         Ptr<const PhasedArrayModel> aPhasedArrayModel,
         Ptr<const PhasedArrayModel> bPhasedArrayModel) const = 0;
 
+    /**
+     * Called by PrepareRxPowerSpectralDensity. The default implementation calls
+     * DoCalcRxPowerSpectralDensity and does not defer any computation.
+     *
+     * @param params the spectrum signal parameters.
+     * @param a sender mobility
+     * @param b receiver mobility
+     * @param aPhasedArrayModel the instance of the phased antenna array of the sender
+     * @param bPhasedArrayModel the instance of the phased antenna array of the receiver
+     * @param deferred the deferred part of the computation (empty if none)
+     *
+     * @return the SpectrumSignalParameters that are updated when calling deferred
+     */
+    virtual Ptr<SpectrumSignalParameters> DoPrepareRxPowerSpectralDensity(
+        Ptr<const SpectrumSignalParameters> params,
+        Ptr<const MobilityModel> a,
+        Ptr<const MobilityModel> b,
+        Ptr<const PhasedArrayModel> aPhasedArrayModel,
+        Ptr<const PhasedArrayModel> bPhasedArrayModel,
+        std::function<void()>& deferred) const;
+
     Ptr<PhasedArraySpectrumPropagationLossModel>
         m_next; //!< PhasedArraySpectrumPropagationLossModel chained to this one.
 };
@@ -21,6 +21,7 @@
 #include "ns3/shuffle.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
+#include "ns3/uinteger.h"
 
 #include <algorithm>
 #include <array>
@@ -1065,6 +1066,29 @@ static const std::map<std::string, std::map<int, std::array<float, 22>>> NTNRura
      }},
 };
 
+/**
+ * Compute the sine and cosine of the cluster angles of the channel params
+ * and store them in m_cachedAngleSincos
+ *
+ * @param channelParams the channel params
+ */
+static void
+CacheAngleSincos(MatrixBasedChannelModel::ChannelParams& channelParams)
+{
+    channelParams.m_cachedAngleSincos.resize(channelParams.m_angle.size());
+    for (size_t direction = 0; direction < channelParams.m_angle.size(); direction++)
+    {
+        channelParams.m_cachedAngleSincos[direction].resize(
+            channelParams.m_angle[direction].size());
+        for (size_t cluster = 0; cluster < channelParams.m_angle[direction].size(); cluster++)
+        {
+            channelParams.m_cachedAngleSincos[direction][cluster] = {
+                sin(channelParams.m_angle[direction][cluster] * DEG2RAD),
+                cos(channelParams.m_angle[direction][cluster] * DEG2RAD)};
+        }
+    }
+}
+
 ThreeGppChannelModel::ThreeGppChannelModel()
 {
     NS_LOG_FUNCTION(this);
@@ -1093,6 +1117,10 @@ ThreeGppChannelModel::DoDispose()
     m_channelMatrixMap.clear();
     m_channelParamsMap.clear();
     m_channelConditionModel = nullptr;
+    m_channelGenerationPool.reset();
+    m_channelMatrixCache.Clear();
+    m_channelParamsCache.Clear();
+    m_compactChannels.clear();
 }
 
 TypeId
@@ -1157,6 +1185,69 @@ ThreeGppChannelModel::GetTypeId()
                           DoubleValue(0.0),
                           MakeDoubleAccessor(&ThreeGppChannelModel::m_vScatt),
                           MakeDoubleChecker<double>(0.0))
+            .AddAttribute("SpatialConsistentUpdate",
+                          "If true, when the update period expires the delays and the angles of "
+                          "the clusters are updated according to the displacements of the nodes "
+                          "(procedure A of 3GPP TR 38.901, Sec. 7.6.3.2) and the coefficients of "
+                          "the channel matrix are rotated accordingly, instead of drawing new "
+                          "channel parameters and coefficients, unless the channel "
+                          "condition changed or a node moved farther than MaxUpdateDistance "
+                          "since the channel was generated.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&ThreeGppChannelModel::m_spatialConsistentUpdate),
+                          MakeBooleanChecker())
+            .AddAttribute("MaxUpdateDistance",
+                          "The maximum distance, in meters, that a node can move since the "
+                          "generation of the channel before a new channel is generated, when "
+                          "SpatialConsistentUpdate is true.",
+                          DoubleValue(10.0),
+                          MakeDoubleAccessor(&ThreeGppChannelModel::m_maxUpdateDistance),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("MaxChannelMatrixBytes",
+                          "The memory budget, in bytes, of the cache of the channel matrices. "
+                          "When the budget is exceeded, the least recently used channel matrices "
+                          "are discarded and generated anew when needed. 0 means no budget.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&ThreeGppChannelModel::m_maxChannelMatrixBytes),
+                          MakeUintegerChecker<uint64_t>())
+            .AddAttribute("MaxChannelParamsBytes",
+                          "The memory budget, in bytes, of the cache of the channel parameters. "
+                          "When the budget is exceeded, the least recently used channel "
+                          "parameters are discarded and generated anew when needed. 0 means no "
+                          "budget.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&ThreeGppChannelModel::m_maxChannelParamsBytes),
+                          MakeUintegerChecker<uint64_t>())
+            .AddAttribute("CompactChannelAge",
+                          "The coefficients of the cached channel matrices that have not been "
+                          "requested for this time are stored in single precision, and restored "
+                          "(with single precision accuracy) when requested again. 0 means that "
+                          "the coefficients are always stored in double precision.",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&ThreeGppChannelModel::m_compactChannelAge),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("ChannelGenerationThreads",
+                          "The number of threads generating the channel matrices requested "
+                          "through GetChannels. With a value larger than 1, the coefficients "
+                          "of the channel matrices are computed in parallel; the channel "
+                          "parameters are still generated sequentially, hence the results do "
+                          "not depend on this value.",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&ThreeGppChannelModel::SetChannelGenerationThreads,
+                                               &ThreeGppChannelModel::GetChannelGenerationThreads),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddTraceSource("ChannelMatrixCache",
+                            "The hit rate and the memory used by the cache of the channel "
+                            "matrices, reported at each access to the cache",
+                            MakeTraceSourceAccessor(
+                                &ThreeGppChannelModel::m_channelMatrixCacheTrace),
+                            "ns3::ThreeGppChannelModel::CacheTracedCallback")
+            .AddTraceSource("ChannelParamsCache",
+                            "The hit rate and the memory used by the cache of the channel "
+                            "parameters, reported at each access to the cache",
+                            MakeTraceSourceAccessor(
+                                &ThreeGppChannelModel::m_channelParamsCacheTrace),
+                            "ns3::ThreeGppChannelModel::CacheTracedCallback")
 
         ;
     return tid;
@@ -2435,17 +2526,236 @@ ThreeGppChannelModel::ChannelParamsNeedsUpdate(Ptr<const ThreeGppChannelParams>
     }
 
     // if the coherence time is over the channel has to be updated
-    if (!m_updatePeriod.IsZero() &&
-        Simulator::Now() - channelParams->m_generatedTime > m_updatePeriod)
+    Time lastUpdateTime = std::max(channelParams->m_generatedTime, channelParams->m_updatedTime);
+    if (!m_updatePeriod.IsZero() && Simulator::Now() - lastUpdateTime > m_updatePeriod)
     {
-        NS_LOG_DEBUG("Generation time " << channelParams->m_generatedTime.As(Time::NS) << " now "
-                                        << Now().As(Time::NS));
+        NS_LOG_DEBUG("Last update time " << lastUpdateTime.As(Time::NS) << " now "
+                                         << Now().As(Time::NS));
         update = true;
     }
 
     return update;
 }
 
+bool
+ThreeGppChannelModel::ChannelParamsCanBeUpdated(Ptr<const ThreeGppChannelParams> channelParams,
+                                                Ptr<const ChannelCondition> channelCondition,
+                                                Ptr<const MobilityModel> aMob,
+                                                Ptr<const MobilityModel> bMob) const
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_spatialConsistentUpdate)
+    {
+        return false;
+    }
+
+    // a change of the channel condition requires new large scale parameters
+    if (!channelCondition->IsEqual(channelParams->m_losCondition, channelParams->m_o2iCondition))
+    {
+        return false;
+    }
+
+    // the update is only accurate for small displacements
+    bool isSameDirection = (channelParams->m_nodeIds.first == aMob->GetObject<Node>()->GetId());
+    const auto& sMob = isSameDirection ? aMob : bMob;
+    const auto& uMob = isSameDirection ? bMob : aMob;
+    double sDistance =
+        CalculateDistance(sMob->GetPosition(), channelParams->m_generatedPositions.first);
+    double uDistance =
+        CalculateDistance(uMob->GetPosition(), channelParams->m_generatedPositions.second);
+    NS_LOG_DEBUG("Displacements since the generation " << sDistance << " " << uDistance);
+    return sDistance <= m_maxUpdateDistance && uDistance <= m_maxUpdateDistance;
+}
+
+void
+ThreeGppChannelModel::UpdateChannelParameters(Ptr<ThreeGppChannelParams> channelParams,
+                                              Ptr<const MobilityModel> aMob,
+                                              Ptr<const MobilityModel> bMob) const
+{
+    NS_LOG_FUNCTION(this);
+
+    // the channel params are stored with the first node of m_nodeIds as node s
+    bool isSameDirection = (channelParams->m_nodeIds.first == aMob->GetObject<Node>()->GetId());
+    Vector sPos = isSameDirection ? aMob->GetPosition() : bMob->GetPosition();
+    Vector uPos = isSameDirection ? bMob->GetPosition() : aMob->GetPosition();
+    Vector sDelta = sPos - channelParams->m_updatedPositions.first;
+    Vector uDelta = uPos - channelParams->m_updatedPositions.second;
+
+    double prevDistance3D = CalculateDistance(channelParams->m_updatedPositions.first,
+                                              channelParams->m_updatedPositions.second);
+    double distance3D = CalculateDistance(sPos, uPos);
+
+    // store the delays and the angles before the update, which are needed to update the
+    // channel matrices generated with them
+    channelParams->m_previousUpdatedTime =
+        std::max(channelParams->m_generatedTime, channelParams->m_updatedTime);
+    channelParams->m_previousDelay = channelParams->m_delay;
+    channelParams->m_previousAngle = channelParams->m_angle;
+
+    for (size_t cIndex = 0; cIndex < channelParams->m_delay.size(); cIndex++)
+    {
+        double aoa = channelParams->m_angle[AOA_INDEX][cIndex] * DEG2RAD;
+        double zoa = channelParams->m_angle[ZOA_INDEX][cIndex] * DEG2RAD;
+        double aod = channelParams->m_angle[AOD_INDEX][cIndex] * DEG2RAD;
+        double zod = channelParams->m_angle[ZOD_INDEX][cIndex] * DEG2RAD;
+
+        // project the displacements on the spherical unit vectors (7.1-13) and (7.1-14)
+        // of the arrival and departure directions
+        double uDeltaR = uDelta.x * sin(zoa) * cos(aoa) + uDelta.y * sin(zoa) * sin(aoa) +
+                         uDelta.z * cos(zoa);
+        double uDeltaTheta = uDelta.x * cos(zoa) * cos(aoa) + uDelta.y * cos(zoa) * sin(aoa) -
+                             uDelta.z * sin(zoa);
+        double uDeltaPhi = -uDelta.x * sin(aoa) + uDelta.y * cos(aoa);
+        double sDeltaR = sDelta.x * sin(zod) * cos(aod) + sDelta.y * sin(zod) * sin(aod) +
+                         sDelta.z * cos(zod);
+        double sDeltaTheta = sDelta.x * cos(zod) * cos(aod) + sDelta.y * cos(zod) * sin(aod) -
+                             sDelta.z * sin(zod);
+        double sDeltaPhi = -sDelta.x * sin(aod) + sDelta.y * cos(aod);
+
+        // length of the path before the update, i.e., c times the absolute delay
+        double pathLength = 3.0e8 * channelParams->m_delay[cIndex] + prevDistance3D;
+
+        // update the delay, which is relative to the delay of the LOS path
+        double newPathLength = pathLength - uDeltaR - sDeltaR;
+        channelParams->m_delay[cIndex] = std::max(newPathLength - distance3D, 0.0) / 3.0e8;
+
+        // update the angles, assuming that the scatterer is at a distance equal to
+        // the length of the path (single bounce approximation)
+        double deltaAoa = -uDeltaPhi / pathLength;
+        double deltaZoa = -uDeltaTheta / pathLength;
+        double deltaAod = -sDeltaPhi / pathLength;
+        double deltaZod = -sDeltaTheta / pathLength;
+        channelParams->m_angle[AOA_INDEX][cIndex] += RadiansToDegrees(deltaAoa);
+        channelParams->m_angle[ZOA_INDEX][cIndex] += RadiansToDegrees(deltaZoa);
+        channelParams->m_angle[AOD_INDEX][cIndex] += RadiansToDegrees(deltaAod);
+        channelParams->m_angle[ZOD_INDEX][cIndex] += RadiansToDegrees(deltaZod);
+
+        // the rays of a cluster are rotated together with the cluster
+        if (cIndex < channelParams->m_reducedClusterNumber)
+        {
+            for (size_t mIndex = 0; mIndex < channelParams->m_rayAoaRadian[cIndex].size();
+                 mIndex++)
+            {
+                std::tie(channelParams->m_rayAoaRadian[cIndex][mIndex],
+                         channelParams->m_rayZoaRadian[cIndex][mIndex]) =
+                    WrapAngles(channelParams->m_rayAoaRadian[cIndex][mIndex] + deltaAoa,
+                               channelParams->m_rayZoaRadian[cIndex][mIndex] + deltaZoa);
+                std::tie(channelParams->m_rayAodRadian[cIndex][mIndex],
+                         channelParams->m_rayZodRadian[cIndex][mIndex]) =
+                    WrapAngles(channelParams->m_rayAodRadian[cIndex][mIndex] + deltaAod,
+                               channelParams->m_rayZodRadian[cIndex][mIndex] + deltaZod);
+            }
+        }
+    }
+
+    CacheAngleSincos(*channelParams);
+    // invalidate the delay terms cached by the spectrum propagation loss model
+    channelParams->m_cachedRbWidth = 0.0;
+
+    channelParams->m_dis3D = distance3D;
+    channelParams->m_dis2D = std::sqrt((sPos.x - uPos.x) * (sPos.x - uPos.x) +
+                                       (sPos.y - uPos.y) * (sPos.y - uPos.y));
+    channelParams->m_updatedTime = Simulator::Now();
+    channelParams->m_updatedPositions = std::make_pair(sPos, uPos);
+}
+
+Ptr<MatrixBasedChannelModel::ChannelMatrix>
+ThreeGppChannelModel::GetUpdatedChannel(Ptr<const ChannelMatrix> channelMatrix,
+                                        Ptr<const ThreeGppChannelParams> channelParams,
+                                        Ptr<const MobilityModel> aMob,
+                                        Ptr<const MobilityModel> bMob,
+                                        Ptr<const PhasedArrayModel> aAntenna,
+                                        Ptr<const PhasedArrayModel> bAntenna) const
+{
+    NS_LOG_FUNCTION(this);
+
+    // the channel matrix may still be used by the callers of GetChannel, hence the rotated
+    // coefficients are stored in a new channel matrix
+    auto updatedMatrix = Create<ChannelMatrix>();
+    updatedMatrix->m_channel = channelMatrix->m_channel;
+    updatedMatrix->m_generatedTime = Simulator::Now();
+    updatedMatrix->m_antennaPair = channelMatrix->m_antennaPair;
+    updatedMatrix->m_nodeIds = channelMatrix->m_nodeIds;
+
+    // the arrival and departure directions of the channel params are those of the u and s
+    // nodes of the channel matrix if they were generated in the same direction
+    bool isSameDirection = (channelParams->m_nodeIds == channelMatrix->m_nodeIds);
+    auto sAntenna = (aAntenna->GetId() == channelMatrix->m_antennaPair.first) ? aAntenna : bAntenna;
+    auto uAntenna = (sAntenna == aAntenna) ? bAntenna : aAntenna;
+    auto uLocs = uAntenna->GetElementLocations();
+    auto sLocs = sAntenna->GetElementLocations();
+
+    // the velocities of the nodes, in the order of m_nodeIds of the channel params
+    bool isParamsSameDirection =
+        (channelParams->m_nodeIds.first == aMob->GetObject<Node>()->GetId());
+    Vector sSpeed = isParamsSameDirection ? aMob->GetVelocity() : bMob->GetVelocity();
+    Vector uSpeed = isParamsSameDirection ? bMob->GetVelocity() : aMob->GetVelocity();
+
+    // unit vector of a direction, given the zenith and the azimuth in degrees (7.1-13)
+    auto direction = [](double zenith, double azimuth) {
+        return Vector(sin(zenith * DEG2RAD) * cos(azimuth * DEG2RAD),
+                      sin(zenith * DEG2RAD) * sin(azimuth * DEG2RAD),
+                      cos(zenith * DEG2RAD));
+    };
+    auto dot = [](const Vector& a, const Vector& b) { return a.x * b.x + a.y * b.y + a.z * b.z; };
+
+    // same as the Doppler term of the ThreeGppSpectrumPropagationLossModel
+    double dopplerFactor = 2 * M_PI * Simulator::Now().GetSeconds() * m_frequency / 3e8;
+
+    Complex3DVector& hUsn = updatedMatrix->m_channel;
+    const auto& angle = channelParams->m_angle;
+    const auto& previousAngle = channelParams->m_previousAngle;
+    NS_ASSERT(hUsn.GetNumPages() <= channelParams->m_delay.size());
+    NS_ASSERT(hUsn.GetNumPages() <= channelParams->m_previousDelay.size());
+    std::vector<std::complex<double>> rxTerms(hUsn.GetNumRows());
+    std::vector<std::complex<double>> txTerms(hUsn.GetNumCols());
+    for (size_t cIndex = 0; cIndex < hUsn.GetNumPages(); cIndex++)
+    {
+        Vector arrivalShift =
+            direction(angle[ZOA_INDEX][cIndex], angle[AOA_INDEX][cIndex]) -
+            direction(previousAngle[ZOA_INDEX][cIndex], previousAngle[AOA_INDEX][cIndex]);
+        Vector departureShift =
+            direction(angle[ZOD_INDEX][cIndex], angle[AOD_INDEX][cIndex]) -
+            direction(previousAngle[ZOD_INDEX][cIndex], previousAngle[AOD_INDEX][cIndex]);
+
+        // the delay term applied by the ThreeGppSpectrumPropagationLossModel rotates the phase
+        // at the carrier frequency by -2 pi f tau, and the Doppler term by the product of
+        // dopplerFactor and the projections of the velocities on the directions of the cluster
+        double phase =
+            2 * M_PI * m_frequency *
+                (channelParams->m_delay[cIndex] - channelParams->m_previousDelay[cIndex]) -
+            dopplerFactor * (dot(arrivalShift, uSpeed) + dot(departureShift, sSpeed));
+
+        // lambda_0 is accounted in the antenna spacing uLoc and sLoc.
+        const Vector& rxShift = isSameDirection ? arrivalShift : departureShift;
+        const Vector& txShift = isSameDirection ? departureShift : arrivalShift;
+        for (size_t uIndex = 0; uIndex < rxTerms.size(); uIndex++)
+        {
+            double rxPhaseDiff = 2 * M_PI *
+                                 (rxShift.x * uLocs->x[uIndex] + rxShift.y * uLocs->y[uIndex] +
+                                  rxShift.z * uLocs->z[uIndex]);
+            rxTerms[uIndex] = std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff));
+        }
+        for (size_t sIndex = 0; sIndex < txTerms.size(); sIndex++)
+        {
+            double txPhaseDiff = phase + 2 * M_PI *
+                                             (txShift.x * sLocs->x[sIndex] +
+                                              txShift.y * sLocs->y[sIndex] +
+                                              txShift.z * sLocs->z[sIndex]);
+            txTerms[sIndex] = std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+        }
+        for (size_t uIndex = 0; uIndex < rxTerms.size(); uIndex++)
+        {
+            for (size_t sIndex = 0; sIndex < txTerms.size(); sIndex++)
+            {
+                hUsn(uIndex, sIndex, cIndex) *= rxTerms[uIndex] * txTerms[sIndex];
+            }
+        }
+    }
+    return updatedMatrix;
+}
+
 bool
 ThreeGppChannelModel::ChannelMatrixNeedsUpdate(Ptr<const ThreeGppChannelParams> channelParams,
                                                Ptr<const ChannelMatrix> channelMatrix)
@@ -2476,6 +2786,76 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
                                  Ptr<const PhasedArrayModel> bAntenna)
 {
     NS_LOG_FUNCTION(this);
+    return DoGetChannel(aMob, bMob, aAntenna, bAntenna, nullptr);
+}
+
+std::vector<Ptr<const MatrixBasedChannelModel::ChannelMatrix>>
+ThreeGppChannelModel::GetChannels(const std::vector<ChannelRequest>& requests)
+{
+    NS_LOG_FUNCTION(this << requests.size());
+
+    if (!m_channelGenerationPool)
+    {
+        return MatrixBasedChannelModel::GetChannels(requests);
+    }
+
+    // Look up the channels and generate the channel parameters in the order of the requests,
+    // so that random numbers are drawn as if GetChannel were called for each request. The
+    // channel matrices to be generated are only allocated and stored at this stage.
+    std::vector<Ptr<const ChannelMatrix>> channels;
+    channels.reserve(requests.size());
+    std::vector<ChannelGeneration> generations;
+    for (const auto& request : requests)
+    {
+        channels.push_back(DoGetChannel(request.aMob,
+                                        request.bMob,
+                                        request.aAntenna,
+                                        request.bAntenna,
+                                        &generations));
+    }
+
+    // the coefficients of each channel matrix only depend on its own generation inputs
+    NS_LOG_DEBUG("Generating " << generations.size() << " channel matrices with "
+                               << m_channelGenerationPool->GetNThreads() << " threads");
+    m_channelGenerationPool->ParallelFor(generations.size(), [this, &generations](std::size_t i) {
+        const auto& generation = generations[i];
+        GenerateChannelCoefficients(*generation.channelMatrix,
+                                    *generation.channelParams,
+                                    *generation.table3gpp,
+                                    generation.sPos,
+                                    generation.uPos,
+                                    *generation.sAntenna,
+                                    *generation.uAntenna);
+    });
+
+    return channels;
+}
+
+void
+ThreeGppChannelModel::SetChannelGenerationThreads(uint32_t nThreads)
+{
+    NS_LOG_FUNCTION(this << nThreads);
+    m_channelGenerationPool.reset();
+    if (nThreads > 1)
+    {
+        m_channelGenerationPool = std::make_unique<ThreadPool>(nThreads);
+    }
+}
+
+uint32_t
+ThreeGppChannelModel::GetChannelGenerationThreads() const
+{
+    return m_channelGenerationPool ? m_channelGenerationPool->GetNThreads() : 1;
+}
+
+Ptr<MatrixBasedChannelModel::ChannelMatrix>
+ThreeGppChannelModel::DoGetChannel(Ptr<const MobilityModel> aMob,
+                                   Ptr<const MobilityModel> bMob,
+                                   Ptr<const PhasedArrayModel> aAntenna,
+                                   Ptr<const PhasedArrayModel> bAntenna,
+                                   std::vector<ChannelGeneration>* generations)
+{
+    NS_LOG_FUNCTION(this);
 
     // Compute the channel params key. The key is reciprocal, i.e., key (a, b) = key (b, a)
     uint64_t channelParamsKey =
@@ -2493,6 +2873,7 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
     bool updateMatrix = false;
     bool notFoundParams = false;
     bool notFoundMatrix = false;
+    bool rotateMatrix = false;
     Ptr<ChannelMatrix> channelMatrix;
     Ptr<ThreeGppChannelParams> channelParams;
 
@@ -2501,6 +2882,12 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
         channelParams = m_channelParamsMap[channelParamsKey];
         // check if it has to be updated
         updateParams = ChannelParamsNeedsUpdate(channelParams, condition);
+        if (updateParams && ChannelParamsCanBeUpdated(channelParams, condition, aMob, bMob))
+        {
+            NS_LOG_DEBUG("update the channel params");
+            UpdateChannelParameters(channelParams, aMob, bMob);
+            updateParams = false;
+        }
     }
     else
     {
@@ -2525,14 +2912,26 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
         // store or replace the channel parameters
         m_channelParamsMap[channelParamsKey] = channelParams;
     }
+    UpdateChannelParamsCache(channelParamsKey, channelParams, !notFoundParams && !updateParams);
 
     if (m_channelMatrixMap.find(channelMatrixKey) != m_channelMatrixMap.end())
     {
         // channel matrix present in the map
         NS_LOG_DEBUG("channel matrix present in the map");
         channelMatrix = m_channelMatrixMap[channelMatrixKey];
+        RestoreChannelMatrix(channelMatrixKey, *channelMatrix);
         updateMatrix = ChannelMatrixNeedsUpdate(channelParams, channelMatrix);
         updateMatrix |= AntennaSetupChanged(aAntenna, bAntenna, channelMatrix);
+        // the channel params may have been evicted from the cache and generated anew
+        updateMatrix |= notFoundParams || updateParams;
+        // if the channel params have been updated since the generation of the channel matrix,
+        // the channel matrix is rotated if it was up to date before the last update, and
+        // generated anew otherwise
+        if (!updateMatrix && channelParams->m_updatedTime > channelMatrix->m_generatedTime)
+        {
+            rotateMatrix = (channelMatrix->m_generatedTime >= channelParams->m_previousUpdatedTime);
+            updateMatrix = !rotateMatrix;
+        }
     }
     else
     {
@@ -2540,12 +2939,47 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
         notFoundMatrix = true;
     }
 
+    if (rotateMatrix)
+    {
+        NS_LOG_DEBUG("rotate the coefficients of the channel matrix");
+        channelMatrix =
+            GetUpdatedChannel(channelMatrix, channelParams, aMob, bMob, aAntenna, bAntenna);
+        m_channelMatrixMap[channelMatrixKey] = channelMatrix;
+    }
+
     // If the channel is not present in the map or if it has to be updated
     // generate a new realization
     if (notFoundMatrix || updateMatrix)
     {
         // channel matrix not found or has to be updated, generate a new one
-        channelMatrix = GetNewChannel(channelParams, table3gpp, aMob, bMob, aAntenna, bAntenna);
+        if (generations == nullptr)
+        {
+            channelMatrix =
+                GetNewChannel(channelParams, table3gpp, aMob, bMob, aAntenna, bAntenna);
+        }
+        else
+        {
+            // defer the generation of the coefficients, but allocate a channel matrix with the
+            // final dimensions so that it is found up to date by the following requests
+            channelMatrix = Create<ChannelMatrix>();
+            channelMatrix->m_generatedTime = Simulator::Now();
+            channelMatrix->m_nodeIds = std::make_pair(aMob->GetObject<Node>()->GetId(),
+                                                      bMob->GetObject<Node>()->GetId());
+            uint16_t numOverallCluster =
+                (channelParams->m_cluster1st != channelParams->m_cluster2nd)
+                    ? channelParams->m_reducedClusterNumber + 4
+                    : channelParams->m_reducedClusterNumber + 2;
+            channelMatrix->m_channel = Complex3DVector(bAntenna->GetNumElems(),
+                                                       aAntenna->GetNumElems(),
+                                                       numOverallCluster);
+            generations->push_back({channelMatrix,
+                                    channelParams,
+                                    table3gpp,
+                                    aMob->GetPosition(),
+                                    bMob->GetPosition(),
+                                    aAntenna,
+                                    bAntenna});
+        }
         channelMatrix->m_antennaPair =
             std::make_pair(aAntenna->GetId(),
                            bAntenna->GetId()); // save antenna pair, with the exact order of s and u
@@ -2554,10 +2988,178 @@ ThreeGppChannelModel::GetChannel(Ptr<const MobilityModel> aMob,
         // store or replace the channel matrix in the channel map
         m_channelMatrixMap[channelMatrixKey] = channelMatrix;
     }
+    UpdateChannelMatrixCache(channelMatrixKey, channelMatrix, !notFoundMatrix && !updateMatrix);
 
     return channelMatrix;
 }
 
+void
+ThreeGppChannelModel::UpdateChannelMatrixCache(uint64_t key,
+                                               Ptr<const ChannelMatrix> channelMatrix,
+                                               bool hit)
+{
+    NS_LOG_FUNCTION(this << key << hit);
+
+    m_channelMatrixAccesses++;
+    m_channelMatrixHits += hit ? 1 : 0;
+    m_channelMatrixCache.Touch(key, GetChannelMatrixBytes(*channelMatrix), Simulator::Now());
+
+    if (m_compactChannelAge.IsStrictlyPositive())
+    {
+        for (auto compactKey : m_channelMatrixCache.Age(Simulator::Now() - m_compactChannelAge))
+        {
+            auto channelMatrix = m_channelMatrixMap.at(compactKey);
+            const auto& coefficients = channelMatrix->m_channel;
+            CompactChannel compact{coefficients.GetNumRows(),
+                                   coefficients.GetNumCols(),
+                                   coefficients.GetNumPages(),
+                                   std::vector<std::complex<float>>(coefficients.GetSize())};
+            for (size_t i = 0; i < coefficients.GetSize(); i++)
+            {
+                compact.values[i] = std::complex<float>(coefficients.GetValues()[i]);
+            }
+            NS_LOG_DEBUG("Compacting channel matrix " << compactKey);
+            // the channel matrix may still be used by the callers of GetChannel, hence it is
+            // replaced in the map by a new channel matrix without coefficients
+            auto compactMatrix = Create<ChannelMatrix>();
+            compactMatrix->m_generatedTime = channelMatrix->m_generatedTime;
+            compactMatrix->m_antennaPair = channelMatrix->m_antennaPair;
+            compactMatrix->m_nodeIds = channelMatrix->m_nodeIds;
+            m_channelMatrixMap[compactKey] = compactMatrix;
+            m_channelMatrixCache.SetBytes(compactKey,
+                                          GetChannelMatrixBytes(*compactMatrix) +
+                                              compact.values.size() *
+                                                  sizeof(std::complex<float>));
+            m_compactChannels[compactKey] = std::move(compact);
+        }
+    }
+
+    if (m_maxChannelMatrixBytes > 0)
+    {
+        for (auto evictedKey : m_channelMatrixCache.Evict(m_maxChannelMatrixBytes))
+        {
+            m_channelMatrixMap.erase(evictedKey);
+            m_compactChannels.erase(evictedKey);
+        }
+    }
+
+    m_channelMatrixCacheTrace(static_cast<double>(m_channelMatrixHits) / m_channelMatrixAccesses,
+                              m_channelMatrixCache.GetBytes());
+}
+
+void
+ThreeGppChannelModel::UpdateChannelParamsCache(uint64_t key,
+                                               Ptr<const ThreeGppChannelParams> channelParams,
+                                               bool hit)
+{
+    NS_LOG_FUNCTION(this << key << hit);
+
+    m_channelParamsAccesses++;
+    m_channelParamsHits += hit ? 1 : 0;
+    m_channelParamsCache.Touch(key, GetChannelParamsBytes(*channelParams), Simulator::Now());
+
+    if (m_maxChannelParamsBytes > 0)
+    {
+        for (auto evictedKey : m_channelParamsCache.Evict(m_maxChannelParamsBytes))
+        {
+            m_channelParamsMap.erase(evictedKey);
+        }
+    }
+
+    m_channelParamsCacheTrace(static_cast<double>(m_channelParamsHits) / m_channelParamsAccesses,
+                              m_channelParamsCache.GetBytes());
+}
+
+void
+ThreeGppChannelModel::RestoreChannelMatrix(uint64_t key, ChannelMatrix& channelMatrix)
+{
+    auto it = m_compactChannels.find(key);
+    if (it == m_compactChannels.end())
+    {
+        return;
+    }
+
+    NS_LOG_DEBUG("Restoring channel matrix " << key);
+    const auto& compact = it->second;
+    std::valarray<std::complex<double>> values(compact.values.size());
+    for (size_t i = 0; i < compact.values.size(); i++)
+    {
+        values[i] = std::complex<double>(compact.values[i]);
+    }
+    channelMatrix.m_channel =
+        Complex3DVector(compact.numRows, compact.numCols, compact.numPages, std::move(values));
+    m_compactChannels.erase(it);
+}
+
+void
+ThreeGppChannelModel::NotifyChannelParamsUpdated(Ptr<const MobilityModel> aMob,
+                                                 Ptr<const MobilityModel> bMob)
+{
+    NS_LOG_FUNCTION(this);
+
+    uint64_t channelParamsKey =
+        GetKey(aMob->GetObject<Node>()->GetId(), bMob->GetObject<Node>()->GetId());
+    auto it = m_channelParamsMap.find(channelParamsKey);
+    if (it == m_channelParamsMap.end())
+    {
+        return;
+    }
+    // the auxiliary variables cached in the channel params (e.g., the delay sincos)
+    // are filled when the channel params are first used
+    m_channelParamsCache.SetBytes(channelParamsKey, GetChannelParamsBytes(*it->second));
+
+    if (m_maxChannelParamsBytes > 0)
+    {
+        for (auto evictedKey : m_channelParamsCache.Evict(m_maxChannelParamsBytes))
+        {
+            m_channelParamsMap.erase(evictedKey);
+        }
+    }
+
+    m_channelParamsCacheTrace(static_cast<double>(m_channelParamsHits) / m_channelParamsAccesses,
+                              m_channelParamsCache.GetBytes());
+}
+
+size_t
+ThreeGppChannelModel::GetChannelMatrixBytes(const ChannelMatrix& channelMatrix)
+{
+    return sizeof(ChannelMatrix) + channelMatrix.m_channel.GetSize() * sizeof(std::complex<double>);
+}
+
+size_t
+ThreeGppChannelModel::GetChannelParamsBytes(const ThreeGppChannelParams& channelParams)
+{
+    auto bytes2D = [](const Double2DVector& values) {
+        size_t bytes = values.size() * sizeof(DoubleVector);
+        for (const auto& row : values)
+        {
+            bytes += row.size() * sizeof(double);
+        }
+        return bytes;
+    };
+
+    size_t bytes = sizeof(ThreeGppChannelParams);
+    bytes += (channelParams.m_delay.size() + channelParams.m_alpha.size() +
+              channelParams.m_D.size() + channelParams.m_clusterPower.size() +
+              channelParams.m_attenuation_dB.size() + channelParams.m_previousDelay.size()) *
+             sizeof(double);
+    bytes += bytes2D(channelParams.m_angle) + bytes2D(channelParams.m_previousAngle) +
+             bytes2D(channelParams.m_nonSelfBlocking) + bytes2D(channelParams.m_norRvAngles) +
+             bytes2D(channelParams.m_rayAodRadian) + bytes2D(channelParams.m_rayAoaRadian) +
+             bytes2D(channelParams.m_rayZodRadian) + bytes2D(channelParams.m_rayZoaRadian) +
+             bytes2D(channelParams.m_crossPolarizationPowerRatios);
+    for (const auto& cluster : channelParams.m_clusterPhase)
+    {
+        bytes += bytes2D(cluster);
+    }
+    for (const auto& direction : channelParams.m_cachedAngleSincos)
+    {
+        bytes += direction.size() * sizeof(std::pair<double, double>);
+    }
+    bytes += channelParams.m_cachedDelaySincos.GetSize() * sizeof(std::complex<double>);
+    return bytes;
+}
+
 Ptr<const MatrixBasedChannelModel::ChannelParams>
 ThreeGppChannelModel::GetParams(Ptr<const MobilityModel> aMob, Ptr<const MobilityModel> bMob) const
 {
@@ -2592,6 +3194,8 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
         std::make_pair(aMob->GetObject<Node>()->GetId(), bMob->GetObject<Node>()->GetId());
     channelParams->m_losCondition = channelCondition->GetLosCondition();
     channelParams->m_o2iCondition = channelCondition->GetO2iCondition();
+    channelParams->m_generatedPositions = std::make_pair(aMob->GetPosition(), bMob->GetPosition());
+    channelParams->m_updatedPositions = channelParams->m_generatedPositions;
 
     // Step 4: Generate large scale parameters. All LSPS are uncorrelated.
     DoubleVector LSPsIndep;
@@ -3177,18 +3781,7 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
     channelParams->m_angle.push_back(clusterZod);
 
     // Precompute angles sincos
-    channelParams->m_cachedAngleSincos.resize(channelParams->m_angle.size());
-    for (size_t direction = 0; direction < channelParams->m_angle.size(); direction++)
-    {
-        channelParams->m_cachedAngleSincos[direction].resize(
-            channelParams->m_angle[direction].size());
-        for (size_t cluster = 0; cluster < channelParams->m_angle[direction].size(); cluster++)
-        {
-            channelParams->m_cachedAngleSincos[direction][cluster] = {
-                sin(channelParams->m_angle[direction][cluster] * DEG2RAD),
-                cos(channelParams->m_angle[direction][cluster] * DEG2RAD)};
-        }
-    }
+    CacheAngleSincos(*channelParams);
 
     // Compute alpha and D as described in 3GPP TR 37.885 v15.3.0, Sec. 6.2.3
     // These terms account for an additional Doppler contribution due to the
@@ -3238,83 +3831,116 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
 {
     NS_LOG_FUNCTION(this);
 
-    NS_ASSERT_MSG(m_frequency > 0.0, "Set the operating frequency first!");
-
     // create a channel matrix instance
     Ptr<ChannelMatrix> channelMatrix = Create<ChannelMatrix>();
     channelMatrix->m_generatedTime = Simulator::Now();
     // save in which order is generated this matrix
     channelMatrix->m_nodeIds =
         std::make_pair(sMob->GetObject<Node>()->GetId(), uMob->GetObject<Node>()->GetId());
-    // check if channelParams structure is generated in direction s-to-u or u-to-s
-    bool isSameDirection = (channelParams->m_nodeIds == channelMatrix->m_nodeIds);
 
-    MatrixBasedChannelModel::Double2DVector rayAodRadian;
-    MatrixBasedChannelModel::Double2DVector rayAoaRadian;
-    MatrixBasedChannelModel::Double2DVector rayZodRadian;
-    MatrixBasedChannelModel::Double2DVector rayZoaRadian;
+    GenerateChannelCoefficients(*channelMatrix,
+                                *channelParams,
+                                *table3gpp,
+                                sMob->GetPosition(),
+                                uMob->GetPosition(),
+                                *sAntenna,
+                                *uAntenna);
+    return channelMatrix;
+}
+
+void
+ThreeGppChannelModel::GenerateChannelCoefficients(ChannelMatrix& channelMatrix,
+                                                  const ThreeGppChannelParams& channelParams,
+                                                  const ParamsTable& table3gpp,
+                                                  const Vector& sPos,
+                                                  const Vector& uPos,
+                                                  const PhasedArrayModel& sAntenna,
+                                                  const PhasedArrayModel& uAntenna) const
+{
+    NS_LOG_FUNCTION(this);
+
+    NS_ASSERT_MSG(m_frequency > 0.0, "Set the operating frequency first!");
+
+    // check if channelParams structure is generated in direction s-to-u or u-to-s
+    bool isSameDirection = (channelParams.m_nodeIds == channelMatrix.m_nodeIds);
 
     // if channel params is generated in the same direction in which we
     // generate the channel matrix, angles and zenith od departure and arrival are ok,
-    // just set them to corresponding variable that will be used for the generation
-    // of channel matrix, otherwise we need to flip angles and zeniths of departure and arrival
-    if (isSameDirection)
-    {
-        rayAodRadian = channelParams->m_rayAodRadian;
-        rayAoaRadian = channelParams->m_rayAoaRadian;
-        rayZodRadian = channelParams->m_rayZodRadian;
-        rayZoaRadian = channelParams->m_rayZoaRadian;
-    }
-    else
-    {
-        rayAodRadian = channelParams->m_rayAoaRadian;
-        rayAoaRadian = channelParams->m_rayAodRadian;
-        rayZodRadian = channelParams->m_rayZoaRadian;
-        rayZoaRadian = channelParams->m_rayZodRadian;
-    }
+    // just use them for the generation of channel matrix, otherwise we need to flip
+    // angles and zeniths of departure and arrival
+    const Double2DVector& rayAodRadian =
+        isSameDirection ? channelParams.m_rayAodRadian : channelParams.m_rayAoaRadian;
+    const Double2DVector& rayAoaRadian =
+        isSameDirection ? channelParams.m_rayAoaRadian : channelParams.m_rayAodRadian;
+    const Double2DVector& rayZodRadian =
+        isSameDirection ? channelParams.m_rayZodRadian : channelParams.m_rayZoaRadian;
+    const Double2DVector& rayZoaRadian =
+        isSameDirection ? channelParams.m_rayZoaRadian : channelParams.m_rayZodRadian;
 
     // Step 11: Generate channel coefficients for each cluster n and each receiver
     //  and transmitter element pair u,s.
     // where n is cluster index, u and s are receive and transmit antenna element.
-    size_t uSize = uAntenna->GetNumElems();
-    size_t sSize = sAntenna->GetNumElems();
+    size_t uSize = uAntenna.GetNumElems();
+    size_t sSize = sAntenna.GetNumElems();
+    const uint8_t raysPerCluster = table3gpp.m_raysPerCluster;
 
     // NOTE: Since each of the strongest 2 clusters are divided into 3 sub-clusters,
     // the total cluster will generally be numReducedCLuster + 4.
     // However, it might be that m_cluster1st = m_cluster2nd. In this case the
     // total number of clusters will be numReducedCLuster + 2.
-    uint16_t numOverallCluster = (channelParams->m_cluster1st != channelParams->m_cluster2nd)
-                                     ? channelParams->m_reducedClusterNumber + 4
-                                     : channelParams->m_reducedClusterNumber + 2;
-    Complex3DVector hUsn(uSize, sSize, numOverallCluster); // channel coefficient hUsn (u, s, n);
-    NS_ASSERT(channelParams->m_reducedClusterNumber <= channelParams->m_clusterPhase.size());
-    NS_ASSERT(channelParams->m_reducedClusterNumber <= channelParams->m_clusterPower.size());
-    NS_ASSERT(channelParams->m_reducedClusterNumber <=
-              channelParams->m_crossPolarizationPowerRatios.size());
-    NS_ASSERT(channelParams->m_reducedClusterNumber <= rayZoaRadian.size());
-    NS_ASSERT(channelParams->m_reducedClusterNumber <= rayZodRadian.size());
-    NS_ASSERT(channelParams->m_reducedClusterNumber <= rayAoaRadian.size());
-    NS_ASSERT(channelParams->m_reducedClusterNumber <= rayAodRadian.size());
-    NS_ASSERT(table3gpp->m_raysPerCluster <= channelParams->m_clusterPhase[0].size());
-    NS_ASSERT(table3gpp->m_raysPerCluster <=
-              channelParams->m_crossPolarizationPowerRatios[0].size());
-    NS_ASSERT(table3gpp->m_raysPerCluster <= rayZoaRadian[0].size());
-    NS_ASSERT(table3gpp->m_raysPerCluster <= rayZodRadian[0].size());
-    NS_ASSERT(table3gpp->m_raysPerCluster <= rayAoaRadian[0].size());
-    NS_ASSERT(table3gpp->m_raysPerCluster <= rayAodRadian[0].size());
-
-    double x = sMob->GetPosition().x - uMob->GetPosition().x;
-    double y = sMob->GetPosition().y - uMob->GetPosition().y;
+    uint16_t numOverallCluster = (channelParams.m_cluster1st != channelParams.m_cluster2nd)
+                                     ? channelParams.m_reducedClusterNumber + 4
+                                     : channelParams.m_reducedClusterNumber + 2;
+    // channel coefficient hUsn (u, s, n); all the coefficients are overwritten below, hence
+    // a matrix that already has the right dimensions is reused
+    Complex3DVector& hUsn = channelMatrix.m_channel;
+    if (hUsn.GetNumRows() != uSize || hUsn.GetNumCols() != sSize ||
+        hUsn.GetNumPages() != numOverallCluster)
+    {
+        hUsn = Complex3DVector(uSize, sSize, numOverallCluster);
+    }
+    NS_ASSERT(channelParams.m_reducedClusterNumber <= channelParams.m_clusterPhase.size());
+    NS_ASSERT(channelParams.m_reducedClusterNumber <= channelParams.m_clusterPower.size());
+    NS_ASSERT(channelParams.m_reducedClusterNumber <=
+              channelParams.m_crossPolarizationPowerRatios.size());
+    NS_ASSERT(channelParams.m_reducedClusterNumber <= rayZoaRadian.size());
+    NS_ASSERT(channelParams.m_reducedClusterNumber <= rayZodRadian.size());
+    NS_ASSERT(channelParams.m_reducedClusterNumber <= rayAoaRadian.size());
+    NS_ASSERT(channelParams.m_reducedClusterNumber <= rayAodRadian.size());
+    NS_ASSERT(raysPerCluster <= channelParams.m_clusterPhase[0].size());
+    NS_ASSERT(raysPerCluster <= channelParams.m_crossPolarizationPowerRatios[0].size());
+    NS_ASSERT(raysPerCluster <= rayZoaRadian[0].size());
+    NS_ASSERT(raysPerCluster <= rayZodRadian[0].size());
+    NS_ASSERT(raysPerCluster <= rayAoaRadian[0].size());
+    NS_ASSERT(raysPerCluster <= rayAodRadian[0].size());
+
+    double x = sPos.x - uPos.x;
+    double y = sPos.y - uPos.y;
     double distance2D = sqrt(x * x + y * y);
     // NOTE we assume hUT = min (height(a), height(b)) and
     // hBS = max (height (a), height (b))
-    double hUt = std::min(sMob->GetPosition().z, uMob->GetPosition().z);
-    double hBs = std::max(sMob->GetPosition().z, uMob->GetPosition().z);
+    double hUt = std::min(sPos.z, uPos.z);
+    double hBs = std::max(sPos.z, uPos.z);
     // compute the 3D distance using eq. 7.4-1
     double distance3D = std::sqrt(distance2D * distance2D + (hBs - hUt) * (hBs - hUt));
 
-    Angles sAngle(uMob->GetPosition(), sMob->GetPosition());
-    Angles uAngle(sMob->GetPosition(), uMob->GetPosition());
+    Angles sAngle(uPos, sPos);
+    Angles uAngle(sPos, uPos);
+
+    // retrieve the locations of the antenna elements, which are cached by the arrays, and
+    // cache the polarizations of the antenna elements
+    auto uLocs = uAntenna.GetElementLocations();
+    std::vector<uint8_t> uPols(uSize);
+    for (size_t uIndex = 0; uIndex < uSize; uIndex++)
+    {
+        uPols[uIndex] = uAntenna.GetElemPol(uIndex);
+    }
+    auto sLocs = sAntenna.GetElementLocations();
+    std::vector<uint8_t> sPols(sSize);
+    for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+    {
+        sPols[sIndex] = sAntenna.GetElemPol(sIndex);
+    }
 
     Double2DVector sinCosA; // cached multiplications of sin and cos of the ZoA and AoA angles
     Double2DVector sinSinA; // cached multiplications of sines of the ZoA and AoA angles
@@ -3326,55 +3952,78 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
     // contains part of the ray expression, cached as independent from the u- and s-indexes,
     // but calculate it for different polarization angles of s and u
     std::map<std::pair<uint8_t, uint8_t>, Complex2DVector> raysPreComp;
-    for (size_t polSa = 0; polSa < sAntenna->GetNumPols(); ++polSa)
+    for (size_t polSa = 0; polSa < sAntenna.GetNumPols(); ++polSa)
     {
-        for (size_t polUa = 0; polUa < uAntenna->GetNumPols(); ++polUa)
+        for (size_t polUa = 0; polUa < uAntenna.GetNumPols(); ++polUa)
         {
             raysPreComp[std::make_pair(polSa, polUa)] =
-                Complex2DVector(channelParams->m_reducedClusterNumber, table3gpp->m_raysPerCluster);
+                Complex2DVector(channelParams.m_reducedClusterNumber, raysPerCluster);
         }
     }
 
     // resize to appropriate dimensions
-    sinCosA.resize(channelParams->m_reducedClusterNumber);
-    sinSinA.resize(channelParams->m_reducedClusterNumber);
-    cosZoA.resize(channelParams->m_reducedClusterNumber);
-    sinCosD.resize(channelParams->m_reducedClusterNumber);
-    sinSinD.resize(channelParams->m_reducedClusterNumber);
-    cosZoD.resize(channelParams->m_reducedClusterNumber);
-    for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
-    {
-        sinCosA[nIndex].resize(table3gpp->m_raysPerCluster);
-        sinSinA[nIndex].resize(table3gpp->m_raysPerCluster);
-        cosZoA[nIndex].resize(table3gpp->m_raysPerCluster);
-        sinCosD[nIndex].resize(table3gpp->m_raysPerCluster);
-        sinSinD[nIndex].resize(table3gpp->m_raysPerCluster);
-        cosZoD[nIndex].resize(table3gpp->m_raysPerCluster);
+    sinCosA.resize(channelParams.m_reducedClusterNumber);
+    sinSinA.resize(channelParams.m_reducedClusterNumber);
+    cosZoA.resize(channelParams.m_reducedClusterNumber);
+    sinCosD.resize(channelParams.m_reducedClusterNumber);
+    sinSinD.resize(channelParams.m_reducedClusterNumber);
+    cosZoD.resize(channelParams.m_reducedClusterNumber);
+    for (uint8_t nIndex = 0; nIndex < channelParams.m_reducedClusterNumber; nIndex++)
+    {
+        sinCosA[nIndex].resize(raysPerCluster);
+        sinSinA[nIndex].resize(raysPerCluster);
+        cosZoA[nIndex].resize(raysPerCluster);
+        sinCosD[nIndex].resize(raysPerCluster);
+        sinSinD[nIndex].resize(raysPerCluster);
+        cosZoD[nIndex].resize(raysPerCluster);
+    }
+    // the field patterns only depend on the ray angles and on the polarization, hence they
+    // are computed for all the rays at once, for each polarization
+    std::vector<Angles> rxRayAngles;
+    std::vector<Angles> txRayAngles;
+    rxRayAngles.reserve(channelParams.m_reducedClusterNumber * raysPerCluster);
+    txRayAngles.reserve(channelParams.m_reducedClusterNumber * raysPerCluster);
+    for (uint8_t nIndex = 0; nIndex < channelParams.m_reducedClusterNumber; nIndex++)
+    {
+        for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
+        {
+            rxRayAngles.emplace_back(channelParams.m_rayAoaRadian[nIndex][mIndex],
+                                     channelParams.m_rayZoaRadian[nIndex][mIndex]);
+            txRayAngles.emplace_back(channelParams.m_rayAodRadian[nIndex][mIndex],
+                                     channelParams.m_rayZodRadian[nIndex][mIndex]);
+        }
+    }
+    std::vector<std::vector<std::pair<double, double>>> rxRayFieldPatterns;
+    for (uint8_t polUa = 0; polUa < uAntenna.GetNumPols(); ++polUa)
+    {
+        rxRayFieldPatterns.push_back(uAntenna.GetElementFieldPatterns(rxRayAngles, polUa));
     }
+    std::vector<std::vector<std::pair<double, double>>> txRayFieldPatterns;
+    for (uint8_t polSa = 0; polSa < sAntenna.GetNumPols(); ++polSa)
+    {
+        txRayFieldPatterns.push_back(sAntenna.GetElementFieldPatterns(txRayAngles, polSa));
+    }
+
     // pre-compute the terms which are independent from uIndex and sIndex
-    for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
+    for (uint8_t nIndex = 0; nIndex < channelParams.m_reducedClusterNumber; nIndex++)
     {
-        for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
+        for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
         {
-            DoubleVector initialPhase = channelParams->m_clusterPhase[nIndex][mIndex];
+            const DoubleVector& initialPhase = channelParams.m_clusterPhase[nIndex][mIndex];
             NS_ASSERT(4 <= initialPhase.size());
-            double k = channelParams->m_crossPolarizationPowerRatios[nIndex][mIndex];
+            double k = channelParams.m_crossPolarizationPowerRatios[nIndex][mIndex];
+            const size_t rayIndex = nIndex * raysPerCluster + mIndex;
 
             // cache the component of the "rays" terms which depend on the random angle of arrivals
             // and departures and initial phases only
-            for (uint8_t polUa = 0; polUa < uAntenna->GetNumPols(); ++polUa)
+            for (uint8_t polUa = 0; polUa < uAntenna.GetNumPols(); ++polUa)
             {
-                auto [rxFieldPatternPhi, rxFieldPatternTheta] = uAntenna->GetElementFieldPattern(
-                    Angles(channelParams->m_rayAoaRadian[nIndex][mIndex],
-                           channelParams->m_rayZoaRadian[nIndex][mIndex]),
-                    polUa);
-                for (uint8_t polSa = 0; polSa < sAntenna->GetNumPols(); ++polSa)
+                auto [rxFieldPatternPhi, rxFieldPatternTheta] =
+                    rxRayFieldPatterns[polUa][rayIndex];
+                for (uint8_t polSa = 0; polSa < sAntenna.GetNumPols(); ++polSa)
                 {
                     auto [txFieldPatternPhi, txFieldPatternTheta] =
-                        sAntenna->GetElementFieldPattern(
-                            Angles(channelParams->m_rayAodRadian[nIndex][mIndex],
-                                   channelParams->m_rayZodRadian[nIndex][mIndex]),
-                            polSa);
+                        txRayFieldPatterns[polSa][rayIndex];
                     raysPreComp[std::make_pair(polSa, polUa)](nIndex, mIndex) =
                         std::complex<double>(cos(initialPhase[0]), sin(initialPhase[0])) *
                             rxFieldPatternTheta * txFieldPatternTheta +
@@ -3407,45 +4056,71 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
         }
     }
 
+    // The phase terms of each ray only depend on one of the antenna elements, hence they
+    // are computed once per cluster and per element and stored contiguously, so that
+    // the loop over the rays of the (u, s) pairs only involves multiplications and sums
+    std::vector<std::complex<double>> rxPhaseTerms(uSize * raysPerCluster);
+    std::vector<std::complex<double>> txPhaseTerms(sSize * raysPerCluster);
+
     // The following for loops computes the channel coefficients
     // Keeps track of how many sub-clusters have been added up to now
     uint8_t numSubClustersAdded = 0;
-    for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
+    for (uint8_t nIndex = 0; nIndex < channelParams.m_reducedClusterNumber; nIndex++)
     {
         for (size_t uIndex = 0; uIndex < uSize; uIndex++)
         {
-            Vector uLoc = uAntenna->GetElementLocation(uIndex);
+            const double uLocX = uLocs->x[uIndex];
+            const double uLocY = uLocs->y[uIndex];
+            const double uLocZ = uLocs->z[uIndex];
+            std::complex<double>* rxTerms = rxPhaseTerms.data() + uIndex * raysPerCluster;
+            for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
+            {
+                // lambda_0 is accounted in the antenna spacing uLoc and sLoc.
+                double rxPhaseDiff =
+                    2 * M_PI *
+                    (sinCosA[nIndex][mIndex] * uLocX + sinSinA[nIndex][mIndex] * uLocY +
+                     cosZoA[nIndex][mIndex] * uLocZ);
+                rxTerms[mIndex] = std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff));
+            }
+        }
+        for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+        {
+            const double sLocX = sLocs->x[sIndex];
+            const double sLocY = sLocs->y[sIndex];
+            const double sLocZ = sLocs->z[sIndex];
+            std::complex<double>* txTerms = txPhaseTerms.data() + sIndex * raysPerCluster;
+            for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
+            {
+                double txPhaseDiff =
+                    2 * M_PI *
+                    (sinCosD[nIndex][mIndex] * sLocX + sinSinD[nIndex][mIndex] * sLocY +
+                     cosZoD[nIndex][mIndex] * sLocZ);
+                txTerms[mIndex] = std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+            }
+        }
+
+        for (size_t uIndex = 0; uIndex < uSize; uIndex++)
+        {
+            const std::complex<double>* rxTerms = rxPhaseTerms.data() + uIndex * raysPerCluster;
 
             for (size_t sIndex = 0; sIndex < sSize; sIndex++)
             {
-                Vector sLoc = sAntenna->GetElementLocation(sIndex);
+                const std::complex<double>* txTerms =
+                    txPhaseTerms.data() + sIndex * raysPerCluster;
+                const Complex2DVector& preComp =
+                    raysPreComp[std::make_pair(sPols[sIndex], uPols[uIndex])];
                 // Compute the N-2 weakest cluster, assuming 0 slant angle and a
                 // polarization slant angle configured in the array (7.5-22)
-                if (nIndex != channelParams->m_cluster1st && nIndex != channelParams->m_cluster2nd)
+                if (nIndex != channelParams.m_cluster1st && nIndex != channelParams.m_cluster2nd)
                 {
                     std::complex<double> rays(0, 0);
-                    for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
+                    for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
                     {
-                        // lambda_0 is accounted in the antenna spacing uLoc and sLoc.
-                        double rxPhaseDiff =
-                            2 * M_PI *
-                            (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
-                             cosZoA[nIndex][mIndex] * uLoc.z);
-
-                        double txPhaseDiff =
-                            2 * M_PI *
-                            (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
-                             cosZoD[nIndex][mIndex] * sLoc.z);
                         // NOTE Doppler is computed in the CalcBeamformingGain function and is
                         // simplified to only account for the center angle of each cluster.
-                        rays += raysPreComp[std::make_pair(sAntenna->GetElemPol(sIndex),
-                                                           uAntenna->GetElemPol(uIndex))](nIndex,
-                                                                                          mIndex) *
-                                std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                                std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+                        rays += preComp(nIndex, mIndex) * rxTerms[mIndex] * txTerms[mIndex];
                     }
-                    rays *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
+                    rays *= sqrt(channelParams.m_clusterPower[nIndex] / raysPerCluster);
                     hUsn(uIndex, sIndex, nIndex) = rays;
                 }
                 else //(7.5-28)
@@ -3454,26 +4129,12 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
                     std::complex<double> raysSub2(0, 0);
                     std::complex<double> raysSub3(0, 0);
 
-                    for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
+                    for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
                     {
                         // ZML:Just remind me that the angle offsets for the 3 subclusters were not
                         // generated correctly.
-                        double rxPhaseDiff =
-                            2 * M_PI *
-                            (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
-                             cosZoA[nIndex][mIndex] * uLoc.z);
-
-                        double txPhaseDiff =
-                            2 * M_PI *
-                            (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
-                             cosZoD[nIndex][mIndex] * sLoc.z);
-
                         std::complex<double> raySub =
-                            raysPreComp[std::make_pair(sAntenna->GetElemPol(sIndex),
-                                                       uAntenna->GetElemPol(uIndex))](nIndex,
-                                                                                      mIndex) *
-                            std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                            std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+                            preComp(nIndex, mIndex) * rxTerms[mIndex] * txTerms[mIndex];
 
                         switch (mIndex)
                         {
@@ -3496,30 +4157,27 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
                             break;
                         }
                     }
-                    raysSub1 *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
-                    raysSub2 *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
-                    raysSub3 *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
+                    raysSub1 *= sqrt(channelParams.m_clusterPower[nIndex] / raysPerCluster);
+                    raysSub2 *= sqrt(channelParams.m_clusterPower[nIndex] / raysPerCluster);
+                    raysSub3 *= sqrt(channelParams.m_clusterPower[nIndex] / raysPerCluster);
                     hUsn(uIndex, sIndex, nIndex) = raysSub1;
                     hUsn(uIndex,
                          sIndex,
-                         channelParams->m_reducedClusterNumber + numSubClustersAdded) = raysSub2;
+                         channelParams.m_reducedClusterNumber + numSubClustersAdded) = raysSub2;
                     hUsn(uIndex,
                          sIndex,
-                         channelParams->m_reducedClusterNumber + numSubClustersAdded + 1) =
+                         channelParams.m_reducedClusterNumber + numSubClustersAdded + 1) =
                         raysSub3;
                 }
             }
         }
-        if (nIndex == channelParams->m_cluster1st || nIndex == channelParams->m_cluster2nd)
+        if (nIndex == channelParams.m_cluster1st || nIndex == channelParams.m_cluster2nd)
         {
             numSubClustersAdded += 2;
         }
     }
 
-    if (channelParams->m_losCondition == ChannelCondition::LOS) //(7.5-29) && (7.5-30)
+    if (channelParams.m_losCondition == ChannelCondition::LOS) //(7.5-29) && (7.5-30)
     {
         double lambda = 3.0e8 / m_frequency; // the wavelength of the carrier frequency
         std::complex<double> phaseDiffDueToDistance(cos(-2 * M_PI * distance3D / lambda),
@@ -3534,52 +4192,63 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
         const double sinSAngleAz = sin(sAngle.GetAzimuth());
         const double cosSAngleAz = cos(sAngle.GetAzimuth());
 
+        // the field patterns only depend on the polarization of the elements, and the
+        // phase terms of the transmit elements do not depend on the receive element
+        std::vector<std::pair<double, double>> txFieldPatterns;
+        for (uint8_t polSa = 0; polSa < sAntenna.GetNumPols(); ++polSa)
+        {
+            txFieldPatterns.push_back(sAntenna.GetElementFieldPattern(sAngle, polSa));
+        }
+        std::vector<std::pair<double, double>> rxFieldPatterns;
+        for (uint8_t polUa = 0; polUa < uAntenna.GetNumPols(); ++polUa)
+        {
+            rxFieldPatterns.push_back(uAntenna.GetElementFieldPattern(uAngle, polUa));
+        }
+        for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+        {
+            double txPhaseDiff = 2 * M_PI *
+                                 (sinSAngleIncl * cosSAngleAz * sLocs->x[sIndex] +
+                                  sinSAngleIncl * sinSAngleAz * sLocs->y[sIndex] +
+                                  cosSAngleIncl * sLocs->z[sIndex]);
+            txPhaseTerms[sIndex] = std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+        }
+
+        const double kLinear = pow(10, channelParams.m_K_factor / 10.0);
+        const double nlosScaling = sqrt(1.0 / (kLinear + 1));
         for (size_t uIndex = 0; uIndex < uSize; uIndex++)
         {
-            Vector uLoc = uAntenna->GetElementLocation(uIndex);
             double rxPhaseDiff = 2 * M_PI *
-                                 (sinUAngleIncl * cosUAngleAz * uLoc.x +
-                                  sinUAngleIncl * sinUAngleAz * uLoc.y + cosUAngleIncl * uLoc.z);
+                                 (sinUAngleIncl * cosUAngleAz * uLocs->x[uIndex] +
+                                  sinUAngleIncl * sinUAngleAz * uLocs->y[uIndex] +
+                                  cosUAngleIncl * uLocs->z[uIndex]);
+            std::complex<double> rxPhaseTerm(cos(rxPhaseDiff), sin(rxPhaseDiff));
+
+            auto [rxFieldPatternPhi, rxFieldPatternTheta] = rxFieldPatterns[uPols[uIndex]];
 
             for (size_t sIndex = 0; sIndex < sSize; sIndex++)
             {
-                Vector sLoc = sAntenna->GetElementLocation(sIndex);
-                std::complex<double> ray(0, 0);
-                double txPhaseDiff =
-                    2 * M_PI *
-                    (sinSAngleIncl * cosSAngleAz * sLoc.x + sinSAngleIncl * sinSAngleAz * sLoc.y +
-                     cosSAngleIncl * sLoc.z);
-
-                auto [rxFieldPatternPhi, rxFieldPatternTheta] = uAntenna->GetElementFieldPattern(
-                    Angles(uAngle.GetAzimuth(), uAngle.GetInclination()),
-                    uAntenna->GetElemPol(uIndex));
-                auto [txFieldPatternPhi, txFieldPatternTheta] = sAntenna->GetElementFieldPattern(
-                    Angles(sAngle.GetAzimuth(), sAngle.GetInclination()),
-                    sAntenna->GetElemPol(sIndex));
-
-                ray = (rxFieldPatternTheta * txFieldPatternTheta -
-                       rxFieldPatternPhi * txFieldPatternPhi) *
-                      phaseDiffDueToDistance *
-                      std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                      std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
-
-                double kLinear = pow(10, channelParams->m_K_factor / 10.0);
+                auto [txFieldPatternPhi, txFieldPatternTheta] = txFieldPatterns[sPols[sIndex]];
+
+                std::complex<double> ray = (rxFieldPatternTheta * txFieldPatternTheta -
+                                            rxFieldPatternPhi * txFieldPatternPhi) *
+                                           phaseDiffDueToDistance * rxPhaseTerm *
+                                           txPhaseTerms[sIndex];
+
                 // the LOS path should be attenuated if blockage is enabled.
                 hUsn(uIndex, sIndex, 0) =
-                    sqrt(1.0 / (kLinear + 1)) * hUsn(uIndex, sIndex, 0) +
+                    nlosScaling * hUsn(uIndex, sIndex, 0) +
                     sqrt(kLinear / (1 + kLinear)) * ray /
                         pow(10,
-                            channelParams->m_attenuation_dB[0] / 10.0); //(7.5-30) for tau = tau1
+                            channelParams.m_attenuation_dB[0] / 10.0); //(7.5-30) for tau = tau1
                 for (size_t nIndex = 1; nIndex < hUsn.GetNumPages(); nIndex++)
                 {
-                    hUsn(uIndex, sIndex, nIndex) *=
-                        sqrt(1.0 / (kLinear + 1)); //(7.5-30) for tau = tau2...tauN
+                    hUsn(uIndex, sIndex, nIndex) *= nlosScaling; //(7.5-30) for tau = tau2...tauN
                 }
             }
         }
     }
 
-    NS_LOG_DEBUG("Husn (sAntenna, uAntenna):" << sAntenna->GetId() << ", " << uAntenna->GetId());
+    NS_LOG_DEBUG("Husn (sAntenna, uAntenna):" << sAntenna.GetId() << ", " << uAntenna.GetId());
     for (size_t cIndex = 0; cIndex < hUsn.GetNumPages(); cIndex++)
     {
         for (size_t rowIdx = 0; rowIdx < hUsn.GetNumRows(); rowIdx++)
@@ -3594,8 +4263,6 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
     NS_LOG_INFO("size of coefficient matrix (rows, columns, clusters) = ("
                 << hUsn.GetNumRows() << ", " << hUsn.GetNumCols() << ", " << hUsn.GetNumPages()
                 << ")");
-    channelMatrix->m_channel = hUsn;
-    return channelMatrix;
 }
 
 std::pair<double, double>
@@ -10,15 +10,20 @@
 #ifndef THREE_GPP_CHANNEL_H
 #define THREE_GPP_CHANNEL_H
 
+#include "lru-cache-index.h"
 #include "matrix-based-channel-model.h"
 
 #include "ns3/angles.h"
 #include "ns3/boolean.h"
 #include "ns3/channel-condition-model.h"
 #include "ns3/deprecated.h"
+#include "ns3/thread-pool.h"
+#include "ns3/traced-callback.h"
 
 #include <complex.h>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -108,6 +113,23 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
                                         Ptr<const PhasedArrayModel> aAntenna,
                                         Ptr<const PhasedArrayModel> bAntenna) override;
 
+    /**
+     * Returns the channel matrices of the given pairs of devices. The channel
+     * matrices are looked up and the channel parameters are generated in the
+     * order of the requests, exactly as GetChannel does, hence the results are
+     * the same as those of calling GetChannel for each request. The coefficients
+     * of the channel matrices that have to be generated are then computed on
+     * ChannelGenerationThreads threads.
+     *
+     * @note the coefficients are computed by GenerateChannelCoefficients, without
+     * calling GetNewChannel, when ChannelGenerationThreads is larger than 1
+     *
+     * @param requests the pairs of devices
+     * @return the channel matrices, in the order of the requests
+     */
+    std::vector<Ptr<const ChannelMatrix>> GetChannels(
+        const std::vector<ChannelRequest>& requests) override;
+
     /**
      * Looks for the channel params associated to the aMob and bMob pair in
      * m_channelParamsMap. If not found it will return a nullptr.
@@ -118,6 +140,16 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
      */
     Ptr<const ChannelParams> GetParams(Ptr<const MobilityModel> aMob,
                                        Ptr<const MobilityModel> bMob) const override;
+
+    /**
+     * Update the memory used by the channel params of the given pair of nodes in the
+     * channel params cache, after that their auxiliary variables have been filled.
+     *
+     * @param aMob mobility model of the a device
+     * @param bMob mobility model of the b device
+     */
+    void NotifyChannelParamsUpdated(Ptr<const MobilityModel> aMob,
+                                    Ptr<const MobilityModel> bMob) override;
     /**
      * @brief Assign a fixed random variable stream number to the random variables
      * used by this model.
@@ -127,6 +159,15 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
      */
     int64_t AssignStreams(int64_t stream);
 
+    /**
+     * TracedCallback signature for the state of a cache.
+     *
+     * @param [in] hitRate the fraction of the accesses to the cache that found an
+     *             up to date entry, since the beginning of the simulation
+     * @param [in] bytes the memory used by the entries of the cache
+     */
+    typedef void (*CacheTracedCallback)(double hitRate, uint64_t bytes);
+
   protected:
     /**
      * Wrap an (azimuth, inclination) angle pair in a valid range.
@@ -185,6 +226,19 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
         DoubleVector m_attenuation_dB;      //!< vector that stores the attenuation of the blockage
         uint8_t m_cluster1st;               //!< index of the first strongest cluster
         uint8_t m_cluster2nd;               //!< index of the second strongest cluster
+        Time m_updatedTime;                 //!< time of the last spatially consistent update
+        Time m_previousUpdatedTime; //!< time of the generation or of the update preceding the
+                                    //!< last spatially consistent update
+        DoubleVector m_previousDelay; //!< cluster delays before the last spatially consistent
+                                      //!< update
+        MatrixBasedChannelModel::Double2DVector
+            m_previousAngle; //!< cluster angles before the last spatially consistent update
+        std::pair<Vector, Vector>
+            m_generatedPositions; //!< positions of the nodes, in the order of m_nodeIds, when
+                                  //!< the parameters were generated
+        std::pair<Vector, Vector>
+            m_updatedPositions; //!< positions of the nodes, in the order of m_nodeIds, at the
+                                //!< last generation or spatially consistent update
     };
 
     /**
@@ -301,6 +355,32 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
                                              const Ptr<const MobilityModel> uMob,
                                              Ptr<const PhasedArrayModel> sAntenna,
                                              Ptr<const PhasedArrayModel> uAntenna) const;
+
+    /**
+     * Compute the coefficients of the channel matrix between two nodes s and u
+     * (step 11 of the procedure described in 3GPP TR 38.901) and store them in
+     * channelMatrix.m_channel. The m_nodeIds of channelMatrix must already be set.
+     *
+     * The method only reads its arguments and the configuration of this object,
+     * hence it can be called concurrently for different channel matrices.
+     *
+     * @param channelMatrix the channel matrix whose coefficients are computed
+     * @param channelParams the channel parameters previously generated for the pair of
+     * nodes s and u
+     * @param table3gpp the 3gpp parameters table
+     * @param sPos the position of node s
+     * @param uPos the position of node u
+     * @param sAntenna the antenna array of node s
+     * @param uAntenna the antenna array of node u
+     */
+    void GenerateChannelCoefficients(ChannelMatrix& channelMatrix,
+                                     const ThreeGppChannelParams& channelParams,
+                                     const ParamsTable& table3gpp,
+                                     const Vector& sPos,
+                                     const Vector& uPos,
+                                     const PhasedArrayModel& sAntenna,
+                                     const PhasedArrayModel& uAntenna) const;
+
     /**
      * Applies the blockage model A described in 3GPP TR 38.901
      * @param channelParams the channel parameters structure
@@ -322,6 +402,61 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
     bool ChannelParamsNeedsUpdate(Ptr<const ThreeGppChannelParams> channelParams,
                                   Ptr<const ChannelCondition> channelCondition) const;
 
+    /**
+     * Check if the channel params, which have to be updated because the update
+     * period expired, can be updated by means of UpdateChannelParameters rather than
+     * generated anew. This is the case if the SpatialConsistentUpdate attribute is
+     * true, the channel condition did not change and neither node moved farther than
+     * MaxUpdateDistance since the channel params were generated.
+     * @param channelParams channel params
+     * @param channelCondition the channel condition
+     * @param aMob mobility model of the a device
+     * @param bMob mobility model of the b device
+     * @return true if the channel params can be updated, false otherwise
+     */
+    bool ChannelParamsCanBeUpdated(Ptr<const ThreeGppChannelParams> channelParams,
+                                   Ptr<const ChannelCondition> channelCondition,
+                                   Ptr<const MobilityModel> aMob,
+                                   Ptr<const MobilityModel> bMob) const;
+
+    /**
+     * Update the delays and the angles of the clusters and of the rays according to
+     * the displacements of the nodes since the last update, as in the spatially
+     * consistent procedure A of 3GPP TR 38.901, Sec. 7.6.3.2, without drawing new
+     * random variables. The delays and the angles before the update are stored, so that
+     * the channel matrices generated with the previous channel params can then be
+     * updated by GetUpdatedChannel.
+     * @param channelParams the channel params to update
+     * @param aMob mobility model of the a device
+     * @param bMob mobility model of the b device
+     */
+    void UpdateChannelParameters(Ptr<ThreeGppChannelParams> channelParams,
+                                 Ptr<const MobilityModel> aMob,
+                                 Ptr<const MobilityModel> bMob) const;
+
+    /**
+     * Update a channel matrix, which was up to date before the last spatially consistent
+     * update of the channel params, by rotating the coefficients of each cluster rather
+     * than generating them again. The coefficients are rotated by the change of the phase
+     * of the response of the antenna elements to the updated directions of the cluster,
+     * and so that the phase of the cluster at the carrier frequency, which evolves
+     * according to the Doppler term, does not jump because of the changes of the delay
+     * and of the Doppler term of the cluster.
+     * @param channelMatrix the channel matrix to update, which is not modified
+     * @param channelParams the updated channel params
+     * @param aMob mobility model of the a device
+     * @param bMob mobility model of the b device
+     * @param aAntenna antenna of the a device
+     * @param bAntenna antenna of the b device
+     * @return the updated channel matrix
+     */
+    Ptr<ChannelMatrix> GetUpdatedChannel(Ptr<const ChannelMatrix> channelMatrix,
+                                         Ptr<const ThreeGppChannelParams> channelParams,
+                                         Ptr<const MobilityModel> aMob,
+                                         Ptr<const MobilityModel> bMob,
+                                         Ptr<const PhasedArrayModel> aAntenna,
+                                         Ptr<const PhasedArrayModel> bAntenna) const;
+
     /**
      * Check if the channel matrix has to be updated (it needs update when the channel params
      * generation time is more recent than channel matrix generation time
@@ -368,6 +503,12 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
     Ptr<UniformRandomVariable> m_uniformRvDoppler; //!< uniform random variable, used to compute the
                                                    //!< additional Doppler contribution
 
+    // parameters for the spatially consistent update
+    bool m_spatialConsistentUpdate; //!< whether the channel params are updated rather than
+                                    //!< generated anew when the update period expires
+    double m_maxUpdateDistance;     //!< the maximum displacement of a node, since the
+                                    //!< generation of the channel params, allowing for an update
+
     // parameters for the blockage model
     bool m_blockage;               //!< enables the blockage model A
     uint16_t m_numNonSelfBlocking; //!< number of non-self-blocking regions
@@ -380,6 +521,123 @@ class ThreeGppChannelModel : public MatrixBasedChannelModel
         2;                            //!< index of the THETA value in the m_nonSelfBlocking array
     static const uint8_t Y_INDEX = 3; //!< index of the Y value in the m_nonSelfBlocking array
     static const uint8_t R_INDEX = 4; //!< index of the R value in the m_nonSelfBlocking array
+
+  private:
+    /**
+     * Inputs of the generation of the coefficients of a channel matrix
+     */
+    struct ChannelGeneration
+    {
+        Ptr<ChannelMatrix> channelMatrix;               //!< the channel matrix to fill
+        Ptr<const ThreeGppChannelParams> channelParams; //!< the channel parameters
+        Ptr<const ParamsTable> table3gpp;               //!< the 3gpp parameters table
+        Vector sPos;                                    //!< the position of node s
+        Vector uPos;                                    //!< the position of node u
+        Ptr<const PhasedArrayModel> sAntenna;           //!< the antenna array of node s
+        Ptr<const PhasedArrayModel> uAntenna;           //!< the antenna array of node u
+    };
+
+    /**
+     * Looks for the channel matrix associated to the aMob and bMob pair and
+     * generates the channel parameters and the channel matrix if needed (see GetChannel).
+     *
+     * @param aMob mobility model of the a device
+     * @param bMob mobility model of the b device
+     * @param aAntenna antenna of the a device
+     * @param bAntenna antenna of the b device
+     * @param generations if not null, a new channel matrix is allocated and the inputs of
+     *                    the generation of its coefficients are appended to this vector,
+     *                    otherwise the channel matrix is generated by GetNewChannel
+     * @return the channel matrix
+     */
+    Ptr<ChannelMatrix> DoGetChannel(Ptr<const MobilityModel> aMob,
+                                    Ptr<const MobilityModel> bMob,
+                                    Ptr<const PhasedArrayModel> aAntenna,
+                                    Ptr<const PhasedArrayModel> bAntenna,
+                                    std::vector<ChannelGeneration>* generations);
+
+    /**
+     * Set the number of threads generating the channel matrices requested through
+     * GetChannels
+     * @param nThreads the number of threads
+     */
+    void SetChannelGenerationThreads(uint32_t nThreads);
+
+    /**
+     * @return the number of threads generating the channel matrices requested
+     * through GetChannels
+     */
+    uint32_t GetChannelGenerationThreads() const;
+
+    std::unique_ptr<ThreadPool> m_channelGenerationPool; //!< threads generating the channels
+
+    /**
+     * Coefficients of a channel matrix stored in single precision
+     */
+    struct CompactChannel
+    {
+        size_t numRows;                          //!< number of rows of the channel matrix
+        size_t numCols;                          //!< number of columns of the channel matrix
+        size_t numPages;                         //!< number of pages of the channel matrix
+        std::vector<std::complex<float>> values; //!< the coefficients
+    };
+
+    /**
+     * Record an access to a channel matrix in the cache, compact the channel matrices
+     * that have not been accessed for CompactChannelAge and evict channel matrices
+     * to keep the memory used by the cache within MaxChannelMatrixBytes.
+     * @param key the key of the channel matrix
+     * @param channelMatrix the channel matrix
+     * @param hit whether the cached channel matrix was up to date
+     */
+    void UpdateChannelMatrixCache(uint64_t key, Ptr<const ChannelMatrix> channelMatrix, bool hit);
+
+    /**
+     * Record an access to channel params in the cache and evict channel params
+     * to keep the memory used by the cache within MaxChannelParamsBytes.
+     * @param key the key of the channel params
+     * @param channelParams the channel params
+     * @param hit whether the cached channel params were up to date
+     */
+    void UpdateChannelParamsCache(uint64_t key,
+                                  Ptr<const ThreeGppChannelParams> channelParams,
+                                  bool hit);
+
+    /**
+     * Restore the coefficients of a channel matrix that has been compacted, if any. A compacted
+     * channel matrix is only referenced by m_channelMatrixMap, hence it is restored in place.
+     * @param key the key of the channel matrix
+     * @param channelMatrix the channel matrix
+     */
+    void RestoreChannelMatrix(uint64_t key, ChannelMatrix& channelMatrix);
+
+    /**
+     * @param channelMatrix a channel matrix
+     * @return an estimate of the memory used by the channel matrix
+     */
+    static size_t GetChannelMatrixBytes(const ChannelMatrix& channelMatrix);
+
+    /**
+     * @param channelParams channel params
+     * @return an estimate of the memory used by the channel params
+     */
+    static size_t GetChannelParamsBytes(const ThreeGppChannelParams& channelParams);
+
+    uint64_t m_maxChannelMatrixBytes;    //!< memory budget of the channel matrix cache
+    uint64_t m_maxChannelParamsBytes;    //!< memory budget of the channel params cache
+    Time m_compactChannelAge;            //!< idle time after which channel matrices are compacted
+    LruCacheIndex m_channelMatrixCache;  //!< index of the entries of m_channelMatrixMap
+    LruCacheIndex m_channelParamsCache;  //!< index of the entries of m_channelParamsMap
+    uint64_t m_channelMatrixAccesses{0}; //!< number of accesses to the channel matrix cache
+    uint64_t m_channelMatrixHits{0};     //!< number of hits of the channel matrix cache
+    uint64_t m_channelParamsAccesses{0}; //!< number of accesses to the channel params cache
+    uint64_t m_channelParamsHits{0};     //!< number of hits of the channel params cache
+    std::unordered_map<uint64_t, CompactChannel>
+        m_compactChannels; //!< compacted coefficients of the cached channel matrices
+    TracedCallback<double, uint64_t>
+        m_channelMatrixCacheTrace; //!< trace of the state of the channel matrix cache
+    TracedCallback<double, uint64_t>
+        m_channelParamsCacheTrace; //!< trace of the state of the channel params cache
 };
 } // namespace ns3
 
@@ -20,6 +20,7 @@
 #include "ns3/pointer.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
+#include "ns3/uinteger.h"
 
 #include <map>
 
@@ -44,6 +45,7 @@ void
 ThreeGppSpectrumPropagationLossModel::DoDispose()
 {
     m_longTermMap.clear();
+    m_longTermCache.Clear();
     m_channelModel = nullptr;
 }
 
@@ -61,7 +63,21 @@ ThreeGppSpectrumPropagationLossModel::GetTypeId()
                 StringValue("ns3::ThreeGppChannelModel"),
                 MakePointerAccessor(&ThreeGppSpectrumPropagationLossModel::SetChannelModel,
                                     &ThreeGppSpectrumPropagationLossModel::GetChannelModel),
-                MakePointerChecker<MatrixBasedChannelModel>());
+                MakePointerChecker<MatrixBasedChannelModel>())
+            .AddAttribute("MaxLongTermBytes",
+                          "The maximum amount of memory, in bytes, used to store the long term "
+                          "components. When exceeded, the least recently used long term components "
+                          "are evicted and computed again when needed. 0 means no limit.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(
+                              &ThreeGppSpectrumPropagationLossModel::m_maxLongTermBytes),
+                          MakeUintegerChecker<uint64_t>())
+            .AddTraceSource("LongTermCache",
+                            "Fired on every access to the long term components, reporting the "
+                            "hit rate and the memory used by the stored long term components",
+                            MakeTraceSourceAccessor(
+                                &ThreeGppSpectrumPropagationLossModel::m_longTermCacheTrace),
+                            "ns3::ThreeGppChannelModel::CacheTracedCallback");
     return tid;
 }
 
@@ -208,7 +224,27 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
 {
     NS_LOG_FUNCTION(this);
     Ptr<SpectrumSignalParameters> rxParams = params->Copy();
-    size_t numCluster = channelMatrix->m_channel.GetNumPages();
+    auto doppler = CalcDoppler(*longTerm, *channelMatrix, *channelParams, sSpeed, uSpeed);
+    ApplyBeamformingGain(*rxParams,
+                         *longTerm,
+                         *channelMatrix,
+                         *channelParams,
+                         doppler,
+                         numTxPorts,
+                         numRxPorts,
+                         isReverse);
+    return rxParams;
+}
+
+PhasedArrayModel::ComplexVector
+ThreeGppSpectrumPropagationLossModel::CalcDoppler(
+    const MatrixBasedChannelModel::Complex3DVector& longTerm,
+    const MatrixBasedChannelModel::ChannelMatrix& channelMatrix,
+    const MatrixBasedChannelModel::ChannelParams& channelParams,
+    const Vector& sSpeed,
+    const Vector& uSpeed) const
+{
+    size_t numCluster = channelMatrix.m_channel.GetNumPages();
     // compute the doppler term
     // NOTE the update of Doppler is simplified by only taking the center angle of
     // each cluster in to consideration.
@@ -218,16 +254,16 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
 
     // Make sure that all the structures that are passed to this function
     // are of the correct dimensions before using the operator [].
-    NS_ASSERT(numCluster <= channelParams->m_alpha.size());
-    NS_ASSERT(numCluster <= channelParams->m_D.size());
-    NS_ASSERT(numCluster <= channelParams->m_angle[MatrixBasedChannelModel::ZOA_INDEX].size());
-    NS_ASSERT(numCluster <= channelParams->m_angle[MatrixBasedChannelModel::ZOD_INDEX].size());
-    NS_ASSERT(numCluster <= channelParams->m_angle[MatrixBasedChannelModel::AOA_INDEX].size());
-    NS_ASSERT(numCluster <= channelParams->m_angle[MatrixBasedChannelModel::AOD_INDEX].size());
-    NS_ASSERT(numCluster <= longTerm->GetNumPages());
+    NS_ASSERT(numCluster <= channelParams.m_alpha.size());
+    NS_ASSERT(numCluster <= channelParams.m_D.size());
+    NS_ASSERT(numCluster <= channelParams.m_angle[MatrixBasedChannelModel::ZOA_INDEX].size());
+    NS_ASSERT(numCluster <= channelParams.m_angle[MatrixBasedChannelModel::ZOD_INDEX].size());
+    NS_ASSERT(numCluster <= channelParams.m_angle[MatrixBasedChannelModel::AOA_INDEX].size());
+    NS_ASSERT(numCluster <= channelParams.m_angle[MatrixBasedChannelModel::AOD_INDEX].size());
+    NS_ASSERT(numCluster <= longTerm.GetNumPages());
 
     // check if channelParams structure is generated in direction s-to-u or u-to-s
-    bool isSameDir = (channelParams->m_nodeIds == channelMatrix->m_nodeIds);
+    bool isSameDir = (channelParams.m_nodeIds == channelMatrix.m_nodeIds);
 
     // if channel params is generated in the same direction in which we
     // generate the channel matrix, angles and zenith of departure and arrival are ok,
@@ -235,7 +271,7 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
     // of channel matrix, otherwise we need to flip angles and zeniths of departure and arrival
     using DPV = std::vector<std::pair<double, double>>;
     using MBCM = MatrixBasedChannelModel;
-    const auto& cachedAngleSincos = channelParams->m_cachedAngleSincos;
+    const auto& cachedAngleSincos = channelParams.m_cachedAngleSincos;
     const DPV& zoa = cachedAngleSincos[isSameDir ? MBCM::ZOA_INDEX : MBCM::ZOD_INDEX];
     const DPV& zod = cachedAngleSincos[isSameDir ? MBCM::ZOD_INDEX : MBCM::ZOA_INDEX];
     const DPV& aoa = cachedAngleSincos[isSameDir ? MBCM::AOA_INDEX : MBCM::AOD_INDEX];
@@ -254,8 +290,8 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
         // By default, m_vScatt is set to 0, so there is no additional Doppler
         // contribution.
 
-        double alpha = channelParams->m_alpha[cIndex];
-        double D = channelParams->m_D[cIndex];
+        double alpha = channelParams.m_alpha[cIndex];
+        double D = channelParams.m_D[cIndex];
 
         // cluster angle angle[direction][n], where direction = 0(aoa), 1(zoa).
         double tempDoppler =
@@ -267,47 +303,57 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
              2 * alpha * D);
         doppler[cIndex] = std::complex<double>(cos(tempDoppler), sin(tempDoppler));
     }
+    return doppler;
+}
 
-    NS_ASSERT(numCluster <= doppler.GetSize());
-
+void
+ThreeGppSpectrumPropagationLossModel::ApplyBeamformingGain(
+    SpectrumSignalParameters& rxParams,
+    const MatrixBasedChannelModel::Complex3DVector& longTerm,
+    const MatrixBasedChannelModel::ChannelMatrix& channelMatrix,
+    const MatrixBasedChannelModel::ChannelParams& channelParams,
+    const PhasedArrayModel::ComplexVector& doppler,
+    uint8_t numTxPorts,
+    uint8_t numRxPorts,
+    bool isReverse) const
+{
     // set the channel matrix
-    rxParams->spectrumChannelMatrix = GenSpectrumChannelMatrix(rxParams->psd,
-                                                               longTerm,
-                                                               channelMatrix,
-                                                               channelParams,
-                                                               doppler,
-                                                               numTxPorts,
-                                                               numRxPorts,
-                                                               isReverse);
-
-    NS_ASSERT_MSG(rxParams->psd->GetValuesN() == rxParams->spectrumChannelMatrix->GetNumPages(),
+    NS_ASSERT(channelMatrix.m_channel.GetNumPages() <= doppler.GetSize());
+    rxParams.spectrumChannelMatrix = GenSpectrumChannelMatrix(*rxParams.psd,
+                                                              longTerm,
+                                                              channelMatrix,
+                                                              channelParams,
+                                                              doppler,
+                                                              numTxPorts,
+                                                              numRxPorts,
+                                                              isReverse);
+
+    NS_ASSERT_MSG(rxParams.psd->GetValuesN() == rxParams.spectrumChannelMatrix->GetNumPages(),
                   "RX PSD and the spectrum channel matrix should have the same number of RBs ");
 
     // Calculate RX PSD from the spectrum channel matrix H and
     // the precoding matrix P as: PSD = (H*P)^h * (H*P)
-    Ptr<const ComplexMatrixArray> p;
-    if (!rxParams->precodingMatrix)
+    // The precoding matrix may be shared with other receivers, hence use a plain pointer
+    ComplexMatrixArray defaultPrecoding;
+    const ComplexMatrixArray* p = PeekPointer(rxParams.precodingMatrix);
+    if (!p)
     {
         // When the precoding matrix P is not set, we create one with a single column
         ComplexMatrixArray page =
-            ComplexMatrixArray(rxParams->spectrumChannelMatrix->GetNumCols(), 1, 1);
+            ComplexMatrixArray(rxParams.spectrumChannelMatrix->GetNumCols(), 1, 1);
         // Initialize it to the inverse square of the number of txPorts
-        page.Elem(0, 0, 0) = 1.0 / sqrt(rxParams->spectrumChannelMatrix->GetNumCols());
-        for (size_t rowI = 0; rowI < rxParams->spectrumChannelMatrix->GetNumCols(); rowI++)
+        page.Elem(0, 0, 0) = 1.0 / sqrt(rxParams.spectrumChannelMatrix->GetNumCols());
+        for (size_t rowI = 0; rowI < rxParams.spectrumChannelMatrix->GetNumCols(); rowI++)
         {
             page.Elem(rowI, 0, 0) = page.Elem(0, 0, 0);
         }
         // Replicate vector to match the number of RBGs
-        p = Create<const ComplexMatrixArray>(
-            page.MakeNCopies(rxParams->spectrumChannelMatrix->GetNumPages()));
-    }
-    else
-    {
-        p = rxParams->precodingMatrix;
+        defaultPrecoding = page.MakeNCopies(rxParams.spectrumChannelMatrix->GetNumPages());
+        p = &defaultPrecoding;
     }
     // When we have the precoding matrix P, we first do
     // H(rxPorts,txPorts,numRbs) x P(txPorts,txStreams,numRbs) = HxP(rxPorts,txStreams,numRbs)
-    MatrixBasedChannelModel::Complex3DVector hP = *rxParams->spectrumChannelMatrix * *p;
+    MatrixBasedChannelModel::Complex3DVector hP = *rxParams.spectrumChannelMatrix * *p;
 
     // Then (HxP)^h dimensions are (txStreams, rxPorts, numRbs)
     // MatrixBasedChannelModel::Complex3DVector hPHerm = hP.HermitianTranspose();
@@ -317,68 +363,81 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
 
     // And the received psd is the Trace(PSD).
     // To avoid wasting computations, we only compute the main diagonal of hPHerm*hP
-    for (uint32_t rbIdx = 0; rbIdx < rxParams->psd->GetValuesN(); ++rbIdx)
+    for (uint32_t rbIdx = 0; rbIdx < rxParams.psd->GetValuesN(); ++rbIdx)
     {
-        (*rxParams->psd)[rbIdx] = 0.0;
+        (*rxParams.psd)[rbIdx] = 0.0;
         for (size_t rxPort = 0; rxPort < hP.GetNumRows(); ++rxPort)
         {
             for (size_t txStream = 0; txStream < hP.GetNumCols(); ++txStream)
             {
-                (*rxParams->psd)[rbIdx] +=
+                (*rxParams.psd)[rbIdx] +=
                     std::real(std::conj(hP(rxPort, txStream, rbIdx)) * hP(rxPort, txStream, rbIdx));
             }
         }
     }
-    return rxParams;
+}
+
+bool
+ThreeGppSpectrumPropagationLossModel::UpdateDelaySincos(
+    const SpectrumValue& inPsd,
+    const MatrixBasedChannelModel::ChannelParams& channelParams,
+    size_t numCluster) const
+{
+    auto numRb = inPsd.GetValuesN();
+
+    // Precompute the delay until numRb, numCluster or RB width changes
+    // Whenever the channelParams is updated, the number of numRbs, numClusters
+    // and RB width (12*SCS) are reset, ensuring these values are updated too
+    double rbWidth = inPsd.ConstBandsBegin()->fh - inPsd.ConstBandsBegin()->fl;
+
+    if (channelParams.m_cachedDelaySincos.GetNumRows() == numRb &&
+        channelParams.m_cachedDelaySincos.GetNumCols() == numCluster &&
+        channelParams.m_cachedRbWidth == rbWidth)
+    {
+        return false;
+    }
+
+    channelParams.m_cachedRbWidth = rbWidth;
+    channelParams.m_cachedDelaySincos = ComplexMatrixArray(numRb, numCluster);
+    auto sbit = inPsd.ConstBandsBegin(); // band iterator
+    for (unsigned i = 0; i < numRb; i++)
+    {
+        double fsb = (*sbit).fc; // center frequency of the sub-band
+        for (std::size_t cIndex = 0; cIndex < numCluster; cIndex++)
+        {
+            double delay = -2 * M_PI * fsb * (channelParams.m_delay[cIndex]);
+            channelParams.m_cachedDelaySincos(i, cIndex) =
+                std::complex<double>(cos(delay), sin(delay));
+        }
+        sbit++;
+    }
+    return true;
 }
 
 Ptr<MatrixBasedChannelModel::Complex3DVector>
 ThreeGppSpectrumPropagationLossModel::GenSpectrumChannelMatrix(
-    Ptr<SpectrumValue> inPsd,
-    Ptr<const MatrixBasedChannelModel::Complex3DVector> longTerm,
-    Ptr<const MatrixBasedChannelModel::ChannelMatrix> channelMatrix,
-    Ptr<const MatrixBasedChannelModel::ChannelParams> channelParams,
-    PhasedArrayModel::ComplexVector doppler,
+    const SpectrumValue& inPsd,
+    const MatrixBasedChannelModel::Complex3DVector& longTerm,
+    const MatrixBasedChannelModel::ChannelMatrix& channelMatrix,
+    const MatrixBasedChannelModel::ChannelParams& channelParams,
+    const PhasedArrayModel::ComplexVector& doppler,
     uint8_t numTxPorts,
     uint8_t numRxPorts,
     bool isReverse) const
 {
-    size_t numCluster = channelMatrix->m_channel.GetNumPages();
-    auto numRb = inPsd->GetValuesN();
+    size_t numCluster = channelMatrix.m_channel.GetNumPages();
+    auto numRb = inPsd.GetValuesN();
 
-    auto directionalLongTerm = isReverse ? longTerm->Transpose() : (*longTerm);
+    auto directionalLongTerm = isReverse ? longTerm.Transpose() : longTerm;
 
     Ptr<MatrixBasedChannelModel::Complex3DVector> chanSpct =
         Create<MatrixBasedChannelModel::Complex3DVector>(numRxPorts, numTxPorts, (uint16_t)numRb);
 
-    // Precompute the delay until numRb, numCluster or RB width changes
-    // Whenever the channelParams is updated, the number of numRbs, numClusters
-    // and RB width (12*SCS) are reset, ensuring these values are updated too
-    double rbWidth = inPsd->ConstBandsBegin()->fh - inPsd->ConstBandsBegin()->fl;
-
-    if (channelParams->m_cachedDelaySincos.GetNumRows() != numRb ||
-        channelParams->m_cachedDelaySincos.GetNumCols() != numCluster ||
-        channelParams->m_cachedRbWidth != rbWidth)
-    {
-        channelParams->m_cachedRbWidth = rbWidth;
-        channelParams->m_cachedDelaySincos = ComplexMatrixArray(numRb, numCluster);
-        auto sbit = inPsd->ConstBandsBegin(); // band iterator
-        for (unsigned i = 0; i < numRb; i++)
-        {
-            double fsb = (*sbit).fc; // center frequency of the sub-band
-            for (std::size_t cIndex = 0; cIndex < numCluster; cIndex++)
-            {
-                double delay = -2 * M_PI * fsb * (channelParams->m_delay[cIndex]);
-                channelParams->m_cachedDelaySincos(i, cIndex) =
-                    std::complex<double>(cos(delay), sin(delay));
-            }
-            sbit++;
-        }
-    }
+    UpdateDelaySincos(inPsd, channelParams, numCluster);
 
     // Compute the product between the doppler and the delay sincos
-    auto delaySincosCopy = channelParams->m_cachedDelaySincos;
-    for (size_t iRb = 0; iRb < inPsd->GetValuesN(); iRb++)
+    auto delaySincosCopy = channelParams.m_cachedDelaySincos;
+    for (size_t iRb = 0; iRb < inPsd.GetValuesN(); iRb++)
     {
         for (std::size_t cIndex = 0; cIndex < numCluster; cIndex++)
         {
@@ -390,10 +449,10 @@ ThreeGppSpectrumPropagationLossModel::GenSpectrumChannelMatrix(
     // is a DL transmission but params and longTerm were last updated during UL), then the elements
     // in longTerm start from different offsets.
 
-    auto vit = inPsd->ValuesBegin(); // psd iterator
+    auto vit = inPsd.ConstValuesBegin(); // psd iterator
     size_t iRb = 0;
     // Compute the frequency-domain channel matrix
-    while (vit != inPsd->ValuesEnd())
+    while (vit != inPsd.ConstValuesEnd())
     {
         if ((*vit) != 0.00)
         {
@@ -465,8 +524,8 @@ ThreeGppSpectrumPropagationLossModel::GetLongTerm(
         // check if the channel matrix has been updated
         // or the s beam has been changed
         // or the u beam has been changed
-        update = (m_longTermMap[longTermId]->m_channel->m_generatedTime !=
-                      channelMatrix->m_generatedTime ||
+        update = (m_longTermMap[longTermId]->m_generatedTime != channelMatrix->m_generatedTime ||
+                  m_longTermMap[longTermId]->m_antennaPair != channelMatrix->m_antennaPair ||
                   m_longTermMap[longTermId]->m_sW != sW || m_longTermMap[longTermId]->m_uW != uW);
     }
     else
@@ -482,7 +541,10 @@ ThreeGppSpectrumPropagationLossModel::GetLongTerm(
         longTerm = CalcLongTerm(channelMatrix, sAntenna, uAntenna);
         Ptr<LongTerm> longTermItem = Create<LongTerm>();
         longTermItem->m_longTerm = longTerm;
-        longTermItem->m_channel = channelMatrix;
+        // the channel matrix is not referenced, so that it can be compacted or evicted by the
+        // channel model
+        longTermItem->m_generatedTime = channelMatrix->m_generatedTime;
+        longTermItem->m_antennaPair = channelMatrix->m_antennaPair;
         longTermItem->m_sW = std::move(sW);
         longTermItem->m_uW = std::move(uW);
         // store the long term to reduce computation load
@@ -491,9 +553,39 @@ ThreeGppSpectrumPropagationLossModel::GetLongTerm(
         m_longTermMap[longTermId] = longTermItem;
     }
 
+    UpdateLongTermCache(longTermId, m_longTermMap[longTermId], !update && !notFound);
+
     return longTerm;
 }
 
+void
+ThreeGppSpectrumPropagationLossModel::UpdateLongTermCache(uint64_t key,
+                                                          Ptr<const LongTerm> longTerm,
+                                                          bool hit) const
+{
+    NS_LOG_FUNCTION(this << key << hit);
+
+    m_longTermAccesses++;
+    m_longTermHits += hit ? 1 : 0;
+
+    std::size_t bytes =
+        sizeof(LongTerm) +
+        (longTerm->m_longTerm->GetSize() + longTerm->m_sW.GetSize() + longTerm->m_uW.GetSize()) *
+            sizeof(std::complex<double>);
+    m_longTermCache.Touch(key, bytes, Simulator::Now());
+
+    if (m_maxLongTermBytes > 0)
+    {
+        for (auto evicted : m_longTermCache.Evict(m_maxLongTermBytes))
+        {
+            m_longTermMap.erase(evicted);
+        }
+    }
+
+    m_longTermCacheTrace(static_cast<double>(m_longTermHits) / m_longTermAccesses,
+                         m_longTermCache.GetBytes());
+}
+
 Ptr<SpectrumSignalParameters>
 ThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity(
     Ptr<const SpectrumSignalParameters> spectrumSignalParams,
@@ -516,6 +608,12 @@ ThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity(
         m_channelModel->GetChannel(a, b, aPhasedArrayModel, bPhasedArrayModel);
     Ptr<const MatrixBasedChannelModel::ChannelParams> channelParams =
         m_channelModel->GetParams(a, b);
+    if (UpdateDelaySincos(*spectrumSignalParams->psd,
+                          *channelParams,
+                          channelMatrix->m_channel.GetNumPages()))
+    {
+        m_channelModel->NotifyChannelParamsUpdated(a, b);
+    }
 
     // retrieve the long term component
     Ptr<const MatrixBasedChannelModel::Complex3DVector> longTerm =
@@ -536,6 +634,70 @@ ThreeGppSpectrumPropagationLossModel::DoCalcRxPowerSpectralDensity(
                                isReverse);
 }
 
+Ptr<SpectrumSignalParameters>
+ThreeGppSpectrumPropagationLossModel::DoPrepareRxPowerSpectralDensity(
+    Ptr<const SpectrumSignalParameters> spectrumSignalParams,
+    Ptr<const MobilityModel> a,
+    Ptr<const MobilityModel> b,
+    Ptr<const PhasedArrayModel> aPhasedArrayModel,
+    Ptr<const PhasedArrayModel> bPhasedArrayModel,
+    std::function<void()>& deferred) const
+{
+    NS_LOG_FUNCTION(this << spectrumSignalParams << a << b << aPhasedArrayModel
+                         << bPhasedArrayModel);
+
+    NS_ASSERT_MSG(aPhasedArrayModel,
+                  "Antenna not found for node " << a->GetObject<Node>()->GetId());
+    NS_ASSERT_MSG(bPhasedArrayModel,
+                  "Antenna not found for node " << b->GetObject<Node>()->GetId());
+
+    // the channel and the long term component may be generated or updated, hence
+    // they are retrieved now
+    Ptr<const MatrixBasedChannelModel::ChannelMatrix> channelMatrix =
+        m_channelModel->GetChannel(a, b, aPhasedArrayModel, bPhasedArrayModel);
+    Ptr<const MatrixBasedChannelModel::ChannelParams> channelParams =
+        m_channelModel->GetParams(a, b);
+    // the delay sincos cached in the channel params are not computed by the deferred
+    // computation, which may run concurrently with other deferred computations
+    if (UpdateDelaySincos(*spectrumSignalParams->psd,
+                          *channelParams,
+                          channelMatrix->m_channel.GetNumPages()))
+    {
+        m_channelModel->NotifyChannelParamsUpdated(a, b);
+    }
+    Ptr<const MatrixBasedChannelModel::Complex3DVector> longTerm =
+        GetLongTerm(channelMatrix, aPhasedArrayModel, bPhasedArrayModel);
+    auto isReverse =
+        channelMatrix->IsReverse(aPhasedArrayModel->GetId(), bPhasedArrayModel->GetId());
+    auto doppler =
+        CalcDoppler(*longTerm, *channelMatrix, *channelParams, a->GetVelocity(), b->GetVelocity());
+
+    Ptr<SpectrumSignalParameters> rxParams = spectrumSignalParams->Copy();
+    // the spectrum channel matrix of the copy is shared with the TX parameters and
+    // is replaced by the deferred computation, hence release it now
+    rxParams->spectrumChannelMatrix = nullptr;
+
+    deferred = [this,
+                rxParams,
+                longTerm,
+                channelMatrix,
+                channelParams,
+                doppler = std::move(doppler),
+                numTxPorts = aPhasedArrayModel->GetNumPorts(),
+                numRxPorts = bPhasedArrayModel->GetNumPorts(),
+                isReverse]() {
+        ApplyBeamformingGain(*rxParams,
+                             *longTerm,
+                             *channelMatrix,
+                             *channelParams,
+                             doppler,
+                             numTxPorts,
+                             numRxPorts,
+                             isReverse);
+    };
+    return rxParams;
+}
+
 int64_t
 ThreeGppSpectrumPropagationLossModel::DoAssignStreams(int64_t stream)
 {
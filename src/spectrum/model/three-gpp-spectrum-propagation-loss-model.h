@@ -10,10 +10,12 @@
 #ifndef THREE_GPP_SPECTRUM_PROPAGATION_LOSS_H
 #define THREE_GPP_SPECTRUM_PROPAGATION_LOSS_H
 
+#include "lru-cache-index.h"
 #include "matrix-based-channel-model.h"
 #include "phased-array-spectrum-propagation-loss-model.h"
 
 #include "ns3/random-variable-stream.h"
+#include "ns3/traced-callback.h"
 
 #include <complex.h>
 #include <map>
@@ -121,6 +123,30 @@ class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagati
         Ptr<const PhasedArrayModel> aPhasedArrayModel,
         Ptr<const PhasedArrayModel> bPhasedArrayModel) const override;
 
+    /**
+     * @brief Prepares the computation of the received PSD.
+     *
+     * The channel matrix, the long term component and the Doppler term are
+     * retrieved or computed immediately, while the generation of the frequency-domain
+     * channel matrix and of the received PSD, which only use the state of the
+     * link between node a and node b, is deferred.
+     *
+     * @param spectrumSignalParams spectrum signal tx parameters
+     * @param a first node mobility model
+     * @param b second node mobility model
+     * @param aPhasedArrayModel the antenna array of the first node
+     * @param bPhasedArrayModel the antenna array of the second node
+     * @param deferred the deferred part of the computation
+     * @return the received PSD, which is computed when calling deferred
+     */
+    Ptr<SpectrumSignalParameters> DoPrepareRxPowerSpectralDensity(
+        Ptr<const SpectrumSignalParameters> spectrumSignalParams,
+        Ptr<const MobilityModel> a,
+        Ptr<const MobilityModel> b,
+        Ptr<const PhasedArrayModel> aPhasedArrayModel,
+        Ptr<const PhasedArrayModel> bPhasedArrayModel,
+        std::function<void()>& deferred) const override;
+
   protected:
     /**
      * Data structure that stores the long term component for a tx-rx pair
@@ -129,14 +155,27 @@ class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagati
     {
         Ptr<const MatrixBasedChannelModel::Complex3DVector>
             m_longTerm; //!< vector containing the long term component for each cluster
-        Ptr<const MatrixBasedChannelModel::ChannelMatrix>
-            m_channel; //!< pointer to the channel matrix used to compute the long term
+        Time m_generatedTime; //!< generation time of the channel matrix used to compute it
+        std::pair<uint32_t, uint32_t>
+            m_antennaPair; //!< the s and u antenna IDs of the channel matrix used to compute it
         PhasedArrayModel::ComplexVector
             m_sW; //!< the beamforming vector for the node s used to compute the long term
         PhasedArrayModel::ComplexVector
             m_uW; //!< the beamforming vector for the node u used to compute the long term
     };
 
+    /**
+     * Precompute the delay sincos of the channel params (m_cachedDelaySincos) unless they
+     * are up to date for the number of RBs, the RB width and the number of clusters.
+     * @param inPsd the input PSD
+     * @param channelParams the channel parameters, including delays
+     * @param numCluster the number of clusters
+     * @return true if the delay sincos have been computed
+     */
+    bool UpdateDelaySincos(const SpectrumValue& inPsd,
+                           const MatrixBasedChannelModel::ChannelParams& channelParams,
+                           size_t numCluster) const;
+
     /**
      * Computes the frequency-domain channel matrix with the dimensions numRxPorts*numTxPorts*numRBs
      * @param inPsd the input PSD
@@ -150,11 +189,11 @@ class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagati
      * @return 3D spectrum channel matrix with dimensions numRxPorts * numTxPorts * numRBs
      */
     Ptr<MatrixBasedChannelModel::Complex3DVector> GenSpectrumChannelMatrix(
-        Ptr<SpectrumValue> inPsd,
-        Ptr<const MatrixBasedChannelModel::Complex3DVector> longTerm,
-        Ptr<const MatrixBasedChannelModel::ChannelMatrix> channelMatrix,
-        Ptr<const MatrixBasedChannelModel::ChannelParams> channelParams,
-        PhasedArrayModel::ComplexVector doppler,
+        const SpectrumValue& inPsd,
+        const MatrixBasedChannelModel::Complex3DVector& longTerm,
+        const MatrixBasedChannelModel::ChannelMatrix& channelMatrix,
+        const MatrixBasedChannelModel::ChannelParams& channelParams,
+        const PhasedArrayModel::ComplexVector& doppler,
         uint8_t numTxPorts,
         uint8_t numRxPorts,
         bool isReverse) const;
@@ -233,11 +272,65 @@ class ThreeGppSpectrumPropagationLossModel : public PhasedArraySpectrumPropagati
         uint8_t numRxPorts,
         bool isReverse) const;
 
+    /**
+     * @brief Computes the Doppler term of each cluster at the current time
+     * @param longTerm the long term component
+     * @param channelMatrix the channel matrix structure
+     * @param channelParams the channel params structure
+     * @param sSpeed the speed of the first node
+     * @param uSpeed the speed of the second node
+     * @return the Doppler term of each cluster
+     */
+    PhasedArrayModel::ComplexVector CalcDoppler(
+        const MatrixBasedChannelModel::Complex3DVector& longTerm,
+        const MatrixBasedChannelModel::ChannelMatrix& channelMatrix,
+        const MatrixBasedChannelModel::ChannelParams& channelParams,
+        const Vector& sSpeed,
+        const Vector& uSpeed) const;
+
+    /**
+     * @brief Sets the spectrum channel matrix of the given parameters and applies
+     * the beamforming gain to their PSD. Reference counts of the shared objects
+     * are not modified, so that the method can be called outside the simulation
+     * thread (see PrepareRxPowerSpectralDensity).
+     * @param rxParams SpectrumSignalParameters holding the PSD to update
+     * @param longTerm the long term component
+     * @param channelMatrix the channel matrix structure
+     * @param channelParams the channel params structure
+     * @param doppler the doppler for each cluster
+     * @param numTxPorts the number of the ports of the first node
+     * @param numRxPorts the number of the porst of the second node
+     * @param isReverse indicator that tells whether the channel matrix is reverse
+     */
+    void ApplyBeamformingGain(SpectrumSignalParameters& rxParams,
+                              const MatrixBasedChannelModel::Complex3DVector& longTerm,
+                              const MatrixBasedChannelModel::ChannelMatrix& channelMatrix,
+                              const MatrixBasedChannelModel::ChannelParams& channelParams,
+                              const PhasedArrayModel::ComplexVector& doppler,
+                              uint8_t numTxPorts,
+                              uint8_t numRxPorts,
+                              bool isReverse) const;
+
     int64_t DoAssignStreams(int64_t stream) override;
 
+    /**
+     * Record an access to the long term component of a tx-rx pair and evict the least
+     * recently used long term components if the memory budget is exceeded
+     * @param key the key of the long term component
+     * @param longTerm the long term component
+     * @param hit whether the long term component was found in the map and reused
+     */
+    void UpdateLongTermCache(uint64_t key, Ptr<const LongTerm> longTerm, bool hit) const;
+
     mutable std::unordered_map<uint64_t, Ptr<const LongTerm>>
         m_longTermMap;                           //!< map containing the long term components
     Ptr<MatrixBasedChannelModel> m_channelModel; //!< the model to generate the channel matrix
+    uint64_t m_maxLongTermBytes;                 //!< memory budget of the long term map (0: none)
+    mutable LruCacheIndex m_longTermCache;       //!< LRU index of the entries of the long term map
+    mutable uint64_t m_longTermAccesses{0};      //!< number of accesses to the long term map
+    mutable uint64_t m_longTermHits{0};          //!< number of hits of the long term map
+    mutable TracedCallback<double, uint64_t>
+        m_longTermCacheTrace; //!< trace of the state of the long term map
 };
 } // namespace ns3
 
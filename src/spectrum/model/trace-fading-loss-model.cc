@@ -12,6 +12,7 @@
 #include "spectrum-signal-parameters.h"
 #include "spectrum-value.h"
 
+#include "ns3/abort.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
@@ -19,6 +20,7 @@
 #include "ns3/string.h"
 #include "ns3/uinteger.h"
 
+#include <cstring>
 #include <fstream>
 
 namespace ns3
@@ -26,10 +28,37 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("TraceFadingLossModel");
 
+namespace
+{
+
+/**
+ * The header of a binary fading trace, followed by the samples (doubles in host byte
+ * order), RB by RB
+ */
+struct BinaryTraceHeader
+{
+    char magic[8];       ///< the magic string, identifying the format
+    uint32_t version;    ///< the version of the format
+    uint32_t rbNum;      ///< the number of RBs
+    uint32_t samplesNum; ///< the number of samples of each RB
+    uint32_t reserved;   ///< padding, aligning the samples to 8 bytes
+};
+
+/// The magic string of the binary fading traces
+constexpr char BINARY_TRACE_MAGIC[8] = {'N', 'S', '3', 'F', 'A', 'D', 'T', 'R'};
+
+/// The version of the binary fading traces
+constexpr uint32_t BINARY_TRACE_VERSION = 1;
+
+static_assert(sizeof(BinaryTraceHeader) == 24, "Unexpected size of the binary trace header");
+
+} // namespace
+
 NS_OBJECT_ENSURE_REGISTERED(TraceFadingLossModel);
 
 TraceFadingLossModel::TraceFadingLossModel()
-    : m_streamsAssigned(false)
+    : m_samples(nullptr),
+      m_streamsAssigned(false)
 {
     NS_LOG_FUNCTION(this);
     SetNext(nullptr);
@@ -38,6 +67,7 @@ TraceFadingLossModel::TraceFadingLossModel()
 TraceFadingLossModel::~TraceFadingLossModel()
 {
     m_fadingTrace.clear();
+    m_mappedTrace.Close();
     m_windowOffsetsMap.clear();
     m_startVariableMap.clear();
 }
@@ -109,27 +139,50 @@ void
 TraceFadingLossModel::LoadTrace()
 {
     NS_LOG_FUNCTION(this << "Loading Fading Trace " << m_traceFile);
-    std::ifstream ifTraceFile;
-    ifTraceFile.open(m_traceFile, std::ifstream::in);
     m_fadingTrace.clear();
-    if (!ifTraceFile.good())
+    m_samples = nullptr;
+
+    BinaryTraceHeader header;
+    if (m_mappedTrace.Open(m_traceFile) && m_mappedTrace.GetSize() >= sizeof(header) &&
+        std::memcmp(m_mappedTrace.GetData(), BINARY_TRACE_MAGIC, sizeof(header.magic)) == 0)
     {
-        NS_LOG_INFO(this << " File: " << m_traceFile);
-        NS_ASSERT_MSG(ifTraceFile.good(), " Fading trace file not found");
+        std::memcpy(&header, m_mappedTrace.GetData(), sizeof(header));
+        NS_ABORT_MSG_IF(header.version != BINARY_TRACE_VERSION,
+                        "Unsupported version " << header.version << " of the fading trace "
+                                               << m_traceFile);
+        NS_ABORT_MSG_IF(m_mappedTrace.GetSize() <
+                            sizeof(header) + sizeof(double) * header.rbNum * header.samplesNum,
+                        "The fading trace " << m_traceFile << " is truncated");
+        NS_LOG_INFO(this << " binary trace with " << header.rbNum << " RBs and "
+                         << header.samplesNum << " samples");
+        m_rbNum = header.rbNum;
+        m_samplesNum = header.samplesNum;
+        // the mapping is page aligned and the header is 24 bytes long, hence the samples
+        // are correctly aligned
+        m_samples = reinterpret_cast<const double*>(m_mappedTrace.GetData() + sizeof(header));
     }
-
-    //   NS_LOG_INFO (this << " length " << m_traceLength.GetSeconds ());
-    //   NS_LOG_INFO (this << " RB " << (uint32_t)m_rbNum << " samples " << m_samplesNum);
-    for (uint32_t i = 0; i < m_rbNum; i++)
+    else
     {
-        FadingTraceSample rbTimeFadingTrace;
-        for (uint32_t j = 0; j < m_samplesNum; j++)
+        m_mappedTrace.Close();
+        std::ifstream ifTraceFile;
+        ifTraceFile.open(m_traceFile, std::ifstream::in);
+        if (!ifTraceFile.good())
+        {
+            NS_LOG_INFO(this << " File: " << m_traceFile);
+            NS_ASSERT_MSG(ifTraceFile.good(), " Fading trace file not found");
+        }
+
+        m_fadingTrace.reserve(static_cast<std::size_t>(m_rbNum) * m_samplesNum);
+        for (uint32_t i = 0; i < m_rbNum; i++)
         {
-            double sample;
-            ifTraceFile >> sample;
-            rbTimeFadingTrace.push_back(sample);
+            for (uint32_t j = 0; j < m_samplesNum; j++)
+            {
+                double sample;
+                ifTraceFile >> sample;
+                m_fadingTrace.push_back(sample);
+            }
         }
-        m_fadingTrace.push_back(rbTimeFadingTrace);
+        m_samples = m_fadingTrace.data();
     }
     m_timeGranularity = m_traceLength.GetMilliSeconds() / m_samplesNum;
     m_lastWindowUpdate = Simulator::Now();
@@ -195,7 +248,7 @@ TraceFadingLossModel::DoCalcRxPowerSpectralDensity(Ptr<const SpectrumSignalParam
     // (aSpeedVector.y-bSpeedVector.y,2));
 
     NS_LOG_LOGIC(this << *rxPsd);
-    NS_ASSERT(!m_fadingTrace.empty());
+    NS_ASSERT(m_samples);
     int now_ms = static_cast<int>(Simulator::Now().GetMilliSeconds() * m_timeGranularity);
     int lastUpdate_ms = static_cast<int>(m_lastWindowUpdate.GetMilliSeconds() * m_timeGranularity);
     int index = ((*itOff).second + now_ms - lastUpdate_ms) % m_samplesNum;
@@ -205,7 +258,8 @@ TraceFadingLossModel::DoCalcRxPowerSpectralDensity(Ptr<const SpectrumSignalParam
         NS_ASSERT(subChannel < 100);
         if (*vit != 0.)
         {
-            double fading = m_fadingTrace.at(subChannel).at(index);
+            NS_ASSERT(static_cast<uint32_t>(subChannel) < m_rbNum);
+            double fading = m_samples[static_cast<std::size_t>(subChannel) * m_samplesNum + index];
             NS_LOG_INFO(this << " FADING now " << now_ms << " offset " << (*itOff).second << " id "
                              << index << " fading " << fading);
             double power = *vit;                     // in Watt/Hz
@@ -226,6 +280,39 @@ TraceFadingLossModel::DoCalcRxPowerSpectralDensity(Ptr<const SpectrumSignalParam
     return rxPsd;
 }
 
+void
+TraceFadingLossModel::ConvertToBinary(const std::string& input,
+                                      const std::string& output,
+                                      uint32_t rbNum,
+                                      uint32_t samplesNum)
+{
+    NS_LOG_FUNCTION(input << output << rbNum << samplesNum);
+    std::ifstream inFile(input, std::ifstream::in);
+    NS_ABORT_MSG_IF(!inFile.good(), "Fading trace file " << input << " not found");
+
+    std::vector<double> samples(static_cast<std::size_t>(rbNum) * samplesNum);
+    for (auto& sample : samples)
+    {
+        inFile >> sample;
+    }
+    NS_ABORT_MSG_IF(inFile.fail(),
+                    "The fading trace " << input << " has less than " << rbNum << " RBs of "
+                                        << samplesNum << " samples");
+
+    BinaryTraceHeader header;
+    std::memcpy(header.magic, BINARY_TRACE_MAGIC, sizeof(header.magic));
+    header.version = BINARY_TRACE_VERSION;
+    header.rbNum = rbNum;
+    header.samplesNum = samplesNum;
+    header.reserved = 0;
+
+    std::ofstream outFile(output, std::ios::out | std::ios::binary | std::ios::trunc);
+    NS_ABORT_MSG_IF(!outFile.is_open(), "Can't open file " << output);
+    outFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    outFile.write(reinterpret_cast<const char*>(samples.data()), sizeof(double) * samples.size());
+    NS_ABORT_MSG_IF(!outFile.good(), "Can't write file " << output);
+}
+
 int64_t
 TraceFadingLossModel::DoAssignStreams(int64_t stream)
 {
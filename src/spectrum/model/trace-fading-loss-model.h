@@ -12,11 +12,13 @@
 
 #include "spectrum-propagation-loss-model.h"
 
+#include "ns3/mapped-file.h"
 #include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/random-variable-stream.h"
 
 #include <map>
+#include <vector>
 
 namespace ns3
 {
@@ -27,6 +29,13 @@ class MobilityModel;
  * @ingroup spectrum
  *
  * @brief fading loss model based on precalculated fading traces
+ *
+ * The trace is either a text file, with the samples of each RB on a line, or a binary
+ * file created by ConvertToBinary(). A binary trace is mapped in memory instead of being
+ * loaded, hence all the models, and all the simulations running on the same machine,
+ * reading the same binary trace share a single copy of the samples. The number of RBs
+ * and of samples of a binary trace are stored in the file, and the RbNum and SamplesNum
+ * attributes are ignored.
  */
 class TraceFadingLossModel : public SpectrumPropagationLossModel
 {
@@ -42,6 +51,19 @@ class TraceFadingLossModel : public SpectrumPropagationLossModel
 
     void DoInitialize() override;
 
+    /**
+     * @brief Convert a text fading trace to the binary format, which is mapped in memory
+     * when loaded
+     * @param input the name of the text trace
+     * @param output the name of the binary trace
+     * @param rbNum the number of RBs of the trace
+     * @param samplesNum the number of samples of the trace
+     */
+    static void ConvertToBinary(const std::string& input,
+                                const std::string& output,
+                                uint32_t rbNum,
+                                uint32_t samplesNum);
+
     /**
      * @brief The couple of mobility node that form a fading channel realization
      */
@@ -89,18 +111,16 @@ class TraceFadingLossModel : public SpectrumPropagationLossModel
     mutable std::map<ChannelRealizationId_t, Ptr<UniformRandomVariable>>
         m_startVariableMap; ///< start variable map
 
+    std::string m_traceFile; ///< the trace file name
+
     /**
-     * Vector with fading samples in time domain (for a fixed RB)
-     */
-    typedef std::vector<double> FadingTraceSample;
-    /**
-     * Vector collecting the time fading traces in the frequency domain (per RB)
+     * The fading samples, RB by RB, each RB with m_samplesNum samples in time domain.
+     * They point either to m_fadingTrace or to the content of m_mappedTrace.
      */
-    typedef std::vector<FadingTraceSample> FadingTrace;
-
-    std::string m_traceFile; ///< the trace file name
+    const double* m_samples;
 
-    FadingTrace m_fadingTrace; ///< fading trace
+    std::vector<double> m_fadingTrace; ///< fading trace, if read from a text file
+    MappedFile m_mappedTrace;          ///< fading trace, if mapped from a binary file
 
     Time m_traceLength;               ///< the trace time
     uint32_t m_samplesNum;            ///< number of samples
@@ -10,6 +10,13 @@ cpp_examples = [
     ("adhoc-aloha-ideal-phy", "True", "True"),
     ("adhoc-aloha-ideal-phy-with-microwave-oven", "True", "True"),
     ("adhoc-aloha-ideal-phy-matrix-propagation-loss-model", "True", "True"),
+    (
+        "fading-trace-converter "
+        "--input=../../src/lte/model/fading-traces/fading_trace_EPA_3kmph.fad "
+        "--output=fading_trace_EPA_3kmph.fad.bin",
+        "True",
+        "False",
+    ),
     ("three-gpp-channel-example", "True", "True"),
 ]
 
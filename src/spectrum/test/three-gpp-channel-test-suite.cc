@@ -6,18 +6,23 @@
 
 #include "ns3/abort.h"
 #include "ns3/angles.h"
+#include "ns3/boolean.h"
 #include "ns3/channel-condition-model.h"
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
 #include "ns3/double.h"
 #include "ns3/ism-spectrum-value-helper.h"
 #include "ns3/isotropic-antenna-model.h"
 #include "ns3/log.h"
+#include "ns3/multi-model-spectrum-channel.h"
 #include "ns3/node-container.h"
 #include "ns3/pointer.h"
+#include "ns3/propagation-delay-model.h"
 #include "ns3/rng-seed-manager.h"
 #include "ns3/simple-net-device.h"
 #include "ns3/simulator.h"
+#include "ns3/spectrum-phy.h"
 #include "ns3/spectrum-signal-parameters.h"
 #include "ns3/string.h"
 #include "ns3/test.h"
@@ -28,6 +33,7 @@
 #include "ns3/uniform-planar-array.h"
 
 #include <valarray>
+#include <vector>
 
 using namespace ns3;
 
@@ -1450,6 +1456,880 @@ ThreeGppMimoPolarizationTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup spectrum-tests
+ *
+ * SpectrumPhy equipped with a phased array that stores the PSDs of the received signals
+ */
+class ThreeGppTestSpectrumPhy : public SpectrumPhy
+{
+  public:
+    void SetDevice(Ptr<NetDevice> d) override
+    {
+        m_device = d;
+    }
+
+    Ptr<NetDevice> GetDevice() const override
+    {
+        return m_device;
+    }
+
+    void SetMobility(Ptr<MobilityModel> m) override
+    {
+        m_mobility = m;
+    }
+
+    Ptr<MobilityModel> GetMobility() const override
+    {
+        return m_mobility;
+    }
+
+    void SetChannel(Ptr<SpectrumChannel> c) override
+    {
+    }
+
+    Ptr<const SpectrumModel> GetRxSpectrumModel() const override
+    {
+        return m_rxSpectrumModel;
+    }
+
+    Ptr<Object> GetAntenna() const override
+    {
+        return m_antenna;
+    }
+
+    void StartRx(Ptr<SpectrumSignalParameters> params) override
+    {
+        m_rxPsds.push_back(params->psd->GetValues());
+    }
+
+    Ptr<NetDevice> m_device;                    //!< the device
+    Ptr<MobilityModel> m_mobility;              //!< the mobility model
+    Ptr<PhasedArrayModel> m_antenna;            //!< the antenna array
+    Ptr<const SpectrumModel> m_rxSpectrumModel; //!< the spectrum model
+    std::vector<Values> m_rxPsds;               //!< the PSDs of the received signals
+};
+
+/**
+ * @ingroup spectrum-tests
+ *
+ * Test case for the RxWorkerThreads attribute of the MultiModelSpectrumChannel.
+ * Signals transmitted by a node are received by nodes moving at different speeds
+ * (one of them having two SpectrumPhy instances) through the 3GPP channel model,
+ * which is updated between transmissions. The test checks that the received PSDs
+ * are the same when computing them in parallel with different numbers of threads
+ * and when computing them separately, with and without propagation delay. With
+ * propagation delay, the receivers move between the start of a transmission and
+ * its reception, hence the signals have to be computed at the reception.
+ */
+class ThreeGppChannelRxWorkerThreadsTest : public TestCase
+{
+  public:
+    ThreeGppChannelRxWorkerThreadsTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the scenario.
+     * @param rxWorkerThreads the value of the RxWorkerThreads attribute of the channel
+     * @param delay whether the channel has a propagation delay model
+     * @return the PSDs received by each receiver
+     */
+    std::vector<std::vector<Values>> RunScenario(uint32_t rxWorkerThreads, bool delay);
+};
+
+ThreeGppChannelRxWorkerThreadsTest::ThreeGppChannelRxWorkerThreadsTest()
+    : TestCase("Check that received signals do not depend on the number of worker threads")
+{
+}
+
+std::vector<std::vector<Values>>
+ThreeGppChannelRxWorkerThreadsTest::RunScenario(uint32_t rxWorkerThreads, bool delay)
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    auto lossModel = CreateObject<ThreeGppSpectrumPropagationLossModel>();
+    lossModel->SetChannelModelAttribute("Frequency", DoubleValue(2.4e9));
+    lossModel->SetChannelModelAttribute("Scenario", StringValue("UMa"));
+    lossModel->SetChannelModelAttribute(
+        "ChannelConditionModel",
+        PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+    lossModel->SetChannelModelAttribute("UpdatePeriod", TimeValue(MilliSeconds(5)));
+    DynamicCast<ThreeGppChannelModel>(lossModel->GetChannelModel())->AssignStreams(1);
+
+    auto channel = CreateObjectWithAttributes<MultiModelSpectrumChannel>(
+        "RxWorkerThreads",
+        UintegerValue(rxWorkerThreads));
+    channel->AddPhasedArraySpectrumPropagationLossModel(lossModel);
+    if (delay)
+    {
+        channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+    }
+
+    SpectrumValue5MhzFactory sf;
+    Ptr<SpectrumValue> txPsd = sf.CreateTxPowerSpectralDensity(0.1, 1);
+
+    // node 0 transmits, the last node has two SpectrumPhy instances
+    const std::size_t nNodes = 6;
+    NodeContainer nodes;
+    nodes.Create(nNodes);
+    std::vector<Ptr<ThreeGppTestSpectrumPhy>> phys;
+    for (std::size_t i = 0; i < nNodes; ++i)
+    {
+        auto mobility = CreateObject<ConstantVelocityMobilityModel>();
+        mobility->SetPosition(i == 0 ? Vector(0, 0, 25) : Vector(20.0 + 10 * i, 5.0 * i, 1.5));
+        mobility->SetVelocity(Vector(3.0 * i, -1.0 * i, 0));
+        nodes.Get(i)->AggregateObject(mobility);
+
+        for (std::size_t j = 0; j < (i == nNodes - 1 ? 2 : 1); ++j)
+        {
+            auto device = CreateObject<SimpleNetDevice>();
+            nodes.Get(i)->AddDevice(device);
+            device->SetNode(nodes.Get(i));
+
+            auto phy = CreateObject<ThreeGppTestSpectrumPhy>();
+            phy->SetDevice(device);
+            phy->SetMobility(mobility);
+            phy->m_rxSpectrumModel = txPsd->GetSpectrumModel();
+            phy->m_antenna = CreateObjectWithAttributes<UniformPlanarArray>(
+                "NumColumns",
+                UintegerValue(2),
+                "NumRows",
+                UintegerValue(2),
+                "AntennaElement",
+                PointerValue(CreateObject<IsotropicAntennaModel>()));
+            channel->AddRx(phy);
+            phys.push_back(phy);
+        }
+    }
+
+    // point the beams of the receivers towards the transmitter and the beam of the
+    // transmitter towards the first receiver
+    const auto txPos = phys[0]->GetMobility()->GetPosition();
+    for (std::size_t i = 1; i < phys.size(); ++i)
+    {
+        const auto rxPos = phys[i]->GetMobility()->GetPosition();
+        phys[i]->m_antenna->SetBeamformingVector(
+            phys[i]->m_antenna->GetBeamformingVector(Angles(txPos, rxPos)));
+    }
+    phys[0]->m_antenna->SetBeamformingVector(
+        phys[0]->m_antenna->GetBeamformingVector(Angles(phys[1]->GetMobility()->GetPosition(),
+                                                        txPos)));
+
+    for (auto time : {MilliSeconds(0), MilliSeconds(3), MilliSeconds(10)})
+    {
+        auto params = Create<SpectrumSignalParameters>();
+        params->psd = txPsd->Copy();
+        params->txPhy = phys[0];
+        params->duration = MicroSeconds(100);
+        Simulator::Schedule(time, &MultiModelSpectrumChannel::StartTx, channel, params);
+    }
+
+    Simulator::Run();
+
+    std::vector<std::vector<Values>> rxPsds;
+    for (std::size_t i = 1; i < phys.size(); ++i)
+    {
+        rxPsds.push_back(phys[i]->m_rxPsds);
+    }
+    Simulator::Destroy();
+    return rxPsds;
+}
+
+void
+ThreeGppChannelRxWorkerThreadsTest::DoRun()
+{
+    for (bool delay : {false, true})
+    {
+        const auto expected = RunScenario(0, delay);
+        for (const auto& psds : expected)
+        {
+            NS_TEST_ASSERT_MSG_EQ(psds.size(), 3, "Unexpected number of received signals");
+        }
+
+        for (uint32_t rxWorkerThreads : {1, 3})
+        {
+            const auto rxPsds = RunScenario(rxWorkerThreads, delay);
+            NS_TEST_ASSERT_MSG_EQ(rxPsds.size(),
+                                  expected.size(),
+                                  "Unexpected number of receivers");
+            for (std::size_t i = 0; i < rxPsds.size(); ++i)
+            {
+                NS_TEST_ASSERT_MSG_EQ(rxPsds[i].size(),
+                                      expected[i].size(),
+                                      "Unexpected number of received signals");
+                for (std::size_t j = 0; j < rxPsds[i].size(); ++j)
+                {
+                    NS_TEST_EXPECT_MSG_EQ((rxPsds[i][j] == expected[i][j]),
+                                          true,
+                                          "Signal " << j << " received by receiver " << i
+                                                    << " differs with " << rxWorkerThreads
+                                                    << " worker threads"
+                                                    << (delay ? " and propagation delay" : ""));
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @ingroup spectrum-tests
+ *
+ * Test case for the GetChannels method of the ThreeGppChannelModel. The channel
+ * matrices between a node and several other nodes, equipped with single and dual
+ * polarized antenna arrays of different sizes, are requested twice, before and
+ * after the channel parameters are updated. Some pairs are requested more than once
+ * and in both directions. The test checks that the channel matrices returned by
+ * GetChannels are exactly the same as those returned by GetChannel, for different
+ * numbers of threads.
+ */
+class ThreeGppChannelBatchGenerationTest : public TestCase
+{
+  public:
+    ThreeGppChannelBatchGenerationTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the scenario.
+     * @param generationThreads the value of the ChannelGenerationThreads attribute of the
+     *                          channel model, or 0 to call GetChannel for each pair of nodes
+     * @return the coefficients of the channel matrices, in the order of the requests
+     */
+    std::vector<MatrixBasedChannelModel::Complex3DVector> RunScenario(uint32_t generationThreads);
+};
+
+ThreeGppChannelBatchGenerationTest::ThreeGppChannelBatchGenerationTest()
+    : TestCase("Check that GetChannels returns the same channel matrices as GetChannel")
+{
+}
+
+std::vector<MatrixBasedChannelModel::Complex3DVector>
+ThreeGppChannelBatchGenerationTest::RunScenario(uint32_t generationThreads)
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    auto channelModel = CreateObject<ThreeGppChannelModel>();
+    channelModel->SetAttribute("Frequency", DoubleValue(28.0e9));
+    channelModel->SetAttribute("Scenario", StringValue("UMa"));
+    channelModel->SetAttribute("ChannelConditionModel",
+                               PointerValue(CreateObject<ThreeGppUmaChannelConditionModel>()));
+    channelModel->SetAttribute("UpdatePeriod", TimeValue(MilliSeconds(5)));
+    if (generationThreads > 0)
+    {
+        channelModel->SetAttribute("ChannelGenerationThreads", UintegerValue(generationThreads));
+    }
+    channelModel->AssignStreams(1);
+    channelModel->GetChannelConditionModel()->AssignStreams(100);
+
+    const std::size_t nNodes = 6;
+    NodeContainer nodes;
+    nodes.Create(nNodes);
+    std::vector<Ptr<MobilityModel>> mobilities;
+    std::vector<Ptr<PhasedArrayModel>> antennas;
+    for (std::size_t i = 0; i < nNodes; ++i)
+    {
+        auto mobility = CreateObject<ConstantVelocityMobilityModel>();
+        mobility->SetPosition(i == 0 ? Vector(0, 0, 25) : Vector(40.0 * i, -30.0 * i, 1.5));
+        mobility->SetVelocity(Vector(2.0 * i, 1.0 * i, 0));
+        nodes.Get(i)->AggregateObject(mobility);
+        mobilities.push_back(mobility);
+
+        antennas.push_back(CreateObjectWithAttributes<UniformPlanarArray>(
+            "NumColumns",
+            UintegerValue(i == 0 ? 4 : 2),
+            "NumRows",
+            UintegerValue(i % 3 + 1),
+            "IsDualPolarized",
+            BooleanValue(i % 2 == 0),
+            "AntennaElement",
+            PointerValue(CreateObject<ThreeGppAntennaModel>())));
+    }
+
+    // node 0 is paired with every other node; the pair (0, 1) is requested twice
+    // and the pair (0, 2) is requested in both directions
+    std::vector<MatrixBasedChannelModel::ChannelRequest> requests;
+    for (std::size_t i = 1; i < nNodes; ++i)
+    {
+        requests.push_back({mobilities[0], mobilities[i], antennas[0], antennas[i]});
+    }
+    requests.push_back({mobilities[0], mobilities[1], antennas[0], antennas[1]});
+    requests.push_back({mobilities[2], mobilities[0], antennas[2], antennas[0]});
+
+    std::vector<MatrixBasedChannelModel::Complex3DVector> channels;
+    auto getChannels = [&]() {
+        if (generationThreads > 0)
+        {
+            for (const auto& channel : channelModel->GetChannels(requests))
+            {
+                channels.push_back(channel->m_channel);
+            }
+        }
+        else
+        {
+            for (const auto& request : requests)
+            {
+                channels.push_back(channelModel
+                                       ->GetChannel(request.aMob,
+                                                    request.bMob,
+                                                    request.aAntenna,
+                                                    request.bAntenna)
+                                       ->m_channel);
+            }
+        }
+    };
+
+    // the second requests are performed after the channel parameters are updated
+    Simulator::Schedule(MilliSeconds(0), getChannels);
+    Simulator::Schedule(MilliSeconds(10), getChannels);
+    Simulator::Run();
+    Simulator::Destroy();
+    return channels;
+}
+
+void
+ThreeGppChannelBatchGenerationTest::DoRun()
+{
+    const auto expected = RunScenario(0);
+    NS_TEST_ASSERT_MSG_EQ(expected.size(), 14, "Unexpected number of channel matrices");
+
+    for (uint32_t generationThreads : {1, 3})
+    {
+        const auto channels = RunScenario(generationThreads);
+        NS_TEST_ASSERT_MSG_EQ(channels.size(),
+                              expected.size(),
+                              "Unexpected number of channel matrices");
+        for (std::size_t i = 0; i < channels.size(); ++i)
+        {
+            NS_TEST_EXPECT_MSG_EQ((channels[i] == expected[i]),
+                                  true,
+                                  "Channel matrix " << i << " differs with " << generationThreads
+                                                    << " generation threads");
+        }
+    }
+}
+
+/**
+ * @ingroup spectrum-tests
+ *
+ * Test case for the SpatialConsistentUpdate attribute of the ThreeGppChannelModel.
+ * A node moves away from a static node at 1 m/s. The test checks that, when the
+ * update period expires, the delays of the clusters are updated consistently with
+ * the displacement of the node and the coefficients of the channel matrix are
+ * rotated, as long as the node does not move farther than MaxUpdateDistance, and
+ * that new channel params are generated afterwards or if the attribute is false.
+ * It is also checked that the channel matrix is not updated between updates.
+ */
+class ThreeGppSpatialConsistentUpdateTest : public TestCase
+{
+  public:
+    ThreeGppSpatialConsistentUpdateTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run the scenario.
+     * @param spatialConsistentUpdate the value of the SpatialConsistentUpdate attribute
+     */
+    void RunScenario(bool spatialConsistentUpdate);
+
+    /**
+     * Get the channel and check whether it has been generated anew or updated.
+     * @param expectGeneration whether new channel params are expected
+     * @param expectUpdate whether an update of the channel params is expected
+     */
+    void CheckChannel(bool expectGeneration, bool expectUpdate);
+
+    Ptr<ThreeGppChannelModel> m_channelModel; //!< the channel model
+    Ptr<MobilityModel> m_txMob;               //!< the mobility model of the static node
+    Ptr<MobilityModel> m_rxMob;               //!< the mobility model of the moving node
+    Ptr<PhasedArrayModel> m_txAntenna;        //!< the antenna of the static node
+    Ptr<PhasedArrayModel> m_rxAntenna;        //!< the antenna of the moving node
+    Ptr<const MatrixBasedChannelModel::ChannelMatrix> m_lastChannel; //!< the last channel
+    MatrixBasedChannelModel::DoubleVector m_lastDelays; //!< the last delays of the clusters
+    Vector m_lastUpdatePosition; //!< the position of the moving node at the last update
+};
+
+ThreeGppSpatialConsistentUpdateTest::ThreeGppSpatialConsistentUpdateTest()
+    : TestCase("Check the spatially consistent update of the channel")
+{
+}
+
+void
+ThreeGppSpatialConsistentUpdateTest::CheckChannel(bool expectGeneration, bool expectUpdate)
+{
+    auto channel = m_channelModel->GetChannel(m_txMob, m_rxMob, m_txAntenna, m_rxAntenna);
+    auto params = m_channelModel->GetParams(m_txMob, m_rxMob);
+    NS_TEST_ASSERT_MSG_NE(params, nullptr, "Channel params not found");
+
+    if (expectGeneration)
+    {
+        NS_TEST_EXPECT_MSG_NE(channel, m_lastChannel, "Expected a new channel matrix");
+        NS_TEST_EXPECT_MSG_EQ(channel->m_generatedTime,
+                              Simulator::Now(),
+                              "Unexpected generation time");
+        NS_TEST_EXPECT_MSG_EQ(params->m_generatedTime,
+                              Simulator::Now(),
+                              "Unexpected generation time of the channel params");
+        m_lastUpdatePosition = m_rxMob->GetPosition();
+    }
+    else if (expectUpdate)
+    {
+        NS_TEST_EXPECT_MSG_NE(channel, m_lastChannel, "Expected an updated channel matrix");
+        NS_TEST_EXPECT_MSG_EQ(channel->m_generatedTime,
+                              Simulator::Now(),
+                              "Unexpected generation time");
+        NS_TEST_EXPECT_MSG_LT(params->m_generatedTime,
+                              Simulator::Now(),
+                              "Unexpected generation of new channel params");
+        const auto& coeffs = channel->m_channel;
+        const auto& lastCoeffs = m_lastChannel->m_channel;
+        NS_TEST_ASSERT_MSG_EQ((coeffs.GetNumRows() == lastCoeffs.GetNumRows() &&
+                               coeffs.GetNumCols() == lastCoeffs.GetNumCols() &&
+                               coeffs.GetNumPages() == lastCoeffs.GetNumPages()),
+                              true,
+                              "Unexpected size of the updated channel matrix");
+        // the coefficients are rotated, rather than generated again
+        bool coeffChanged = false;
+        for (std::size_t i = 0; i < coeffs.GetSize(); ++i)
+        {
+            coeffChanged |= (coeffs.GetValues()[i] != lastCoeffs.GetValues()[i]);
+            NS_TEST_EXPECT_MSG_EQ_TOL(std::abs(coeffs.GetValues()[i]),
+                                      std::abs(lastCoeffs.GetValues()[i]),
+                                      1e-12 * std::abs(lastCoeffs.GetValues()[i]),
+                                      "The channel coefficient " << i << " was not rotated");
+        }
+        NS_TEST_EXPECT_MSG_EQ(coeffChanged, true, "The channel coefficients were not updated");
+    }
+    else
+    {
+        NS_TEST_EXPECT_MSG_EQ(channel, m_lastChannel, "Expected the same channel matrix");
+    }
+
+    if (!expectGeneration)
+    {
+        NS_TEST_ASSERT_MSG_EQ(params->m_delay.size(),
+                              m_lastDelays.size(),
+                              "Unexpected number of clusters");
+        // the length of each path and the length of the LOS path change by at most
+        // the displacement of the node since the last update
+        double displacement = CalculateDistance(m_rxMob->GetPosition(), m_lastUpdatePosition);
+        bool delayChanged = false;
+        for (std::size_t i = 0; i < m_lastDelays.size(); ++i)
+        {
+            double delayChange = params->m_delay[i] - m_lastDelays[i];
+            delayChanged |= (delayChange != 0);
+            NS_TEST_EXPECT_MSG_LT_OR_EQ(std::abs(delayChange),
+                                        2 * displacement / 3e8 + 1e-15,
+                                        "Unexpected change of the delay of cluster " << i);
+        }
+        NS_TEST_EXPECT_MSG_EQ(delayChanged, expectUpdate, "Unexpected update of the delays");
+        if (expectUpdate)
+        {
+            m_lastUpdatePosition = m_rxMob->GetPosition();
+        }
+    }
+
+    m_lastChannel = channel;
+    m_lastDelays = params->m_delay;
+}
+
+void
+ThreeGppSpatialConsistentUpdateTest::RunScenario(bool spatialConsistentUpdate)
+{
+    m_channelModel = CreateObject<ThreeGppChannelModel>();
+    m_channelModel->SetAttribute("Frequency", DoubleValue(28.0e9));
+    m_channelModel->SetAttribute("Scenario", StringValue("UMi-StreetCanyon"));
+    m_channelModel->SetAttribute("ChannelConditionModel",
+                                 PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+    m_channelModel->SetAttribute("UpdatePeriod", TimeValue(MilliSeconds(10)));
+    m_channelModel->SetAttribute("SpatialConsistentUpdate", BooleanValue(spatialConsistentUpdate));
+    m_channelModel->SetAttribute("MaxUpdateDistance", DoubleValue(1.0));
+    m_channelModel->AssignStreams(1);
+
+    NodeContainer nodes;
+    nodes.Create(2);
+    m_txMob = CreateObject<ConstantPositionMobilityModel>();
+    m_txMob->SetPosition(Vector(0, 0, 10));
+    nodes.Get(0)->AggregateObject(m_txMob);
+    auto rxMob = CreateObject<ConstantVelocityMobilityModel>();
+    rxMob->SetPosition(Vector(50, 20, 1.5));
+    rxMob->SetVelocity(Vector(1, 0, 0));
+    nodes.Get(1)->AggregateObject(rxMob);
+    m_rxMob = rxMob;
+
+    m_txAntenna = CreateObjectWithAttributes<UniformPlanarArray>("NumColumns",
+                                                                 UintegerValue(2),
+                                                                 "NumRows",
+                                                                 UintegerValue(2));
+    m_rxAntenna = CreateObjectWithAttributes<UniformPlanarArray>("NumColumns",
+                                                                 UintegerValue(2),
+                                                                 "NumRows",
+                                                                 UintegerValue(2));
+    // the antennas mark their channels as out of date when configured; clear the
+    // flag, otherwise the channel is generated again at the second request
+    m_txAntenna->IsChannelOutOfDate(m_rxAntenna);
+    m_lastChannel = nullptr;
+
+    // the update period expires at 20 ms and 700 ms; the node moved farther than
+    // MaxUpdateDistance at 1.5 s
+    Simulator::Schedule(MilliSeconds(0),
+                        &ThreeGppSpatialConsistentUpdateTest::CheckChannel,
+                        this,
+                        true,
+                        false);
+    Simulator::Schedule(MilliSeconds(5),
+                        &ThreeGppSpatialConsistentUpdateTest::CheckChannel,
+                        this,
+                        false,
+                        false);
+    Simulator::Schedule(MilliSeconds(20),
+                        &ThreeGppSpatialConsistentUpdateTest::CheckChannel,
+                        this,
+                        !spatialConsistentUpdate,
+                        spatialConsistentUpdate);
+    Simulator::Schedule(MilliSeconds(700),
+                        &ThreeGppSpatialConsistentUpdateTest::CheckChannel,
+                        this,
+                        !spatialConsistentUpdate,
+                        spatialConsistentUpdate);
+    Simulator::Schedule(MilliSeconds(1500),
+                        &ThreeGppSpatialConsistentUpdateTest::CheckChannel,
+                        this,
+                        true,
+                        false);
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+void
+ThreeGppSpatialConsistentUpdateTest::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    RunScenario(true);
+    RunScenario(false);
+}
+
+/**
+ * @ingroup spectrum-tests
+ *
+ * Test case for the memory budgets of the caches of the ThreeGppChannelModel.
+ * With a budget smaller than a single entry, only the most recently used channel
+ * matrix and channel params are kept, and the evicted ones are generated anew when
+ * requested again. The test also checks that the channel matrices which are not
+ * requested for CompactChannelAge are stored in single precision and restored
+ * when requested again, without modifying the channel matrices that are in use, that
+ * the memory used by the delay sincos cached in the channel params is accounted for, and
+ * that the long term components do not reference the channel matrices.
+ */
+class ThreeGppChannelCacheTest : public TestCase
+{
+  public:
+    ThreeGppChannelCacheTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the eviction of the least recently used entries.
+     */
+    void CheckEviction();
+
+    /**
+     * Check the compaction of the channel matrices which are not requested.
+     */
+    void CheckCompaction();
+
+    /**
+     * Check that the memory used by the delay sincos that the spectrum propagation loss
+     * model caches in the channel params is accounted for, and that the long term
+     * component it caches does not keep the channel matrix alive.
+     */
+    void CheckChannelParamsBytes();
+
+    /**
+     * Get the channel matrix of a link and check whether it is the same as the
+     * previous one of the link.
+     * @param rx the index of the receiver
+     * @param expectSame whether the same channel matrix is expected
+     */
+    void GetChannel(uint32_t rx, bool expectSame);
+
+    /**
+     * Check that the coefficients of the channel matrix of a link are the same as
+     * the ones stored when the channel matrix was generated, up to single precision
+     * @param rx the index of the receiver
+     */
+    void CheckCoefficients(uint32_t rx);
+
+    /**
+     * Callback for the ChannelMatrixCache trace source
+     * @param hitRate the hit rate of the cache
+     * @param bytes the memory used by the cache
+     */
+    void ChannelMatrixCache(double hitRate, uint64_t bytes);
+
+    /**
+     * Callback for the ChannelParamsCache trace source
+     * @param hitRate the hit rate of the cache
+     * @param bytes the memory used by the cache
+     */
+    void ChannelParamsCache(double hitRate, uint64_t bytes);
+
+    /**
+     * Create the channel model, the nodes and the antennas
+     */
+    void Setup();
+
+    Ptr<ThreeGppChannelModel> m_channelModel;       //!< the channel model
+    Ptr<MobilityModel> m_txMob;                     //!< the mobility model of the transmitter
+    Ptr<PhasedArrayModel> m_txAntenna;              //!< the antenna of the transmitter
+    std::vector<Ptr<MobilityModel>> m_rxMob;        //!< the mobility models of the receivers
+    std::vector<Ptr<PhasedArrayModel>> m_rxAntenna; //!< the antennas of the receivers
+    std::vector<Ptr<const MatrixBasedChannelModel::ChannelMatrix>>
+        m_channels; //!< the last channel matrix of each link
+    std::vector<MatrixBasedChannelModel::Complex3DVector>
+        m_coefficients;  //!< the coefficients of each link when generated
+    double m_hitRate{0};       //!< the last hit rate reported by the trace source
+    uint64_t m_bytes{0};       //!< the last memory usage reported by the trace source
+    uint64_t m_paramsBytes{0}; //!< the last memory usage of the channel params cache
+};
+
+ThreeGppChannelCacheTest::ThreeGppChannelCacheTest()
+    : TestCase("Check the memory budgets and the compaction of the channel caches")
+{
+}
+
+void
+ThreeGppChannelCacheTest::ChannelMatrixCache(double hitRate, uint64_t bytes)
+{
+    m_hitRate = hitRate;
+    m_bytes = bytes;
+}
+
+void
+ThreeGppChannelCacheTest::ChannelParamsCache(double hitRate, uint64_t bytes)
+{
+    m_paramsBytes = bytes;
+}
+
+void
+ThreeGppChannelCacheTest::Setup()
+{
+    m_channelModel = CreateObject<ThreeGppChannelModel>();
+    m_channelModel->SetAttribute("Frequency", DoubleValue(28.0e9));
+    m_channelModel->SetAttribute("Scenario", StringValue("UMi-StreetCanyon"));
+    m_channelModel->SetAttribute("ChannelConditionModel",
+                                 PointerValue(CreateObject<AlwaysLosChannelConditionModel>()));
+    m_channelModel->AssignStreams(1);
+    m_channelModel->TraceConnectWithoutContext(
+        "ChannelMatrixCache",
+        MakeCallback(&ThreeGppChannelCacheTest::ChannelMatrixCache, this));
+    m_channelModel->TraceConnectWithoutContext(
+        "ChannelParamsCache",
+        MakeCallback(&ThreeGppChannelCacheTest::ChannelParamsCache, this));
+
+    NodeContainer nodes;
+    nodes.Create(3);
+    m_txMob = CreateObject<ConstantPositionMobilityModel>();
+    m_txMob->SetPosition(Vector(0, 0, 10));
+    nodes.Get(0)->AggregateObject(m_txMob);
+    m_txAntenna = CreateObjectWithAttributes<UniformPlanarArray>("NumColumns",
+                                                                 UintegerValue(2),
+                                                                 "NumRows",
+                                                                 UintegerValue(2));
+    m_rxMob.clear();
+    m_rxAntenna.clear();
+    for (uint32_t i = 1; i < nodes.GetN(); ++i)
+    {
+        auto rxMob = CreateObject<ConstantPositionMobilityModel>();
+        rxMob->SetPosition(Vector(20.0 * i, 10, 1.5));
+        nodes.Get(i)->AggregateObject(rxMob);
+        m_rxMob.push_back(rxMob);
+        m_rxAntenna.push_back(CreateObjectWithAttributes<UniformPlanarArray>("NumColumns",
+                                                                             UintegerValue(2),
+                                                                             "NumRows",
+                                                                             UintegerValue(2)));
+    }
+    // the antennas mark their channels as out of date when configured; clear the
+    // flag, otherwise the channels are generated again at the second request
+    for (const auto& rxAntenna : m_rxAntenna)
+    {
+        m_txAntenna->IsChannelOutOfDate(rxAntenna);
+    }
+    m_channels.assign(m_rxMob.size(), nullptr);
+    m_coefficients.assign(m_rxMob.size(), MatrixBasedChannelModel::Complex3DVector());
+}
+
+void
+ThreeGppChannelCacheTest::GetChannel(uint32_t rx, bool expectSame)
+{
+    auto channel = m_channelModel->GetChannel(m_txMob, m_rxMob[rx], m_txAntenna, m_rxAntenna[rx]);
+    if (expectSame)
+    {
+        NS_TEST_EXPECT_MSG_EQ(channel, m_channels[rx], "Expected the cached channel matrix");
+    }
+    else
+    {
+        NS_TEST_EXPECT_MSG_NE(channel, m_channels[rx], "Expected a new channel matrix");
+        m_coefficients[rx] = channel->m_channel;
+    }
+    m_channels[rx] = channel;
+}
+
+void
+ThreeGppChannelCacheTest::CheckCoefficients(uint32_t rx)
+{
+    const auto& coefficients = m_channels[rx]->m_channel;
+    NS_TEST_ASSERT_MSG_EQ(coefficients.GetSize(),
+                          m_coefficients[rx].GetSize(),
+                          "Unexpected size of the restored channel matrix");
+    for (size_t i = 0; i < coefficients.GetSize(); ++i)
+    {
+        auto expected = m_coefficients[rx].GetValues()[i];
+        NS_TEST_EXPECT_MSG_LT_OR_EQ(std::abs(coefficients.GetValues()[i] - expected),
+                                    1e-6 * std::abs(expected),
+                                    "Unexpected restored coefficient " << i);
+    }
+}
+
+void
+ThreeGppChannelCacheTest::CheckEviction()
+{
+    // without a budget, both the channel matrices are kept
+    GetChannel(0, false);
+    uint64_t bytes0 = m_bytes;
+    GetChannel(1, false);
+    uint64_t bytes1 = m_bytes;
+    GetChannel(0, true);
+    GetChannel(1, true);
+    NS_TEST_EXPECT_MSG_EQ_TOL(m_hitRate, 0.5, 1e-9, "Unexpected hit rate");
+
+    // with a budget smaller than an entry, only the most recently used entry is kept
+    m_channelModel->SetAttribute("MaxChannelMatrixBytes", UintegerValue(1));
+    m_channelModel->SetAttribute("MaxChannelParamsBytes", UintegerValue(1));
+    GetChannel(1, true);
+    NS_TEST_EXPECT_MSG_EQ(m_bytes,
+                          bytes1 - bytes0,
+                          "The least recently used channel matrix was not evicted");
+    NS_TEST_EXPECT_MSG_EQ(m_channelModel->GetParams(m_txMob, m_rxMob[0]),
+                          nullptr,
+                          "The least recently used channel params were not evicted");
+    NS_TEST_EXPECT_MSG_NE(m_channelModel->GetParams(m_txMob, m_rxMob[1]),
+                          nullptr,
+                          "The most recently used channel params were evicted");
+    GetChannel(1, true);
+    GetChannel(0, false);
+    NS_TEST_EXPECT_MSG_EQ(m_channelModel->GetParams(m_txMob, m_rxMob[1]),
+                          nullptr,
+                          "The least recently used channel params were not evicted");
+    GetChannel(1, false);
+}
+
+void
+ThreeGppChannelCacheTest::CheckCompaction()
+{
+    if (Simulator::Now() == Seconds(0))
+    {
+        GetChannel(0, false);
+        GetChannel(1, false);
+        return;
+    }
+
+    // the channel matrix of the first link has not been requested for longer than
+    // CompactChannelAge, hence it is compacted when the second link is requested
+    uint64_t bytes = m_bytes;
+    GetChannel(1, true);
+    NS_TEST_EXPECT_MSG_LT(m_bytes, bytes, "The channel matrix was not compacted");
+
+    // the channel matrix handed out before the compaction is not modified
+    auto compacted = m_channels[0];
+    NS_TEST_ASSERT_MSG_EQ(compacted->m_channel.GetSize(),
+                          m_coefficients[0].GetSize(),
+                          "The coefficients of a channel matrix in use were released");
+    for (size_t i = 0; i < m_coefficients[0].GetSize(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(compacted->m_channel.GetValues()[i],
+                              m_coefficients[0].GetValues()[i],
+                              "The coefficients of a channel matrix in use were modified");
+    }
+
+    // the channel matrix is restored, in a new object, when requested again
+    m_channels[0] =
+        m_channelModel->GetChannel(m_txMob, m_rxMob[0], m_txAntenna, m_rxAntenna[0]);
+    NS_TEST_EXPECT_MSG_NE(m_channels[0], compacted, "Expected a restored channel matrix");
+    NS_TEST_EXPECT_MSG_EQ(m_channels[0]->m_generatedTime,
+                          compacted->m_generatedTime,
+                          "The restored channel matrix was generated anew");
+    NS_TEST_EXPECT_MSG_EQ(m_bytes, bytes, "Unexpected memory usage after the restore");
+    CheckCoefficients(0);
+}
+
+void
+ThreeGppChannelCacheTest::CheckChannelParamsBytes()
+{
+    auto lossModel = CreateObject<ThreeGppSpectrumPropagationLossModel>();
+    lossModel->SetChannelModel(m_channelModel);
+    for (const auto& antenna : {m_txAntenna, m_rxAntenna[0]})
+    {
+        const auto numElems = antenna->GetNumElems();
+        antenna->SetBeamformingVector(PhasedArrayModel::ComplexVector(
+            std::valarray<std::complex<double>>(1.0 / std::sqrt(numElems), numElems)));
+    }
+    SpectrumValue5MhzFactory sf;
+    auto txParams = Create<SpectrumSignalParameters>();
+    txParams->psd = sf.CreateTxPowerSpectralDensity(0.1, 1);
+
+    GetChannel(0, false);
+    uint64_t bytes = m_paramsBytes;
+    lossModel->DoCalcRxPowerSpectralDensity(txParams,
+                                            m_txMob,
+                                            m_rxMob[0],
+                                            m_txAntenna,
+                                            m_rxAntenna[0]);
+    // the delay sincos are computed for every RB and every cluster
+    NS_TEST_EXPECT_MSG_EQ(m_paramsBytes,
+                          bytes + txParams->psd->GetValuesN() *
+                                      m_channels[0]->m_channel.GetNumPages() *
+                                      sizeof(std::complex<double>),
+                          "The memory used by the delay sincos was not accounted for");
+
+    // only the channel model and this test reference the channel matrix, so that it is
+    // released when evicted or compacted by the channel model
+    NS_TEST_EXPECT_MSG_EQ(m_channels[0]->GetReferenceCount(),
+                          2,
+                          "The channel matrix is referenced by the long term component");
+}
+
+void
+ThreeGppChannelCacheTest::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    Setup();
+    CheckEviction();
+    Simulator::Destroy();
+
+    Setup();
+    CheckChannelParamsBytes();
+    Simulator::Destroy();
+
+    Setup();
+    m_channelModel->SetAttribute("CompactChannelAge", TimeValue(MilliSeconds(10)));
+    Simulator::Schedule(MilliSeconds(0), &ThreeGppChannelCacheTest::CheckCompaction, this);
+    Simulator::Schedule(MilliSeconds(20), &ThreeGppChannelCacheTest::CheckCompaction, this);
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
 /**
  * @ingroup spectrum-tests
  *
@@ -1486,6 +2366,10 @@ ThreeGppChannelTestSuite::ThreeGppChannelTestSuite()
     AddTestCase(new ThreeGppSpectrumPropagationLossModelTest(4, 2, 2, 1),
                 TestCase::Duration::QUICK);
     AddTestCase(new ThreeGppCalcLongTermMultiPortTest(), TestCase::Duration::QUICK);
+    AddTestCase(new ThreeGppChannelRxWorkerThreadsTest(), TestCase::Duration::QUICK);
+    AddTestCase(new ThreeGppChannelBatchGenerationTest(), TestCase::Duration::QUICK);
+    AddTestCase(new ThreeGppSpatialConsistentUpdateTest(), TestCase::Duration::QUICK);
+    AddTestCase(new ThreeGppChannelCacheTest(), TestCase::Duration::QUICK);
 
     /**
      *  The TX and RX antennas are configured face-to-face.
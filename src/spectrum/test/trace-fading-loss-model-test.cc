@@ -0,0 +1,159 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/spectrum-signal-parameters.h"
+#include "ns3/spectrum-value.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/trace-fading-loss-model.h"
+#include "ns3/uinteger.h"
+
+#include <cmath>
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE("TraceFadingLossModelTest");
+
+using namespace ns3;
+
+/**
+ * @ingroup spectrum-tests
+ *
+ * @brief Check that a fading trace converted to the binary format, which is mapped in
+ * memory, yields the same fading as the text trace, over several windows.
+ */
+class TraceFadingBinaryTestCase : public TestCase
+{
+  public:
+    TraceFadingBinaryTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Create a fading model reading a trace
+     * @param filename the name of the trace
+     * @return the fading model
+     */
+    Ptr<TraceFadingLossModel> CreateModel(std::string filename);
+
+    /// Check that both models apply the same fading to the signal
+    void Check();
+
+    static constexpr uint32_t RB_NUM = 4;       //!< the number of RBs of the trace
+    static constexpr uint32_t SAMPLES_NUM = 50; //!< the number of samples of the trace
+
+    Ptr<TraceFadingLossModel> m_text;       //!< the model reading the text trace
+    Ptr<TraceFadingLossModel> m_binary;     //!< the model mapping the binary trace
+    Ptr<SpectrumSignalParameters> m_params; //!< the transmitted signal
+    Ptr<MobilityModel> m_a;                 //!< the mobility of the transmitter
+    Ptr<MobilityModel> m_b;                 //!< the mobility of the receiver
+};
+
+TraceFadingBinaryTestCase::TraceFadingBinaryTestCase()
+    : TestCase("Check the fading of a binary trace mapped in memory")
+{
+}
+
+Ptr<TraceFadingLossModel>
+TraceFadingBinaryTestCase::CreateModel(std::string filename)
+{
+    Ptr<TraceFadingLossModel> model = CreateObject<TraceFadingLossModel>();
+    model->SetAttribute("TraceFilename", StringValue(filename));
+    model->SetAttribute("TraceLength", TimeValue(MilliSeconds(SAMPLES_NUM)));
+    model->SetAttribute("SamplesNum", UintegerValue(SAMPLES_NUM));
+    model->SetAttribute("WindowSize", TimeValue(MilliSeconds(10)));
+    model->SetAttribute("RbNum", UintegerValue(RB_NUM));
+    model->AssignStreams(7);
+    model->Initialize();
+    return model;
+}
+
+void
+TraceFadingBinaryTestCase::Check()
+{
+    Ptr<SpectrumValue> text = m_text->CalcRxPowerSpectralDensity(m_params, m_a, m_b);
+    Ptr<SpectrumValue> binary = m_binary->CalcRxPowerSpectralDensity(m_params, m_a, m_b);
+    for (uint32_t rb = 0; rb < RB_NUM; rb++)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL((*binary)[rb],
+                                  (*text)[rb],
+                                  (*text)[rb] * 1e-12,
+                                  "Unexpected fading of RB " << rb << " at "
+                                                             << Simulator::Now().As(Time::MS));
+        // the samples of an RB are those of the previous RB minus 0.5 dB
+        double fadingDb = 10 * std::log10((*binary)[rb] / (*m_params->psd)[rb]);
+        double firstFadingDb = 10 * std::log10((*binary)[0] / (*m_params->psd)[0]);
+        NS_TEST_EXPECT_MSG_EQ_TOL(fadingDb,
+                                  firstFadingDb - 0.5 * rb,
+                                  1e-5,
+                                  "The RBs use different samples");
+    }
+}
+
+void
+TraceFadingBinaryTestCase::DoRun()
+{
+    std::string textTrace = CreateTempDirFilename("trace-fading-test.fad");
+    std::string binaryTrace = CreateTempDirFilename("trace-fading-test.fad.bin");
+    {
+        std::ofstream file(textTrace);
+        for (uint32_t rb = 0; rb < RB_NUM; rb++)
+        {
+            for (uint32_t i = 0; i < SAMPLES_NUM; i++)
+            {
+                file << -0.5 * rb + std::sin(i) << " ";
+            }
+            file << "\n";
+        }
+    }
+    TraceFadingLossModel::ConvertToBinary(textTrace, binaryTrace, RB_NUM, SAMPLES_NUM);
+
+    m_text = CreateModel(textTrace);
+    m_binary = CreateModel(binaryTrace);
+
+    std::vector<double> centerFrequencies;
+    for (uint32_t rb = 0; rb < RB_NUM; rb++)
+    {
+        centerFrequencies.push_back(2e9 + 180e3 * rb);
+    }
+    m_params = Create<SpectrumSignalParameters>();
+    m_params->psd = Create<SpectrumValue>(Create<SpectrumModel>(centerFrequencies));
+    *m_params->psd = 1e-9;
+    m_a = CreateObject<ConstantPositionMobilityModel>();
+    m_b = CreateObject<ConstantPositionMobilityModel>();
+    m_b->SetPosition(Vector(100, 0, 0));
+
+    for (double ms : {0.0, 3.0, 9.0, 10.0, 17.0, 25.0, 39.0})
+    {
+        Simulator::Schedule(MilliSeconds(ms), &TraceFadingBinaryTestCase::Check, this);
+    }
+    Simulator::Run();
+    Simulator::Destroy();
+
+    m_text = nullptr;
+    m_binary = nullptr;
+}
+
+/**
+ * @ingroup spectrum-tests
+ *
+ * @brief TraceFadingLossModel TestSuite
+ */
+class TraceFadingLossModelTestSuite : public TestSuite
+{
+  public:
+    TraceFadingLossModelTestSuite();
+};
+
+TraceFadingLossModelTestSuite::TraceFadingLossModelTestSuite()
+    : TestSuite("trace-fading-loss-model", Type::UNIT)
+{
+    AddTestCase(new TraceFadingBinaryTestCase, TestCase::Duration::QUICK);
+}
+
+/// Static variable for test initialization
+static TraceFadingLossModelTestSuite g_traceFadingLossModelTestSuite;
@@ -8,6 +8,7 @@
 #include "queue-disc.h"
 
 #include "ns3/abort.h"
+#include "ns3/fluid-background-traffic.h"
 #include "ns3/log.h"
 #include "ns3/net-device-queue-interface.h"
 #include "ns3/object-vector.h"
@@ -261,6 +262,13 @@ QueueDisc::GetTypeId()
                           ObjectVectorValue(),
                           MakeObjectVectorAccessor(&QueueDisc::m_classes),
                           MakeObjectVectorChecker<QueueDiscClass>())
+            .AddAttribute("BackgroundTraffic",
+                          "An analytic model of the background traffic sharing the link. "
+                          "Received packets are dropped with the probability that the buffer "
+                          "is full of background packets.",
+                          PointerValue(),
+                          MakePointerAccessor(&QueueDisc::m_backgroundTraffic),
+                          MakePointerChecker<FluidBackgroundTraffic>())
             .AddTraceSource("Enqueue",
                             "Enqueue a packet in the queue disc",
                             MakeTraceSourceAccessor(&QueueDisc::m_traceEnqueue),
@@ -369,6 +377,7 @@ QueueDisc::DoDispose()
     m_filters.clear();
     m_classes.clear();
     m_devQueueIface = nullptr;
+    m_backgroundTraffic = nullptr;
     m_send = nullptr;
     m_requeued = nullptr;
     m_internalQueueDbeFunctor = nullptr;
@@ -844,6 +853,12 @@ QueueDisc::Enqueue(Ptr<QueueDiscItem> item)
     m_stats.nTotalReceivedPackets++;
     m_stats.nTotalReceivedBytes += item->GetSize();
 
+    if (m_backgroundTraffic && m_backgroundTraffic->IsDropped())
+    {
+        DropBeforeEnqueue(item, BACKGROUND_TRAFFIC_DROP);
+        return false;
+    }
+
     bool retval = DoEnqueue(item);
 
     if (retval)
@@ -27,6 +27,7 @@ namespace ns3
 
 class QueueDisc;
 class NetDeviceQueueInterface;
+class FluidBackgroundTraffic;
 
 /**
  * @ingroup traffic-control
@@ -159,6 +160,11 @@ enum QueueDiscSizePolicy
  * queue disc, the reason is "(Dropped by child queue disc) " followed by the
  * reason why the child queue disc dropped the packet.
  *
+ * An analytic model of the background traffic sharing the link can be attached
+ * to a queue disc through the BackgroundTraffic attribute. In such a case,
+ * received packets are dropped (with reason "Dropped due to background traffic")
+ * with the probability that the buffer is full of background packets.
+ *
  * The QueueDisc base class provides the SojournTime trace source, which provides
  * the sojourn time of every packet dequeued from a queue disc, including packets
  * that are dropped or requeued after being dequeued. The sojourn time is taken
@@ -514,6 +520,8 @@ class QueueDisc : public Object
         "(Dropped by child queue disc) "; //!< Packet dropped by a child queue disc
     static constexpr const char* CHILD_QUEUE_DISC_MARK =
         "(Marked by child queue disc) "; //!< Packet marked by a child queue disc
+    static constexpr const char* BACKGROUND_TRAFFIC_DROP =
+        "Dropped due to background traffic"; //!< Packet dropped due to background traffic
 
   protected:
     /**
@@ -688,6 +696,7 @@ class QueueDisc : public Object
     Stats m_stats;    //!< The collected statistics
     uint32_t m_quota; //!< Maximum number of packets dequeued in a qdisc run
     Ptr<NetDeviceQueueInterface> m_devQueueIface; //!< NetDevice queue interface
+    Ptr<FluidBackgroundTraffic> m_backgroundTraffic; //!< Background traffic model, if any
     SendCallback m_send;           //!< Callback used to send a packet to the receiving object
     bool m_running;                //!< The queue disc is performing multiple dequeue operations
     Ptr<QueueDiscItem> m_requeued; //!< The last packet that failed to be transmitted
@@ -0,0 +1,586 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/command-line.h"
+#include "ns3/double.h"
+#include "ns3/error-rate-table-file.h"
+#include "ns3/he-phy.h"
+#include "ns3/log.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/node-container.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/table-based-error-rate-model.h"
+#include "ns3/wifi-mac-trailer.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-phy-state-helper.h"
+#include "ns3/wifi-psdu.h"
+#include "ns3/wifi-utils.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#ifndef __WIN32__
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+/**
+ * This program generates the SNR/PER tables of an error rate table file, which can be
+ * loaded at runtime by the TableBasedErrorRateModel (through its "TableFile" attribute).
+ *
+ * For every requested MCS and PSDU size, PPDUs are sent over the existing PHY reception
+ * pipeline (YansWifiPhy, with the configured error rate model) at every SNR of the
+ * requested range, until enough errors are observed or the maximum number of PPDUs is
+ * reached. The SNR is set through a fixed received power, which can be affected by
+ * Rayleigh or Nakagami-m block fading (one independent draw per PPDU). The PER is the
+ * fraction of PPDUs whose PSDU is not successfully received; preamble detection is
+ * disabled so that the PER is only determined by the decoding of the PHY header and of
+ * the payload.
+ *
+ * Every SNR point is an independent simulation (with its own run number and random variable
+ * streams, so that results do not depend on the number of workers). Since the simulator
+ * cannot be used from several threads, the points are spread over worker processes.
+ *
+ * Example (HE MCS 0 to 11, LDPC, 80 MHz, Rayleigh fading, 4 workers):
+ *
+ * ./ns3 run "wifi-error-rate-table-generator --standard=11ax --mcs=0-11 --ldpc=1
+ *            --channelWidth=80 --sizes=1458 --fading=rayleigh --minSnr=0 --maxSnr=45
+ *            --workers=4 --output=he-80MHz-rayleigh.bin"
+ */
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("WifiErrorRateTableGenerator");
+
+/// Parameters of the simulations
+struct GeneratorParams
+{
+    WifiStandard standard{WIFI_STANDARD_80211ax};          ///< the standard
+    MHz_u channelWidth{20};                                ///< the channel width
+    bool ldpc{false};                                      ///< whether LDPC is used
+    std::string errorRateModel{"ns3::NistErrorRateModel"}; ///< the error rate model
+    std::string fading{"awgn"};                            ///< the fading model
+    double nakagamiM{1};                                   ///< the m parameter of Nakagami fading
+    uint64_t minPackets{1000};                             ///< minimum number of PPDUs per SNR
+    uint64_t maxPackets{40000};                            ///< maximum number of PPDUs per SNR
+    uint64_t minErrors{200};                               ///< number of errors to stop at
+    uint64_t runBase{1};                                   ///< run number of the first SNR point
+};
+
+/// Parameters of a table to generate
+struct TableParams
+{
+    uint8_t mcs;   ///< the MCS (as returned by TableBasedErrorRateModel::GetMcsForMode)
+    WifiMode mode; ///< the mode
+    uint32_t size; ///< the PSDU size (bytes)
+};
+
+/// Result of the simulation of an SNR point
+struct PointResult
+{
+    uint32_t point; ///< index of the SNR point
+    uint64_t nTx;   ///< number of transmitted PPDUs
+    uint64_t nRxOk; ///< number of successfully received PPDUs
+};
+
+/// Number of random variable streams reserved for the simulation of an SNR point
+constexpr int64_t STREAMS_PER_POINT = 1000;
+
+/// Simulation of an SNR point
+class PerExperiment
+{
+  public:
+    /**
+     * Run the simulation of an SNR point.
+     *
+     * @param params the parameters of the simulations
+     * @param table the parameters of the table
+     * @param snr the SNR
+     * @param point the index of the SNR point, which determines the run number and the
+     *        random variable streams
+     * @return the number of transmitted and successfully received PPDUs
+     */
+    std::pair<uint64_t, uint64_t> Run(const GeneratorParams& params,
+                                      const TableParams& table,
+                                      dB_u snr,
+                                      uint32_t point);
+
+  private:
+    /// Send a PPDU (or stop the simulation if enough PPDUs have been sent)
+    void Send();
+
+    /**
+     * Callback invoked when a PSDU has been successfully received
+     * @param packet the received packet
+     * @param snr the SNR (linear scale)
+     * @param mode the mode
+     * @param preamble the preamble
+     */
+    void Receive(Ptr<const Packet> packet, double snr, WifiMode mode, WifiPreamble preamble);
+
+    GeneratorParams m_params; ///< parameters of the simulations
+    Ptr<WifiPhy> m_tx;        ///< transmitting PHY
+    Ptr<WifiPsdu> m_psdu;     ///< transmitted PSDU
+    WifiTxVector m_txVector;  ///< TXVECTOR of the transmitted PPDUs
+    Time m_interval;          ///< interval between two PPDUs
+    uint64_t m_nTx{0};        ///< number of transmitted PPDUs
+    uint64_t m_nRxOk{0};      ///< number of successfully received PPDUs
+};
+
+std::pair<uint64_t, uint64_t>
+PerExperiment::Run(const GeneratorParams& params,
+                   const TableParams& table,
+                   dB_u snr,
+                   uint32_t point)
+{
+    m_params = params;
+    m_nTx = 0;
+    m_nRxOk = 0;
+    RngSeedManager::SetRun(params.runBase + point);
+
+    // noise computed as in InterferenceHelper::CalculateSnr
+    const dB_u noiseFigure{7};
+    const auto noise = WToDbm(1.3803e-23 * 290 * MHzToHz(params.channelWidth)) + noiseFigure;
+
+    NodeContainer nodes;
+    nodes.Create(2);
+    MobilityHelper mobility;
+    mobility.Install(nodes);
+
+    YansWifiChannelHelper channel;
+    channel.SetPropagationDelay("ns3::ConstantSpeedPropagationDelayModel");
+    channel.AddPropagationLoss("ns3::FixedRssLossModel", "Rss", DoubleValue(noise + snr));
+    if (params.fading != "awgn")
+    {
+        const auto m = (params.fading == "rayleigh") ? 1.0 : params.nakagamiM;
+        channel.AddPropagationLoss("ns3::NakagamiPropagationLossModel",
+                                   "m0",
+                                   DoubleValue(m),
+                                   "m1",
+                                   DoubleValue(m),
+                                   "m2",
+                                   DoubleValue(m));
+    }
+
+    auto wifiChannel = channel.Create();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(wifiChannel);
+    phy.SetErrorRateModel(params.errorRateModel);
+    phy.DisablePreambleDetectionModel();
+    phy.Set("RxNoiseFigure", DoubleValue(noiseFigure));
+    std::ostringstream channelSettings;
+    channelSettings << "{0, " << params.channelWidth << ", BAND_5GHZ, 0}";
+    phy.Set("ChannelSettings", StringValue(channelSettings.str()));
+
+    WifiHelper wifi;
+    wifi.SetStandard(params.standard);
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    auto devices = wifi.Install(phy, mac, nodes);
+    // the automatic stream numbers keep increasing across the points simulated by a worker,
+    // hence the streams are fixed by the index of the point
+    int64_t stream = static_cast<int64_t>(point) * STREAMS_PER_POINT;
+    stream += WifiHelper::AssignStreams(devices, stream);
+    channel.AssignStreams(wifiChannel, stream);
+    m_tx = DynamicCast<WifiNetDevice>(devices.Get(0))->GetPhy();
+    auto rx = DynamicCast<WifiNetDevice>(devices.Get(1))->GetPhy();
+    rx->GetState()->TraceConnectWithoutContext("RxOk",
+                                               MakeCallback(&PerExperiment::Receive, this));
+
+    // broadcast frames, so that the receiver does not respond
+    WifiMacHeader hdr(WIFI_MAC_DATA);
+    hdr.SetAddr1(Mac48Address::GetBroadcast());
+    hdr.SetAddr2(Mac48Address::ConvertFrom(devices.Get(0)->GetAddress()));
+    const auto overhead = hdr.GetSerializedSize() + WIFI_MAC_FCS_LENGTH;
+    NS_ABORT_MSG_IF(table.size <= overhead, "PSDU size must exceed " << overhead << " bytes");
+    m_psdu = Create<WifiPsdu>(Create<Packet>(table.size - overhead), hdr);
+
+    WifiPreamble preamble = WIFI_PREAMBLE_LONG;
+    switch (table.mode.GetModulationClass())
+    {
+    case WIFI_MOD_CLASS_HT:
+        preamble = WIFI_PREAMBLE_HT_MF;
+        break;
+    case WIFI_MOD_CLASS_VHT:
+        preamble = WIFI_PREAMBLE_VHT_SU;
+        break;
+    case WIFI_MOD_CLASS_HE:
+        preamble = WIFI_PREAMBLE_HE_SU;
+        break;
+    default:
+        break;
+    }
+    m_txVector = WifiTxVector(table.mode,
+                              0,
+                              preamble,
+                              NanoSeconds(800),
+                              1,
+                              1,
+                              0,
+                              params.channelWidth,
+                              false,
+                              false,
+                              params.ldpc);
+    m_interval =
+        WifiPhy::CalculateTxDuration(m_psdu->GetSize(), m_txVector, m_tx->GetPhyBand()) +
+        MicroSeconds(1);
+
+    Simulator::Schedule(MicroSeconds(1), &PerExperiment::Send, this);
+    Simulator::Run();
+    Simulator::Destroy();
+    return {m_nTx, m_nRxOk};
+}
+
+void
+PerExperiment::Send()
+{
+    // the previous PPDU has been received by now
+    const auto nErrors = m_nTx - m_nRxOk;
+    if (m_nTx >= m_params.maxPackets ||
+        (m_nTx >= m_params.minPackets && nErrors >= m_params.minErrors))
+    {
+        Simulator::Stop();
+        return;
+    }
+    m_tx->Send(m_psdu, m_txVector);
+    ++m_nTx;
+    Simulator::Schedule(m_interval, &PerExperiment::Send, this);
+}
+
+void
+PerExperiment::Receive(Ptr<const Packet> packet, double snr, WifiMode mode, WifiPreamble preamble)
+{
+    ++m_nRxOk;
+}
+
+/**
+ * Parse a list of integers such as "0,2,5-7".
+ *
+ * @param list the list
+ * @return the integers
+ */
+std::vector<uint32_t>
+ParseList(const std::string& list)
+{
+    std::vector<uint32_t> values;
+    std::istringstream iss(list);
+    std::string item;
+    while (std::getline(iss, item, ','))
+    {
+        const auto dash = item.find('-');
+        const auto first = std::stoul(item.substr(0, dash));
+        const auto last = (dash == std::string::npos) ? first : std::stoul(item.substr(dash + 1));
+        for (auto value = first; value <= last; ++value)
+        {
+            values.push_back(value);
+        }
+    }
+    return values;
+}
+
+/**
+ * Get the mode of a standard corresponding to an MCS of the TableBasedErrorRateModel.
+ *
+ * @param standard the standard
+ * @param mcs the MCS
+ * @return the mode
+ */
+WifiMode
+GetMode(WifiStandard standard, uint8_t mcs)
+{
+    switch (standard)
+    {
+    case WIFI_STANDARD_80211a:
+        for (uint64_t rate : {6, 9, 12, 18, 24, 36, 48, 54})
+        {
+            const auto mode = OfdmPhy::GetOfdmRate(rate * 1000000);
+            if (TableBasedErrorRateModel::GetMcsForMode(mode) == mcs)
+            {
+                return mode;
+            }
+        }
+        NS_ABORT_MSG("Unsupported MCS " << +mcs << " for 802.11a");
+    case WIFI_STANDARD_80211n:
+        NS_ABORT_MSG_IF(mcs > 7, "Only single stream HT MCSs (0-7) are supported");
+        return HtPhy::GetHtMcs(mcs);
+    case WIFI_STANDARD_80211ac:
+        return VhtPhy::GetVhtMcs(mcs);
+    case WIFI_STANDARD_80211ax:
+        return HePhy::GetHeMcs(mcs);
+    default:
+        NS_ABORT_MSG("Unsupported standard");
+    }
+    return WifiMode();
+}
+
+/**
+ * Simulate the SNR points assigned to a worker, i.e., whose index modulo the number of
+ * workers is the index of the worker.
+ *
+ * @param params the parameters of the simulations
+ * @param tables the parameters of the tables
+ * @param snrs the SNRs of each table
+ * @param worker the index of the worker
+ * @param nWorkers the number of workers
+ * @param output the callback invoked with the result of every SNR point
+ */
+void
+RunWorker(const GeneratorParams& params,
+          const std::vector<TableParams>& tables,
+          const std::vector<dB_u>& snrs,
+          uint32_t worker,
+          uint32_t nWorkers,
+          std::function<void(const PointResult&)> output)
+{
+    PerExperiment experiment;
+    const auto nPoints = tables.size() * snrs.size();
+    for (uint32_t point = worker; point < nPoints; point += nWorkers)
+    {
+        const auto& table = tables.at(point / snrs.size());
+        const auto snr = snrs.at(point % snrs.size());
+        const auto [nTx, nRxOk] = experiment.Run(params, table, snr, point);
+        NS_LOG_DEBUG("Worker " << worker << ": " << table.mode << " " << table.size
+                               << " bytes, SNR=" << snr << "dB: " << nTx - nRxOk
+                               << " errors out of " << nTx << " PPDUs");
+        output({point, nTx, nRxOk});
+    }
+}
+
+/**
+ * Simulate all the SNR points with the given number of worker processes.
+ *
+ * @param params the parameters of the simulations
+ * @param tables the parameters of the tables
+ * @param snrs the SNRs of each table
+ * @param nWorkers the number of worker processes
+ * @return the results of all the SNR points, in any order
+ */
+std::vector<PointResult>
+RunWorkers(const GeneratorParams& params,
+           const std::vector<TableParams>& tables,
+           const std::vector<dB_u>& snrs,
+           uint32_t nWorkers)
+{
+    std::vector<PointResult> results;
+    auto store = [&results](const PointResult& result) { results.push_back(result); };
+#ifdef __WIN32__
+    NS_LOG_WARN("Worker processes are not supported on this platform");
+    RunWorker(params, tables, snrs, 0, 1, store);
+#else
+    if (nWorkers <= 1)
+    {
+        RunWorker(params, tables, snrs, 0, 1, store);
+        return results;
+    }
+    std::vector<pollfd> pipes;
+    std::vector<pid_t> pids;
+    for (uint32_t worker = 0; worker < nWorkers; ++worker)
+    {
+        int fds[2];
+        NS_ABORT_MSG_IF(pipe(fds) != 0, "Cannot create a pipe");
+        const auto pid = fork();
+        NS_ABORT_MSG_IF(pid < 0, "Cannot create a worker process");
+        if (pid == 0)
+        {
+            close(fds[0]);
+            RunWorker(params, tables, snrs, worker, nWorkers, [&](const PointResult& result) {
+                NS_ABORT_MSG_IF(write(fds[1], &result, sizeof(result)) != sizeof(result),
+                                "Cannot send the result of a worker");
+            });
+            close(fds[1]);
+            _exit(0);
+        }
+        close(fds[1]);
+        pipes.push_back({fds[0], POLLIN, 0});
+        pids.push_back(pid);
+    }
+
+    auto nOpen = pipes.size();
+    while (nOpen > 0)
+    {
+        NS_ABORT_MSG_IF(poll(pipes.data(), pipes.size(), -1) < 0, "Cannot poll the workers");
+        for (auto& pfd : pipes)
+        {
+            if (pfd.fd < 0 || pfd.revents == 0)
+            {
+                continue;
+            }
+            PointResult result;
+            // results are smaller than PIPE_BUF, hence written atomically
+            if (read(pfd.fd, &result, sizeof(result)) == sizeof(result))
+            {
+                store(result);
+                continue;
+            }
+            close(pfd.fd);
+            pfd.fd = -1;
+            --nOpen;
+        }
+    }
+    for (const auto pid : pids)
+    {
+        int status;
+        waitpid(pid, &status, 0);
+        NS_ABORT_MSG_IF(!WIFEXITED(status) || WEXITSTATUS(status) != 0, "A worker failed");
+    }
+#endif
+    return results;
+}
+
+int
+main(int argc, char* argv[])
+{
+    GeneratorParams params;
+    std::string standard{"11ax"};
+    std::string mcsList{"0-11"};
+    std::string sizeList{"1458"};
+    dB_u minSnr{-5};
+    dB_u maxSnr{40};
+    dB_u snrStep{0.5};
+    uint32_t nWorkers = std::max(1U, std::thread::hardware_concurrency());
+    std::string output{"wifi-error-rate-tables.bin"};
+    bool append{false};
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("standard", "Standard [11a, 11n, 11ac, 11ax]", standard);
+    cmd.AddValue("mcs", "MCSs of the tables (e.g., 0,2,5-7)", mcsList);
+    cmd.AddValue("channelWidth", "Channel width (MHz)", params.channelWidth);
+    cmd.AddValue("ldpc", "Use LDPC instead of BCC", params.ldpc);
+    cmd.AddValue("sizes", "PSDU sizes (bytes) of the tables (e.g., 32,1458)", sizeList);
+    cmd.AddValue("errorRateModel", "TypeId of the error rate model", params.errorRateModel);
+    cmd.AddValue("fading", "Fading model [awgn, rayleigh, nakagami]", params.fading);
+    cmd.AddValue("nakagamiM", "m parameter of the Nakagami fading", params.nakagamiM);
+    cmd.AddValue("minSnr", "Lowest SNR (dB)", minSnr);
+    cmd.AddValue("maxSnr", "Highest SNR (dB)", maxSnr);
+    cmd.AddValue("snrStep", "SNR step (dB, multiple of 0.01 dB)", snrStep);
+    cmd.AddValue("minPackets", "Minimum number of PPDUs per SNR", params.minPackets);
+    cmd.AddValue("maxPackets", "Maximum number of PPDUs per SNR", params.maxPackets);
+    cmd.AddValue("minErrors",
+                 "Stop at an SNR once this many errors are observed (and minPackets are sent)",
+                 params.minErrors);
+    cmd.AddValue("run", "Run number of the first SNR point", params.runBase);
+    cmd.AddValue("workers", "Number of worker processes", nWorkers);
+    cmd.AddValue("output", "Name of the error rate table file", output);
+    cmd.AddValue("append", "Keep the tables of the output file that are not generated", append);
+    cmd.Parse(argc, argv);
+
+    if (standard == "11a")
+    {
+        params.standard = WIFI_STANDARD_80211a;
+    }
+    else if (standard == "11n")
+    {
+        params.standard = WIFI_STANDARD_80211n;
+    }
+    else if (standard == "11ac")
+    {
+        params.standard = WIFI_STANDARD_80211ac;
+    }
+    else if (standard == "11ax")
+    {
+        params.standard = WIFI_STANDARD_80211ax;
+    }
+    else
+    {
+        NS_ABORT_MSG("Unsupported standard " << standard);
+    }
+    NS_ABORT_MSG_IF(params.fading != "awgn" && params.fading != "rayleigh" &&
+                        params.fading != "nakagami",
+                    "Unknown fading model " << params.fading);
+    NS_ABORT_MSG_IF(snrStep < 0.01 || maxSnr < minSnr, "Invalid SNR range");
+
+    std::vector<TableParams> tables;
+    for (const auto mcs : ParseList(mcsList))
+    {
+        for (const auto size : ParseList(sizeList))
+        {
+            tables.push_back({static_cast<uint8_t>(mcs), GetMode(params.standard, mcs), size});
+        }
+    }
+    std::vector<dB_u> snrs;
+    const auto nSnrs = static_cast<std::size_t>(std::round((maxSnr - minSnr) / snrStep)) + 1;
+    for (std::size_t i = 0; i < nSnrs; ++i)
+    {
+        snrs.push_back(std::round((minSnr + i * snrStep) * 100) / 100);
+    }
+
+    std::cout << "Simulating " << tables.size() * snrs.size() << " SNR points with " << nWorkers
+              << " workers" << std::endl;
+    auto results = RunWorkers(params, tables, snrs, nWorkers);
+    NS_ABORT_MSG_IF(results.size() != tables.size() * snrs.size(), "Missing results");
+    std::sort(results.begin(), results.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.point < rhs.point;
+    });
+
+    ErrorRateTableFile file;
+    if (append)
+    {
+        file = ReadErrorRateTableFile(output);
+    }
+    std::ostringstream description;
+    description << "standard=" << standard << " channelWidth=" << params.channelWidth
+                << " ldpc=" << params.ldpc << " errorRateModel=" << params.errorRateModel
+                << " fading=" << params.fading;
+    if (params.fading == "nakagami")
+    {
+        description << " m=" << params.nakagamiM;
+    }
+    file.description += (file.description.empty() ? "" : "\n") + description.str();
+
+    for (std::size_t i = 0; i < tables.size(); ++i)
+    {
+        ErrorRateTableFileEntry entry{tables[i].mcs,
+                                      params.ldpc,
+                                      params.channelWidth,
+                                      tables[i].size};
+        for (std::size_t j = 0; j < snrs.size(); ++j)
+        {
+            const auto& result = results.at(i * snrs.size() + j);
+            entry.table.emplace_back(snrs[j],
+                                     1.0 - static_cast<double>(result.nRxOk) / result.nTx);
+        }
+        // the table-based model assumes a PER of 1 (0) below (above) the SNRs of the table,
+        // hence only the last of the leading points with a PER of 1 and the first of the
+        // trailing points with a PER of 0 are kept
+        auto first = std::find_if(entry.table.cbegin(), entry.table.cend(), [](const auto& p) {
+            return p.second < 1;
+        });
+        auto last = std::find_if(entry.table.crbegin(), entry.table.crend(), [](const auto& p) {
+                        return p.second > 0;
+                    }).base();
+        if (first != entry.table.cbegin())
+        {
+            --first;
+        }
+        if (last != entry.table.cend())
+        {
+            ++last;
+        }
+        entry.table = SnrPerTable(first, last);
+
+        std::cout << tables[i].mode << " " << tables[i].size << " bytes:";
+        for (const auto& [snr, per] : entry.table)
+        {
+            std::cout << " " << snr << "dB=" << per;
+        }
+        std::cout << std::endl;
+
+        std::erase_if(file.tables, [&entry](const auto& table) {
+            return table.mcs == entry.mcs && table.ldpc == entry.ldpc &&
+                   table.channelWidth == entry.channelWidth && table.refSize == entry.refSize;
+        });
+        file.tables.push_back(std::move(entry));
+    }
+
+    WriteErrorRateTableFile(output, file);
+    std::cout << "Wrote " << file.tables.size() << " tables to " << output << std::endl;
+    return 0;
+}
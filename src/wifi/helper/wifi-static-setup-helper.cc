@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "wifi-static-setup-helper.h"
+
+#include "ns3/abort.h"
+#include "ns3/ap-wifi-mac.h"
+#include "ns3/block-ack-manager.h"
+#include "ns3/ht-frame-exchange-manager.h"
+#include "ns3/log.h"
+#include "ns3/mgt-action-headers.h"
+#include "ns3/net-device-container.h"
+#include "ns3/qos-txop.h"
+#include "ns3/sta-wifi-mac.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-net-device.h"
+
+#include <variant>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("WifiStaticSetupHelper");
+
+void
+WifiStaticSetupHelper::SetStaticAssociation(Ptr<WifiNetDevice> apDev,
+                                            const NetDeviceContainer& clientDevs)
+{
+    NS_LOG_FUNCTION_NOARGS();
+    for (auto it = clientDevs.Begin(); it != clientDevs.End(); ++it)
+    {
+        auto clientDev = DynamicCast<WifiNetDevice>(*it);
+        NS_ABORT_MSG_IF(!clientDev, "Expected a WifiNetDevice");
+        SetStaticAssociation(apDev, clientDev);
+    }
+}
+
+void
+WifiStaticSetupHelper::SetStaticAssociation(Ptr<WifiNetDevice> apDev, Ptr<WifiNetDevice> clientDev)
+{
+    NS_LOG_FUNCTION_NOARGS();
+
+    auto apMac = DynamicCast<ApWifiMac>(apDev->GetMac());
+    NS_ABORT_MSG_IF(!apMac, "Expected a device hosting an AP");
+    auto staMac = DynamicCast<StaWifiMac>(clientDev->GetMac());
+    NS_ABORT_MSG_IF(!staMac, "Expected a device hosting a non-AP STA");
+    NS_ABORT_MSG_IF(apMac->GetNLinks() > 1 || staMac->GetNLinks() > 1,
+                    "Static setup is only supported for single-link devices");
+    NS_ABORT_MSG_IF(staMac->IsInitialized(), "Static setup must be done before the simulation");
+    NS_ABORT_MSG_IF(staMac->IsAssociated(), "Non-AP STA " << staMac->GetAddress() << " is "
+                                                          << "already associated");
+    NS_ABORT_MSG_IF(!staMac->GetSsid().IsBroadcast() && !staMac->GetSsid().IsEqual(apMac->GetSsid()),
+                    "The SSID of the non-AP STA does not match the SSID of the AP");
+
+    const uint8_t linkId = 0;
+    const auto apAddr = apMac->GetFrameExchangeManager(linkId)->GetAddress();
+    const auto staAddr = staMac->GetFrameExchangeManager(linkId)->GetAddress();
+    NS_LOG_DEBUG("Associate non-AP STA " << staAddr << " with AP " << apAddr);
+
+    // the non-AP STA gets the information about the AP from a Beacon frame, as it would do
+    // at the end of the scanning procedure
+    staMac->UpdateApInfo(apMac->GetBeacon(linkId), apAddr, apAddr, linkId);
+    auto& staLink = staMac->GetLink(linkId);
+    staLink.sendAssocReq = true;
+    staLink.bssid = apAddr;
+    staMac->SetState(StaWifiMac::WAIT_ASSOC_RESP);
+
+    // the AP processes the Association Request
+    auto frame = staMac->GetAssociationRequest(false, linkId);
+    auto& assocReq = std::get<MgtAssocRequestHeader>(frame);
+    apMac->ReceiveAssocRequest(assocReq, staAddr, linkId);
+
+    // the AP assigns an AID to the non-AP STA and the Association Response is acknowledged
+    auto mpdu = apMac->GetAssocRespMpdu(staAddr, false, linkId);
+    apMac->TxOk(mpdu);
+
+    // the non-AP STA processes the Association Response
+    staMac->ReceiveAssocResp(mpdu, linkId);
+    NS_ABORT_MSG_IF(!staMac->IsAssociated(),
+                    "Association of non-AP STA " << staAddr << " with AP " << apAddr << " failed");
+}
+
+void
+WifiStaticSetupHelper::SetStaticBlockAck(Ptr<WifiNetDevice> apDev,
+                                         const NetDeviceContainer& clientDevs,
+                                         const std::set<uint8_t>& tids)
+{
+    NS_LOG_FUNCTION_NOARGS();
+    for (auto it = clientDevs.Begin(); it != clientDevs.End(); ++it)
+    {
+        auto clientDev = DynamicCast<WifiNetDevice>(*it);
+        NS_ABORT_MSG_IF(!clientDev, "Expected a WifiNetDevice");
+        for (const auto tid : tids)
+        {
+            SetStaticBlockAck(apDev, clientDev, tid);
+            SetStaticBlockAck(clientDev, apDev, tid);
+        }
+    }
+}
+
+void
+WifiStaticSetupHelper::SetStaticBlockAck(Ptr<WifiNetDevice> originatorDev,
+                                         Ptr<WifiNetDevice> recipientDev,
+                                         uint8_t tid)
+{
+    NS_LOG_FUNCTION(+tid);
+
+    auto originatorMac = originatorDev->GetMac();
+    auto recipientMac = recipientDev->GetMac();
+    NS_ABORT_MSG_IF(originatorMac->GetNLinks() > 1 || recipientMac->GetNLinks() > 1,
+                    "Static setup is only supported for single-link devices");
+    NS_ABORT_MSG_IF(!originatorMac->GetQosSupported() || !recipientMac->GetQosSupported(),
+                    "Block Ack agreements require QoS support");
+
+    const uint8_t linkId = 0;
+    auto originatorFem =
+        DynamicCast<HtFrameExchangeManager>(originatorMac->GetFrameExchangeManager(linkId));
+    auto recipientFem =
+        DynamicCast<HtFrameExchangeManager>(recipientMac->GetFrameExchangeManager(linkId));
+    NS_ABORT_MSG_IF(!originatorFem || !recipientFem,
+                    "Block Ack agreements require HT or later devices");
+    const auto originatorAddr = originatorFem->GetAddress();
+    const auto recipientAddr = recipientFem->GetAddress();
+    NS_ABORT_MSG_IF(originatorMac->GetBaAgreementEstablishedAsOriginator(recipientAddr, tid),
+                    "A Block Ack agreement with " << recipientAddr << " for TID " << +tid
+                                                  << " already exists");
+    NS_LOG_DEBUG("Establish Block Ack agreement for TID " << +tid << " between originator "
+                                                         << originatorAddr << " and recipient "
+                                                         << recipientAddr);
+
+    auto edca = originatorMac->GetQosTxop(tid);
+
+    // the starting sequence number is the sequence number of the next QoS data frame
+    WifiMacHeader qosHdr(WIFI_MAC_QOSDATA);
+    qosHdr.SetAddr1(recipientAddr);
+    qosHdr.SetQosTid(tid);
+
+    // build the ADDBA Request as HtFrameExchangeManager::SendAddBaRequest does
+    MgtAddBaRequestHeader reqHdr;
+    reqHdr.SetAmsduSupport(true);
+    reqHdr.SetImmediateBlockAck();
+    reqHdr.SetTid(tid);
+    reqHdr.SetBufferSize(0);
+    reqHdr.SetTimeout(edca->GetBlockAckInactivityTimeout());
+    reqHdr.SetStartingSequence(edca->PeekNextSequenceNumberFor(&qosHdr));
+
+    edca->GetBaManager()->CreateOriginatorAgreement(reqHdr, recipientAddr);
+
+    // the recipient accepts the ADDBA Request and the originator gets the ADDBA Response
+    auto respHdr = recipientFem->AcceptAddBaRequest(reqHdr, originatorAddr);
+    edca->GotAddBaResponse(respHdr, recipientAddr);
+    edca->GetBaManager()->SetBlockAckInactivityCallback(
+        MakeCallback(&HtFrameExchangeManager::SendDelbaFrame, originatorFem));
+}
+
+} // namespace ns3
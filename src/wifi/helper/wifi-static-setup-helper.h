@@ -0,0 +1,84 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef WIFI_STATIC_SETUP_HELPER_H
+#define WIFI_STATIC_SETUP_HELPER_H
+
+#include "ns3/ptr.h"
+
+#include <cstdint>
+#include <set>
+
+namespace ns3
+{
+
+class NetDeviceContainer;
+class WifiNetDevice;
+
+/**
+ * @ingroup wifi
+ * @brief Helper to statically set up the association and Block Ack agreements
+ *
+ * Bringing up a BSS by means of the scanning and association procedures and setting up
+ * Block Ack agreements by means of ADDBA Request/Response exchanges takes a non-negligible
+ * amount of simulated time, during which only management frames are exchanged. In scenarios
+ * where such procedures are not of interest, this helper can be used to establish the
+ * association state (including the AIDs and the information stored by the remote station
+ * managers) and the Block Ack agreements before the simulation starts, without exchanging
+ * any frame over the air.
+ *
+ * The frames that would be exchanged are built by the MAC layers and handled as if they
+ * were received, so that the resulting state is the same as the one obtained by performing
+ * the procedures over the air. The methods of this helper must be called after the devices
+ * have been installed and before the simulation starts. Only single-link devices are
+ * supported.
+ */
+class WifiStaticSetupHelper
+{
+  public:
+    /**
+     * Associate the given non-AP STAs with the given AP.
+     *
+     * @param apDev the device of the AP
+     * @param clientDevs the devices of the non-AP STAs
+     */
+    static void SetStaticAssociation(Ptr<WifiNetDevice> apDev,
+                                     const NetDeviceContainer& clientDevs);
+
+    /**
+     * Associate the given non-AP STA with the given AP.
+     *
+     * @param apDev the device of the AP
+     * @param clientDev the device of the non-AP STA
+     */
+    static void SetStaticAssociation(Ptr<WifiNetDevice> apDev, Ptr<WifiNetDevice> clientDev);
+
+    /**
+     * Establish Block Ack agreements for the given TIDs in both the downlink and the uplink
+     * direction between the given AP and each of the given (associated) non-AP STAs.
+     *
+     * @param apDev the device of the AP
+     * @param clientDevs the devices of the non-AP STAs
+     * @param tids the given TIDs
+     */
+    static void SetStaticBlockAck(Ptr<WifiNetDevice> apDev,
+                                  const NetDeviceContainer& clientDevs,
+                                  const std::set<uint8_t>& tids);
+
+    /**
+     * Establish a Block Ack agreement for the given TID between the given originator and
+     * the given recipient.
+     *
+     * @param originatorDev the device of the originator
+     * @param recipientDev the device of the recipient
+     * @param tid the given TID
+     */
+    static void SetStaticBlockAck(Ptr<WifiNetDevice> originatorDev,
+                                  Ptr<WifiNetDevice> recipientDev,
+                                  uint8_t tid);
+};
+
+} // namespace ns3
+
+#endif /* WIFI_STATIC_SETUP_HELPER_H */
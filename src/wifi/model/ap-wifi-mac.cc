@@ -69,6 +69,17 @@ ApWifiMac::GetTypeId()
                           BooleanValue(true),
                           MakeBooleanAccessor(&ApWifiMac::m_enableBeaconJitter),
                           MakeBooleanChecker())
+            .AddAttribute("EnableBeaconCache",
+                          "Whether to build the Beacon frame body only when its content "
+                          "changes (i.e., when stations associate or disassociate, the beacon "
+                          "interval, the operating channel or the advertised EDCA parameters "
+                          "are changed) and reuse it for the following Beacon frames. The MU "
+                          "EDCA parameters and the BSS color are read from the HE configuration "
+                          "for every Beacon frame. Changes to the capabilities of the AP that "
+                          "are made at runtime are not detected.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&ApWifiMac::m_enableBeaconCache),
+                          MakeBooleanChecker())
             .AddAttribute("BeaconGeneration",
                           "Whether or not beacons are generated.",
                           BooleanValue(true),
@@ -119,7 +130,8 @@ ApWifiMac::GetTypeId()
                 "for an AP MLD having three links.",
                 StringValue(""),
                 MakeAttributeContainerAccessor<UintAccessParamsPairValue, ';'>(
-                    &ApWifiMac::m_cwMinsForSta),
+                    &ApWifiMac::GetCwMinsForSta,
+                    &ApWifiMac::SetCwMinsForSta),
                 GetUintAccessParamsChecker<uint32_t>())
             .AddAttribute(
                 "CwMaxsForSta",
@@ -135,7 +147,8 @@ ApWifiMac::GetTypeId()
                 "for an AP MLD having three links.",
                 StringValue(""),
                 MakeAttributeContainerAccessor<UintAccessParamsPairValue, ';'>(
-                    &ApWifiMac::m_cwMaxsForSta),
+                    &ApWifiMac::GetCwMaxsForSta,
+                    &ApWifiMac::SetCwMaxsForSta),
                 GetUintAccessParamsChecker<uint32_t>())
             .AddAttribute(
                 "AifsnsForSta",
@@ -151,7 +164,8 @@ ApWifiMac::GetTypeId()
                 "for an AP MLD having three links.",
                 StringValue(""),
                 MakeAttributeContainerAccessor<UintAccessParamsPairValue, ';'>(
-                    &ApWifiMac::m_aifsnsForSta),
+                    &ApWifiMac::GetAifsnsForSta,
+                    &ApWifiMac::SetAifsnsForSta),
                 GetUintAccessParamsChecker<uint8_t>())
             .AddAttribute(
                 "TxopLimitsForSta",
@@ -167,7 +181,8 @@ ApWifiMac::GetTypeId()
                 "values for AC BE and AC VI for an AP MLD having three links.",
                 StringValue(""),
                 MakeAttributeContainerAccessor<TimeAccessParamsPairValue, ';'>(
-                    &ApWifiMac::m_txopLimitsForSta),
+                    &ApWifiMac::GetTxopLimitsForSta,
+                    &ApWifiMac::SetTxopLimitsForSta),
                 GetTimeAccessParamsChecker())
             .AddAttribute("GcrManager",
                           "The GCR manager object.",
@@ -354,6 +369,78 @@ ApWifiMac::GetTxopQueue(AcIndex ac) const
     return WifiMac::GetTxopQueue(ac);
 }
 
+void
+ApWifiMac::NotifyChannelSwitching(uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << +linkId);
+
+    WifiMac::NotifyChannelSwitching(linkId);
+
+    // the content of the Beacon frames depends on the operating channel
+    ResetBeaconCache();
+}
+
+void
+ApWifiMac::NotifyEdcaParametersChanged(uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << +linkId);
+    // the EDCA Parameter Set element advertises the EDCA parameters of the AP, unless
+    // the values to advertise to stations are specified
+    ResetBeaconCache();
+}
+
+void
+ApWifiMac::SetCwMinsForSta(const UintAccessParamsMap& cwMins)
+{
+    m_cwMinsForSta = cwMins;
+    ResetBeaconCache();
+}
+
+const ApWifiMac::UintAccessParamsMap&
+ApWifiMac::GetCwMinsForSta() const
+{
+    return m_cwMinsForSta;
+}
+
+void
+ApWifiMac::SetCwMaxsForSta(const UintAccessParamsMap& cwMaxs)
+{
+    m_cwMaxsForSta = cwMaxs;
+    ResetBeaconCache();
+}
+
+const ApWifiMac::UintAccessParamsMap&
+ApWifiMac::GetCwMaxsForSta() const
+{
+    return m_cwMaxsForSta;
+}
+
+void
+ApWifiMac::SetAifsnsForSta(const UintAccessParamsMap& aifsns)
+{
+    m_aifsnsForSta = aifsns;
+    ResetBeaconCache();
+}
+
+const ApWifiMac::UintAccessParamsMap&
+ApWifiMac::GetAifsnsForSta() const
+{
+    return m_aifsnsForSta;
+}
+
+void
+ApWifiMac::SetTxopLimitsForSta(const TimeAccessParamsMap& txopLimits)
+{
+    m_txopLimitsForSta = txopLimits;
+    ResetBeaconCache();
+}
+
+const ApWifiMac::TimeAccessParamsMap&
+ApWifiMac::GetTxopLimitsForSta() const
+{
+    return m_txopLimitsForSta;
+}
+
 void
 ApWifiMac::SetBeaconGeneration(bool enable)
 {
@@ -407,6 +494,7 @@ ApWifiMac::SetBeaconInterval(Time interval)
             "beacon interval should be smaller then or equal to 65535 * 1024us (802.11 time unit)");
     }
     m_beaconInterval = interval;
+    ResetBeaconCache();
 }
 
 int64_t
@@ -1443,6 +1531,7 @@ ApWifiMac::SetAid(MgtAssocResponseHeader& assoc, const LinkIdStaAddrMap& linkIdS
             }
             UpdateShortSlotTimeEnabled(id);
             UpdateShortPreambleEnabled(id);
+            ResetBeaconCache();
         }
         else
         {
@@ -1476,8 +1565,8 @@ ApWifiMac::SetAid(MgtAssocResponseHeader& assoc, const LinkIdStaAddrMap& linkIdS
     }
 }
 
-void
-ApWifiMac::SendAssocResp(Mac48Address to, bool isReassoc, uint8_t linkId)
+Ptr<WifiMpdu>
+ApWifiMac::GetAssocRespMpdu(Mac48Address to, bool isReassoc, uint8_t linkId)
 {
     NS_LOG_FUNCTION(this << to << isReassoc << +linkId);
     WifiMacHeader hdr;
@@ -1508,9 +1597,18 @@ ApWifiMac::SendAssocResp(Mac48Address to, bool isReassoc, uint8_t linkId)
     Ptr<Packet> packet = Create<Packet>();
     packet->AddHeader(assoc);
 
+    return Create<WifiMpdu>(packet, hdr);
+}
+
+void
+ApWifiMac::SendAssocResp(Mac48Address to, bool isReassoc, uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << to << isReassoc << +linkId);
+    auto mpdu = GetAssocRespMpdu(to, isReassoc, linkId);
+
     if (!GetQosSupported())
     {
-        GetTxop()->Queue(Create<WifiMpdu>(packet, hdr));
+        GetTxop()->Queue(mpdu);
     }
     // "A QoS STA that transmits a Management frame determines access category used
     // for medium access in transmission of the Management frame as follows
@@ -1521,27 +1619,17 @@ ApWifiMac::SendAssocResp(Mac48Address to, bool isReassoc, uint8_t linkId)
     //   shall be selected." (Sec. 10.2.3.2 of 802.11-2020)
     else if (!GetWifiRemoteStationManager(linkId)->GetQosSupported(to))
     {
-        GetBEQueue()->Queue(Create<WifiMpdu>(packet, hdr));
+        GetBEQueue()->Queue(mpdu);
     }
     else
     {
-        GetVOQueue()->Queue(Create<WifiMpdu>(packet, hdr));
+        GetVOQueue()->Queue(mpdu);
     }
 }
 
-void
-ApWifiMac::SendOneBeacon(uint8_t linkId)
+MgtBeaconHeader
+ApWifiMac::GetBeacon(uint8_t linkId)
 {
-    NS_LOG_FUNCTION(this << +linkId);
-    auto& link = GetLink(linkId);
-    WifiMacHeader hdr;
-    hdr.SetType(WIFI_MAC_MGT_BEACON);
-    hdr.SetAddr1(Mac48Address::GetBroadcast());
-    hdr.SetAddr2(link.feManager->GetAddress());
-    hdr.SetAddr3(link.feManager->GetAddress());
-    hdr.SetDsNotFrom();
-    hdr.SetDsNotTo();
-    Ptr<Packet> packet = Create<Packet>();
     MgtBeaconHeader beacon;
     beacon.Get<Ssid>() = GetSsid();
     auto supportedRates = GetSupportedRates(linkId);
@@ -1549,8 +1637,6 @@ ApWifiMac::SendOneBeacon(uint8_t linkId)
     beacon.Get<ExtendedSupportedRatesIE>() = supportedRates.extendedRates;
     beacon.SetBeaconIntervalUs(GetBeaconInterval().GetMicroSeconds());
     beacon.Capabilities() = GetCapabilities(linkId);
-    GetWifiRemoteStationManager(linkId)->SetShortPreambleEnabled(link.shortPreambleEnabled);
-    GetWifiRemoteStationManager(linkId)->SetShortSlotTimeEnabled(link.shortSlotTimeEnabled);
     if (GetDsssSupported(linkId))
     {
         beacon.Get<DsssParameterSet>() = GetDsssParameterSet(linkId);
@@ -1616,7 +1702,57 @@ ApWifiMac::SendOneBeacon(uint8_t linkId)
             beacon.Get<MultiLinkElement>() = GetMultiLinkElement(linkId, WIFI_MAC_MGT_BEACON);
         }
     }
-    packet->AddHeader(beacon);
+    return beacon;
+}
+
+void
+ApWifiMac::ResetBeaconCache()
+{
+    NS_LOG_FUNCTION(this);
+    for (const auto& [id, link] : GetLinks())
+    {
+        GetLink(id).beacon.reset();
+    }
+}
+
+void
+ApWifiMac::SendOneBeacon(uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << +linkId);
+    auto& link = GetLink(linkId);
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_MGT_BEACON);
+    hdr.SetAddr1(Mac48Address::GetBroadcast());
+    hdr.SetAddr2(link.feManager->GetAddress());
+    hdr.SetAddr3(link.feManager->GetAddress());
+    hdr.SetDsNotFrom();
+    hdr.SetDsNotTo();
+    GetWifiRemoteStationManager(linkId)->SetShortPreambleEnabled(link.shortPreambleEnabled);
+    GetWifiRemoteStationManager(linkId)->SetShortSlotTimeEnabled(link.shortSlotTimeEnabled);
+    auto packet = Create<Packet>();
+    if (!m_enableBeaconCache)
+    {
+        packet->AddHeader(GetBeacon(linkId));
+    }
+    else
+    {
+        if (!link.beacon)
+        {
+            NS_LOG_DEBUG("Build the Beacon frame body for link " << +linkId);
+            link.beacon = GetBeacon(linkId);
+        }
+        if (GetHeSupported())
+        {
+            // the MU EDCA parameters and the BSS color are public members of the HE
+            // configuration, which can be modified without notifying the AP
+            link.beacon->Get<HeOperation>()->m_bssColorInfo.m_bssColor =
+                GetHeConfiguration()->m_bssColor;
+            link.beacon->Get<MuEdcaParameterSet>() = GetMuEdcaParameterSet();
+        }
+        // the Timestamp field (i.e., the value of the TSF timer at the time the frame is
+        // transmitted) is set when the frame body is serialized
+        packet->AddHeader(*link.beacon);
+    }
 
     NS_LOG_INFO("Generating beacon from " << link.feManager->GetAddress() << " linkID " << +linkId);
     // The beacon has it's own special queue, so we load it in there
@@ -1849,6 +1985,7 @@ ApWifiMac::TxFailed(WifiMacDropReason timeoutReason, Ptr<const WifiMpdu> mpdu)
             auto& link = GetLink(id);
             link.staList.erase(aid);
         }
+        ResetBeaconCache();
     }
 }
 
@@ -2108,6 +2245,7 @@ ApWifiMac::Receive(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
                         }
                         UpdateShortSlotTimeEnabled(linkId);
                         UpdateShortPreambleEnabled(linkId);
+                        ResetBeaconCache();
                         StaSwitchingToActiveModeOrDeassociated(from, linkId);
                         if (m_gcrManager)
                         {
@@ -2647,6 +2785,7 @@ ApWifiMac::DoInitialize()
         UpdateShortSlotTimeEnabled(linkId);
         UpdateShortPreambleEnabled(linkId);
     }
+    ResetBeaconCache();
 
     if (m_gcrManager)
     {
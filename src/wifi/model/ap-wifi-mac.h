@@ -40,6 +40,7 @@ class UniformRandomVariable;
 class MgtEmlOmn;
 class ApEmlsrManager;
 class GcrManager;
+class WifiStaticSetupHelper;
 
 /// variant holding a  reference to a (Re)Association Request
 using AssocReqRefVariant = std::variant<std::reference_wrapper<MgtAssocRequestHeader>,
@@ -59,6 +60,9 @@ using AssocReqRefVariant = std::variant<std::reference_wrapper<MgtAssocRequestHe
 class ApWifiMac : public WifiMac
 {
   public:
+    /// Allow the helper performing static setup to access private members
+    friend class WifiStaticSetupHelper;
+
     /**
      * @brief Get the type ID.
      * @return the object TypeId
@@ -276,6 +280,8 @@ class ApWifiMac : public WifiMac
         bool shortSlotTimeEnabled{
             false}; //!< Flag whether short slot time is enabled within the BSS
         bool shortPreambleEnabled{false}; //!< Flag whether short preamble is enabled in the BSS
+        /// the body of the Beacon frame, if cached
+        std::optional<MgtBeaconHeader> beacon;
     };
 
     /**
@@ -296,6 +302,8 @@ class ApWifiMac : public WifiMac
     void Receive(Ptr<const WifiMpdu> mpdu, uint8_t linkId) override;
     void DoCompleteConfig() override;
     void Enqueue(Ptr<WifiMpdu> mpdu, Mac48Address to, Mac48Address from) override;
+    void NotifyChannelSwitching(uint8_t linkId) override;
+    void NotifyEdcaParametersChanged(uint8_t linkId) override;
 
     /**
      * Check whether the supported rate set included in the received (Re)Association
@@ -437,6 +445,23 @@ class ApWifiMac : public WifiMac
      * @param linkId the ID of the link on which the association response must be sent
      */
     void SendAssocResp(Mac48Address to, bool isReassoc, uint8_t linkId);
+    /**
+     * Get an association or a reassociation response frame to send to the given station
+     * on the given link. The AIDs of the station(s) are assigned by this function.
+     *
+     * @param to the address of the STA we are sending an association response to
+     * @param isReassoc indicates whether it is a reassociation response
+     * @param linkId the ID of the link on which the association response must be sent
+     * @return the association or reassociation response frame
+     */
+    Ptr<WifiMpdu> GetAssocRespMpdu(Mac48Address to, bool isReassoc, uint8_t linkId);
+    /**
+     * Get the Beacon frame body to send on the given link.
+     *
+     * @param linkId the ID of the given link
+     * @return the Beacon frame body
+     */
+    MgtBeaconHeader GetBeacon(uint8_t linkId);
     /**
      * Forward a beacon packet to the beacon special DCF for transmission
      * on the given link.
@@ -444,6 +469,51 @@ class ApWifiMac : public WifiMac
      * @param linkId the ID of the given link
      */
     void SendOneBeacon(uint8_t linkId);
+    /**
+     * Discard the cached Beacon frames of all the links, because their content changed.
+     */
+    void ResetBeaconCache();
+
+    /**
+     * Set the CW min values to advertise to stations.
+     *
+     * @param cwMins the per-AC CW min values to advertise to stations
+     */
+    void SetCwMinsForSta(const UintAccessParamsMap& cwMins);
+    /**
+     * @return the per-AC CW min values to advertise to stations
+     */
+    const UintAccessParamsMap& GetCwMinsForSta() const;
+    /**
+     * Set the CW max values to advertise to stations.
+     *
+     * @param cwMaxs the per-AC CW max values to advertise to stations
+     */
+    void SetCwMaxsForSta(const UintAccessParamsMap& cwMaxs);
+    /**
+     * @return the per-AC CW max values to advertise to stations
+     */
+    const UintAccessParamsMap& GetCwMaxsForSta() const;
+    /**
+     * Set the AIFSN values to advertise to stations.
+     *
+     * @param aifsns the per-AC AIFSN values to advertise to stations
+     */
+    void SetAifsnsForSta(const UintAccessParamsMap& aifsns);
+    /**
+     * @return the per-AC AIFSN values to advertise to stations
+     */
+    const UintAccessParamsMap& GetAifsnsForSta() const;
+    /**
+     * Set the TXOP limit values to advertise to stations.
+     *
+     * @param txopLimits the per-AC TXOP limit values to advertise to stations
+     */
+    void SetTxopLimitsForSta(const TimeAccessParamsMap& txopLimits);
+    /**
+     * @return the per-AC TXOP limit values to advertise to stations
+     */
+    const TimeAccessParamsMap& GetTxopLimitsForSta() const;
 
     /**
      * Get the FILS Discovery frame to send on the given link.
@@ -634,6 +704,7 @@ class ApWifiMac : public WifiMac
     Ptr<UniformRandomVariable>
         m_beaconJitter; //!< UniformRandomVariable used to randomize the time of the first beacon
     bool m_enableBeaconJitter; //!< Flag whether the first beacon should be generated at random time
+    bool m_enableBeaconCache;  //!< Flag whether the Beacon frame bodies are cached
     bool m_enableNonErpProtection; //!< Flag whether protection mechanism is used or not when
                                    //!< non-ERP STAs are present within the BSS
     Time m_bsrLifetime;            //!< Lifetime of Buffer Status Reports
@@ -0,0 +1,160 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "error-rate-table-file.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ErrorRateTableFile");
+
+namespace
+{
+
+const char ERROR_RATE_TABLE_FILE_MAGIC[4] = {'W', 'P', 'E', 'R'}; //!< magic number
+const uint16_t ERROR_RATE_TABLE_FILE_VERSION = 1;                //!< format version
+const double ERROR_RATE_TABLE_FILE_SNR_SCALE = 100; //!< SNRs are stored in hundredths of dB
+
+/**
+ * Write an unsigned integer in little-endian order.
+ *
+ * @param os the output stream
+ * @param value the value
+ * @param nBytes the number of bytes to write
+ */
+void
+WriteLe(std::ostream& os, uint32_t value, std::size_t nBytes)
+{
+    for (std::size_t i = 0; i < nBytes; ++i)
+    {
+        os.put(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+/**
+ * Read an unsigned integer stored in little-endian order.
+ *
+ * @param is the input stream
+ * @param nBytes the number of bytes to read
+ * @param filename the name of the file (for error messages)
+ * @return the value
+ */
+uint32_t
+ReadLe(std::istream& is, std::size_t nBytes, const std::string& filename)
+{
+    uint32_t value = 0;
+    for (std::size_t i = 0; i < nBytes; ++i)
+    {
+        const auto byte = is.get();
+        NS_ABORT_MSG_IF(byte == std::istream::traits_type::eof(),
+                        "Unexpected end of error rate table file " << filename);
+        value |= static_cast<uint32_t>(byte) << (8 * i);
+    }
+    return value;
+}
+
+} // namespace
+
+ErrorRateTableFile
+ReadErrorRateTableFile(const std::string& filename)
+{
+    NS_LOG_FUNCTION(filename);
+    std::ifstream is(filename, std::ios::binary);
+    NS_ABORT_MSG_IF(!is.is_open(), "Cannot open error rate table file " << filename);
+
+    char magic[sizeof(ERROR_RATE_TABLE_FILE_MAGIC)];
+    is.read(magic, sizeof(magic));
+    NS_ABORT_MSG_IF(!is || std::memcmp(magic, ERROR_RATE_TABLE_FILE_MAGIC, sizeof(magic)) != 0,
+                    filename << " is not an error rate table file");
+    const auto version = ReadLe(is, 2, filename);
+    NS_ABORT_MSG_IF(version != ERROR_RATE_TABLE_FILE_VERSION,
+                    "Unsupported version " << version << " of error rate table file "
+                                           << filename);
+
+    // check the length of the description against the size of the file before allocating it
+    const auto descriptionLength = ReadLe(is, 4, filename);
+    const auto descriptionStart = is.tellg();
+    is.seekg(0, std::ios::end);
+    const auto remaining = is.tellg() - descriptionStart;
+    is.seekg(descriptionStart);
+    NS_ABORT_MSG_IF(descriptionLength > remaining,
+                    "Description length " << descriptionLength
+                                          << " exceeds the size of error rate table file "
+                                          << filename);
+
+    ErrorRateTableFile file;
+    file.description.resize(descriptionLength);
+    is.read(file.description.data(), file.description.size());
+    NS_ABORT_MSG_IF(!is, "Unexpected end of error rate table file " << filename);
+
+    const auto nTables = ReadLe(is, 4, filename);
+    for (uint32_t i = 0; i < nTables; ++i)
+    {
+        ErrorRateTableFileEntry entry;
+        entry.mcs = ReadLe(is, 1, filename);
+        entry.ldpc = (ReadLe(is, 1, filename) != 0);
+        entry.channelWidth = MHz_u{static_cast<double>(ReadLe(is, 2, filename))};
+        entry.refSize = ReadLe(is, 4, filename);
+        NS_ABORT_MSG_IF(entry.refSize == 0, "Null reference size in " << filename);
+        const auto nPoints = ReadLe(is, 4, filename);
+        NS_ABORT_MSG_IF(nPoints == 0, "Empty table in " << filename);
+        for (uint32_t j = 0; j < nPoints; ++j)
+        {
+            const auto snr = static_cast<int32_t>(ReadLe(is, 4, filename));
+            const auto perBits = ReadLe(is, 4, filename);
+            float per;
+            std::memcpy(&per, &perBits, sizeof(per));
+            const dB_u snrDb{snr / ERROR_RATE_TABLE_FILE_SNR_SCALE};
+            NS_ABORT_MSG_IF(!entry.table.empty() && snrDb <= entry.table.back().first,
+                            "SNRs not sorted in increasing order in " << filename);
+            entry.table.emplace_back(snrDb, per);
+        }
+        file.tables.push_back(std::move(entry));
+    }
+    NS_LOG_DEBUG("Read " << nTables << " tables from " << filename);
+    return file;
+}
+
+void
+WriteErrorRateTableFile(const std::string& filename, const ErrorRateTableFile& file)
+{
+    NS_LOG_FUNCTION(filename);
+    std::ofstream os(filename, std::ios::binary | std::ios::trunc);
+    NS_ABORT_MSG_IF(!os.is_open(), "Cannot open error rate table file " << filename);
+
+    os.write(ERROR_RATE_TABLE_FILE_MAGIC, sizeof(ERROR_RATE_TABLE_FILE_MAGIC));
+    WriteLe(os, ERROR_RATE_TABLE_FILE_VERSION, 2);
+    WriteLe(os, file.description.size(), 4);
+    os.write(file.description.data(), file.description.size());
+
+    WriteLe(os, file.tables.size(), 4);
+    for (const auto& entry : file.tables)
+    {
+        WriteLe(os, entry.mcs, 1);
+        WriteLe(os, entry.ldpc ? 1 : 0, 1);
+        WriteLe(os, static_cast<uint32_t>(entry.channelWidth), 2);
+        WriteLe(os, entry.refSize, 4);
+        WriteLe(os, entry.table.size(), 4);
+        for (const auto& [snr, per] : entry.table)
+        {
+            const auto snrCentiDb =
+                static_cast<int32_t>(std::lround(snr * ERROR_RATE_TABLE_FILE_SNR_SCALE));
+            WriteLe(os, static_cast<uint32_t>(snrCentiDb), 4);
+            const auto perFloat = static_cast<float>(per);
+            uint32_t perBits;
+            std::memcpy(&perBits, &perFloat, sizeof(perBits));
+            WriteLe(os, perBits, 4);
+        }
+    }
+    NS_ABORT_MSG_IF(!os, "Cannot write error rate table file " << filename);
+}
+
+} // namespace ns3
@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef ERROR_RATE_TABLE_FILE_H
+#define ERROR_RATE_TABLE_FILE_H
+
+#include "wifi-units.h"
+
+#include "ns3/error-rate-tables.h"
+
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup wifi
+ * @brief SNR/PER table stored in an error rate table file, along with the parameters
+ * of the transmissions it applies to
+ */
+struct ErrorRateTableFileEntry
+{
+    uint8_t mcs{0};       //!< MCS (as returned by TableBasedErrorRateModel::GetMcsForMode)
+    bool ldpc{false};     //!< whether the LDPC (true) or the BCC (false) FEC coding is used
+    MHz_u channelWidth{}; //!< channel width
+    uint32_t refSize{0};  //!< size (bytes) of the PSDUs the PER applies to
+    SnrPerTable table;    //!< SNR/PER pairs, sorted by increasing SNR
+};
+
+/**
+ * @ingroup wifi
+ * @brief Content of an error rate table file
+ *
+ * The file is binary and little-endian. It starts with the "WPER" magic number, a
+ * 16-bit version number and the description (32-bit length followed by the characters),
+ * followed by the 32-bit number of tables. Each table is made of the MCS (8 bits), the
+ * FEC coding (8 bits, 1 for LDPC), the channel width in MHz (16 bits), the reference size
+ * in bytes (32 bits) and the number of points (32 bits), followed by the points. Each
+ * point is made of the SNR in hundredths of dB (signed 32 bits), i.e. the precision
+ * of the SNRs looked up by the TableBasedErrorRateModel, and the PER (32-bit IEEE 754
+ * float).
+ */
+struct ErrorRateTableFile
+{
+    std::string description;                     //!< free text (e.g., how tables were generated)
+    std::vector<ErrorRateTableFileEntry> tables; //!< the tables
+};
+
+/**
+ * Read an error rate table file. The simulation is aborted if the file cannot be
+ * read or is malformed.
+ *
+ * @param filename the name of the file
+ * @return the content of the file
+ */
+ErrorRateTableFile ReadErrorRateTableFile(const std::string& filename);
+
+/**
+ * Write an error rate table file. The simulation is aborted if the file cannot be
+ * written. SNRs are rounded to the hundredth of dB.
+ *
+ * @param filename the name of the file
+ * @param file the content of the file
+ */
+void WriteErrorRateTableFile(const std::string& filename, const ErrorRateTableFile& file);
+
+} // namespace ns3
+
+#endif /* ERROR_RATE_TABLE_FILE_H */
@@ -92,22 +92,10 @@ FcfsWifiQueueScheduler::HasToDropBeforeEnqueuePriv(AcIndex ac, Ptr<WifiMpdu> mpd
     {
         for (const auto& [priority, queueInfo] : GetSortedQueues(ac))
         {
-            if (std::get<WifiContainerQueueType>(queueInfo.get().first) == WIFI_MGT_QUEUE ||
-                std::get<WifiContainerQueueType>(queueInfo.get().first) == WIFI_CTL_QUEUE)
+            if (auto item = GetMpduToDrop(queue, queueInfo.get().first))
             {
-                // do not drop control or management frames
-                continue;
-            }
-
-            // do not drop frames that are inflight or to be retransmitted
-            Ptr<WifiMpdu> item;
-            while ((item = queue->PeekByQueueId(queueInfo.get().first, item)))
-            {
-                if (!item->IsInFlight() && !item->GetHeader().IsRetry())
-                {
-                    NS_LOG_DEBUG("Dropping " << *item);
-                    return item;
-                }
+                NS_LOG_DEBUG("Dropping " << *item);
+                return item;
             }
         }
     }
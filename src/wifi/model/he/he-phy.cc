@@ -1298,7 +1298,7 @@ HePhy::GetMaxDelayPpduSameUid(const WifiTxVector& txVector)
     return maxDelay;
 }
 
-Ptr<SpectrumValue>
+Ptr<const SpectrumValue>
 HePhy::GetTxPowerSpectralDensity(Watt_u txPower, Ptr<const WifiPpdu> ppdu) const
 {
     auto hePpdu = DynamicCast<const HePpdu>(ppdu);
@@ -1307,7 +1307,7 @@ HePhy::GetTxPowerSpectralDensity(Watt_u txPower, Ptr<const WifiPpdu> ppdu) const
     return GetTxPowerSpectralDensity(txPower, ppdu, flag);
 }
 
-Ptr<SpectrumValue>
+Ptr<const SpectrumValue>
 HePhy::GetTxPowerSpectralDensity(Watt_u txPower,
                                  Ptr<const WifiPpdu> ppdu,
                                  HePpdu::TxPsdFlag flag) const
@@ -1493,7 +1493,7 @@ HePhy::StartTx(Ptr<const WifiPpdu> ppdu)
 void
 HePhy::StartTxHePortion(Ptr<const WifiPpdu> ppdu,
                         dBm_u txPower,
-                        Ptr<SpectrumValue> txPowerSpectrum,
+                        Ptr<const SpectrumValue> txPowerSpectrum,
                         Time hePortionDuration)
 {
     NS_LOG_FUNCTION(this << ppdu << txPower << hePortionDuration);
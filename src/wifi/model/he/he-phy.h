@@ -473,8 +473,8 @@ class HePhy : public VhtPhy
     void DoAbortCurrentReception(WifiPhyRxfailureReason reason) override;
     uint64_t ObtainNextUid(const WifiTxVector& txVector) override;
     Time GetMaxDelayPpduSameUid(const WifiTxVector& txVector) override;
-    Ptr<SpectrumValue> GetTxPowerSpectralDensity(Watt_u txPower,
-                                                 Ptr<const WifiPpdu> ppdu) const override;
+    Ptr<const SpectrumValue> GetTxPowerSpectralDensity(Watt_u txPower,
+                                                       Ptr<const WifiPpdu> ppdu) const override;
     uint32_t GetMaxPsduSize() const override;
     WifiConstPsduMap GetWifiConstPsduMap(Ptr<const WifiPsdu> psdu,
                                          const WifiTxVector& txVector) const override;
@@ -579,9 +579,9 @@ class HePhy : public VhtPhy
      * @param flag flag indicating whether the PSD is for non-HE portion or HE portion
      * @return Pointer to SpectrumValue
      */
-    Ptr<SpectrumValue> GetTxPowerSpectralDensity(Watt_u txPower,
-                                                 Ptr<const WifiPpdu> ppdu,
-                                                 HePpdu::TxPsdFlag flag) const;
+    Ptr<const SpectrumValue> GetTxPowerSpectralDensity(Watt_u txPower,
+                                                       Ptr<const WifiPpdu> ppdu,
+                                                       HePpdu::TxPsdFlag flag) const;
 
     /**
      * Start the transmission of the HE portion of the MU PPDU.
@@ -593,7 +593,7 @@ class HePhy : public VhtPhy
      */
     void StartTxHePortion(Ptr<const WifiPpdu> ppdu,
                           dBm_u txPower,
-                          Ptr<SpectrumValue> txPowerSpectrum,
+                          Ptr<const SpectrumValue> txPowerSpectrum,
                           Time hePortionDuration);
 
     /**
@@ -0,0 +1,597 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "heap-wifi-queue-scheduler.h"
+
+#include "wifi-mac-queue.h"
+#include "wifi-mac.h"
+
+#include "ns3/enum.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("HeapWifiQueueScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED(HeapWifiQueueScheduler);
+
+TypeId
+HeapWifiQueueScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::HeapWifiQueueScheduler")
+            .SetParent<WifiMacQueueScheduler>()
+            .SetGroupName("Wifi")
+            .AddConstructor<HeapWifiQueueScheduler>()
+            .AddAttribute("DropPolicy",
+                          "Upon enqueue with full queue, drop oldest (DropOldest) "
+                          "or newest (DropNewest) packet",
+                          EnumValue(DROP_NEWEST),
+                          MakeEnumAccessor<DropPolicy>(&HeapWifiQueueScheduler::m_dropPolicy),
+                          MakeEnumChecker(HeapWifiQueueScheduler::DROP_OLDEST,
+                                          "DropOldest",
+                                          HeapWifiQueueScheduler::DROP_NEWEST,
+                                          "DropNewest"));
+    return tid;
+}
+
+HeapWifiQueueScheduler::HeapWifiQueueScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+HeapWifiQueueScheduler::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_perAcInfo.clear();
+    WifiMacQueueScheduler::DoDispose();
+}
+
+void
+HeapWifiQueueScheduler::SetWifiMac(Ptr<WifiMac> mac)
+{
+    NS_LOG_FUNCTION(this << mac);
+    for (auto ac : {AC_BE, AC_BK, AC_VI, AC_VO, AC_BE_NQOS, AC_BEACON})
+    {
+        if (auto queue = mac->GetTxopQueue(ac); queue != nullptr)
+        {
+            m_perAcInfo.at(ac).wifiMacQueue = queue;
+            queue->SetScheduler(this);
+        }
+    }
+    WifiMacQueueScheduler::SetWifiMac(mac);
+}
+
+bool
+HeapWifiQueueScheduler::Precedes(const QueueInfo& lhs, const QueueInfo& rhs)
+{
+    if (lhs.priority < rhs.priority)
+    {
+        return true;
+    }
+    if (rhs.priority < lhs.priority)
+    {
+        return false;
+    }
+    return lhs.seqNo < rhs.seqNo;
+}
+
+std::size_t&
+HeapWifiQueueScheduler::HeapPos(const Heap& heap, QueueInfo& info)
+{
+    return heap.linkId ? info.linkHeapPos.try_emplace(*heap.linkId, NOT_IN_HEAP).first->second
+                       : info.heapPos;
+}
+
+void
+HeapWifiQueueScheduler::HeapSwap(Heap& heap, std::size_t i, std::size_t j)
+{
+    std::swap(heap.queues[i], heap.queues[j]);
+    HeapPos(heap, heap.queues[i]->second) = i;
+    HeapPos(heap, heap.queues[j]->second) = j;
+}
+
+void
+HeapWifiQueueScheduler::HeapUpdate(Heap& heap, std::size_t pos)
+{
+    NS_ASSERT(pos < heap.queues.size());
+    // sift up
+    while (pos > 0)
+    {
+        auto parent = (pos - 1) / 2;
+        if (!Precedes(heap.queues[pos]->second, heap.queues[parent]->second))
+        {
+            break;
+        }
+        HeapSwap(heap, pos, parent);
+        pos = parent;
+    }
+    // sift down
+    while (true)
+    {
+        auto first = pos;
+        for (auto child : {2 * pos + 1, 2 * pos + 2})
+        {
+            if (child < heap.queues.size() &&
+                Precedes(heap.queues[child]->second, heap.queues[first]->second))
+            {
+                first = child;
+            }
+        }
+        if (first == pos)
+        {
+            break;
+        }
+        HeapSwap(heap, pos, first);
+        pos = first;
+    }
+}
+
+void
+HeapWifiQueueScheduler::HeapPush(Heap& heap, QueueInfoPair& queue)
+{
+    NS_ASSERT(HeapPos(heap, queue.second) == NOT_IN_HEAP);
+    heap.queues.push_back(&queue);
+    HeapPos(heap, queue.second) = heap.queues.size() - 1;
+    HeapUpdate(heap, heap.queues.size() - 1);
+}
+
+void
+HeapWifiQueueScheduler::HeapErase(Heap& heap, QueueInfoPair& queue)
+{
+    auto& pos = HeapPos(heap, queue.second);
+    NS_ASSERT(pos < heap.queues.size() && heap.queues[pos] == &queue);
+    const auto erasedPos = pos;
+    const auto lastPos = heap.queues.size() - 1;
+    if (erasedPos != lastPos)
+    {
+        HeapSwap(heap, erasedPos, lastPos);
+    }
+    heap.queues.pop_back();
+    pos = NOT_IN_HEAP;
+    if (erasedPos < heap.queues.size())
+    {
+        HeapUpdate(heap, erasedPos);
+    }
+}
+
+HeapWifiQueueScheduler::QueueInfoPair*
+HeapWifiQueueScheduler::HeapNext(const Heap& heap, const QueueInfo& prev)
+{
+    // the queues following prev are the roots of the subtrees whose nodes all follow prev;
+    // only the nodes preceding prev need to be visited to find them
+    QueueInfoPair* next = nullptr;
+    std::vector<std::size_t> toVisit;
+    if (!heap.queues.empty())
+    {
+        toVisit.push_back(0);
+    }
+    while (!toVisit.empty())
+    {
+        auto pos = toVisit.back();
+        toVisit.pop_back();
+        const auto& info = heap.queues[pos]->second;
+        if (Precedes(prev, info))
+        {
+            if (!next || Precedes(info, next->second))
+            {
+                next = heap.queues[pos];
+            }
+            continue;
+        }
+        for (auto child : {2 * pos + 1, 2 * pos + 2})
+        {
+            if (child < heap.queues.size())
+            {
+                toVisit.push_back(child);
+            }
+        }
+    }
+    return next;
+}
+
+HeapWifiQueueScheduler::Heap*
+HeapWifiQueueScheduler::GetHeap(AcIndex ac, std::optional<uint8_t> linkId)
+{
+    auto& perAcInfo = m_perAcInfo.at(ac);
+    if (!linkId)
+    {
+        return &perAcInfo.allQueues;
+    }
+    if (auto it = perAcInfo.linkQueues.find(*linkId); it != perAcInfo.linkQueues.end())
+    {
+        return &it->second;
+    }
+    return nullptr;
+}
+
+HeapWifiQueueScheduler::QueueInfoMap::iterator
+HeapWifiQueueScheduler::InitQueueInfo(AcIndex ac, Ptr<const WifiMpdu> mpdu)
+{
+    NS_LOG_FUNCTION(this << ac << *mpdu);
+
+    auto queueId = WifiMacQueueContainer::GetQueueId(mpdu);
+    // insert queueId in the queue info map if not present yet
+    auto [queueInfoIt, ret] = m_perAcInfo.at(ac).queueInfoMap.insert({queueId, QueueInfo()});
+
+    // the per-link heaps only need to be updated if the set of links has changed
+    if (UpdateQueueLinks(mpdu, queueInfoIt->second.linkIds))
+    {
+        UpdateLinkHeaps(ac, *queueInfoIt);
+    }
+    return queueInfoIt;
+}
+
+void
+HeapWifiQueueScheduler::UpdateLinkHeaps(AcIndex ac, QueueInfoPair& queue)
+{
+    auto& perAcInfo = m_perAcInfo.at(ac);
+    auto& info = queue.second;
+    const auto inHeap = (info.heapPos != NOT_IN_HEAP);
+
+    // remove the container queue from the heaps of the links it no longer has
+    for (const auto& [linkId, heapPos] : info.linkHeapPos)
+    {
+        if (heapPos != NOT_IN_HEAP && !info.linkIds.contains(linkId))
+        {
+            HeapErase(perAcInfo.linkQueues.at(linkId), queue);
+        }
+    }
+
+    for (const auto& [linkId, mask] : info.linkIds)
+    {
+        auto [heapIt, inserted] = perAcInfo.linkQueues.try_emplace(linkId);
+        auto& heap = heapIt->second;
+        if (inserted)
+        {
+            heap.linkId = linkId;
+        }
+
+        const auto heapPos = HeapPos(heap, info);
+        if (!inHeap || mask.any())
+        {
+            if (heapPos != NOT_IN_HEAP)
+            {
+                HeapErase(heap, queue);
+            }
+        }
+        else if (heapPos == NOT_IN_HEAP)
+        {
+            HeapPush(heap, queue);
+        }
+        else
+        {
+            HeapUpdate(heap, heapPos);
+        }
+    }
+}
+
+void
+HeapWifiQueueScheduler::MarkStale(AcIndex ac, QueueInfoPair& queue)
+{
+    if (!queue.second.stale)
+    {
+        queue.second.stale = true;
+        m_perAcInfo.at(ac).staleQueues.push_back(&queue);
+    }
+}
+
+void
+HeapWifiQueueScheduler::Refresh(AcIndex ac)
+{
+    auto& perAcInfo = m_perAcInfo.at(ac);
+
+    // peeking a container queue may remove MPDUs with expired lifetime, which marks the
+    // container queue as stale again; hence, loop until no queue is stale
+    while (!perAcInfo.staleQueues.empty())
+    {
+        auto staleQueues = std::move(perAcInfo.staleQueues);
+        perAcInfo.staleQueues.clear();
+
+        for (auto queue : staleQueues)
+        {
+            auto& [queueId, info] = *queue;
+            info.stale = false;
+
+            // priority is determined by the head of the queue
+            auto item = perAcInfo.wifiMacQueue->PeekByQueueId(queueId);
+
+            if (!item)
+            {
+                // the queue has become empty and needs to be removed from the heaps
+                if (info.heapPos != NOT_IN_HEAP)
+                {
+                    HeapErase(perAcInfo.allQueues, *queue);
+                    UpdateLinkHeaps(ac, *queue);
+                }
+                continue;
+            }
+
+            FcfsPrio priority{item->GetTimestamp(), std::get<WifiContainerQueueType>(queueId)};
+            if (info.heapPos != NOT_IN_HEAP && info.priority == priority)
+            {
+                continue;
+            }
+            info.priority = priority;
+            info.seqNo = ++m_prioritySeqNo;
+            if (info.heapPos == NOT_IN_HEAP)
+            {
+                HeapPush(perAcInfo.allQueues, *queue);
+            }
+            else
+            {
+                HeapUpdate(perAcInfo.allQueues, info.heapPos);
+            }
+            UpdateLinkHeaps(ac, *queue);
+        }
+    }
+}
+
+std::list<uint8_t>
+HeapWifiQueueScheduler::GetLinkIds(AcIndex ac,
+                                   Ptr<const WifiMpdu> mpdu,
+                                   const std::list<WifiQueueBlockedReason>& ignoredReasons)
+{
+    // the set of links is re-evaluated because links may have been setup or torn down
+    auto queueInfoIt = InitQueueInfo(ac, mpdu);
+
+    return GetUnblockedLinks(queueInfoIt->second.linkIds, ignoredReasons);
+}
+
+void
+HeapWifiQueueScheduler::DoBlockQueues(bool block,
+                                      WifiQueueBlockedReason reason,
+                                      AcIndex ac,
+                                      const std::list<WifiContainerQueueType>& types,
+                                      const Mac48Address& rxAddress,
+                                      const Mac48Address& txAddress,
+                                      const std::set<uint8_t>& tids,
+                                      const std::set<uint8_t>& linkIds)
+{
+    NS_LOG_FUNCTION(this << block << reason << ac << rxAddress << txAddress);
+
+    for (const auto& hdr : GetQueueHeaders(types, rxAddress, txAddress, tids))
+    {
+        auto queueInfoIt = InitQueueInfo(ac, Create<WifiMpdu>(Create<Packet>(), hdr));
+        if (SetLinkMasks(queueInfoIt->second.linkIds, block, reason, linkIds))
+        {
+            UpdateLinkHeaps(ac, *queueInfoIt);
+        }
+    }
+}
+
+void
+HeapWifiQueueScheduler::BlockQueues(WifiQueueBlockedReason reason,
+                                    AcIndex ac,
+                                    const std::list<WifiContainerQueueType>& types,
+                                    const Mac48Address& rxAddress,
+                                    const Mac48Address& txAddress,
+                                    const std::set<uint8_t>& tids,
+                                    const std::set<uint8_t>& linkIds)
+{
+    DoBlockQueues(true, reason, ac, types, rxAddress, txAddress, tids, linkIds);
+}
+
+void
+HeapWifiQueueScheduler::UnblockQueues(WifiQueueBlockedReason reason,
+                                      AcIndex ac,
+                                      const std::list<WifiContainerQueueType>& types,
+                                      const Mac48Address& rxAddress,
+                                      const Mac48Address& txAddress,
+                                      const std::set<uint8_t>& tids,
+                                      const std::set<uint8_t>& linkIds)
+{
+    DoBlockQueues(false, reason, ac, types, rxAddress, txAddress, tids, linkIds);
+}
+
+void
+HeapWifiQueueScheduler::DoBlockAllQueues(bool block,
+                                         WifiQueueBlockedReason reason,
+                                         const std::set<uint8_t>& linkIds)
+{
+    NS_LOG_FUNCTION(this << block << reason);
+
+    for (std::size_t ac = 0; ac < m_perAcInfo.size(); ++ac)
+    {
+        for (auto& queue : m_perAcInfo[ac].queueInfoMap)
+        {
+            if (SetLinkMasks(queue.second.linkIds, block, reason, linkIds))
+            {
+                UpdateLinkHeaps(static_cast<AcIndex>(ac), queue);
+            }
+        }
+    }
+}
+
+void
+HeapWifiQueueScheduler::BlockAllQueues(WifiQueueBlockedReason reason,
+                                       const std::set<uint8_t>& linkIds)
+{
+    DoBlockAllQueues(true, reason, linkIds);
+    SetAllQueuesBlocked(true, reason, linkIds);
+}
+
+void
+HeapWifiQueueScheduler::UnblockAllQueues(WifiQueueBlockedReason reason,
+                                         const std::set<uint8_t>& linkIds)
+{
+    DoBlockAllQueues(false, reason, linkIds);
+    SetAllQueuesBlocked(false, reason, linkIds);
+}
+
+std::optional<WifiMacQueueScheduler::Mask>
+HeapWifiQueueScheduler::GetQueueLinkMask(AcIndex ac,
+                                         const WifiContainerQueueId& queueId,
+                                         uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << +ac << +linkId);
+
+    const auto& queueInfoMap = m_perAcInfo.at(ac).queueInfoMap;
+    const auto queueInfoIt = queueInfoMap.find(queueId);
+
+    if (queueInfoIt == queueInfoMap.cend())
+    {
+        // the given container queue does not exist
+        return std::nullopt;
+    }
+
+    const auto& linkIds = queueInfoIt->second.linkIds;
+    if (const auto linkIt = linkIds.find(linkId); linkIt != linkIds.cend())
+    {
+        return linkIt->second;
+    }
+
+    return std::nullopt;
+}
+
+std::optional<WifiContainerQueueId>
+HeapWifiQueueScheduler::GetNext(AcIndex ac, std::optional<uint8_t> linkId)
+{
+    NS_LOG_FUNCTION(this << +ac << linkId.has_value());
+    return DoGetNext(ac, linkId, nullptr);
+}
+
+std::optional<WifiContainerQueueId>
+HeapWifiQueueScheduler::GetNext(AcIndex ac,
+                                std::optional<uint8_t> linkId,
+                                const WifiContainerQueueId& prevQueueId)
+{
+    NS_LOG_FUNCTION(this << +ac << linkId.has_value());
+
+    Refresh(ac);
+    const auto& queueInfoMap = m_perAcInfo.at(ac).queueInfoMap;
+    auto queueInfoIt = queueInfoMap.find(prevQueueId);
+    NS_ABORT_IF(queueInfoIt == queueInfoMap.end() ||
+                queueInfoIt->second.heapPos == NOT_IN_HEAP);
+
+    return DoGetNext(ac, linkId, &queueInfoIt->second);
+}
+
+std::optional<WifiContainerQueueId>
+HeapWifiQueueScheduler::DoGetNext(AcIndex ac, std::optional<uint8_t> linkId, const QueueInfo* prev)
+{
+    NS_LOG_FUNCTION(this << +ac << linkId.has_value());
+    NS_ASSERT(static_cast<uint8_t>(ac) < AC_UNDEF);
+
+    // the search starts after the given queue; the priority of the latter is copied
+    // because it may change while searching
+    std::optional<QueueInfo> prevInfo;
+    if (prev)
+    {
+        prevInfo.emplace();
+        prevInfo->priority = prev->priority;
+        prevInfo->seqNo = prev->seqNo;
+    }
+
+    Refresh(ac);
+
+    while (true)
+    {
+        auto heap = GetHeap(ac, linkId);
+        if (!heap || heap->queues.empty())
+        {
+            return {};
+        }
+        auto queue = prevInfo ? HeapNext(*heap, *prevInfo) : heap->queues.front();
+        if (!queue)
+        {
+            return {};
+        }
+
+        // Packets in this queue can be sent over the link we got channel access on.
+        // Now remove packets with expired lifetime from this queue.
+        const auto queueId = queue->first;
+        m_perAcInfo[ac].wifiMacQueue->ExtractExpiredMpdus(queueId);
+        Refresh(ac);
+
+        if (m_perAcInfo[ac].wifiMacQueue->PeekByQueueId(queueId))
+        {
+            return queueId;
+        }
+        // the queue has become empty and has been removed from the heaps, search again
+    }
+}
+
+Ptr<WifiMpdu>
+HeapWifiQueueScheduler::HasToDropBeforeEnqueue(AcIndex ac, Ptr<WifiMpdu> mpdu)
+{
+    NS_LOG_FUNCTION(this << +ac << *mpdu);
+
+    auto queue = m_perAcInfo.at(ac).wifiMacQueue;
+    if (queue->QueueBase::GetNPackets() < queue->GetMaxSize().GetValue())
+    {
+        // the queue is not full, do not drop anything
+        return nullptr;
+    }
+
+    // Control and management frames should be prioritized
+    if (m_dropPolicy == DROP_OLDEST || mpdu->GetHeader().IsCtl() || mpdu->GetHeader().IsMgt())
+    {
+        Refresh(ac);
+        // visit the queues in the order of service
+        auto sortedQueues = m_perAcInfo.at(ac).allQueues.queues;
+        std::sort(sortedQueues.begin(), sortedQueues.end(), [](auto lhs, auto rhs) {
+            return Precedes(lhs->second, rhs->second);
+        });
+
+        for (const auto sortedQueue : sortedQueues)
+        {
+            if (auto item = GetMpduToDrop(queue, sortedQueue->first))
+            {
+                NS_LOG_DEBUG("Dropping " << *item);
+                return item;
+            }
+        }
+    }
+    NS_LOG_DEBUG("Dropping received MPDU: " << *mpdu);
+    return mpdu;
+}
+
+void
+HeapWifiQueueScheduler::NotifyEnqueue(AcIndex ac, Ptr<WifiMpdu> mpdu)
+{
+    NS_LOG_FUNCTION(this << +ac << *mpdu);
+    NS_ASSERT(static_cast<uint8_t>(ac) < AC_UNDEF);
+
+    // add information for the queue storing the MPDU to the queue info map, if not present
+    // yet. The set of links of an existing queue is not re-evaluated, because the MAC gets
+    // the links an MPDU can be sent on (thus re-evaluating them) before enqueuing it
+    auto& queueInfoMap = m_perAcInfo[ac].queueInfoMap;
+    auto queueInfoIt = queueInfoMap.find(WifiMacQueueContainer::GetQueueId(mpdu));
+    if (queueInfoIt == queueInfoMap.end())
+    {
+        queueInfoIt = InitQueueInfo(ac, mpdu);
+    }
+
+    MarkStale(ac, *queueInfoIt);
+}
+
+void
+HeapWifiQueueScheduler::NotifyDequeue(AcIndex ac, const std::list<Ptr<WifiMpdu>>& mpdus)
+{
+    NS_LOG_FUNCTION(this << +ac);
+    NotifyRemove(ac, mpdus);
+}
+
+void
+HeapWifiQueueScheduler::NotifyRemove(AcIndex ac, const std::list<Ptr<WifiMpdu>>& mpdus)
+{
+    NS_LOG_FUNCTION(this << +ac);
+    NS_ASSERT(static_cast<uint8_t>(ac) < AC_UNDEF);
+
+    auto& queueInfoMap = m_perAcInfo[ac].queueInfoMap;
+
+    for (const auto& mpdu : mpdus)
+    {
+        auto queueInfoIt = queueInfoMap.find(WifiMacQueueContainer::GetQueueId(mpdu));
+        NS_ASSERT(queueInfoIt != queueInfoMap.end());
+        MarkStale(ac, *queueInfoIt);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,344 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef HEAP_WIFI_QUEUE_SCHEDULER_H
+#define HEAP_WIFI_QUEUE_SCHEDULER_H
+
+#include "fcfs-wifi-queue-scheduler.h"
+#include "wifi-mac-queue-scheduler.h"
+
+#include <limits>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+class WifiMacQueuePerformanceTest;
+class WifiMacQueueSchedulerConsistencyTest;
+
+namespace ns3
+{
+
+class WifiMacQueue;
+
+/**
+ * @ingroup wifi
+ *
+ * HeapWifiQueueScheduler is a wifi queue scheduler that serves container queues in the
+ * same (first come first serve) order as FcfsWifiQueueScheduler, but is designed to
+ * scale with the number of container queues (e.g., an AP MLD serving many stations):
+ *
+ * - the non-empty container queues of each Access Category are kept in an indexed binary
+ *   heap, and also in one indexed binary heap per link, which only holds the queues that
+ *   are not blocked on that link. The masks of blocked reasons are cached per queue and per
+ *   link and the per-link heaps are updated when a mask changes, hence selecting the next
+ *   queue to serve on a link does not require to skip the queues that are blocked;
+ * - priorities are updated lazily: enqueuing, dequeuing or removing MPDUs only marks the
+ *   affected container queues, whose priority is recomputed (once) before the scheduler is
+ *   next queried;
+ * - the set of links on which the frames of a container queue can be sent is evaluated when
+ *   the container queue is created and re-evaluated (through the code shared with
+ *   FcfsWifiQueueScheduler) when the links an MPDU can be sent on are requested, which the
+ *   MAC does before enqueuing every MPDU, and when the queue is blocked or unblocked (e.g.,
+ *   because the TID-to-link mapping changed). The per-link heaps are only updated if the set
+ *   of links or the blocked state of a link changed.
+ */
+class HeapWifiQueueScheduler : public WifiMacQueueScheduler
+{
+  public:
+    /// allow WifiMacQueuePerformanceTest class access
+    friend class ::WifiMacQueuePerformanceTest;
+    /// allow WifiMacQueueSchedulerConsistencyTest class access
+    friend class ::WifiMacQueueSchedulerConsistencyTest;
+
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    HeapWifiQueueScheduler();
+
+    /// drop policy
+    enum DropPolicy
+    {
+        DROP_NEWEST,
+        DROP_OLDEST
+    };
+
+    /** @copydoc ns3::WifiMacQueueScheduler::SetWifiMac */
+    void SetWifiMac(Ptr<WifiMac> mac) override;
+    /** @copydoc ns3::WifiMacQueueScheduler::GetNext(AcIndex,std::optional<uint8_t>) */
+    std::optional<WifiContainerQueueId> GetNext(AcIndex ac, std::optional<uint8_t> linkId) override;
+    /**
+     *  @copydoc ns3::WifiMacQueueScheduler::GetNext(AcIndex,std::optional<uint8_t>,
+     *           const WifiContainerQueueId&)
+     */
+    std::optional<WifiContainerQueueId> GetNext(AcIndex ac,
+                                                std::optional<uint8_t> linkId,
+                                                const WifiContainerQueueId& prevQueueId) override;
+    /** @copydoc ns3::WifiMacQueueScheduler::GetLinkIds */
+    std::list<uint8_t> GetLinkIds(AcIndex ac,
+                                  Ptr<const WifiMpdu> mpdu,
+                                  const std::list<WifiQueueBlockedReason>& ignoredReasons) override;
+    /** @copydoc ns3::WifiMacQueueScheduler::BlockQueues */
+    void BlockQueues(WifiQueueBlockedReason reason,
+                     AcIndex ac,
+                     const std::list<WifiContainerQueueType>& types,
+                     const Mac48Address& rxAddress,
+                     const Mac48Address& txAddress,
+                     const std::set<uint8_t>& tids,
+                     const std::set<uint8_t>& linkIds) override;
+    /** @copydoc ns3::WifiMacQueueScheduler::UnblockQueues */
+    void UnblockQueues(WifiQueueBlockedReason reason,
+                       AcIndex ac,
+                       const std::list<WifiContainerQueueType>& types,
+                       const Mac48Address& rxAddress,
+                       const Mac48Address& txAddress,
+                       const std::set<uint8_t>& tids,
+                       const std::set<uint8_t>& linkIds) override;
+    /** @copydoc ns3::WifiMacQueueScheduler::BlockAllQueues */
+    void BlockAllQueues(WifiQueueBlockedReason reason, const std::set<uint8_t>& linkIds) override;
+    /** @copydoc ns3::WifiMacQueueScheduler::UnblockAllQueues */
+    void UnblockAllQueues(WifiQueueBlockedReason reason, const std::set<uint8_t>& linkIds) override;
+    /** @copydoc ns3::WifiMacQueueScheduler::GetQueueLinkMask */
+    std::optional<Mask> GetQueueLinkMask(AcIndex ac,
+                                         const WifiContainerQueueId& queueId,
+                                         uint8_t linkId) override;
+    /** @copydoc ns3::WifiMacQueueScheduler::HasToDropBeforeEnqueue */
+    Ptr<WifiMpdu> HasToDropBeforeEnqueue(AcIndex ac, Ptr<WifiMpdu> mpdu) override;
+    /** @copydoc ns3::WifiMacQueueScheduler::NotifyEnqueue */
+    void NotifyEnqueue(AcIndex ac, Ptr<WifiMpdu> mpdu) override;
+    /** @copydoc ns3::WifiMacQueueScheduler::NotifyDequeue */
+    void NotifyDequeue(AcIndex ac, const std::list<Ptr<WifiMpdu>>& mpdus) override;
+    /** @copydoc ns3::WifiMacQueueScheduler::NotifyRemove */
+    void NotifyRemove(AcIndex ac, const std::list<Ptr<WifiMpdu>>& mpdus) override;
+
+  protected:
+    /** @copydoc ns3::Object::DoDispose */
+    void DoDispose() override;
+
+  private:
+    /// value of a heap position indicating that a container queue is not in the heap
+    static constexpr std::size_t NOT_IN_HEAP = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * Information associated with a container queue.
+     */
+    struct QueueInfo
+    {
+        FcfsPrio priority;                //!< the priority of the container queue
+        uint64_t seqNo{0};                //!< sequence number of the priority assignment, used
+                                          //!< to serve queues with equal priority in FIFO order
+        std::size_t heapPos{NOT_IN_HEAP}; //!< position in the heap of all the non-empty queues
+        bool stale{false};                //!< whether the priority has to be recomputed
+        std::map<uint8_t, Mask> linkIds;  //!< Maps ID of each link on which packets contained
+                                          //!< in this queue can be sent to a bitset indicating
+                                          //!< whether the link is blocked (at least one bit is
+                                          //!< non-zero) and for which reason
+        std::map<uint8_t, std::size_t> linkHeapPos; //!< position in the heap of the queues of
+                                                    //!< each link
+    };
+
+    /**
+     * Map identifiers (QueueIds) to information associated with container queues.
+     *
+     * Entries are never removed from this map (so that references to them stay valid),
+     * because queue information (such as the set of link IDs) may be configured just once.
+     */
+    using QueueInfoMap = std::unordered_map<WifiContainerQueueId, QueueInfo>;
+
+    /// typedef for a QueueInfoMap element
+    using QueueInfoPair = std::pair<const WifiContainerQueueId, QueueInfo>;
+
+    /**
+     * Binary min-heap of container queues. The position of each container queue in the heap
+     * is stored in the information associated with the container queue.
+     */
+    struct Heap
+    {
+        std::optional<uint8_t> linkId;      //!< the link of the queues (none for all the queues)
+        std::vector<QueueInfoPair*> queues; //!< the container queues
+    };
+
+    /**
+     * Information specific to a wifi MAC queue
+     */
+    struct PerAcInfo
+    {
+        QueueInfoMap queueInfoMap;               //!< information associated with container queues
+        Heap allQueues;                          //!< heap of all the non-empty queues
+        std::map<uint8_t, Heap> linkQueues;      //!< per-link heap of the non-empty queues that
+                                                 //!< are not blocked on the link
+        std::vector<QueueInfoPair*> staleQueues; //!< queues whose priority is to be recomputed
+        Ptr<WifiMacQueue> wifiMacQueue;          //!< pointer to the WifiMacQueue object
+    };
+
+    /**
+     * @param lhs the left hand side container queue
+     * @param rhs the right hand side container queue
+     * @return whether the left hand side container queue has to be served before the right
+     *         hand side container queue
+     */
+    static bool Precedes(const QueueInfo& lhs, const QueueInfo& rhs);
+
+    /**
+     * @param heap the given heap
+     * @param info the information associated with a container queue
+     * @return a reference to the position of the container queue in the given heap
+     */
+    static std::size_t& HeapPos(const Heap& heap, QueueInfo& info);
+
+    /**
+     * Insert a container queue in the given heap.
+     *
+     * @param heap the given heap
+     * @param queue the container queue
+     */
+    static void HeapPush(Heap& heap, QueueInfoPair& queue);
+
+    /**
+     * Remove a container queue from the given heap.
+     *
+     * @param heap the given heap
+     * @param queue the container queue
+     */
+    static void HeapErase(Heap& heap, QueueInfoPair& queue);
+
+    /**
+     * Restore the heap property after that the priority of the container queue at the
+     * given position has changed.
+     *
+     * @param heap the given heap
+     * @param pos the position of the container queue
+     */
+    static void HeapUpdate(Heap& heap, std::size_t pos);
+
+    /**
+     * Swap the container queues at the given positions of the given heap.
+     *
+     * @param heap the given heap
+     * @param i the first position
+     * @param j the second position
+     */
+    static void HeapSwap(Heap& heap, std::size_t i, std::size_t j);
+
+    /**
+     * Get the container queue of the given heap that immediately follows the given
+     * container queue in the order of service. The given container queue needs not
+     * be in the given heap.
+     *
+     * @param heap the given heap
+     * @param prev the information associated with the given container queue
+     * @return the container queue following the given one, if any
+     */
+    static QueueInfoPair* HeapNext(const Heap& heap, const QueueInfo& prev);
+
+    /**
+     * Get the heap of the given Access Category storing the queues that can be served on
+     * the given link.
+     *
+     * @param ac the given Access Category
+     * @param linkId the ID of the given link (none for all the queues)
+     * @return a pointer to the heap, if any
+     */
+    Heap* GetHeap(AcIndex ac, std::optional<uint8_t> linkId);
+
+    /**
+     * If no information for the container queue used to store the given MPDU of the given
+     * Access Category is present in the queue info map, add the information for such a
+     * container queue. Initialize or update the list of the IDs of the links over which packets
+     * contained in that container queue can be sent and, if it changed, the per-link heaps.
+     *
+     * @param ac the given Access Category
+     * @param mpdu the given MPDU
+     * @return an iterator to the information associated with the container queue used to
+     *         store the given MPDU of the given Access Category
+     */
+    QueueInfoMap::iterator InitQueueInfo(AcIndex ac, Ptr<const WifiMpdu> mpdu);
+
+    /**
+     * Make the membership and the position of the given container queue in the per-link
+     * heaps consistent with its presence in the heap of all the queues, its priority and
+     * the masks of its links.
+     *
+     * @param ac the Access Category of the given container queue
+     * @param queue the given container queue
+     */
+    void UpdateLinkHeaps(AcIndex ac, QueueInfoPair& queue);
+
+    /**
+     * Record that the priority of the given container queue has to be recomputed.
+     *
+     * @param ac the Access Category of the given container queue
+     * @param queue the given container queue
+     */
+    void MarkStale(AcIndex ac, QueueInfoPair& queue);
+
+    /**
+     * Recompute the priority of the container queues of the given Access Category that have
+     * been marked as stale and remove the container queues that became empty from the heaps.
+     *
+     * @param ac the given Access Category
+     */
+    void Refresh(AcIndex ac);
+
+    /**
+     * Get the next queue to serve, i.e., the queue at the head of the given heap or the queue
+     * following the given one. The returned queue is guaranteed to contain at least an MPDU
+     * whose lifetime has not expired.
+     *
+     * @param ac the Access Category that we want to serve
+     * @param linkId the ID of the link on which MPDUs contained in the returned queue must be
+     *               allowed to be sent
+     * @param prev the information associated with the queue after which the search starts
+     *             (null to start from the head of the heap)
+     * @return the ID of the selected container queue (if any)
+     */
+    std::optional<WifiContainerQueueId> DoGetNext(AcIndex ac,
+                                                  std::optional<uint8_t> linkId,
+                                                  const QueueInfo* prev);
+
+    /**
+     * Block or unblock the given set of links for the container queues of the given types and
+     * Access Category that hold frames having the given Receiver Address (RA),
+     * Transmitter Address (TA) and TID (if needed) for the given reason.
+     *
+     * @param block true to block the queues, false to unblock
+     * @param reason the reason for blocking the queues
+     * @param ac the given Access Category
+     * @param types the types of the queues to block
+     * @param rxAddress the Receiver Address (RA) of the frames
+     * @param txAddress the Transmitter Address (TA) of the frames
+     * @param tids the TIDs optionally identifying the queues to block
+     * @param linkIds set of links to block (empty to block all setup links)
+     */
+    void DoBlockQueues(bool block,
+                       WifiQueueBlockedReason reason,
+                       AcIndex ac,
+                       const std::list<WifiContainerQueueType>& types,
+                       const Mac48Address& rxAddress,
+                       const Mac48Address& txAddress,
+                       const std::set<uint8_t>& tids,
+                       const std::set<uint8_t>& linkIds);
+
+    /**
+     * Block or unblock the given set of links for all the container queues for the given reason.
+     *
+     * @param block true to block the queues, false to unblock
+     * @param reason the reason for blocking the queues
+     * @param linkIds set of links to block (empty to block all setup links)
+     */
+    void DoBlockAllQueues(bool block,
+                          WifiQueueBlockedReason reason,
+                          const std::set<uint8_t>& linkIds);
+
+    std::vector<PerAcInfo> m_perAcInfo{AC_UNDEF}; //!< vector of per-AC information
+    uint64_t m_prioritySeqNo{0};                  //!< counter of priority assignments
+    DropPolicy m_dropPolicy;                      //!< Drop behavior of queue
+};
+
+} // namespace ns3
+
+#endif /* HEAP_WIFI_QUEUE_SCHEDULER_H */
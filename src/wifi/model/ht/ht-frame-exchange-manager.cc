@@ -260,19 +260,11 @@ HtFrameExchangeManager::SendAddBaRequest(Mac48Address dest,
     return true;
 }
 
-void
-HtFrameExchangeManager::SendAddBaResponse(const MgtAddBaRequestHeader& reqHdr,
-                                          Mac48Address originator)
+MgtAddBaResponseHeader
+HtFrameExchangeManager::AcceptAddBaRequest(const MgtAddBaRequestHeader& reqHdr,
+                                           Mac48Address originator)
 {
     NS_LOG_FUNCTION(this << originator);
-    WifiMacHeader hdr;
-    hdr.SetType(WIFI_MAC_MGT_ACTION);
-    hdr.SetAddr1(originator);
-    hdr.SetAddr2(m_self);
-    hdr.SetAddr3(m_bssid);
-    hdr.SetDsNotFrom();
-    hdr.SetDsNotTo();
-
     MgtAddBaResponseHeader respHdr;
     StatusCode code;
     code.SetSuccess();
@@ -300,15 +292,6 @@ HtFrameExchangeManager::SendAddBaResponse(const MgtAddBaRequestHeader& reqHdr,
         respHdr.SetGcrGroupAddress(*gcrGroupAddr);
     }
 
-    WifiActionHeader actionHdr;
-    WifiActionHeader::ActionValue action;
-    action.blockAck = WifiActionHeader::BLOCK_ACK_ADDBA_RESPONSE;
-    actionHdr.SetAction(WifiActionHeader::BLOCK_ACK, action);
-
-    Ptr<Packet> packet = Create<Packet>();
-    packet->AddHeader(respHdr);
-    packet->AddHeader(actionHdr);
-
     // Get the MLD address of the originator, if an ML setup was performed
     if (auto originatorMld = GetWifiRemoteStationManager()->GetMldAddress(originator))
     {
@@ -336,6 +319,40 @@ HtFrameExchangeManager::SendAddBaResponse(const MgtAddBaRequestHeader& reqHdr,
                                 reqHdr.GetGcrGroupAddress());
     }
 
+    return respHdr;
+}
+
+void
+HtFrameExchangeManager::SendAddBaResponse(const MgtAddBaRequestHeader& reqHdr,
+                                          Mac48Address originator)
+{
+    NS_LOG_FUNCTION(this << originator);
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_MGT_ACTION);
+    hdr.SetAddr1(originator);
+    hdr.SetAddr2(m_self);
+    hdr.SetAddr3(m_bssid);
+    hdr.SetDsNotFrom();
+    hdr.SetDsNotTo();
+
+    auto respHdr = AcceptAddBaRequest(reqHdr, originator);
+    auto tid = reqHdr.GetTid();
+
+    WifiActionHeader actionHdr;
+    WifiActionHeader::ActionValue action;
+    action.blockAck = WifiActionHeader::BLOCK_ACK_ADDBA_RESPONSE;
+    actionHdr.SetAction(WifiActionHeader::BLOCK_ACK, action);
+
+    Ptr<Packet> packet = Create<Packet>();
+    packet->AddHeader(respHdr);
+    packet->AddHeader(actionHdr);
+
+    // Get the MLD address of the originator, if an ML setup was performed
+    if (auto originatorMld = GetWifiRemoteStationManager()->GetMldAddress(originator))
+    {
+        originator = *originatorMld;
+    }
+
     auto mpdu = Create<WifiMpdu>(packet, hdr);
 
     /*
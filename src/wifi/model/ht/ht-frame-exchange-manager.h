@@ -131,6 +131,17 @@ class HtFrameExchangeManager : public QosFrameExchangeManager
      */
     void SendAddBaResponse(const MgtAddBaRequestHeader& reqHdr, Mac48Address originator);
 
+    /**
+     * Accept the given ADDBA Request, i.e., create the Block Ack agreement as recipient,
+     * and return the ADDBA Response to send to the originator.
+     *
+     * @param reqHdr the ADDBA Request header.
+     * @param originator the MAC address of the originator.
+     * @return the ADDBA Response header
+     */
+    MgtAddBaResponseHeader AcceptAddBaRequest(const MgtAddBaRequestHeader& reqHdr,
+                                              Mac48Address originator);
+
     /**
      * Sends DELBA frame to cancel a block ack agreement with STA
      * addressed by <i>addr</i> for TID <i>tid</i>.
@@ -408,9 +408,7 @@ HtPhy::EndReceiveHtSig(Ptr<Event> event)
 {
     NS_LOG_FUNCTION(this << *event);
     NS_ASSERT(event->GetPpdu()->GetTxVector().GetPreambleType() == WIFI_PREAMBLE_HT_MF);
-    SnrPer snrPer = GetPhyHeaderSnrPer(WIFI_PPDU_FIELD_HT_SIG, event);
-    NS_LOG_DEBUG("HT-SIG: SNR(dB)=" << RatioToDb(snrPer.snr) << ", PER=" << snrPer.per);
-    PhyFieldRxStatus status(GetRandomValue() > snrPer.per);
+    PhyFieldRxStatus status(IsPhyHeaderReceived(WIFI_PPDU_FIELD_HT_SIG, event));
     if (status.isSuccess)
     {
         NS_LOG_DEBUG("Received HT-SIG");
@@ -456,7 +454,7 @@ HtPhy::IsConfigSupported(Ptr<const WifiPpdu> ppdu) const
     return true;
 }
 
-Ptr<SpectrumValue>
+Ptr<const SpectrumValue>
 HtPhy::GetTxPowerSpectralDensity(Watt_u txPower, Ptr<const WifiPpdu> ppdu) const
 {
     const auto& centerFrequencies = ppdu->GetTxCenterFreqs();
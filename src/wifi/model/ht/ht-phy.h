@@ -455,8 +455,8 @@ class HtPhy : public OfdmPhy
     PhyFieldRxStatus DoEndReceiveField(WifiPpduField field, Ptr<Event> event) override;
     bool IsAllConfigSupported(WifiPpduField field, Ptr<const WifiPpdu> ppdu) const override;
     bool IsConfigSupported(Ptr<const WifiPpdu> ppdu) const override;
-    Ptr<SpectrumValue> GetTxPowerSpectralDensity(Watt_u txPower,
-                                                 Ptr<const WifiPpdu> ppdu) const override;
+    Ptr<const SpectrumValue> GetTxPowerSpectralDensity(Watt_u txPower,
+                                                       Ptr<const WifiPpdu> ppdu) const override;
     uint32_t GetMaxPsduSize() const override;
     CcaIndication GetCcaIndication(const Ptr<const WifiPpdu> ppdu) override;
 
@@ -10,6 +10,7 @@
 #include "interference-helper.h"
 
 #include "error-rate-model.h"
+#include "wifi-link-to-system-mapping.h"
 #include "wifi-phy-operating-channel.h"
 #include "wifi-phy.h"
 #include "wifi-psdu.h"
@@ -30,6 +31,9 @@ NS_LOG_COMPONENT_DEFINE("InterferenceHelper");
 
 NS_OBJECT_ENSURE_REGISTERED(InterferenceHelper);
 
+/// Minimum number of released NI changes of a band before they are compacted
+static const std::size_t NI_CHANGES_COMPACTION_THRESHOLD = 64;
+
 /****************************************************************
  *       PHY event class
  ****************************************************************/
@@ -123,40 +127,6 @@ operator<<(std::ostream& os, const Event& event)
     return os;
 }
 
-/****************************************************************
- *       Class which records SNIR change events for a
- *       short period of time.
- ****************************************************************/
-
-InterferenceHelper::NiChange::NiChange(Watt_u power, Ptr<Event> event)
-    : m_power(power),
-      m_event(event)
-{
-}
-
-InterferenceHelper::NiChange::~NiChange()
-{
-    m_event = nullptr;
-}
-
-Watt_u
-InterferenceHelper::NiChange::GetPower() const
-{
-    return m_power;
-}
-
-void
-InterferenceHelper::NiChange::AddPower(Watt_u power)
-{
-    m_power += power;
-}
-
-Ptr<Event>
-InterferenceHelper::NiChange::GetEvent() const
-{
-    return m_event;
-}
-
 /****************************************************************
  *       The actual InterferenceHelper
  ****************************************************************/
@@ -187,12 +157,9 @@ void
 InterferenceHelper::DoDispose()
 {
     NS_LOG_FUNCTION(this);
-    for (auto it : m_niChanges)
-    {
-        it.second.clear();
-    }
     m_niChanges.clear();
-    m_firstPowers.clear();
+    m_bands.clear();
+    m_bandIndices.clear();
     m_errorRateModel = nullptr;
 }
 
@@ -227,39 +194,50 @@ InterferenceHelper::AddForeignSignal(Time duration,
 bool
 InterferenceHelper::HasBands() const
 {
-    return !m_niChanges.empty();
+    return !m_bands.empty();
 }
 
 bool
 InterferenceHelper::HasBand(const WifiSpectrumBandInfo& band) const
 {
-    return m_niChanges.contains(band);
+    return m_bandIndices.contains(band);
+}
+
+std::size_t
+InterferenceHelper::GetBandIndex(const WifiSpectrumBandInfo& band) const
+{
+    auto it = m_bandIndices.find(band);
+    NS_ABORT_IF(it == m_bandIndices.end());
+    return it->second;
 }
 
 void
 InterferenceHelper::AddBand(const WifiSpectrumBandInfo& band)
 {
     NS_LOG_FUNCTION(this << band);
-    NS_ASSERT(!m_niChanges.contains(band));
-    NS_ASSERT(!m_firstPowers.contains(band));
-    NiChanges niChanges;
-    auto result = m_niChanges.insert({band, niChanges});
+    auto result = m_bandIndices.insert({band, m_bands.size()});
     NS_ASSERT(result.second);
+    m_bands.push_back(band);
+    m_niChanges.emplace_back();
     // Always have a zero power noise event in the list
-    AddNiChangeEvent(Time(0), NiChange(Watt_u{0}, nullptr), result.first);
-    m_firstPowers.insert({band, Watt_u{0}});
+    AddNiChangeEvent(Time(0), Watt_u{0}, nullptr, m_niChanges.back());
 }
 
 void
 InterferenceHelper::RemoveBand(const WifiSpectrumBandInfo& band)
 {
     NS_LOG_FUNCTION(this << band);
-    NS_ASSERT(m_firstPowers.count(band) != 0);
-    m_firstPowers.erase(band);
-    auto it = m_niChanges.find(band);
-    NS_ASSERT(it != std::end(m_niChanges));
-    it->second.clear();
-    m_niChanges.erase(it);
+    const auto index = GetBandIndex(band);
+    m_bands.erase(m_bands.begin() + index);
+    m_niChanges.erase(m_niChanges.begin() + index);
+    m_bandIndices.erase(band);
+    for (auto& [otherBand, otherIndex] : m_bandIndices)
+    {
+        if (otherIndex > index)
+        {
+            --otherIndex;
+        }
+    }
 }
 
 void
@@ -268,13 +246,13 @@ InterferenceHelper::UpdateBands(const std::vector<WifiSpectrumBandInfo>& bands,
 {
     NS_LOG_FUNCTION(this << freqRange);
     std::vector<WifiSpectrumBandInfo> bandsToRemove{};
-    for (auto it = m_niChanges.begin(); it != m_niChanges.end(); ++it)
+    for (const auto& trackedBand : m_bands)
     {
-        if (!IsBandInFrequencyRange(it->first, freqRange))
+        if (!IsBandInFrequencyRange(trackedBand, freqRange))
         {
             continue;
         }
-        const auto frequencies = it->first.frequencies;
+        const auto frequencies = trackedBand.frequencies;
         const auto found =
             std::find_if(bands.cbegin(), bands.cend(), [frequencies](const auto& item) {
                 return frequencies == item.frequencies;
@@ -282,7 +260,7 @@ InterferenceHelper::UpdateBands(const std::vector<WifiSpectrumBandInfo>& bands,
         if (!found)
         {
             // band does not belong to the new bands, erase it
-            bandsToRemove.emplace_back(it->first);
+            bandsToRemove.emplace_back(trackedBand);
         }
     }
     for (const auto& band : bandsToRemove)
@@ -303,12 +281,14 @@ void
 InterferenceHelper::SetNoiseFigure(double value)
 {
     m_noiseFigure = value;
+    ResetPayloadPerStates();
 }
 
 void
 InterferenceHelper::SetErrorRateModel(const Ptr<ErrorRateModel> rate)
 {
     m_errorRateModel = rate;
+    ResetPayloadPerStates();
 }
 
 Ptr<ErrorRateModel>
@@ -321,6 +301,16 @@ void
 InterferenceHelper::SetNumberOfReceiveAntennas(uint8_t rx)
 {
     m_numRxAntennas = rx;
+    ResetPayloadPerStates();
+}
+
+void
+InterferenceHelper::ResetPayloadPerStates()
+{
+    for (auto& nis : m_niChanges)
+    {
+        nis.payloadState.event = nullptr;
+    }
 }
 
 Time
@@ -328,14 +318,13 @@ InterferenceHelper::GetEnergyDuration(Watt_u energy, const WifiSpectrumBandInfo&
 {
     NS_LOG_FUNCTION(this << energy << band);
     Time now = Simulator::Now();
-    auto niIt = m_niChanges.find(band);
-    NS_ABORT_IF(niIt == m_niChanges.end());
-    auto i = GetPreviousPosition(now, niIt);
-    Time end = i->first;
-    for (; i != niIt->second.end(); ++i)
-    {
-        const auto noiseInterference = i->second.GetPower();
-        end = i->first;
+    const auto& nis = m_niChanges[GetBandIndex(band)];
+    auto i = GetPreviousPosition(now, nis);
+    Time end = nis.times[i];
+    for (; i < nis.times.size(); ++i)
+    {
+        const auto noiseInterference = nis.powers[i];
+        end = nis.times[i];
         if (noiseInterference < energy)
         {
             break;
@@ -350,34 +339,32 @@ InterferenceHelper::AppendEvent(Ptr<Event> event,
                                 bool isStartHePortionRxing)
 {
     NS_LOG_FUNCTION(this << event << freqRange << isStartHePortionRxing);
+    const auto rxing = (m_rxing.contains(freqRange) && m_rxing.at(freqRange));
     for (const auto& [band, power] : event->GetRxPowerPerBand())
     {
-        auto niIt = m_niChanges.find(band);
-        NS_ABORT_IF(niIt == m_niChanges.end());
-        Watt_u previousPowerStart{0.0};
-        Watt_u previousPowerEnd{0.0};
-        auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), niIt);
-        previousPowerStart = previousPowerPosition->second.GetPower();
-        previousPowerEnd = GetPreviousPosition(event->GetEndTime(), niIt)->second.GetPower();
-        if (const auto rxing = (m_rxing.contains(freqRange) && m_rxing.at(freqRange)); !rxing)
+        auto& nis = m_niChanges[GetBandIndex(band)];
+        const auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), nis);
+        const auto previousPowerStart = nis.powers[previousPowerPosition];
+        const auto previousPowerEnd = nis.powers[GetPreviousPosition(event->GetEndTime(), nis)];
+        if (!rxing)
         {
-            m_firstPowers.find(band)->second = previousPowerStart;
+            nis.firstPower = previousPowerStart;
             // Always leave the first zero power noise event in the list
-            niIt->second.erase(++(niIt->second.begin()), ++previousPowerPosition);
+            DropNiChanges(previousPowerPosition, nis);
         }
         else if (isStartHePortionRxing)
         {
-            // When the first HE portion is received, we need to set m_firstPowerPerBand
+            // When the first HE portion is received, we need to set the first power
             // so that it takes into account interferences that arrived between the start of the
             // HE TB PPDU transmission and the start of HE TB payload.
-            m_firstPowers.find(band)->second = previousPowerStart;
+            nis.firstPower = previousPowerStart;
         }
-        auto first =
-            AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
-        auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
+        const auto first =
+            AddNiChangeEvent(event->GetStartTime(), previousPowerStart, event, nis);
+        const auto last = AddNiChangeEvent(event->GetEndTime(), previousPowerEnd, event, nis);
         for (auto i = first; i != last; ++i)
         {
-            i->second.AddPower(power);
+            nis.powers[i] += power;
         }
     }
 }
@@ -389,14 +376,14 @@ InterferenceHelper::UpdateEvent(Ptr<Event> event, const RxPowerWattPerChannelBan
     // This is called for UL MU events, in order to scale power as long as UL MU PPDUs arrive
     for (const auto& [band, power] : rxPower)
     {
-        auto niIt = m_niChanges.find(band);
-        NS_ABORT_IF(niIt == m_niChanges.end());
-        auto first = GetPreviousPosition(event->GetStartTime(), niIt);
-        auto last = GetPreviousPosition(event->GetEndTime(), niIt);
+        auto& nis = m_niChanges[GetBandIndex(band)];
+        const auto first = GetPreviousPosition(event->GetStartTime(), nis);
+        const auto last = GetPreviousPosition(event->GetEndTime(), nis);
         for (auto i = first; i != last; ++i)
         {
-            i->second.AddPower(power);
+            nis.powers[i] += power;
         }
+        ++nis.version;
     }
     event->UpdateRxPowerW(rxPower);
 }
@@ -433,52 +420,64 @@ InterferenceHelper::CalculateSnr(Watt_u signal,
     return snr;
 }
 
+std::size_t
+InterferenceHelper::FindEventNiChanges(Ptr<const Event> event,
+                                       const WifiSpectrumBandInfo& band,
+                                       EventNiChanges& nis) const
+{
+    nis.band = GetBandIndex(band);
+    const auto& niChanges = m_niChanges[nis.band];
+    const auto begin = niChanges.times.cbegin();
+    const auto start = static_cast<std::size_t>(
+        std::lower_bound(begin + niChanges.first, niChanges.times.cend(), event->GetStartTime()) -
+        begin);
+    const auto size = niChanges.times.size();
+    NS_ABORT_IF(start == size || niChanges.times[start] != event->GetStartTime());
+    auto i = start;
+    for (; i < size && niChanges.events[i] != event; ++i)
+    {
+        ;
+    }
+    nis.start = i;
+    while (++i < size && niChanges.events[i] != event)
+    {
+        ;
+    }
+    NS_ABORT_IF(i == size);
+    nis.end = i;
+    return start;
+}
+
 Watt_u
 InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
-                                                NiChangesPerBand& nis,
-                                                const WifiSpectrumBandInfo& band) const
+                                                const WifiSpectrumBandInfo& band,
+                                                EventNiChanges& nis) const
 {
     NS_LOG_FUNCTION(this << band);
-    auto firstPower_it = m_firstPowers.find(band);
-    NS_ABORT_IF(firstPower_it == m_firstPowers.end());
-    auto noiseInterference = firstPower_it->second;
-    auto niIt = m_niChanges.find(band);
-    NS_ABORT_IF(niIt == m_niChanges.end());
+    const auto start = FindEventNiChanges(event, band, nis);
+    const auto& niChanges = m_niChanges[nis.band];
+    auto noiseInterference = niChanges.firstPower;
     const auto now = Simulator::Now();
-    auto it = niIt->second.find(event->GetStartTime());
+    const auto size = niChanges.times.size();
     const auto muMimoPower = (event->GetPpdu()->GetType() == WIFI_PPDU_TYPE_UL_MU)
                                  ? CalculateMuMimoPowerW(event, band)
                                  : Watt_u{0.0};
-    for (; it != niIt->second.end() && it->first < now; ++it)
+    for (auto i = start; i < size && niChanges.times[i] < now; ++i)
     {
-        if (IsSameMuMimoTransmission(event, it->second.GetEvent()) &&
-            (event != it->second.GetEvent()))
+        if (IsSameMuMimoTransmission(event, niChanges.events[i]) &&
+            (event != niChanges.events[i]))
         {
             // Do not calculate noiseInterferenceW if events belong to the same MU-MIMO transmission
             // unless this is the same event
             continue;
         }
-        noiseInterference = it->second.GetPower() - event->GetRxPower(band) - muMimoPower;
+        noiseInterference = niChanges.powers[i] - event->GetRxPower(band) - muMimoPower;
         if (std::abs(noiseInterference) < std::numeric_limits<double>::epsilon())
         {
             // fix some possible rounding issues with double values
             noiseInterference = Watt_u{0.0};
         }
     }
-    it = niIt->second.find(event->GetStartTime());
-    NS_ABORT_IF(it == niIt->second.end());
-    for (; it != niIt->second.end() && it->second.GetEvent() != event; ++it)
-    {
-        ;
-    }
-    NiChanges ni;
-    ni.emplace(event->GetStartTime(), NiChange(Watt_u{0}, event));
-    while (++it != niIt->second.end() && it->second.GetEvent() != event)
-    {
-        ni.insert(*it);
-    }
-    ni.emplace(event->GetEndTime(), NiChange(Watt_u{0}, event));
-    nis.insert({band, ni});
     NS_ASSERT_MSG(noiseInterference >= Watt_u{0.0},
                   "CalculateNoiseInterferenceW returns negative value " << noiseInterference);
     return noiseInterference;
@@ -488,33 +487,26 @@ Watt_u
 InterferenceHelper::CalculateMuMimoPowerW(Ptr<const Event> event,
                                           const WifiSpectrumBandInfo& band) const
 {
-    auto niIt = m_niChanges.find(band);
-    NS_ASSERT(niIt != m_niChanges.end());
-    auto it = niIt->second.begin();
-    ++it;
+    const auto& nis = m_niChanges[GetBandIndex(band)];
     Watt_u muMimoPower{0.0};
-    for (; it != niIt->second.end() && it->first < Simulator::Now(); ++it)
+    for (auto i = nis.first + 1; i < nis.times.size() && nis.times[i] < Simulator::Now(); ++i)
     {
-        if (IsSameMuMimoTransmission(event, it->second.GetEvent()))
+        if (IsSameMuMimoTransmission(event, nis.events[i]))
         {
-            auto hePpdu = DynamicCast<HePpdu>(it->second.GetEvent()->GetPpdu()->Copy());
+            auto hePpdu = DynamicCast<HePpdu>(nis.events[i]->GetPpdu()->Copy());
             NS_ASSERT(hePpdu);
             HePpdu::TxPsdFlag psdFlag = hePpdu->GetTxPsdFlag();
             if (psdFlag == HePpdu::PSD_HE_PORTION)
             {
                 const auto staId =
                     event->GetPpdu()->GetTxVector().GetHeMuUserInfoMap().cbegin()->first;
-                const auto otherStaId = it->second.GetEvent()
-                                            ->GetPpdu()
-                                            ->GetTxVector()
-                                            .GetHeMuUserInfoMap()
-                                            .cbegin()
-                                            ->first;
+                const auto otherStaId =
+                    nis.events[i]->GetPpdu()->GetTxVector().GetHeMuUserInfoMap().cbegin()->first;
                 if (staId == otherStaId)
                 {
                     break;
                 }
-                muMimoPower += it->second.GetEvent()->GetRxPower(band);
+                muMimoPower += nis.events[i]->GetRxPower(band);
             }
         }
     }
@@ -567,25 +559,25 @@ InterferenceHelper::CalculatePayloadChunkSuccessRate(double snir,
 double
 InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
                                         MHz_u channelWidth,
-                                        NiChangesPerBand* nis,
+                                        const EventNiChanges& nis,
                                         const WifiSpectrumBandInfo& band,
                                         uint16_t staId,
                                         std::pair<Time, Time> window) const
 {
     NS_LOG_FUNCTION(this << channelWidth << band << staId << window.first << window.second);
     double psr = 1.0; /* Packet Success Rate */
-    const auto& niIt = nis->find(band)->second;
-    auto j = niIt.cbegin();
-    auto previous = j->first;
+    const auto& niChanges = m_niChanges[nis.band];
+    auto j = nis.start;
+    auto previous = niChanges.times[j];
     Watt_u muMimoPower{0.0};
-    const auto payloadMode = event->GetPpdu()->GetTxVector().GetMode(staId);
-    auto phyPayloadStart = j->first;
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    const auto payloadMode = txVector.GetMode(staId);
+    auto phyPayloadStart = previous;
     if (event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_UL_MU &&
         event->GetPpdu()->GetType() !=
-            WIFI_PPDU_TYPE_DL_MU) // j->first corresponds to the start of the MU payload
+            WIFI_PPDU_TYPE_DL_MU) // j corresponds to the start of the MU payload
     {
-        phyPayloadStart = j->first + WifiPhy::CalculatePhyPreambleAndHeaderDuration(
-                                         event->GetPpdu()->GetTxVector());
+        phyPayloadStart = previous + WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector);
     }
     else
     {
@@ -593,24 +585,45 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
     }
     const auto windowStart = phyPayloadStart + window.first;
     const auto windowEnd = phyPayloadStart + window.second;
-    NS_ABORT_IF(!m_firstPowers.contains(band));
-    auto noiseInterference = m_firstPowers.at(band);
+    auto noiseInterference = niChanges.firstPower;
     auto power = event->GetRxPower(band);
-    while (++j != niIt.cend())
+
+    // The chunks preceding the state saved by the computation for a previous window of
+    // the same payload (e.g., the previous MPDU of an A-MPDU) end before the start of this
+    // window, hence resume from there if the NI changes have not been modified since then.
+    // This is not done for UL MU PPDUs, since the MU-MIMO power depends on the current time.
+    auto& state = niChanges.payloadState;
+    bool saveState = (event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_UL_MU);
+    if (saveState && state.event == event && state.staId == staId &&
+        state.channelWidth == channelWidth && state.version == niChanges.version &&
+        state.previous <= windowStart)
     {
-        Time current = j->first;
+        NS_LOG_DEBUG("Resume from NI change at " << state.previous);
+        j = state.index - 1;
+        previous = state.previous;
+        noiseInterference = state.noiseInterference;
+        muMimoPower = state.muMimoPower;
+    }
+
+    while (++j <= nis.end)
+    {
+        Time current = niChanges.times[j];
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
-        const auto snr = CalculateSnr(power,
-                                      noiseInterference,
-                                      channelWidth,
-                                      event->GetPpdu()->GetTxVector().GetNss(staId));
+        if (saveState && current >= windowEnd)
+        {
+            state = {event, staId, channelWidth, niChanges.version, j, previous,
+                     noiseInterference, muMimoPower};
+            saveState = false;
+        }
+        const auto snr =
+            CalculateSnr(power, noiseInterference, channelWidth, txVector.GetNss(staId));
         // Case 1: Both previous and current point to the windowed payload
         if (previous >= windowStart)
         {
             psr *= CalculatePayloadChunkSuccessRate(snr,
                                                     Min(windowEnd, current) - previous,
-                                                    event->GetPpdu()->GetTxVector(),
+                                                    txVector,
                                                     staId);
             NS_LOG_DEBUG("Both previous and current point to the windowed payload: mode="
                          << payloadMode << ", psr=" << psr);
@@ -620,20 +633,20 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
         {
             psr *= CalculatePayloadChunkSuccessRate(snr,
                                                     Min(windowEnd, current) - windowStart,
-                                                    event->GetPpdu()->GetTxVector(),
+                                                    txVector,
                                                     staId);
             NS_LOG_DEBUG(
                 "previous is before windowed payload and current is in the windowed payload: mode="
                 << payloadMode << ", psr=" << psr);
         }
-        noiseInterference = j->second.GetPower() - power;
-        if (IsSameMuMimoTransmission(event, j->second.GetEvent()))
+        noiseInterference = niChanges.powers[j] - power;
+        if (IsSameMuMimoTransmission(event, niChanges.events[j]))
         {
-            muMimoPower += j->second.GetEvent()->GetRxPower(band);
+            muMimoPower += niChanges.events[j]->GetRxPower(band);
             NS_LOG_DEBUG("PPDU belongs to same MU-MIMO transmission: muMimoPowerW=" << muMimoPower);
         }
         noiseInterference -= muMimoPower;
-        previous = j->first;
+        previous = current;
         if (previous > windowEnd)
         {
             NS_LOG_DEBUG("Stop: new previous=" << previous
@@ -645,18 +658,73 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
     return per;
 }
 
+std::vector<std::pair<Time, double>>
+InterferenceHelper::CalculatePayloadChunkSnrs(Ptr<Event> event,
+                                              MHz_u channelWidth,
+                                              const WifiSpectrumBandInfo& band,
+                                              uint16_t staId,
+                                              std::pair<Time, Time> window) const
+{
+    NS_LOG_FUNCTION(this << channelWidth << band << staId << window.first << window.second);
+    std::vector<std::pair<Time, double>> chunks;
+    // the noise and interference of the chunks are obtained while walking through the NI changes
+    // of the event, hence only the changes of the event are looked up
+    EventNiChanges nis;
+    FindEventNiChanges(event, band, nis);
+    const auto& niChanges = m_niChanges[nis.band];
+    auto j = nis.start;
+    auto previous = niChanges.times[j];
+    Watt_u muMimoPower{0.0};
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    auto phyPayloadStart = previous;
+    if (event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_UL_MU &&
+        event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_DL_MU)
+    {
+        phyPayloadStart = previous + WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector);
+    }
+    else
+    {
+        muMimoPower = CalculateMuMimoPowerW(event, band);
+    }
+    const auto windowStart = phyPayloadStart + window.first;
+    const auto windowEnd = phyPayloadStart + window.second;
+    auto noiseInterference = niChanges.firstPower;
+    const auto power = event->GetRxPower(band);
+
+    while (++j <= nis.end && previous < windowEnd)
+    {
+        const auto current = niChanges.times[j];
+        NS_ASSERT(current >= previous);
+        const auto duration = Min(current, windowEnd) - Max(windowStart, previous);
+        if (duration.IsStrictlyPositive())
+        {
+            chunks.emplace_back(
+                duration,
+                CalculateSnr(power, noiseInterference, channelWidth, txVector.GetNss(staId)));
+        }
+        noiseInterference = niChanges.powers[j] - power;
+        if (IsSameMuMimoTransmission(event, niChanges.events[j]))
+        {
+            muMimoPower += niChanges.events[j]->GetRxPower(band);
+        }
+        noiseInterference -= muMimoPower;
+        previous = current;
+    }
+    return chunks;
+}
+
 double
 InterferenceHelper::CalculatePhyHeaderSectionPsr(
     Ptr<const Event> event,
-    NiChangesPerBand* nis,
+    const EventNiChanges& nis,
     MHz_u channelWidth,
     const WifiSpectrumBandInfo& band,
     PhyEntity::PhyHeaderSections phyHeaderSections) const
 {
     NS_LOG_FUNCTION(this << band);
     double psr = 1.0; /* Packet Success Rate */
-    auto niIt = nis->find(band)->second;
-    auto j = niIt.begin();
+    const auto& niChanges = m_niChanges[nis.band];
+    auto j = nis.start;
 
     NS_ASSERT(!phyHeaderSections.empty());
     Time stopLastSection;
@@ -665,13 +733,12 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
         stopLastSection = Max(stopLastSection, section.second.first.second);
     }
 
-    auto previous = j->first;
-    NS_ABORT_IF(!m_firstPowers.contains(band));
-    auto noiseInterference = m_firstPowers.at(band);
+    auto previous = niChanges.times[j];
+    auto noiseInterference = niChanges.firstPower;
     const auto power = event->GetRxPower(band);
-    while (++j != niIt.end())
+    while (++j <= nis.end)
     {
-        auto current = j->first;
+        auto current = niChanges.times[j];
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
         const auto snr = CalculateSnr(power, noiseInterference, channelWidth, 1);
@@ -697,8 +764,8 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
                 }
             }
         }
-        noiseInterference = j->second.GetPower() - power;
-        previous = j->first;
+        noiseInterference = niChanges.powers[j] - power;
+        previous = current;
         if (previous > stopLastSection)
         {
             NS_LOG_DEBUG("Stop: new previous=" << previous << " after stop of last section="
@@ -711,19 +778,19 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
 
 double
 InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
-                                          NiChangesPerBand* nis,
+                                          const EventNiChanges& nis,
                                           MHz_u channelWidth,
                                           const WifiSpectrumBandInfo& band,
                                           WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    auto niIt = nis->find(band)->second;
     auto phyEntity =
         WifiPhy::GetStaticPhyEntity(event->GetPpdu()->GetTxVector().GetModulationClass());
 
     PhyEntity::PhyHeaderSections sections;
     for (const auto& section :
-         phyEntity->GetPhyHeaderSections(event->GetPpdu()->GetTxVector(), niIt.begin()->first))
+         phyEntity->GetPhyHeaderSections(event->GetPpdu()->GetTxVector(),
+                                         m_niChanges[nis.band].times[nis.start]))
     {
         if (section.first == header)
         {
@@ -748,8 +815,8 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
 {
     NS_LOG_FUNCTION(this << channelWidth << band << staId << relativeMpduStartStop.first
                          << relativeMpduStartStop.second);
-    NiChangesPerBand ni;
-    const auto noiseInterference = CalculateNoiseInterferenceW(event, ni, band);
+    EventNiChanges nis;
+    const auto noiseInterference = CalculateNoiseInterferenceW(event, band, nis);
     const auto snr = CalculateSnr(event->GetRxPower(band),
                                   noiseInterference,
                                   channelWidth,
@@ -759,19 +826,54 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
      * all SNIR changes in the SNIR vector.
      */
     const auto per =
-        CalculatePayloadPer(event, channelWidth, &ni, band, staId, relativeMpduStartStop);
+        CalculatePayloadPer(event, channelWidth, nis, band, staId, relativeMpduStartStop);
 
     return PhyEntity::SnrPer(snr, per);
 }
 
+PhyEntity::SnrPer
+InterferenceHelper::CalculatePayloadEffectiveSnrPer(
+    Ptr<Event> event,
+    MHz_u channelWidth,
+    const std::vector<WifiSpectrumBandInfo>& bands,
+    uint16_t staId,
+    Ptr<const WifiLinkToSystemMapping> mapping,
+    std::pair<Time, Time> relativeMpduStartStop) const
+{
+    NS_LOG_FUNCTION(this << channelWidth << bands.size() << staId << mapping
+                         << relativeMpduStartStop.first << relativeMpduStartStop.second);
+    NS_ASSERT(!bands.empty());
+    const auto bandWidth = channelWidth / bands.size();
+    std::vector<std::pair<double, double>> samples;
+    Time windowDuration;
+    for (const auto& band : bands)
+    {
+        windowDuration = Time();
+        for (const auto& [duration, snr] :
+             CalculatePayloadChunkSnrs(event, bandWidth, band, staId, relativeMpduStartStop))
+        {
+            samples.emplace_back(duration.GetSeconds(), snr);
+            windowDuration += duration;
+        }
+    }
+    const auto snr = mapping->GetEffectiveSnr(samples);
+    const auto per = 1.0 - CalculatePayloadChunkSuccessRate(snr,
+                                                            windowDuration,
+                                                            event->GetPpdu()->GetTxVector(),
+                                                            staId);
+    NS_LOG_DEBUG("Effective SNR=" << RatioToDb(snr) << "dB over " << bands.size()
+                                  << " subband(s), PER=" << per);
+    return PhyEntity::SnrPer(snr, per);
+}
+
 double
 InterferenceHelper::CalculateSnr(Ptr<Event> event,
                                  MHz_u channelWidth,
                                  uint8_t nss,
                                  const WifiSpectrumBandInfo& band) const
 {
-    NiChangesPerBand ni;
-    const auto noiseInterference = CalculateNoiseInterferenceW(event, ni, band);
+    EventNiChanges nis;
+    const auto noiseInterference = CalculateNoiseInterferenceW(event, band, nis);
     return CalculateSnr(event->GetRxPower(band), noiseInterference, channelWidth, nss);
 }
 
@@ -782,35 +884,71 @@ InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
                                              WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    NiChangesPerBand ni;
-    const auto noiseInterference = CalculateNoiseInterferenceW(event, ni, band);
+    EventNiChanges nis;
+    const auto noiseInterference = CalculateNoiseInterferenceW(event, band, nis);
     const auto snr = CalculateSnr(event->GetRxPower(band), noiseInterference, channelWidth, 1);
 
     /* calculate the SNIR at the start of the PHY header and accumulate
      * all SNIR changes in the SNIR vector.
      */
-    const auto per = CalculatePhyHeaderPer(event, &ni, channelWidth, band, header);
+    const auto per = CalculatePhyHeaderPer(event, nis, channelWidth, band, header);
 
     return PhyEntity::SnrPer(snr, per);
 }
 
-InterferenceHelper::NiChanges::iterator
-InterferenceHelper::GetNextPosition(Time moment, NiChangesPerBand::iterator niIt) const
+std::size_t
+InterferenceHelper::GetNextPosition(Time moment, const NiChanges& nis) const
 {
-    return niIt->second.upper_bound(moment);
+    return std::upper_bound(nis.times.cbegin() + nis.first, nis.times.cend(), moment) -
+           nis.times.cbegin();
 }
 
-InterferenceHelper::NiChanges::iterator
-InterferenceHelper::GetPreviousPosition(Time moment, NiChangesPerBand::iterator niIt) const
+std::size_t
+InterferenceHelper::GetPreviousPosition(Time moment, const NiChanges& nis) const
 {
     // This is safe since there is always an NiChange at time 0, before moment.
-    return std::prev(GetNextPosition(moment, niIt));
+    return GetNextPosition(moment, nis) - 1;
+}
+
+std::size_t
+InterferenceHelper::AddNiChangeEvent(Time moment, Watt_u power, Ptr<Event> event, NiChanges& nis)
+{
+    const auto position = GetNextPosition(moment, nis);
+    nis.times.insert(nis.times.begin() + position, moment);
+    nis.powers.insert(nis.powers.begin() + position, power);
+    nis.events.insert(nis.events.begin() + position, event);
+    ++nis.version;
+    return position;
 }
 
-InterferenceHelper::NiChanges::iterator
-InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, NiChangesPerBand::iterator niIt)
+void
+InterferenceHelper::DropNiChanges(std::size_t last, NiChanges& nis)
 {
-    return niIt->second.insert(GetNextPosition(moment, niIt), {moment, change});
+    if (last == nis.first)
+    {
+        return;
+    }
+    // move the initial zero power change to the last dropped change, so that dropping
+    // does not shift the following changes, and release the events of the dropped changes
+    for (auto i = nis.first; i < last; ++i)
+    {
+        nis.events[i] = nullptr;
+    }
+    nis.times[last] = Time(0);
+    nis.powers[last] = Watt_u{0};
+    nis.events[last] = nullptr;
+    nis.first = last;
+    ++nis.version;
+
+    // compact the arrays when the released changes make up at least half of them
+    if (nis.first >= NI_CHANGES_COMPACTION_THRESHOLD && 2 * nis.first >= nis.times.size())
+    {
+        NS_LOG_DEBUG("Compact " << nis.first << " out of " << nis.times.size() << " NI changes");
+        nis.times.erase(nis.times.begin(), nis.times.begin() + nis.first);
+        nis.powers.erase(nis.powers.begin(), nis.powers.begin() + nis.first);
+        nis.events.erase(nis.events.begin(), nis.events.begin() + nis.first);
+        nis.first = 0;
+    }
 }
 
 void
@@ -825,16 +963,17 @@ InterferenceHelper::NotifyRxEnd(Time endTime, const FrequencyRange& freqRange)
 {
     NS_LOG_FUNCTION(this << endTime << freqRange);
     m_rxing.at(freqRange) = false;
-    // Update m_firstPowers for frame capture
-    for (auto niIt = m_niChanges.begin(); niIt != m_niChanges.end(); ++niIt)
+    // Update first powers for frame capture
+    for (std::size_t band = 0; band < m_bands.size(); ++band)
     {
-        if (!IsBandInFrequencyRange(niIt->first, freqRange))
+        if (!IsBandInFrequencyRange(m_bands[band], freqRange))
         {
             continue;
         }
-        NS_ASSERT(niIt->second.size() > 1);
-        auto it = std::prev(GetPreviousPosition(endTime, niIt));
-        m_firstPowers.find(niIt->first)->second = it->second.GetPower();
+        auto& nis = m_niChanges[band];
+        NS_ASSERT(nis.times.size() > nis.first + 1);
+        nis.firstPower = nis.powers[GetPreviousPosition(endTime, nis) - 1];
+        ++nis.version;
     }
 }
 
@@ -19,6 +19,7 @@ namespace ns3
 class WifiPpdu;
 class WifiPsdu;
 class ErrorRateModel;
+class WifiLinkToSystemMapping;
 
 /**
  * @ingroup wifi
@@ -246,6 +247,29 @@ class InterferenceHelper : public Object
                                              const WifiSpectrumBandInfo& band,
                                              uint16_t staId,
                                              std::pair<Time, Time> relativeMpduStartStop) const;
+    /**
+     * Calculate the effective SNIR over the given time window of the payload and over
+     * the given subbands, and the error rate of the window at that SNIR. This is used by
+     * the abstracted PHY, which decides the reception of each MPDU from a single draw.
+     *
+     * @param event the event corresponding to the first time the corresponding PPDU arrives
+     * @param channelWidth the channel width used to transmit the PSDU
+     * @param bands the subbands (of equal width) covering the band used by the PSDU
+     * @param staId the station ID of the PSDU (only used for MU)
+     * @param mapping the mapping of the SNIR samples to the effective SNIR
+     * @param relativeMpduStartStop the time window (pair of start and end times) of PHY payload to
+     * focus on
+     *
+     * @return struct of effective SNR and PER (with PER being evaluated over the provided time
+     * window)
+     */
+    PhyEntity::SnrPer CalculatePayloadEffectiveSnrPer(
+        Ptr<Event> event,
+        MHz_u channelWidth,
+        const std::vector<WifiSpectrumBandInfo>& bands,
+        uint16_t staId,
+        Ptr<const WifiLinkToSystemMapping> mapping,
+        std::pair<Time, Time> relativeMpduStartStop) const;
     /**
      * Calculate the SNIR for the event (starting from now until the event end).
      *
@@ -353,59 +377,42 @@ class InterferenceHelper : public Object
         m_rxing; //!< flag whether it is in receiving state for a given FrequencyRange
 
     /**
-     * Noise and Interference (thus Ni) event.
+     * State of the computation of the PER of the payload of an event, saved at the NI change
+     * following the end of the last computed window so that the computation for the next
+     * window (e.g., the next MPDU of an A-MPDU) resumes from there.
      */
-    class NiChange
+    struct PayloadPerState
     {
-      public:
-        /**
-         * Create a NiChange at the given time and the amount of NI change.
-         *
-         * @param power the power
-         * @param event causes this NI change
-         */
-        NiChange(Watt_u power, Ptr<Event> event);
-        ~NiChange();
-        /**
-         * Return the power
-         *
-         * @return the power
-         */
-        Watt_u GetPower() const;
-        /**
-         * Add a given amount of power.
-         *
-         * @param power the power to be added to the existing value
-         */
-        void AddPower(Watt_u power);
-        /**
-         * Return the event causes the corresponding NI change
-         *
-         * @return the event
-         */
-        Ptr<Event> GetEvent() const;
-
-      private:
-        Watt_u m_power;     ///< power
-        Ptr<Event> m_event; ///< event
+        Ptr<const Event> event;    //!< the event (null if the state is not valid)
+        uint16_t staId{0};         //!< the station ID of the PSDU
+        MHz_u channelWidth{0};     //!< the channel width used to transmit the PSDU
+        uint64_t version{0};       //!< the version of the NI changes the state refers to
+        std::size_t index{0};      //!< the index of the next NI change to process
+        Time previous;             //!< the time of the previous NI change
+        Watt_u noiseInterference;  //!< the noise and interference power since previous
+        Watt_u muMimoPower;        //!< the power of the same MU-MIMO transmission
     };
 
     /**
-     * typedef for a multimap of NiChange
-     */
-    using NiChanges = std::multimap<Time, NiChange>;
-
-    /**
-     * Map of NiChanges per band
+     * Noise and Interference (thus Ni) changes of a band, i.e., the total received
+     * power from each change on, stored as time-sorted arrays. The changes that are
+     * no longer needed are dropped by moving the initial zero power change forward
+     * (the slots before it are released) and the arrays are compacted when
+     * the released slots make up a large part of them.
      */
-    using NiChangesPerBand = std::map<WifiSpectrumBandInfo, NiChanges>;
-
-    /**
-     * Map of first power per band
-     */
-    using FirstPowerPerBand = std::map<WifiSpectrumBandInfo, Watt_u>;
+    struct NiChanges
+    {
+        std::vector<Time> times;        //!< the time of each change
+        std::vector<Watt_u> powers;     //!< the total received power from each change on
+        std::vector<Ptr<Event>> events; //!< the event causing each change
+        std::size_t first{0};           //!< the index of the initial zero power change
+        Watt_u firstPower{0};           //!< the power at the start of the current reception
+        uint64_t version{0};            //!< incremented whenever the changes are modified
+        mutable PayloadPerState payloadState; //!< state of the last payload PER computation
+    };
 
-    NiChangesPerBand m_niChanges; //!< NI Changes for each band
+    std::vector<WifiSpectrumBandInfo> m_bands; //!< the tracked bands
+    std::vector<NiChanges> m_niChanges;        //!< NI changes of each tracked band
 
   private:
     /**
@@ -416,6 +423,12 @@ class InterferenceHelper : public Object
      */
     bool HasBand(const WifiSpectrumBandInfo& band) const;
 
+    /**
+     * @param band a tracked band
+     * @return the index of the band in m_bands and m_niChanges
+     */
+    std::size_t GetBandIndex(const WifiSpectrumBandInfo& band) const;
+
     /**
      * Check whether a given band belongs to a given frequency range.
      *
@@ -436,18 +449,39 @@ class InterferenceHelper : public Object
      */
     void AppendEvent(Ptr<Event> event, const FrequencyRange& freqRange, bool isStartHePortionRxing);
 
+    /// The NI changes of a band from the start to the end of an event
+    struct EventNiChanges
+    {
+        std::size_t band;  //!< the index of the band
+        std::size_t start; //!< the index of the NI change at the start of the event
+        std::size_t end;   //!< the index of the NI change at the end of the event
+    };
+
+    /**
+     * Find the NI changes at the start and at the end of an event.
+     *
+     * @param event the event
+     * @param band the band
+     * @param nis the NI changes of the band during the event
+     *
+     * @return the index of the first NI change at the start time of the event
+     */
+    std::size_t FindEventNiChanges(Ptr<const Event> event,
+                                   const WifiSpectrumBandInfo& band,
+                                   EventNiChanges& nis) const;
+
     /**
      * Calculate noise and interference power.
      *
      * @param event the event
-     * @param nis the NiChanges
      * @param band the band
+     * @param nis the NI changes of the band during the event
      *
      * @return noise and interference power
      */
     Watt_u CalculateNoiseInterferenceW(Ptr<Event> event,
-                                       NiChangesPerBand& nis,
-                                       const WifiSpectrumBandInfo& band) const;
+                                       const WifiSpectrumBandInfo& band,
+                                       EventNiChanges& nis) const;
 
     /**
      * Calculate power of all other events preceding a given event that belong to the same MU-MIMO
@@ -468,7 +502,7 @@ class InterferenceHelper : public Object
      *
      * @param event the event
      * @param channelWidth the channel width used to transmit the PSDU
-     * @param nis the NiChanges
+     * @param nis the NI changes of the band during the event
      * @param band identify the band used by the PSDU
      * @param staId the station ID of the PSDU (only used for MU)
      * @param window time window (pair of start and end times) of PHY payload to focus on
@@ -477,16 +511,34 @@ class InterferenceHelper : public Object
      */
     double CalculatePayloadPer(Ptr<const Event> event,
                                MHz_u channelWidth,
-                               NiChangesPerBand* nis,
+                               const EventNiChanges& nis,
                                const WifiSpectrumBandInfo& band,
                                uint16_t staId,
                                std::pair<Time, Time> window) const;
+    /**
+     * Calculate the SNIR of each chunk of the given time window of the PHY payload, i.e.,
+     * of each interval of the window over which the noise plus interference is constant.
+     *
+     * @param event the event
+     * @param channelWidth the width of the band
+     * @param band the band
+     * @param staId the station ID of the PSDU (only used for MU)
+     * @param window time window (pair of start and end times) of PHY payload to focus on
+     *
+     * @return the duration and the SNIR (linear scale) of each chunk
+     */
+    std::vector<std::pair<Time, double>> CalculatePayloadChunkSnrs(
+        Ptr<Event> event,
+        MHz_u channelWidth,
+        const WifiSpectrumBandInfo& band,
+        uint16_t staId,
+        std::pair<Time, Time> window) const;
     /**
      * Calculate the error rate of the PHY header. The PHY header
      * can be divided into multiple chunks (e.g. due to interference from other transmissions).
      *
      * @param event the event
-     * @param nis the NiChanges
+     * @param nis the NI changes of the band during the event
      * @param channelWidth the channel width for header measurement
      * @param band the band
      * @param header the PHY header to consider
@@ -494,7 +546,7 @@ class InterferenceHelper : public Object
      * @return the error rate of the HT PHY header
      */
     double CalculatePhyHeaderPer(Ptr<const Event> event,
-                                 NiChangesPerBand* nis,
+                                 const EventNiChanges& nis,
                                  MHz_u channelWidth,
                                  const WifiSpectrumBandInfo& band,
                                  WifiPpduField header) const;
@@ -502,7 +554,7 @@ class InterferenceHelper : public Object
      * Calculate the success rate of the PHY header sections for the provided event.
      *
      * @param event the event
-     * @param nis the NiChanges
+     * @param nis the NI changes of the band during the event
      * @param channelWidth the channel width for header measurement
      * @param band the band
      * @param phyHeaderSections the map of PHY header sections (\see PhyEntity::PhyHeaderSections)
@@ -510,45 +562,58 @@ class InterferenceHelper : public Object
      * @return the success rate of the PHY header sections
      */
     double CalculatePhyHeaderSectionPsr(Ptr<const Event> event,
-                                        NiChangesPerBand* nis,
+                                        const EventNiChanges& nis,
                                         MHz_u channelWidth,
                                         const WifiSpectrumBandInfo& band,
                                         PhyEntity::PhyHeaderSections phyHeaderSections) const;
 
+    /**
+     * Invalidate the saved states of the payload PER computations.
+     */
+    void ResetPayloadPerStates();
+
     double m_noiseFigure;                 //!< noise figure (linear)
     Ptr<ErrorRateModel> m_errorRateModel; //!< error rate model
-    uint8_t m_numRxAntennas;         //!< the number of RX antennas in the corresponding receiver
-    FirstPowerPerBand m_firstPowers; //!< first power of each band
+    uint8_t m_numRxAntennas; //!< the number of RX antennas in the corresponding receiver
+    std::map<WifiSpectrumBandInfo, std::size_t> m_bandIndices; //!< index of each tracked band
 
     /**
-     * Returns an iterator to the first NiChange that is later than moment
+     * Returns the index of the first NiChange that is later than moment
      *
      * @param moment time to check from
-     * @param niIt iterator of the band to check
-     * @returns an iterator to the list of NiChanges
+     * @param nis the NI changes of the band to check
+     * @returns the index of the NiChange
      */
-    NiChanges::iterator GetNextPosition(Time moment, NiChangesPerBand::iterator niIt) const;
+    std::size_t GetNextPosition(Time moment, const NiChanges& nis) const;
     /**
-     * Returns an iterator to the last NiChange that is before than moment
+     * Returns the index of the last NiChange that is before than moment
      *
      * @param moment time to check from
-     * @param niIt iterator of the band to check
-     * @returns an iterator to the list of NiChanges
+     * @param nis the NI changes of the band to check
+     * @returns the index of the NiChange
      */
-    NiChanges::iterator GetPreviousPosition(Time moment, NiChangesPerBand::iterator niIt) const;
+    std::size_t GetPreviousPosition(Time moment, const NiChanges& nis) const;
 
     /**
      * Add NiChange to the list at the appropriate position and
-     * return the iterator of the new event.
+     * return the index of the new change.
      *
-     * @param moment time to check from
-     * @param change the NiChange to add
-     * @param niIt iterator of the band to check
-     * @returns the iterator of the new event
+     * @param moment time of the change
+     * @param power the total received power from the change on
+     * @param event the event causing the change
+     * @param nis the NI changes of the band
+     * @returns the index of the new change
+     */
+    std::size_t AddNiChangeEvent(Time moment, Watt_u power, Ptr<Event> event, NiChanges& nis);
+
+    /**
+     * Drop the NI changes following the initial zero power change up to the given one
+     * (included).
+     *
+     * @param last the index of the last NI change to drop
+     * @param nis the NI changes of the band
      */
-    NiChanges::iterator AddNiChangeEvent(Time moment,
-                                         NiChange change,
-                                         NiChangesPerBand::iterator niIt);
+    void DropNiChanges(std::size_t last, NiChanges& nis);
 
     /**
      * Return whether another event is a MU-MIMO event that belongs to the same transmission and to
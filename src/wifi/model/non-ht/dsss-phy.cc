@@ -213,10 +213,7 @@ PhyEntity::PhyFieldRxStatus
 DsssPhy::EndReceiveHeader(Ptr<Event> event)
 {
     NS_LOG_FUNCTION(this << *event);
-    SnrPer snrPer = GetPhyHeaderSnrPer(WIFI_PPDU_FIELD_NON_HT_HEADER, event);
-    NS_LOG_DEBUG("Long/Short PHY header: SNR(dB)=" << RatioToDb(snrPer.snr)
-                                                   << ", PER=" << snrPer.per);
-    PhyFieldRxStatus status(GetRandomValue() > snrPer.per);
+    PhyFieldRxStatus status(IsPhyHeaderReceived(WIFI_PPDU_FIELD_NON_HT_HEADER, event));
     if (status.isSuccess)
     {
         NS_LOG_DEBUG("Received long/short PHY header");
@@ -256,7 +253,7 @@ DsssPhy::GetMeasurementChannelWidth(const Ptr<const WifiPpdu> ppdu) const
     return ppdu ? GetRxChannelWidth(ppdu->GetTxVector()) : MHz_u{22};
 }
 
-Ptr<SpectrumValue>
+Ptr<const SpectrumValue>
 DsssPhy::GetTxPowerSpectralDensity(Watt_u txPower, Ptr<const WifiPpdu> ppdu) const
 {
     const auto& centerFrequencies = ppdu->GetTxCenterFreqs();
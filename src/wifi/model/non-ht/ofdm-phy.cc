@@ -310,9 +310,7 @@ PhyEntity::PhyFieldRxStatus
 OfdmPhy::EndReceiveHeader(Ptr<Event> event)
 {
     NS_LOG_FUNCTION(this << *event);
-    SnrPer snrPer = GetPhyHeaderSnrPer(WIFI_PPDU_FIELD_NON_HT_HEADER, event);
-    NS_LOG_DEBUG("L-SIG: SNR(dB)=" << RatioToDb(snrPer.snr) << ", PER=" << snrPer.per);
-    PhyFieldRxStatus status(GetRandomValue() > snrPer.per);
+    PhyFieldRxStatus status(IsPhyHeaderReceived(WIFI_PPDU_FIELD_NON_HT_HEADER, event));
     if (status.isSuccess)
     {
         NS_LOG_DEBUG("Received non-HT PHY header");
@@ -353,7 +351,7 @@ OfdmPhy::IsAllConfigSupported(WifiPpduField /* field */, Ptr<const WifiPpdu> ppd
     return IsConfigSupported(ppdu);
 }
 
-Ptr<SpectrumValue>
+Ptr<const SpectrumValue>
 OfdmPhy::GetTxPowerSpectralDensity(Watt_u txPower, Ptr<const WifiPpdu> ppdu) const
 {
     const auto& centerFrequencies = ppdu->GetTxCenterFreqs();
@@ -361,7 +359,7 @@ OfdmPhy::GetTxPowerSpectralDensity(Watt_u txPower, Ptr<const WifiPpdu> ppdu) con
     const auto channelWidth = txVector.GetChannelWidth();
     NS_LOG_FUNCTION(this << centerFrequencies.front() << channelWidth << txPower);
     const auto& txMaskRejectionParams = GetTxMaskRejectionParams();
-    Ptr<SpectrumValue> v;
+    Ptr<const SpectrumValue> v;
     if (txVector.IsNonHtDuplicate())
     {
         v = WifiSpectrumValueHelper::CreateDuplicated20MhzTxPowerSpectralDensity(
@@ -313,8 +313,8 @@ class OfdmPhy : public PhyEntity
 
   protected:
     PhyFieldRxStatus DoEndReceiveField(WifiPpduField field, Ptr<Event> event) override;
-    Ptr<SpectrumValue> GetTxPowerSpectralDensity(Watt_u txPower,
-                                                 Ptr<const WifiPpdu> ppdu) const override;
+    Ptr<const SpectrumValue> GetTxPowerSpectralDensity(Watt_u txPower,
+                                                       Ptr<const WifiPpdu> ppdu) const override;
     uint32_t GetMaxPsduSize() const override;
     MHz_u GetMeasurementChannelWidth(const Ptr<const WifiPpdu> ppdu) const override;
 
@@ -15,6 +15,7 @@
 #include "interference-helper.h"
 #include "preamble-detection-model.h"
 #include "spectrum-wifi-phy.h"
+#include "wifi-link-to-system-mapping.h"
 #include "wifi-psdu.h"
 #include "wifi-spectrum-signal-parameters.h"
 #include "wifi-utils.h"
@@ -268,6 +269,19 @@ PhyEntity::GetPhyHeaderSnrPer(WifiPpduField field, Ptr<Event> event) const
         field);
 }
 
+bool
+PhyEntity::IsPhyHeaderReceived(WifiPpduField field, Ptr<Event> event) const
+{
+    if (m_wifiPhy->m_linkToSystemMapping)
+    {
+        // the abstracted PHY only decides the reception of the payload
+        return true;
+    }
+    const auto snrPer = GetPhyHeaderSnrPer(field, event);
+    NS_LOG_DEBUG(field << ": SNR(dB)=" << RatioToDb(snrPer.snr) << ", PER=" << snrPer.per);
+    return GetRandomValue() > snrPer.per;
+}
+
 void
 PhyEntity::StartReceiveField(WifiPpduField field, Ptr<Event> event)
 {
@@ -707,6 +721,26 @@ PhyEntity::EndOfMpdu(Ptr<Event> event,
     }
 }
 
+std::vector<WifiSpectrumBandInfo>
+PhyEntity::GetAbstractedPhySubbands(const WifiTxVector& txVector, uint16_t staId) const
+{
+    const auto [channelWidth, band] = GetChannelWidthAndBand(txVector, staId);
+    if (txVector.IsMu() || channelWidth < MHz_u{40} ||
+        static_cast<uint16_t>(m_wifiPhy->GetChannelWidth()) % 20 != 0)
+    {
+        return {band};
+    }
+    const auto nSubbands = Count20MHzSubchannels(channelWidth);
+    const auto primaryIndex =
+        m_wifiPhy->GetOperatingChannel().GetPrimaryChannelIndex(channelWidth);
+    std::vector<WifiSpectrumBandInfo> subbands;
+    for (std::size_t i = 0; i < nSubbands; ++i)
+    {
+        subbands.push_back(m_wifiPhy->GetBand(MHz_u{20}, primaryIndex * nSubbands + i));
+    }
+    return subbands;
+}
+
 void
 PhyEntity::EndReceivePayload(Ptr<Event> event)
 {
@@ -808,13 +842,23 @@ PhyEntity::GetReceptionStatus(Ptr<WifiMpdu> mpdu,
                               Time mpduDuration)
 {
     NS_LOG_FUNCTION(this << *mpdu << *event << staId << relativeMpduStart << mpduDuration);
-    const auto channelWidthAndBand = GetChannelWidthAndBand(event->GetPpdu()->GetTxVector(), staId);
-    SnrPer snrPer = m_wifiPhy->m_interference->CalculatePayloadSnrPer(
-        event,
-        channelWidthAndBand.first,
-        channelWidthAndBand.second,
-        staId,
-        {relativeMpduStart, relativeMpduStart + mpduDuration});
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    const auto channelWidthAndBand = GetChannelWidthAndBand(txVector, staId);
+    const std::pair window{relativeMpduStart, relativeMpduStart + mpduDuration};
+    SnrPer snrPer =
+        m_wifiPhy->m_linkToSystemMapping
+            ? m_wifiPhy->m_interference->CalculatePayloadEffectiveSnrPer(
+                  event,
+                  channelWidthAndBand.first,
+                  GetAbstractedPhySubbands(txVector, staId),
+                  staId,
+                  m_wifiPhy->m_linkToSystemMapping,
+                  window)
+            : m_wifiPhy->m_interference->CalculatePayloadSnrPer(event,
+                                                                channelWidthAndBand.first,
+                                                                channelWidthAndBand.second,
+                                                                staId,
+                                                                window);
 
     WifiMode mode = event->GetPpdu()->GetTxVector().GetMode(staId);
     NS_LOG_DEBUG("rate=" << (mode.GetDataRate(event->GetPpdu()->GetTxVector(), staId))
@@ -1385,14 +1429,16 @@ void
 PhyEntity::Transmit(Time txDuration,
                     Ptr<const WifiPpdu> ppdu,
                     dBm_u txPower,
-                    Ptr<SpectrumValue> txPowerSpectrum,
+                    Ptr<const SpectrumValue> txPowerSpectrum,
                     const std::string& type)
 {
     NS_LOG_FUNCTION(this << txDuration << ppdu << txPower << type);
     NS_LOG_DEBUG("Start " << type << ": signal power before antenna gain=" << txPower << "dBm");
     auto txParams = Create<WifiSpectrumSignalParameters>();
     txParams->duration = txDuration;
-    txParams->psd = txPowerSpectrum;
+    // the transmit PSD may be shared with other transmissions, which is fine since the
+    // spectrum channels copy it before applying the propagation loss
+    txParams->psd = ConstCast<SpectrumValue>(txPowerSpectrum);
     txParams->ppdu = ppdu;
     NS_LOG_DEBUG("Starting " << type << " with power " << txPower << " dBm on channel "
                              << +m_wifiPhy->GetChannelNumber() << " for "
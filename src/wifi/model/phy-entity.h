@@ -477,7 +477,7 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
     void Transmit(Time txDuration,
                   Ptr<const WifiPpdu> ppdu,
                   dBm_u txPower,
-                  Ptr<SpectrumValue> txPowerSpectrum,
+                  Ptr<const SpectrumValue> txPowerSpectrum,
                   const std::string& type);
 
     /**
@@ -708,6 +708,17 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
      */
     void ScheduleEndOfMpdus(Ptr<Event> event);
 
+    /**
+     * Get the subbands over which the SINR samples of the abstracted PHY are taken,
+     * i.e., the 20 MHz subchannels of the band used by the PSDU or the RU for MU PPDUs.
+     *
+     * @param txVector the transmission parameters
+     * @param staId the station ID of the PSDU
+     * @return the subbands
+     */
+    std::vector<WifiSpectrumBandInfo> GetAbstractedPhySubbands(const WifiTxVector& txVector,
+                                                               uint16_t staId) const;
+
     /**
      * Perform amendment-specific actions when the payload is successfully received.
      *
@@ -775,6 +786,18 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
      * @return the SNR and PER
      */
     SnrPer GetPhyHeaderSnrPer(WifiPpduField field, Ptr<Event> event) const;
+    /**
+     * Determine whether a field of the PHY header is successfully received, by drawing
+     * a random value against the PER of the field. The abstracted PHY only decides the
+     * reception of the payload, hence it considers the PHY header fields as received
+     * without computing their SNR nor drawing a random value.
+     * Wrapper used by child classes.
+     *
+     * @param field the PPDU field
+     * @param event the event holding incoming PPDU's information
+     * @return true if the field is successfully received
+     */
+    bool IsPhyHeaderReceived(WifiPpduField field, Ptr<Event> event) const;
     /**
      * Obtain the received power for a given band.
      * Wrapper used by child classes.
@@ -853,8 +876,8 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
      * This is a helper function to create the right TX PSD corresponding
      * to the amendment of this PHY.
      */
-    virtual Ptr<SpectrumValue> GetTxPowerSpectralDensity(Watt_u txPower,
-                                                         Ptr<const WifiPpdu> ppdu) const = 0;
+    virtual Ptr<const SpectrumValue> GetTxPowerSpectralDensity(Watt_u txPower,
+                                                               Ptr<const WifiPpdu> ppdu) const = 0;
 
     /**
      * Fire the trace indicating that the PHY is starting to receive the payload of a PPDU.
@@ -98,6 +98,14 @@ struct MinstrelHtWifiRemoteStation : MinstrelWifiRemoteStation
     McsGroupData m_groupsTable; //!< Table of groups with stats.
     bool m_isHt;                //!< If the station is HT capable.
 
+    uint32_t m_numStatsUpdates;                 //!< Number of statistics updates.
+    std::vector<std::size_t> m_supportedGroups; //!< IDs of the groups supported by the station.
+    std::vector<uint16_t> m_sampledRates;       //!< Rates attempted since the last stats update.
+    std::vector<uint16_t> m_prevSampledRates;   //!< Rates attempted in the previous interval.
+    std::vector<uint16_t> m_retryUpdatedRates;  //!< Rates whose retry count has been updated.
+    std::vector<uint16_t> m_ratesWithTp;        //!< Sorted indexes of the rates with non-zero
+                                                //!< throughput.
+
     std::ofstream m_statsFile; //!< File where statistics table is written.
 };
 
@@ -458,6 +466,7 @@ MinstrelHtWifiManager::DoCreateStation() const
     station->m_avgAmpduLen = 1;
     station->m_ampduLen = 0;
     station->m_ampduPacketCount = 0;
+    station->m_numStatsUpdates = 0;
 
     // Use the variable in the station to indicate whether the device supports HT.
     // When correct information available it will be checked.
@@ -574,11 +583,7 @@ MinstrelHtWifiManager::DoReportDataFailed(WifiRemoteStation* st)
     }
     else if (station->m_longRetry < CountRetries(station))
     {
-        const auto rateId = GetRateId(station->m_txrate);
-        const auto groupId = GetGroupId(station->m_txrate);
-        station->m_groupsTable[groupId]
-            .m_ratesTable[rateId]
-            .numRateAttempt++; // Increment the attempts counter for the rate used.
+        AddRateAttempts(station, 0, 1); // Increment the attempts counter for the rate used.
         UpdateRate(station);
     }
 }
@@ -639,8 +644,7 @@ MinstrelHtWifiManager::DoReportDataOk(WifiRemoteStation* st,
             << ", success = " << station->m_groupsTable[groupId].m_ratesTable[rateId].numRateSuccess
             << " (before update).");
 
-        station->m_groupsTable[groupId].m_ratesTable[rateId].numRateSuccess++;
-        station->m_groupsTable[groupId].m_ratesTable[rateId].numRateAttempt++;
+        AddRateAttempts(station, 1, 0);
 
         UpdatePacketCounters(station, 1, 0);
 
@@ -746,11 +750,7 @@ MinstrelHtWifiManager::DoReportAmpduTxStatus(WifiRemoteStation* st,
 
     UpdatePacketCounters(station, nSuccessfulMpdus, nFailedMpdus);
 
-    const auto rateId = GetRateId(station->m_txrate);
-    const auto groupId = GetGroupId(station->m_txrate);
-    station->m_groupsTable[groupId].m_ratesTable[rateId].numRateSuccess += nSuccessfulMpdus;
-    station->m_groupsTable[groupId].m_ratesTable[rateId].numRateAttempt +=
-        nSuccessfulMpdus + nFailedMpdus;
+    AddRateAttempts(station, nSuccessfulMpdus, nFailedMpdus);
 
     if (nSuccessfulMpdus == 0 && station->m_longRetry < CountRetries(station))
     {
@@ -1328,7 +1328,10 @@ MinstrelHtWifiManager::FindRate(MinstrelHtWifiRemoteStation* station)
                 else
                 {
                     station->m_numSamplesSlow++;
-                    if (sampleRateInfo.numSamplesSkipped >= 20 && station->m_numSamplesSlow <= 2)
+                    // number of statistics updates without attempts at the sample rate
+                    const auto numSamplesSkipped =
+                        station->m_numStatsUpdates - sampleRateInfo.lastSampledUpdate;
+                    if (numSamplesSkipped >= 20 && station->m_numSamplesSlow <= 2)
                     {
                         /// Set flag that we are currently sampling.
                         station->m_isSampling = true;
@@ -1355,18 +1358,35 @@ MinstrelHtWifiManager::FindRate(MinstrelHtWifiRemoteStation* station)
     return station->m_maxTpRate;
 }
 
+void
+MinstrelHtWifiManager::AddRateAttempts(MinstrelHtWifiRemoteStation* station,
+                                       uint16_t nSuccessfulMpdus,
+                                       uint16_t nFailedMpdus)
+{
+    NS_LOG_FUNCTION(this << station << nSuccessfulMpdus << nFailedMpdus);
+
+    auto& rate = station->m_groupsTable[GetGroupId(station->m_txrate)]
+                     .m_ratesTable[GetRateId(station->m_txrate)];
+    if (rate.numRateAttempt == 0 && nSuccessfulMpdus + nFailedMpdus > 0)
+    {
+        // first attempt at this rate in the current interval
+        station->m_sampledRates.push_back(station->m_txrate);
+    }
+    rate.numRateSuccess += nSuccessfulMpdus;
+    rate.numRateAttempt += nSuccessfulMpdus + nFailedMpdus;
+}
+
 void
 MinstrelHtWifiManager::UpdateStats(MinstrelHtWifiRemoteStation* station)
 {
     NS_LOG_FUNCTION(this << station);
 
     station->m_nextStatsUpdate = Simulator::Now() + m_updateStats;
+    station->m_numStatsUpdates++;
 
     station->m_numSamplesSlow = 0;
     station->m_sampleCount = 0;
 
-    double tempProb;
-
     if (station->m_ampduPacketCount > 0)
     {
         uint32_t newLen = station->m_ampduLen / station->m_ampduPacketCount;
@@ -1381,96 +1401,65 @@ MinstrelHtWifiManager::UpdateStats(MinstrelHtWifiRemoteStation* station)
     station->m_maxTpRate2 = GetLowestIndex(station);
     station->m_maxProbRate = GetLowestIndex(station);
 
-    /// Update throughput and EWMA for each rate inside each group.
-    for (std::size_t j = 0; j < m_numGroups; j++)
+    for (const auto j : station->m_supportedGroups)
     {
-        if (station->m_groupsTable[j].m_supported)
-        {
-            station->m_sampleCount++;
+        station->m_sampleCount++;
 
-            /* (re)Initialize group rate indexes */
-            station->m_groupsTable[j].m_maxTpRate = GetLowestIndex(station, j);
-            station->m_groupsTable[j].m_maxTpRate2 = GetLowestIndex(station, j);
-            station->m_groupsTable[j].m_maxProbRate = GetLowestIndex(station, j);
-
-            for (uint8_t i = 0; i < m_numRates; i++)
-            {
-                if (station->m_groupsTable[j].m_ratesTable[i].supported)
-                {
-                    station->m_groupsTable[j].m_ratesTable[i].retryUpdated = false;
-
-                    NS_LOG_DEBUG(
-                        +i << " "
-                           << GetMcsSupported(station,
-                                              station->m_groupsTable[j].m_ratesTable[i].mcsIndex)
-                           << "\t attempt="
-                           << station->m_groupsTable[j].m_ratesTable[i].numRateAttempt
-                           << "\t success="
-                           << station->m_groupsTable[j].m_ratesTable[i].numRateSuccess);
-
-                    /// If we've attempted something.
-                    if (station->m_groupsTable[j].m_ratesTable[i].numRateAttempt > 0)
-                    {
-                        station->m_groupsTable[j].m_ratesTable[i].numSamplesSkipped = 0;
-                        /**
-                         * Calculate the probability of success.
-                         * Assume probability scales from 0 to 100.
-                         */
-                        tempProb =
-                            (100 * station->m_groupsTable[j].m_ratesTable[i].numRateSuccess) /
-                            station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-
-                        /// Bookkeeping.
-                        station->m_groupsTable[j].m_ratesTable[i].prob = tempProb;
-
-                        if (station->m_groupsTable[j].m_ratesTable[i].successHist == 0)
-                        {
-                            station->m_groupsTable[j].m_ratesTable[i].ewmaProb = tempProb;
-                        }
-                        else
-                        {
-                            station->m_groupsTable[j].m_ratesTable[i].ewmsdProb =
-                                CalculateEwmsd(station->m_groupsTable[j].m_ratesTable[i].ewmsdProb,
-                                               tempProb,
-                                               station->m_groupsTable[j].m_ratesTable[i].ewmaProb,
-                                               m_ewmaLevel);
-                            /// EWMA probability
-                            tempProb =
-                                (tempProb * (100 - m_ewmaLevel) +
-                                 station->m_groupsTable[j].m_ratesTable[i].ewmaProb * m_ewmaLevel) /
-                                100;
-                            station->m_groupsTable[j].m_ratesTable[i].ewmaProb = tempProb;
-                        }
+        /* (re)Initialize group rate indexes */
+        station->m_groupsTable[j].m_maxTpRate = GetLowestIndex(station, j);
+        station->m_groupsTable[j].m_maxTpRate2 = GetLowestIndex(station, j);
+        station->m_groupsTable[j].m_maxProbRate = GetLowestIndex(station, j);
+    }
 
-                        station->m_groupsTable[j].m_ratesTable[i].throughput =
-                            CalculateThroughput(station, j, i, tempProb);
+    for (const auto index : station->m_retryUpdatedRates)
+    {
+        station->m_groupsTable[GetGroupId(index)].m_ratesTable[GetRateId(index)].retryUpdated =
+            false;
+    }
+    station->m_retryUpdatedRates.clear();
 
-                        station->m_groupsTable[j].m_ratesTable[i].successHist +=
-                            station->m_groupsTable[j].m_ratesTable[i].numRateSuccess;
-                        station->m_groupsTable[j].m_ratesTable[i].attemptHist +=
-                            station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-                    }
-                    else
-                    {
-                        station->m_groupsTable[j].m_ratesTable[i].numSamplesSkipped++;
-                    }
+    /// Update throughput and EWMA for the rates attempted in the last interval.
+    UpdateEwma(station);
 
-                    /// Bookkeeping.
-                    station->m_groupsTable[j].m_ratesTable[i].prevNumRateSuccess =
-                        station->m_groupsTable[j].m_ratesTable[i].numRateSuccess;
-                    station->m_groupsTable[j].m_ratesTable[i].prevNumRateAttempt =
-                        station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-                    station->m_groupsTable[j].m_ratesTable[i].numRateSuccess = 0;
-                    station->m_groupsTable[j].m_ratesTable[i].numRateAttempt = 0;
+    /// Bookkeeping. The counters of the rates that have not been attempted in the last
+    /// interval nor in the previous one are already zero.
+    for (const auto index : station->m_prevSampledRates)
+    {
+        auto& rate = station->m_groupsTable[GetGroupId(index)].m_ratesTable[GetRateId(index)];
+        rate.prevNumRateSuccess = 0;
+        rate.prevNumRateAttempt = 0;
+    }
+    for (const auto index : station->m_sampledRates)
+    {
+        auto& rate = station->m_groupsTable[GetGroupId(index)].m_ratesTable[GetRateId(index)];
+        rate.prevNumRateSuccess = rate.numRateSuccess;
+        rate.prevNumRateAttempt = rate.numRateAttempt;
+        rate.numRateSuccess = 0;
+        rate.numRateAttempt = 0;
 
-                    if (station->m_groupsTable[j].m_ratesTable[i].throughput != 0)
-                    {
-                        SetBestStationThRates(station, GetIndex(j, i));
-                        SetBestProbabilityRate(station, GetIndex(j, i));
-                    }
-                }
-            }
+        // keep track of the rates having a non-zero throughput, sorted by index
+        auto it = std::lower_bound(station->m_ratesWithTp.begin(),
+                                   station->m_ratesWithTp.end(),
+                                   index);
+        const auto found = (it != station->m_ratesWithTp.end() && *it == index);
+        if (rate.throughput != 0 && !found)
+        {
+            station->m_ratesWithTp.insert(it, index);
         }
+        else if (rate.throughput == 0 && found)
+        {
+            station->m_ratesWithTp.erase(it);
+        }
+    }
+    station->m_prevSampledRates.swap(station->m_sampledRates);
+    station->m_sampledRates.clear();
+
+    /// Rates are visited in increasing order of index, as the rates with the same throughput
+    /// are sorted based on the order in which they are visited.
+    for (const auto index : station->m_ratesWithTp)
+    {
+        SetBestStationThRates(station, index);
+        SetBestProbabilityRate(station, index);
     }
 
     // Try to sample all available rates during each interval.
@@ -1489,6 +1478,79 @@ MinstrelHtWifiManager::UpdateStats(MinstrelHtWifiRemoteStation* station)
     }
 }
 
+void
+MinstrelHtWifiManager::UpdateEwma(MinstrelHtWifiRemoteStation* station)
+{
+    NS_LOG_FUNCTION(this << station);
+
+    const auto n = station->m_sampledRates.size();
+    auto& batch = m_statsBatch;
+    batch.prob.resize(n);
+    batch.ewmaProb.resize(n);
+    batch.ewmsdProb.resize(n);
+    batch.txTime.resize(n);
+    batch.throughput.resize(n);
+    batch.firstSuccess.resize(n);
+
+    // gather the statistics of the attempted rates
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        const auto index = station->m_sampledRates[k];
+        const auto& rate = station->m_groupsTable[GetGroupId(index)].m_ratesTable[GetRateId(index)];
+        NS_ASSERT(rate.supported && rate.numRateAttempt > 0);
+
+        NS_LOG_DEBUG(+GetRateId(index)
+                     << " " << GetMcsSupported(station, rate.mcsIndex)
+                     << "\t attempt=" << rate.numRateAttempt
+                     << "\t success=" << rate.numRateSuccess);
+
+        /**
+         * Calculate the probability of success.
+         * Assume probability scales from 0 to 100.
+         */
+        batch.prob[k] = (100 * rate.numRateSuccess) / rate.numRateAttempt;
+        batch.ewmaProb[k] = rate.ewmaProb;
+        batch.ewmsdProb[k] = rate.ewmsdProb;
+        batch.txTime[k] = rate.perfectTxTime.GetSeconds();
+        batch.firstSuccess[k] = (rate.successHist == 0);
+    }
+
+    // update EWMA, EWMSD and throughput; the loop has no dependency across iterations
+    const double weight = m_ewmaLevel;
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        const auto prob = batch.prob[k];
+        const auto oldEwma = batch.ewmaProb[k];
+        const auto oldEwmsd = batch.ewmsdProb[k];
+        const auto ewmsd = CalculateEwmsd(oldEwmsd, prob, oldEwma, weight);
+        const auto ewma = (prob * (100 - weight) + oldEwma * weight) / 100;
+
+        batch.ewmsdProb[k] = batch.firstSuccess[k] ? oldEwmsd : ewmsd;
+        batch.ewmaProb[k] = batch.firstSuccess[k] ? prob : ewma;
+        /**
+         * Do not account throughput if probability of success is below 10%
+         * (as done in minstrel_ht linux implementation). Limit the probability
+         * value to 90% to account for collision related packet error rate fluctuation.
+         */
+        batch.throughput[k] =
+            (batch.ewmaProb[k] < 10) ? 0 : std::min(batch.ewmaProb[k], 90.0) / batch.txTime[k];
+    }
+
+    // scatter the updated statistics
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        const auto index = station->m_sampledRates[k];
+        auto& rate = station->m_groupsTable[GetGroupId(index)].m_ratesTable[GetRateId(index)];
+        rate.prob = batch.prob[k];
+        rate.ewmaProb = batch.ewmaProb[k];
+        rate.ewmsdProb = batch.ewmsdProb[k];
+        rate.throughput = batch.throughput[k];
+        rate.successHist += rate.numRateSuccess;
+        rate.attemptHist += rate.numRateAttempt;
+        rate.lastSampledUpdate = station->m_numStatsUpdates;
+    }
+}
+
 double
 MinstrelHtWifiManager::CalculateThroughput(MinstrelHtWifiRemoteStation* station,
                                            std::size_t groupId,
@@ -1658,6 +1720,12 @@ MinstrelHtWifiManager::RateInit(MinstrelHtWifiRemoteStation* station)
     NS_LOG_FUNCTION(this << station);
 
     station->m_groupsTable = McsGroupData(m_numGroups);
+    station->m_numStatsUpdates = 0;
+    station->m_supportedGroups.clear();
+    station->m_sampledRates.clear();
+    station->m_prevSampledRates.clear();
+    station->m_retryUpdatedRates.clear();
+    station->m_ratesWithTp.clear();
 
     /**
      * Initialize groups supported by the receiver.
@@ -1728,6 +1796,7 @@ MinstrelHtWifiManager::RateInit(MinstrelHtWifiRemoteStation* station)
 
             noSupportedGroupFound = false;
             station->m_groupsTable[groupId].m_supported = true;
+            station->m_supportedGroups.push_back(groupId);
             station->m_groupsTable[groupId].m_col = 0;
             station->m_groupsTable[groupId].m_index = 0;
 
@@ -1764,7 +1833,7 @@ MinstrelHtWifiManager::RateInit(MinstrelHtWifiRemoteStation* station)
                     station->m_groupsTable[groupId].m_ratesTable[rateId].ewmaProb = 0;
                     station->m_groupsTable[groupId].m_ratesTable[rateId].prevNumRateAttempt = 0;
                     station->m_groupsTable[groupId].m_ratesTable[rateId].prevNumRateSuccess = 0;
-                    station->m_groupsTable[groupId].m_ratesTable[rateId].numSamplesSkipped = 0;
+                    station->m_groupsTable[groupId].m_ratesTable[rateId].lastSampledUpdate = 0;
                     station->m_groupsTable[groupId].m_ratesTable[rateId].successHist = 0;
                     station->m_groupsTable[groupId].m_ratesTable[rateId].attemptHist = 0;
                     station->m_groupsTable[groupId].m_ratesTable[rateId].throughput = 0;
@@ -1820,6 +1889,10 @@ MinstrelHtWifiManager::CalculateRetransmits(MinstrelHtWifiRemoteStation* station
     else
     {
         station->m_groupsTable[groupId].m_ratesTable[rateId].retryCount = 2;
+        if (!station->m_groupsTable[groupId].m_ratesTable[rateId].retryUpdated)
+        {
+            station->m_retryUpdatedRates.push_back(GetIndex(groupId, rateId));
+        }
         station->m_groupsTable[groupId].m_ratesTable[rateId].retryUpdated = true;
 
         auto mode =
@@ -119,8 +119,8 @@ struct MinstrelHtRateInfo
     double ewmsdProb;            //!< Exponential weighted moving standard deviation of probability.
     uint32_t prevNumRateAttempt; //!< Number of transmission attempts with previous rate.
     uint32_t prevNumRateSuccess; //!< Number of successful frames transmitted with previous rate.
-    uint32_t numSamplesSkipped;  //!< Number of times this rate statistics were not updated because
-                                 //!< no attempts have been made.
+    uint32_t lastSampledUpdate;  //!< Number of statistics updates of the station when attempts
+                                 //!< were last made at this rate.
     uint64_t successHist;        //!< Aggregate of all transmission successes.
     uint64_t attemptHist;        //!< Aggregate of all transmission attempts.
     double throughput;           //!< Throughput of this rate (in packets per second).
@@ -399,10 +399,34 @@ class MinstrelHtWifiManager : public WifiRemoteStationManager
     /**
      * Update the Minstrel Table.
      *
+     * Only the statistics of the rates that have been attempted since the last update are
+     * recomputed; the selection of the best rates only considers the rates with a non-zero
+     * throughput.
+     *
      * @param station the Minstrel-HT wifi remote station
      */
     void UpdateStats(MinstrelHtWifiRemoteStation* station);
 
+    /**
+     * Update the EWMA and EWMSD of the success probability and the throughput of the rates
+     * that have been attempted since the last update of the statistics of the given station.
+     *
+     * @param station the Minstrel-HT wifi remote station
+     */
+    void UpdateEwma(MinstrelHtWifiRemoteStation* station);
+
+    /**
+     * Account for the given number of successful and failed MPDUs transmitted at the
+     * current TX rate of the given station.
+     *
+     * @param station the Minstrel-HT wifi remote station
+     * @param nSuccessfulMpdus the number of successfully transmitted MPDUs
+     * @param nFailedMpdus the number of unsuccessfully transmitted MPDUs
+     */
+    void AddRateAttempts(MinstrelHtWifiRemoteStation* station,
+                         uint16_t nSuccessfulMpdus,
+                         uint16_t nFailedMpdus);
+
     /**
      * Initialize Minstrel Table.
      *
@@ -704,6 +728,23 @@ class MinstrelHtWifiManager : public WifiRemoteStationManager
 
     Ptr<UniformRandomVariable> m_uniformRandomVariable; //!< Provides uniform random variables.
 
+    /**
+     * Statistics of the rates being updated by UpdateEwma(), stored as a structure of
+     * arrays so that the update can be vectorized. These buffers are shared by all the
+     * stations to avoid allocations.
+     */
+    struct StatsBatch
+    {
+        std::vector<double> prob;          //!< success probability in the last interval
+        std::vector<double> ewmaProb;      //!< EWMA of the success probability
+        std::vector<double> ewmsdProb;     //!< EWMSD of the success probability
+        std::vector<double> txTime;        //!< perfect TX time (seconds)
+        std::vector<double> throughput;    //!< throughput
+        std::vector<uint8_t> firstSuccess; //!< whether no transmission has ever succeeded
+    };
+
+    StatsBatch m_statsBatch; //!< statistics of the rates being updated
+
     TracedValue<uint64_t> m_currentRate; //!< Trace rate changes
 };
 
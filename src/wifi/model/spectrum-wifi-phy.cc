@@ -14,6 +14,7 @@
 #include "spectrum-wifi-phy.h"
 
 #include "interference-helper.h"
+#include "wifi-link-to-system-mapping.h"
 #include "wifi-net-device.h"
 #include "wifi-psdu.h"
 #include "wifi-spectrum-phy-interface.h"
@@ -25,6 +26,7 @@
 #include "ns3/he-phy.h"
 #include "ns3/log.h"
 #include "ns3/node.h"
+#include "ns3/pointer.h"
 #include "ns3/simulator.h"
 #include "ns3/spectrum-channel.h"
 
@@ -78,6 +80,14 @@ SpectrumWifiPhy::GetTypeId()
                 DoubleValue(-40.0),
                 MakeDoubleAccessor(&SpectrumWifiPhy::m_txMaskOuterBandMaximumRejection),
                 MakeDoubleChecker<dBr_u>())
+            .AddAttribute("LinkToSystemMapping",
+                          "The effective SINR mapping of the abstracted PHY, which does not "
+                          "evaluate the PHY header fields and decides the reception of each "
+                          "MPDU based on its effective SINR. If null, the full PHY is used.",
+                          PointerValue(),
+                          MakePointerAccessor(&SpectrumWifiPhy::SetLinkToSystemMapping,
+                                              &SpectrumWifiPhy::GetLinkToSystemMapping),
+                          MakePointerChecker<WifiLinkToSystemMapping>())
             .AddTraceSource(
                 "SignalArrival",
                 "Trace start of all signal arrivals, including weak and foreign signals",
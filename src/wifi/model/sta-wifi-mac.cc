@@ -190,7 +190,11 @@ StaWifiMac::DoInitialize()
     {
         m_emlsrManager->Initialize();
     }
-    StartScanning();
+    // no need to scan if association has been statically set up
+    if (!IsAssociated())
+    {
+        StartScanning();
+    }
     NS_ABORT_IF(!TraceConnectWithoutContext("AckedMpdu", MakeCallback(&StaWifiMac::TxOk, this)));
     WifiMac::DoInitialize();
 }
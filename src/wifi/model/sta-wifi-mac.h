@@ -30,6 +30,7 @@ class CapabilityInformation;
 class RandomVariableStream;
 class WifiAssocManager;
 class EmlsrManager;
+class WifiStaticSetupHelper;
 
 /**
  * @ingroup wifi
@@ -148,6 +149,8 @@ class StaWifiMac : public WifiMac
     friend class ::AmpduAggregationTest;
     friend class ::MultiLinkOperationsTestBase;
     friend class ::ProbeExchTest;
+    /// Allow the helper performing static setup to access private members
+    friend class WifiStaticSetupHelper;
 
     /// type of the management frames used to get info about APs
     using MgtFrameType =
@@ -9,6 +9,7 @@
 
 #include "table-based-error-rate-model.h"
 
+#include "error-rate-table-file.h"
 #include "wifi-tx-vector.h"
 #include "wifi-utils.h"
 #include "yans-error-rate-model.h"
@@ -21,6 +22,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
 
 namespace ns3
 {
@@ -50,7 +52,16 @@ TableBasedErrorRateModel::GetTypeId()
                           "Threshold in bytes over which the table for large size frames is used",
                           UintegerValue(400),
                           MakeUintegerAccessor(&TableBasedErrorRateModel::m_threshold),
-                          MakeUintegerChecker<uint64_t>());
+                          MakeUintegerChecker<uint64_t>())
+            .AddAttribute("TableFile",
+                          "The name of an error rate table file (e.g., generated by the "
+                          "wifi-error-rate-table-generator program) whose tables are used in "
+                          "place of the built-in ones for the transmissions they cover. An "
+                          "empty string means that only the built-in tables are used.",
+                          StringValue(""),
+                          MakeStringAccessor(&TableBasedErrorRateModel::SetTableFile,
+                                             &TableBasedErrorRateModel::GetTableFile),
+                          MakeStringChecker());
     return tid;
 }
 
@@ -65,6 +76,29 @@ TableBasedErrorRateModel::~TableBasedErrorRateModel()
     m_fallbackErrorModel = nullptr;
 }
 
+void
+TableBasedErrorRateModel::SetTableFile(const std::string& filename)
+{
+    NS_LOG_FUNCTION(this << filename);
+    m_tableFile = filename;
+    m_loadedTables.clear();
+    if (filename.empty())
+    {
+        return;
+    }
+    for (auto& entry : ReadErrorRateTableFile(filename).tables)
+    {
+        m_loadedTables[{entry.ldpc, entry.mcs, entry.channelWidth}][entry.refSize] =
+            std::move(entry.table);
+    }
+}
+
+std::string
+TableBasedErrorRateModel::GetTableFile() const
+{
+    return m_tableFile;
+}
+
 dB_u
 TableBasedErrorRateModel::RoundSnr(dB_u snr, double precision) const
 {
@@ -135,6 +169,47 @@ TableBasedErrorRateModel::GetMcsForMode(WifiMode mode)
     return mcs;
 }
 
+double
+TableBasedErrorRateModel::GetPerFromTable(const SnrPerTable& table, dB_u snr)
+{
+    auto itTable = std::find_if(table.cbegin(), table.cend(), [&snr](const auto& element) {
+        return element.first == snr;
+    });
+    if (itTable != table.cend())
+    {
+        return itTable->second;
+    }
+    const auto minSnr = table.cbegin()->first;
+    const auto maxSnr = (--table.cend())->first;
+    if (snr < minSnr)
+    {
+        return 1.0;
+    }
+    if (snr > maxSnr)
+    {
+        return 0.0;
+    }
+    double a = 0.0;
+    double b = 0.0;
+    dB_u previousSnr{0.0};
+    dB_u nextSnr{0.0};
+    for (auto i = table.cbegin(); i != table.cend(); ++i)
+    {
+        if (i->first < snr)
+        {
+            previousSnr = i->first;
+            a = i->second;
+        }
+        else
+        {
+            nextSnr = i->first;
+            b = i->second;
+            break;
+        }
+    }
+    return a + (snr - previousSnr) * (b - a) / (nextSnr - previousSnr);
+}
+
 double
 TableBasedErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
                                                 const WifiTxVector& txVector,
@@ -167,65 +242,45 @@ TableBasedErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
         mcs = mcs % 8;
     }
 
-    if (mcs >= (ldpc ? ERROR_TABLE_LDPC_MAX_NUM_MCS : ERROR_TABLE_BCC_MAX_NUM_MCS))
+    const SnrPerTable* table = nullptr;
+    uint32_t tableSize = 0;
+    if (auto it = m_loadedTables.find({ldpc, mcs, txVector.GetChannelWidth()});
+        it != m_loadedTables.cend())
     {
-        NS_LOG_WARN("Table missing for MCS: "
-                    << +mcs << " in TableBasedErrorRateModel: use fallback error rate model");
-        return m_fallbackErrorModel
-            ->GetChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
-    }
-
-    auto errorTable = (ldpc ? AwgnErrorTableLdpc1458
-                            : (size < m_threshold ? AwgnErrorTableBcc32 : AwgnErrorTableBcc1458));
-    const auto& itVector = errorTable[mcs];
-    auto itTable =
-        std::find_if(itVector.cbegin(), itVector.cend(), [&roundedSnr](const auto& element) {
-            return element.first == roundedSnr;
-        });
-    const auto minSnr = itVector.cbegin()->first;
-    const auto maxSnr = (--itVector.cend())->first;
-    double per;
-    if (itTable == itVector.cend())
-    {
-        if (roundedSnr < minSnr)
+        // select the table whose reference size is the closest (in ratio) to the frame size
+        auto itSize = it->second.lower_bound(size);
+        if (itSize == it->second.cend() ||
+            (itSize != it->second.cbegin() &&
+             static_cast<double>(itSize->first) / size >
+                 static_cast<double>(size) / std::prev(itSize)->first))
         {
-            per = 1.0;
-        }
-        else if (roundedSnr > maxSnr)
-        {
-            per = 0.0;
-        }
-        else
-        {
-            double a = 0.0;
-            double b = 0.0;
-            dB_u previousSnr{0.0};
-            dB_u nextSnr{0.0};
-            for (auto i = itVector.cbegin(); i != itVector.cend(); ++i)
-            {
-                if (i->first < roundedSnr)
-                {
-                    previousSnr = i->first;
-                    a = i->second;
-                }
-                else
-                {
-                    nextSnr = i->first;
-                    b = i->second;
-                    break;
-                }
-            }
-            per = a + (roundedSnr - previousSnr) * (b - a) / (nextSnr - previousSnr);
+            --itSize;
         }
+        NS_LOG_DEBUG("Use loaded table with reference size " << itSize->first);
+        table = &itSize->second;
+        tableSize = itSize->first;
     }
     else
     {
-        per = itTable->second;
+        if (mcs >= (ldpc ? ERROR_TABLE_LDPC_MAX_NUM_MCS : ERROR_TABLE_BCC_MAX_NUM_MCS))
+        {
+            NS_LOG_WARN("Table missing for MCS: "
+                        << +mcs << " in TableBasedErrorRateModel: use fallback error rate model");
+            return m_fallbackErrorModel
+                ->GetChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+        }
+
+        auto errorTable =
+            (ldpc ? AwgnErrorTableLdpc1458
+                  : (size < m_threshold ? AwgnErrorTableBcc32 : AwgnErrorTableBcc1458));
+        table = &errorTable[mcs];
+        tableSize = (ldpc ? ERROR_TABLE_LDPC_FRAME_SIZE
+                          : (size < m_threshold ? ERROR_TABLE_BCC_SMALL_FRAME_SIZE
+                                                : ERROR_TABLE_BCC_LARGE_FRAME_SIZE));
     }
 
-    uint16_t tableSize = (ldpc ? ERROR_TABLE_LDPC_FRAME_SIZE
-                               : (size < m_threshold ? ERROR_TABLE_BCC_SMALL_FRAME_SIZE
-                                                     : ERROR_TABLE_BCC_LARGE_FRAME_SIZE));
+    double per = GetPerFromTable(*table, roundedSnr);
+
     if (size != tableSize)
     {
         // From IEEE document 11-14/0803r1 (Packet Length for Box 0 Calibration)
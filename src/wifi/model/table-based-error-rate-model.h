@@ -15,7 +15,9 @@
 
 #include "ns3/error-rate-tables.h"
 
+#include <map>
 #include <optional>
+#include <tuple>
 
 namespace ns3
 {
@@ -26,6 +28,11 @@ class WifiTxVector;
  * @ingroup wifi
  * @brief the interface for the table-driven OFDM error model
  *
+ * The built-in AWGN tables can be complemented by the tables of an error rate table
+ * file (see ErrorRateTableFile), set through the "TableFile" attribute. A table of the
+ * file is used for the transmissions with the same MCS, FEC coding and channel width;
+ * among them, the table whose reference size is the closest (in ratio) to the frame size
+ * is selected. The built-in tables are used for the transmissions not covered by the file.
  */
 class TableBasedErrorRateModel : public ErrorRateModel
 {
@@ -46,6 +53,19 @@ class TableBasedErrorRateModel : public ErrorRateModel
      */
     static std::optional<uint8_t> GetMcsForMode(WifiMode mode);
 
+    /**
+     * Load the tables of an error rate table file, replacing the tables of the
+     * previously loaded file, if any.
+     *
+     * @param filename the name of the file (an empty string unloads the tables)
+     */
+    void SetTableFile(const std::string& filename);
+
+    /**
+     * @return the name of the loaded error rate table file
+     */
+    std::string GetTableFile() const;
+
   private:
     double DoGetChunkSuccessRate(WifiMode mode,
                                  const WifiTxVector& txVector,
@@ -74,10 +94,28 @@ class TableBasedErrorRateModel : public ErrorRateModel
      */
     double FetchFsr(WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits) const;
 
+    /**
+     * Get the PER from a table, by linear interpolation between the two closest SNRs.
+     *
+     * @param table the table
+     * @param snr the SNR (rounded to the precision of the table)
+     * @return the PER (1 below the lowest SNR of the table and 0 above the highest SNR)
+     */
+    static double GetPerFromTable(const SnrPerTable& table, dB_u snr);
+
+    /// Key of the loaded tables: FEC coding (true for LDPC), MCS and channel width
+    using LoadedTableKey = std::tuple<bool, uint8_t, MHz_u>;
+
+    /// Loaded tables, indexed by reference size (bytes)
+    using LoadedTables = std::map<uint32_t, SnrPerTable>;
+
     Ptr<ErrorRateModel>
         m_fallbackErrorModel; //!< Error rate model to fallback to if no value is found in the table
 
     uint64_t m_threshold; //!< Threshold in bytes over which the table for large size frames is used
+
+    std::string m_tableFile;                               //!< loaded error rate table file
+    std::map<LoadedTableKey, LoadedTables> m_loadedTables; //!< tables of the loaded file
 };
 
 } // namespace ns3
@@ -0,0 +1,403 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "tabulated-error-rate-model.h"
+
+#include "nist-error-rate-model.h"
+#include "wifi-phy.h"
+#include "wifi-tx-vector.h"
+#include "wifi-utils.h"
+
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/pointer.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace ns3
+{
+
+static const double INITIAL_SNR_STEP = 1;      //!< grid step (dB) of the coarsest table
+static const double MIN_SUCCESS_RATE = 1e-300; //!< success rates are floored to this value
+/// maximum difference of the log of the success rate between the bounds of a grid interval
+/// whose success rate is not negligible, so that the interval is sampled finely enough
+static const double MAX_LOG_CSR_STEP = 1;
+
+NS_LOG_COMPONENT_DEFINE("TabulatedErrorRateModel");
+
+NS_OBJECT_ENSURE_REGISTERED(TabulatedErrorRateModel);
+
+TypeId
+TabulatedErrorRateModel::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::TabulatedErrorRateModel")
+            .SetParent<ErrorRateModel>()
+            .SetGroupName("Wifi")
+            .AddConstructor<TabulatedErrorRateModel>()
+            .AddAttribute("ErrorRateModel",
+                          "The error rate model whose chunk success rate is tabulated",
+                          PointerValue(CreateObject<NistErrorRateModel>()),
+                          MakePointerAccessor(&TabulatedErrorRateModel::SetErrorRateModel,
+                                              &TabulatedErrorRateModel::GetErrorRateModel),
+                          MakePointerChecker<ErrorRateModel>())
+            .AddAttribute("MinSnr",
+                          "The lowest tabulated SNR (dB). The wrapped model is used below it.",
+                          DoubleValue(-10),
+                          MakeDoubleAccessor(&TabulatedErrorRateModel::m_minSnr),
+                          MakeDoubleChecker<dB_u>())
+            .AddAttribute("MaxSnr",
+                          "The highest tabulated SNR (dB). The wrapped model is used above it.",
+                          DoubleValue(50),
+                          MakeDoubleAccessor(&TabulatedErrorRateModel::m_maxSnr),
+                          MakeDoubleChecker<dB_u>())
+            .AddAttribute("MinSnrStep",
+                          "The minimum step (dB) of the SNR grid",
+                          DoubleValue(0.01),
+                          MakeDoubleAccessor(&TabulatedErrorRateModel::m_minStep),
+                          MakeDoubleChecker<dB_u>(1e-6))
+            .AddAttribute("Accuracy",
+                          "The maximum absolute difference between the interpolated chunk "
+                          "success rate and the one of the wrapped model",
+                          DoubleValue(1e-4),
+                          MakeDoubleAccessor(&TabulatedErrorRateModel::m_accuracy),
+                          MakeDoubleChecker<double>(0, 1));
+    return tid;
+}
+
+TabulatedErrorRateModel::TabulatedErrorRateModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TabulatedErrorRateModel::~TabulatedErrorRateModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+TabulatedErrorRateModel::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_model = nullptr;
+    m_tables = nullptr;
+    ErrorRateModel::DoDispose();
+}
+
+void
+TabulatedErrorRateModel::SetErrorRateModel(Ptr<ErrorRateModel> model)
+{
+    NS_LOG_FUNCTION(this << model);
+    m_model = model;
+    m_tables = nullptr;
+}
+
+Ptr<ErrorRateModel>
+TabulatedErrorRateModel::GetErrorRateModel() const
+{
+    return m_model;
+}
+
+std::size_t
+TabulatedErrorRateModel::GetNTables() const
+{
+    return GetTables().size();
+}
+
+void
+TabulatedErrorRateModel::AppendConfiguration(Ptr<const Object> object, std::string& configuration)
+{
+    if (!object)
+    {
+        configuration += "null;";
+        return;
+    }
+    configuration += object->GetInstanceTypeId().GetName() + "{";
+    for (auto tid = object->GetInstanceTypeId(); tid.HasParent(); tid = tid.GetParent())
+    {
+        for (std::size_t i = 0; i < tid.GetAttributeN(); ++i)
+        {
+            const auto info = tid.GetAttribute(i);
+            if (!(info.flags & TypeId::ATTR_GET) || !info.accessor->HasGetter() ||
+                info.supportLevel == TypeId::SupportLevel::OBSOLETE)
+            {
+                continue;
+            }
+            configuration += info.name + "=";
+            if (dynamic_cast<const PointerChecker*>(PeekPointer(info.checker)))
+            {
+                PointerValue ptr;
+                object->GetAttribute(info.name, ptr, true);
+                AppendConfiguration(ptr.Get<Object>(), configuration);
+                continue;
+            }
+            auto value = info.checker->Create();
+            object->GetAttribute(info.name, *value, true);
+            configuration += value->SerializeToString(info.checker) + ";";
+        }
+    }
+    configuration += "};";
+}
+
+TabulatedErrorRateModel::Tables&
+TabulatedErrorRateModel::GetTables() const
+{
+    if (!m_tables)
+    {
+        // the tables of all the configurations used so far, indexed by a string made of the
+        // attribute values of this model and of the type and attribute values of the wrapped model
+        static std::unordered_map<std::string, Tables> tables;
+        std::ostringstream oss;
+        oss << std::setprecision(17) << m_minSnr << ";" << m_maxSnr << ";" << m_minStep << ";"
+            << m_accuracy << ";";
+        auto configuration = oss.str();
+        AppendConfiguration(m_model, configuration);
+        NS_LOG_DEBUG("Tables of configuration " << configuration);
+        m_tables = &tables[configuration];
+    }
+    return *m_tables;
+}
+
+bool
+TabulatedErrorRateModel::IsAwgn() const
+{
+    return m_model->IsAwgn();
+}
+
+int64_t
+TabulatedErrorRateModel::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    return m_model->AssignStreams(stream);
+}
+
+uint64_t
+TabulatedErrorRateModel::GetKey(WifiMode mode,
+                                const WifiTxVector& txVector,
+                                uint8_t numRxAntennas,
+                                WifiPpduField field,
+                                uint8_t bucket)
+{
+    // the parameters used by the error rate models, besides the SNR and the chunk size
+    return (static_cast<uint64_t>(mode.GetUid() & 0xffff) << 48) |
+           (static_cast<uint64_t>(txVector.GetChannelWidth()) << 32) |
+           (static_cast<uint64_t>(txVector.GetGuardInterval().GetNanoSeconds() / 100 & 0xff)
+            << 24) |
+           (static_cast<uint64_t>(txVector.GetNss() & 0xf) << 20) |
+           (static_cast<uint64_t>(numRxAntennas & 0xf) << 16) |
+           (static_cast<uint64_t>(txVector.IsLdpc()) << 15) |
+           (static_cast<uint64_t>(field & 0x7f) << 8) | bucket;
+}
+
+TabulatedErrorRateModel::Table
+TabulatedErrorRateModel::BuildTable(WifiMode mode,
+                                    const WifiTxVector& txVector,
+                                    uint8_t numRxAntennas,
+                                    WifiPpduField field,
+                                    uint16_t staId,
+                                    uint8_t bucket) const
+{
+    NS_LOG_FUNCTION(this << mode << +numRxAntennas << field << +bucket);
+
+    // the table holds the success rate of the largest chunk of the bucket that is made of
+    // whole bytes (models such as the TableBasedErrorRateModel work on bytes)
+    Table table;
+    const uint64_t minBits = uint64_t{1} << bucket;
+    const uint64_t refBits =
+        (bucket < 3) ? (uint64_t{2} << bucket) - 1 : (uint64_t{2} << bucket) - 8;
+    table.refBits = refBits;
+
+    auto getCsr = [&](dB_u snr, uint64_t nbits) {
+        return m_model->GetChunkSuccessRate(mode,
+                                            txVector,
+                                            DbToRatio(snr),
+                                            nbits,
+                                            numRxAntennas,
+                                            field,
+                                            staId);
+    };
+    auto getLogCsr = [&](dB_u snr) {
+        return std::log(std::max(getCsr(snr, refBits), MIN_SUCCESS_RATE));
+    };
+    // error of the success rate obtained from the given (interpolated) log of the success rate
+    // of the reference chunk, given the actual one, for the largest and the smallest chunks of
+    // the bucket, for the smallest chunk that is not made of whole bytes (where the error of
+    // models working on bytes is the largest) and for the chunk whose success rate is the most
+    // sensitive to the error
+    const uint64_t partialByteBits = (bucket < 3) ? minBits : minBits + 7;
+    auto getError = [&](dB_u snr, double logCsr, double refLogCsr) {
+        const auto worstBits = std::clamp<uint64_t>(
+            std::llround(refBits / std::max(-refLogCsr, 1.0 / refBits)),
+            minBits,
+            refBits);
+        double error = std::abs(std::exp(logCsr) - std::exp(refLogCsr));
+        for (auto nbits : {minBits, partialByteBits, worstBits})
+        {
+            error = std::max(error,
+                             std::abs(std::exp(logCsr * nbits / refBits) - getCsr(snr, nbits)));
+        }
+        return error;
+    };
+
+    // a grid point, with the log of the success rate and the error due to the scaling with
+    // the chunk size
+    struct GridPoint
+    {
+        dB_u snr;
+        double logCsr;
+        double error;
+    };
+    auto getGridPoint = [&](dB_u snr) {
+        const auto logCsr = getLogCsr(snr);
+        return GridPoint{snr, logCsr, getError(snr, logCsr, logCsr)};
+    };
+
+    // the intervals of the coarsest grid are pushed in reverse order, so that the intervals
+    // are popped (and appended to the table) in increasing SNR order
+    const auto nIntervals =
+        static_cast<std::size_t>(std::ceil((m_maxSnr - m_minSnr) / INITIAL_SNR_STEP));
+    std::vector<std::pair<GridPoint, GridPoint>> stack;
+    auto hi = getGridPoint(m_minSnr + nIntervals * INITIAL_SNR_STEP);
+    for (std::size_t i = nIntervals; i > 0; --i)
+    {
+        auto lo = getGridPoint(m_minSnr + (i - 1) * INITIAL_SNR_STEP);
+        stack.emplace_back(lo, hi);
+        hi = lo;
+    }
+    table.snrs.push_back(hi.snr);
+    table.logCsr.push_back(hi.logCsr);
+
+    // each interval is halved until the interpolation at its middle and at its eighths (the
+    // latter detect the steps of models that round the SNR) is accurate enough and, unless the
+    // success rate is negligible over the interval, its log varies by at most MAX_LOG_CSR_STEP
+    while (!stack.empty())
+    {
+        const auto [lo, hi] = stack.back();
+        stack.pop_back();
+
+        GridPoint mid{};
+        double error = std::max(lo.error, hi.error);
+        for (double fraction : {0.5, 0.125, 0.25, 0.375, 0.625, 0.75, 0.875})
+        {
+            dB_u snr = lo.snr + fraction * (hi.snr - lo.snr);
+            double interpolated = lo.logCsr + fraction * (hi.logCsr - lo.logCsr);
+            double logCsr = getLogCsr(snr);
+            if (fraction == 0.5)
+            {
+                mid = {snr, logCsr, getError(snr, logCsr, logCsr)};
+            }
+            error = std::max(error, getError(snr, interpolated, logCsr));
+        }
+        // the success rate of the smallest chunk of the bucket is the least negligible
+        const auto minScale = static_cast<double>(minBits) / refBits;
+        const auto tooSteep =
+            std::abs(hi.logCsr - lo.logCsr) > MAX_LOG_CSR_STEP &&
+            std::exp(std::max(lo.logCsr, hi.logCsr) * minScale) > m_accuracy;
+
+        if ((error > m_accuracy || tooSteep) && (hi.snr - lo.snr) / 2 >= m_minStep)
+        {
+            stack.emplace_back(mid, hi);
+            stack.emplace_back(lo, mid);
+            continue;
+        }
+        table.snrs.push_back(hi.snr);
+        table.logCsr.push_back(hi.logCsr);
+        table.delegated.push_back(error > m_accuracy || tooSteep);
+    }
+
+    NS_LOG_DEBUG("Table for " << mode << " and chunks of " << minBits << "-" << refBits
+                              << " bits: " << table.delegated.size() << " intervals, "
+                              << std::count(table.delegated.cbegin(), table.delegated.cend(), true)
+                              << " delegated");
+    return table;
+}
+
+void
+TabulatedErrorRateModel::BuildTables(Ptr<const WifiPhy> phy)
+{
+    NS_LOG_FUNCTION(this << phy);
+
+    const auto nRxAntennas = phy->GetNumberOfAntennas();
+    auto modes = phy->GetModeList();
+    modes.splice(modes.end(), phy->GetMcsList());
+    auto& tables = GetTables();
+    for (const auto& mode : modes)
+    {
+        // the TXVECTOR of the SU PPDUs transmitted by the PHY with this mode
+        const auto modClass = mode.GetModulationClass();
+        WifiTxVector txVector;
+        txVector.SetMode(mode);
+        txVector.SetChannelWidth(modClass < WIFI_MOD_CLASS_HT
+                                     ? std::min(phy->GetChannelWidth(), MHz_u{20})
+                                     : phy->GetChannelWidth());
+        if (!txVector.IsValid(phy->GetPhyBand()))
+        {
+            continue;
+        }
+        const auto maxBits = uint64_t{WifiPhy::GetMaxPsduSize(modClass)} * 8;
+        for (uint8_t bucket = 0; bucket < std::bit_width(maxBits); ++bucket)
+        {
+            const auto key = GetKey(mode, txVector, nRxAntennas, WIFI_PPDU_FIELD_DATA, bucket);
+            if (!tables.contains(key))
+            {
+                tables.emplace(key,
+                               BuildTable(mode,
+                                          txVector,
+                                          nRxAntennas,
+                                          WIFI_PPDU_FIELD_DATA,
+                                          SU_STA_ID,
+                                          bucket));
+            }
+        }
+    }
+}
+
+double
+TabulatedErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
+                                               const WifiTxVector& txVector,
+                                               double snr,
+                                               uint64_t nbits,
+                                               uint8_t numRxAntennas,
+                                               WifiPpduField field,
+                                               uint16_t staId) const
+{
+    NS_LOG_FUNCTION(this << mode << snr << nbits << +numRxAntennas << field << staId);
+
+    const auto snrDb = RatioToDb(snr);
+    if (nbits == 0 || txVector.IsMu() || !(snrDb >= m_minSnr) || snrDb >= m_maxSnr)
+    {
+        return m_model
+            ->GetChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
+
+    const auto bucket = static_cast<uint8_t>(std::bit_width(nbits) - 1);
+    const auto key = GetKey(mode, txVector, numRxAntennas, field, bucket);
+    auto& tables = GetTables();
+    auto it = tables.find(key);
+    if (it == tables.end())
+    {
+        it = tables
+                 .emplace(key, BuildTable(mode, txVector, numRxAntennas, field, staId, bucket))
+                 .first;
+    }
+    const auto& table = it->second;
+
+    // the first grid point is m_minSnr, hence snrDb is not below the first grid point
+    const auto i = static_cast<std::size_t>(
+        std::upper_bound(table.snrs.cbegin(), table.snrs.cend(), snrDb) - table.snrs.cbegin() - 1);
+    if (i >= table.delegated.size() || table.delegated[i])
+    {
+        return m_model
+            ->GetChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
+    const double x = (snrDb - table.snrs[i]) / (table.snrs[i + 1] - table.snrs[i]);
+    const double logCsr = table.logCsr[i] + x * (table.logCsr[i + 1] - table.logCsr[i]);
+    return std::exp(logCsr * (nbits / table.refBits));
+}
+
+} // namespace ns3
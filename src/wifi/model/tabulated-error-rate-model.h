@@ -0,0 +1,181 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef TABULATED_ERROR_RATE_MODEL_H
+#define TABULATED_ERROR_RATE_MODEL_H
+
+#include "error-rate-model.h"
+#include "wifi-units.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+class WifiPhy;
+
+/**
+ * @ingroup wifi
+ * @brief an error rate model that tabulates the chunk success rate of another error rate model
+ *
+ * Evaluating the chunk success rate of analytic models such as NistErrorRateModel
+ * or YansErrorRateModel requires many transcendental functions, and it is done for
+ * every interference change of every received PPDU. This model wraps another error
+ * rate model (set through the "ErrorRateModel" attribute) and answers by linear
+ * interpolation over an SNR grid precomputed from the wrapped model.
+ *
+ * A table is built for each combination of Wi-Fi mode, relevant TXVECTOR parameters
+ * (channel width, guard interval, number of spatial streams, coding), PPDU field,
+ * number of RX antennas and power-of-two bucket of chunk sizes (in bits). When the PHY
+ * is initialized, the tables of the data field of the SU PPDUs that the PHY can transmit
+ * are built for all the buckets (see BuildTables()); the tables of other combinations are
+ * built the first time they are used. The table stores the logarithm of the success
+ * rate of the largest chunk of whole bytes of the bucket; the success rate of other
+ * chunks is obtained by scaling it with the chunk size (which is exact for all the
+ * models whose success rate is a power of a per-bit success rate). Starting from a
+ * 1 dB grid, each interval is halved until the interpolated success rate at its middle
+ * and at its eighths is within the configured accuracy of the wrapped model, for the
+ * largest and the smallest chunks of the bucket, for the smallest chunk that is not
+ * made of whole bytes and for the chunk whose success rate is the most sensitive to
+ * the interpolation error, and (unless the success rate is negligible over the interval)
+ * until the log of the success rate varies by at most 1 over the interval, down to the
+ * "MinSnrStep" attribute. Hence, the grid is only fine where the success rate varies
+ * quickly. Intervals that are still not accurate
+ * enough at the minimum step (e.g., the steps introduced by the SNR rounding of the
+ * TableBasedErrorRateModel) and SNRs outside the tabulated range are delegated to the
+ * wrapped model, as well as MU PPDUs (whose success rate depends on the RU allocation).
+ *
+ * The tables are shared by all the instances of this model whose attributes are equal
+ * and whose wrapped models have the same type and the same attribute values, hence they
+ * are only built once per configuration (e.g., once for all the PHYs of a simulation
+ * using the same error rate model). The configuration is read when the tables are
+ * first used.
+ */
+class TabulatedErrorRateModel : public ErrorRateModel
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    TabulatedErrorRateModel();
+    ~TabulatedErrorRateModel() override;
+
+    bool IsAwgn() const override;
+    int64_t AssignStreams(int64_t stream) override;
+
+    /**
+     * @param model the error rate model to tabulate
+     */
+    void SetErrorRateModel(Ptr<ErrorRateModel> model);
+
+    /**
+     * @return the tabulated error rate model
+     */
+    Ptr<ErrorRateModel> GetErrorRateModel() const;
+
+    /**
+     * @return the number of tables built so far for the configuration of this model,
+     *         including those built through other instances with the same configuration
+     */
+    std::size_t GetNTables() const;
+
+    /**
+     * Build the tables of the data field of the SU PPDUs that the given PHY can transmit,
+     * i.e., for all the modes supported by the PHY, with its channel width (20 MHz for
+     * non-HT modes), the default TXVECTOR parameters otherwise and the number of antennas
+     * of the PHY, for all the chunk sizes up to the maximum PSDU size, unless they have
+     * already been built for this configuration. This is called by the PHY when it is
+     * initialized, so that the tables are not built during the simulation.
+     *
+     * @param phy the PHY
+     */
+    void BuildTables(Ptr<const WifiPhy> phy);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    double DoGetChunkSuccessRate(WifiMode mode,
+                                 const WifiTxVector& txVector,
+                                 double snr,
+                                 uint64_t nbits,
+                                 uint8_t numRxAntennas,
+                                 WifiPpduField field,
+                                 uint16_t staId) const override;
+
+    /// Success rate of the chunks of a bucket, tabulated over a non-uniform SNR grid
+    struct Table
+    {
+        double refBits{0};           //!< size (bits) of the tabulated chunk
+        std::vector<dB_u> snrs;      //!< increasing grid points (dB), the first is the min SNR
+        std::vector<double> logCsr;  //!< log of the success rate at each grid point
+        std::vector<bool> delegated; //!< whether each interval is delegated to the wrapped model
+    };
+
+    /// Tables of a configuration, indexed by key (see GetKey())
+    using Tables = std::unordered_map<uint64_t, Table>;
+
+    /**
+     * @return the tables of the configuration of this model, shared with the other instances
+     *         with the same configuration
+     */
+    Tables& GetTables() const;
+
+    /**
+     * Append the type and the attribute values of an object, including those of the objects
+     * it points to, to a string identifying a configuration.
+     *
+     * @param object the object
+     * @param configuration the string identifying the configuration
+     */
+    static void AppendConfiguration(Ptr<const Object> object, std::string& configuration);
+
+    /**
+     * @param mode the Wi-Fi mode
+     * @param txVector the TXVECTOR
+     * @param numRxAntennas the number of active RX antennas
+     * @param field the PPDU field
+     * @param bucket the bucket of the chunk size (floor of its base-2 logarithm)
+     * @return the key of the table to use
+     */
+    static uint64_t GetKey(WifiMode mode,
+                           const WifiTxVector& txVector,
+                           uint8_t numRxAntennas,
+                           WifiPpduField field,
+                           uint8_t bucket);
+
+    /**
+     * Build the table of a bucket.
+     *
+     * @param mode the Wi-Fi mode
+     * @param txVector the TXVECTOR
+     * @param numRxAntennas the number of active RX antennas
+     * @param field the PPDU field
+     * @param staId the station ID
+     * @param bucket the bucket of the chunk size (floor of its base-2 logarithm)
+     * @return the table
+     */
+    Table BuildTable(WifiMode mode,
+                     const WifiTxVector& txVector,
+                     uint8_t numRxAntennas,
+                     WifiPpduField field,
+                     uint16_t staId,
+                     uint8_t bucket) const;
+
+    Ptr<ErrorRateModel> m_model;       //!< the tabulated error rate model
+    dB_u m_minSnr;                     //!< lowest tabulated SNR
+    dB_u m_maxSnr;                     //!< highest tabulated SNR
+    dB_u m_minStep;                    //!< minimum grid step
+    double m_accuracy;                 //!< maximum interpolation error
+    mutable Tables* m_tables{nullptr}; //!< tables of the configuration, null until first used
+};
+
+} // namespace ns3
+
+#endif /* TABULATED_ERROR_RATE_MODEL_H */
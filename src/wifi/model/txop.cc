@@ -313,6 +313,7 @@ Txop::SetMinCw(uint32_t minCw, uint8_t linkId)
     if (changed)
     {
         ResetCw(linkId);
+        m_mac->NotifyEdcaParametersChanged(linkId);
     }
 }
 
@@ -356,6 +357,7 @@ Txop::SetMaxCw(uint32_t maxCw, uint8_t linkId)
     if (changed)
     {
         ResetCw(linkId);
+        m_mac->NotifyEdcaParametersChanged(linkId);
     }
 }
 
@@ -484,7 +486,12 @@ Txop::SetAifsn(uint8_t aifsn, uint8_t linkId)
     NS_LOG_FUNCTION(this << aifsn << linkId);
     NS_ASSERT_MSG(!m_links.empty(),
                   "This function can only be called after that links have been created");
-    GetLink(linkId).aifsn = aifsn;
+    auto& link = GetLink(linkId);
+    if (link.aifsn != aifsn)
+    {
+        link.aifsn = aifsn;
+        m_mac->NotifyEdcaParametersChanged(linkId);
+    }
 }
 
 void
@@ -524,7 +531,12 @@ Txop::SetTxopLimit(Time txopLimit, uint8_t linkId)
                   "The TXOP limit must be expressed in multiple of 32 microseconds!");
     NS_ASSERT_MSG(!m_links.empty(),
                   "This function can only be called after that links have been created");
-    GetLink(linkId).txopLimit = txopLimit;
+    auto& link = GetLink(linkId);
+    if (link.txopLimit != txopLimit)
+    {
+        link.txopLimit = txopLimit;
+        m_mac->NotifyEdcaParametersChanged(linkId);
+    }
 }
 
 const Txop::UserDefinedAccessParams&
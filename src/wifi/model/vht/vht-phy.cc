@@ -266,9 +266,7 @@ PhyEntity::PhyFieldRxStatus
 VhtPhy::EndReceiveSig(Ptr<Event> event, WifiPpduField field)
 {
     NS_LOG_FUNCTION(this << *event << field);
-    SnrPer snrPer = GetPhyHeaderSnrPer(field, event);
-    NS_LOG_DEBUG(field << ": SNR(dB)=" << RatioToDb(snrPer.snr) << ", PER=" << snrPer.per);
-    PhyFieldRxStatus status(GetRandomValue() > snrPer.per);
+    PhyFieldRxStatus status(IsPhyHeaderReceived(field, event));
     if (status.isSuccess)
     {
         NS_LOG_DEBUG("Received " << field);
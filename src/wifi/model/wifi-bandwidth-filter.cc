@@ -62,11 +62,12 @@ WifiBandwidthFilter::DoFilter(Ptr<const SpectrumSignalParameters> params,
                   "WifiPhy should be valid if WifiSpectrumSignalParameters was found and sending "
                   "to a WifiSpectrumPhyInterface");
 
-    BooleanValue trackSignalsInactiveInterfaces;
-    wifiPhy->GetAttribute("TrackSignalsFromInactiveInterfaces", trackSignalsInactiveInterfaces);
-
-    NS_ASSERT_MSG(trackSignalsInactiveInterfaces.Get() ||
-                      (interface == wifiPhy->GetCurrentInterface()),
+    NS_ASSERT_MSG((interface == wifiPhy->GetCurrentInterface()) || [&] {
+                      BooleanValue trackSignalsInactiveInterfaces;
+                      wifiPhy->GetAttribute("TrackSignalsFromInactiveInterfaces",
+                                            trackSignalsInactiveInterfaces);
+                      return trackSignalsInactiveInterfaces.Get();
+                  }(),
                   "DoFilter should not be called for an inactive interface if "
                   "SpectrumWifiPhy::TrackSignalsFromInactiveInterfaces attribute is not enabled");
 
@@ -83,14 +84,14 @@ WifiBandwidthFilter::DoFilter(Ptr<const SpectrumSignalParameters> params,
     const auto rxWidth =
         (wifiRxParams->ppdu->GetTxVector().GetChannelWidth() / rxCenterFreqs.size());
     const auto guardBandwidth = wifiPhy->GetGuardBandwidth(rxWidth);
+    const auto& operatingFrequencies = interface->GetCenterFrequencies();
+    const auto operatingChannelWidth = interface->GetChannelWidth() / operatingFrequencies.size();
+
     bool filter = true;
     for (auto rxCenterFreq : rxCenterFreqs)
     {
         const auto rxMinFreq = rxCenterFreq - rxWidth / 2 - guardBandwidth;
         const auto rxMaxFreq = rxCenterFreq + rxWidth / 2 + guardBandwidth;
-        const auto operatingFrequencies = interface->GetCenterFrequencies();
-        const auto operatingChannelWidth =
-            interface->GetChannelWidth() / operatingFrequencies.size();
         for (auto operatingFrequency : operatingFrequencies)
         {
             const auto channelMinFreq = operatingFrequency - operatingChannelWidth / 2;
@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "wifi-link-to-system-mapping.h"
+
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("WifiLinkToSystemMapping");
+
+NS_OBJECT_ENSURE_REGISTERED(WifiLinkToSystemMapping);
+
+TypeId
+WifiLinkToSystemMapping::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::WifiLinkToSystemMapping")
+            .SetParent<Object>()
+            .SetGroupName("Wifi")
+            .AddConstructor<WifiLinkToSystemMapping>()
+            .AddAttribute("Method",
+                          "The mapping used to compute the effective SINR",
+                          EnumValue(WifiLinkToSystemMapping::SHANNON),
+                          MakeEnumAccessor<Method>(&WifiLinkToSystemMapping::m_method),
+                          MakeEnumChecker(WifiLinkToSystemMapping::SHANNON,
+                                          "Shannon",
+                                          WifiLinkToSystemMapping::EESM,
+                                          "EESM"))
+            .AddAttribute("Beta",
+                          "The calibration factor of the EESM (linear scale)",
+                          DoubleValue(1),
+                          MakeDoubleAccessor(&WifiLinkToSystemMapping::m_beta),
+                          MakeDoubleChecker<double>(1e-3));
+    return tid;
+}
+
+WifiLinkToSystemMapping::WifiLinkToSystemMapping()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+WifiLinkToSystemMapping::~WifiLinkToSystemMapping()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+double
+WifiLinkToSystemMapping::GetEffectiveSnr(
+    const std::vector<std::pair<double, double>>& samples) const
+{
+    NS_LOG_FUNCTION(this << samples.size());
+    NS_ASSERT(!samples.empty());
+
+    double totalWeight = 0;
+    double sum = 0;
+    double snrEff = 0;
+    switch (m_method)
+    {
+    case SHANNON:
+        for (const auto& [weight, snr] : samples)
+        {
+            totalWeight += weight;
+            sum += weight * std::log2(1 + snr);
+        }
+        snrEff = (totalWeight > 0) ? std::exp2(sum / totalWeight) - 1 : samples.front().second;
+        break;
+    case EESM: {
+        // factor out the lowest SINR to avoid the underflow of the exponentials
+        const auto minSnr =
+            std::min_element(samples.cbegin(), samples.cend(), [](auto& a, auto& b) {
+                return a.second < b.second;
+            })->second;
+        for (const auto& [weight, snr] : samples)
+        {
+            totalWeight += weight;
+            sum += weight * std::exp(-(snr - minSnr) / m_beta);
+        }
+        snrEff = (totalWeight > 0) ? minSnr - m_beta * std::log(sum / totalWeight) : minSnr;
+        break;
+    }
+    default:
+        NS_ABORT_MSG("Unknown effective SINR mapping");
+    }
+    NS_LOG_DEBUG("Effective SINR of " << samples.size() << " samples: " << snrEff);
+    return snrEff;
+}
+
+} // namespace ns3
@@ -0,0 +1,70 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef WIFI_LINK_TO_SYSTEM_MAPPING_H
+#define WIFI_LINK_TO_SYSTEM_MAPPING_H
+
+#include "ns3/object.h"
+
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup wifi
+ * @brief Effective SINR mapping used by the abstracted PHY
+ *
+ * When a WifiLinkToSystemMapping is installed on a SpectrumWifiPhy (through the
+ * "LinkToSystemMapping" attribute), the PHY header fields are not evaluated and the
+ * reception of each MPDU is decided from a single draw: the SINRs experienced by the
+ * MPDU over the 20 MHz subchannels (or the RU) and over the chunks delimited by the
+ * changes of interference are compressed into a single effective SINR, which is then
+ * looked up in the AWGN curves of the error rate model of the PHY.
+ *
+ * Two mappings are supported:
+ *
+ * - SHANNON: the mean of the Shannon capacity log2(1 + SINR) is mapped back to an SINR.
+ *   This is a mutual information effective SINR mapping (MIESM) with the mutual
+ *   information of a Gaussian input instead of the one of the modulation, hence the
+ *   contribution of the high SINRs does not saturate at the number of bits per symbol;
+ * - EESM (exponential effective SINR mapping): SINR_eff = -beta ln(mean(exp(-SINR / beta))),
+ *   where beta is a calibration factor that depends on the MCS.
+ */
+class WifiLinkToSystemMapping : public Object
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    WifiLinkToSystemMapping();
+    ~WifiLinkToSystemMapping() override;
+
+    /// The supported effective SINR mappings
+    enum Method
+    {
+        SHANNON = 0,
+        EESM
+    };
+
+    /**
+     * Compute the effective SINR of a set of SINR samples.
+     *
+     * @param samples the weight (e.g., the duration) and the SINR (linear scale) of each sample
+     * @return the effective SINR (linear scale)
+     */
+    double GetEffectiveSnr(const std::vector<std::pair<double, double>>& samples) const;
+
+  private:
+    Method m_method; //!< the effective SINR mapping
+    double m_beta;   //!< the calibration factor of the EESM
+};
+
+} // namespace ns3
+
+#endif /* WIFI_LINK_TO_SYSTEM_MAPPING_H */
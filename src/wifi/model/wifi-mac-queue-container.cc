@@ -19,27 +19,57 @@
 namespace ns3
 {
 
+WifiMacQueueContainer::QueueInfo::QueueInfo(std::pmr::memory_resource* pool)
+    : queue(pool)
+{
+}
+
 void
 WifiMacQueueContainer::clear()
 {
     m_queues.clear();
     m_expiredQueue.clear();
-    m_nBytesPerQueue.clear();
+    m_expiryIndex.clear();
+    m_modifiedQueues.clear();
+}
+
+WifiMacQueueContainer::QueueInfo&
+WifiMacQueueContainer::GetQueueInfo(const WifiContainerQueueId& queueId) const
+{
+    return m_queues.try_emplace(queueId, &m_pool).first->second;
+}
+
+void
+WifiMacQueueContainer::NotifyModified(const WifiContainerQueueId& queueId, QueueInfo& info) const
+{
+    if (info.indexed)
+    {
+        m_expiryIndex.erase({info.nextExpiry, queueId});
+        info.indexed = false;
+    }
+    info.modified = true;
+    if (!info.toSweep)
+    {
+        info.toSweep = true;
+        m_modifiedQueues.push_back(queueId);
+    }
 }
 
 WifiMacQueueContainer::iterator
 WifiMacQueueContainer::insert(const_iterator pos, Ptr<WifiMpdu> item)
 {
     WifiContainerQueueId queueId = GetQueueId(item);
+    auto& info = GetQueueInfo(queueId);
 
-    NS_ABORT_MSG_UNLESS(pos == m_queues[queueId].cend() || GetQueueId(pos->mpdu) == queueId,
+    NS_ABORT_MSG_UNLESS(pos == info.queue.cend() || GetQueueId(pos->mpdu) == queueId,
                         "pos iterator does not point to the correct container queue");
     NS_ABORT_MSG_IF(!item->IsOriginal(), "Only the original copy of an MPDU can be inserted");
 
-    auto [it, ret] = m_nBytesPerQueue.insert({queueId, 0});
-    it->second += item->GetSize();
+    info.nBytes += item->GetSize();
+    // the expiry time of the new element is set after insertion
+    NotifyModified(queueId, info);
 
-    return m_queues[queueId].emplace(pos, item);
+    return info.queue.emplace(pos, item);
 }
 
 WifiMacQueueContainer::iterator
@@ -51,12 +81,12 @@ WifiMacQueueContainer::erase(const_iterator pos)
     }
 
     WifiContainerQueueId queueId = GetQueueId(pos->mpdu);
-    auto it = m_nBytesPerQueue.find(queueId);
-    NS_ASSERT(it != m_nBytesPerQueue.end());
-    NS_ASSERT(it->second >= pos->mpdu->GetSize());
-    it->second -= pos->mpdu->GetSize();
+    auto& info = GetQueueInfo(queueId);
+    NS_ASSERT(info.nBytes >= pos->mpdu->GetSize());
+    info.nBytes -= pos->mpdu->GetSize();
+    NotifyModified(queueId, info);
 
-    return m_queues[queueId].erase(pos);
+    return info.queue.erase(pos);
 }
 
 Ptr<WifiMpdu>
@@ -106,32 +136,36 @@ WifiMacQueueContainer::GetQueueId(Ptr<const WifiMpdu> mpdu)
 const WifiMacQueueContainer::ContainerQueue&
 WifiMacQueueContainer::GetQueue(const WifiContainerQueueId& queueId) const
 {
-    return m_queues[queueId];
+    return GetQueueInfo(queueId).queue;
 }
 
 uint32_t
 WifiMacQueueContainer::GetNBytes(const WifiContainerQueueId& queueId) const
 {
-    if (auto it = m_queues.find(queueId); it == m_queues.end() || it->second.empty())
+    if (auto it = m_queues.find(queueId); it == m_queues.end() || it->second.queue.empty())
     {
         return 0;
     }
-    return m_nBytesPerQueue.at(queueId);
+    return m_queues.at(queueId).nBytes;
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::ExtractExpiredMpdus(const WifiContainerQueueId& queueId) const
 {
-    return DoExtractExpiredMpdus(m_queues[queueId]);
+    return DoExtractExpiredMpdus(queueId, GetQueueInfo(queueId));
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
-WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
+WifiMacQueueContainer::DoExtractExpiredMpdus(const WifiContainerQueueId& queueId,
+                                             QueueInfo& info) const
 {
     std::optional<std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>> ret;
+    auto& queue = info.queue;
     auto firstExpiredIt = queue.begin();
     auto lastExpiredIt = firstExpiredIt;
     Time now = Simulator::Now();
+    // earliest expiry time of the MPDUs that are visited but not extracted
+    Time nextExpiry = Time::Max();
 
     do
     {
@@ -140,6 +174,7 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
              firstExpiredIt != queue.end() && !firstExpiredIt->inflights.empty();
              ++firstExpiredIt, ++lastExpiredIt)
         {
+            nextExpiry = Min(nextExpiry, firstExpiredIt->expiryTime);
         }
 
         if (!ret)
@@ -157,17 +192,19 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
             lastExpiredIt->ac = AC_UNDEF;
             lastExpiredIt->deleter(lastExpiredIt->mpdu);
 
-            WifiContainerQueueId queueId = GetQueueId(lastExpiredIt->mpdu);
-            auto it = m_nBytesPerQueue.find(queueId);
-            NS_ASSERT(it != m_nBytesPerQueue.end());
-            NS_ASSERT(it->second >= lastExpiredIt->mpdu->GetSize());
-            it->second -= lastExpiredIt->mpdu->GetSize();
+            NS_ASSERT(info.nBytes >= lastExpiredIt->mpdu->GetSize());
+            info.nBytes -= lastExpiredIt->mpdu->GetSize();
 
             ++lastExpiredIt;
         }
 
         if (lastExpiredIt == firstExpiredIt)
         {
+            if (lastExpiredIt != queue.end())
+            {
+                // the sweep stops at the first non-inflight MPDU that has not expired
+                nextExpiry = Min(nextExpiry, lastExpiredIt->expiryTime);
+            }
             break;
         }
 
@@ -177,6 +214,20 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
 
     } while (true);
 
+    // the container queue needs not be checked again until nextExpiry, unless it is modified
+    if (info.indexed)
+    {
+        m_expiryIndex.erase({info.nextExpiry, queueId});
+        info.indexed = false;
+    }
+    info.modified = false;
+    if (!queue.empty() && nextExpiry != Time::Max())
+    {
+        info.nextExpiry = nextExpiry;
+        info.indexed = true;
+        m_expiryIndex.emplace(nextExpiry, queueId);
+    }
+
     return *ret;
 }
 
@@ -185,16 +236,41 @@ WifiMacQueueContainer::ExtractAllExpiredMpdus() const
 {
     std::optional<WifiMacQueueContainer::iterator> firstExpiredIt;
 
-    for (auto& queue : m_queues)
-    {
-        auto [firstIt, lastIt] = DoExtractExpiredMpdus(queue.second);
+    auto extract = [&](const WifiContainerQueueId& queueId, QueueInfo& info) {
+        auto [firstIt, lastIt] = DoExtractExpiredMpdus(queueId, info);
 
         if (firstIt != lastIt && !firstExpiredIt)
         {
             // this is the first queue with MPDUs with expired lifetime
             firstExpiredIt = firstIt;
         }
+    };
+
+    // container queues that were not modified since they were last checked and in which
+    // an MPDU may have expired
+    std::vector<WifiContainerQueueId> dueQueues;
+    const auto now = Simulator::Now();
+    for (auto it = m_expiryIndex.cbegin(); it != m_expiryIndex.cend() && it->first <= now; ++it)
+    {
+        dueQueues.push_back(it->second);
     }
+    for (const auto& queueId : dueQueues)
+    {
+        extract(queueId, m_queues.at(queueId));
+    }
+
+    // container queues modified since they were last checked
+    for (const auto& queueId : m_modifiedQueues)
+    {
+        auto& info = m_queues.at(queueId);
+        info.toSweep = false;
+        if (info.modified)
+        {
+            extract(queueId, info);
+        }
+    }
+    m_modifiedQueues.clear();
+
     return std::make_pair(firstExpiredIt ? *firstExpiredIt : m_expiredQueue.end(),
                           m_expiredQueue.end());
 }
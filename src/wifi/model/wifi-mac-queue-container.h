@@ -14,9 +14,12 @@
 #include "ns3/mac48-address.h"
 
 #include <list>
+#include <memory_resource>
 #include <optional>
+#include <set>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -99,12 +102,22 @@ namespace ns3
  *
  * This container holds multiple container queues organized in an hash table
  * whose keys are WifiContainerQueueId tuples identifying the container queues.
+ *
+ * The elements of all the container queues are allocated from a memory pool owned
+ * by the container, so that the elements stored by an AP serving many stations are
+ * kept close in memory and enqueuing/dequeuing MPDUs does not involve the global heap.
+ *
+ * The container keeps track of the container queues that have been modified since
+ * the last time expired MPDUs were extracted and, for each of the other container
+ * queues, of the earliest time at which an MPDU may expire. Hence, extracting all
+ * the MPDUs with expired lifetime only visits the container queues that may contain
+ * such MPDUs, and takes constant time if there is none.
  */
 class WifiMacQueueContainer
 {
   public:
     /// Type of a queue held by the container
-    using ContainerQueue = std::list<WifiMacQueueElem>;
+    using ContainerQueue = std::pmr::list<WifiMacQueueElem>;
     /// iterator over elements in a container queue
     using iterator = ContainerQueue::iterator;
     /// const iterator over elements in a container queue
@@ -195,21 +208,62 @@ class WifiMacQueueContainer
     std::pair<iterator, iterator> GetAllExpiredMpdus() const;
 
   private:
+    /// Information associated with a container queue
+    struct QueueInfo
+    {
+        /**
+         * Constructor.
+         * @param pool the memory pool used to allocate the elements of the container queue
+         */
+        QueueInfo(std::pmr::memory_resource* pool);
+
+        ContainerQueue queue; //!< the container queue
+        uint32_t nBytes{0};   //!< size in bytes of the container queue
+        Time nextExpiry;      //!< earliest time an MPDU may expire (if indexed)
+        bool indexed{false};  //!< whether the container queue is in the expiry index
+        bool modified{false}; //!< whether the container queue was modified since last checked
+        bool toSweep{false};  //!< whether the container queue is in the list of modified queues
+    };
+
+    /**
+     * Get the information associated with the container queue identified by the given
+     * QueueId. The container queue is created if it does not exist.
+     *
+     * @param queueId the given QueueId
+     * @return the information associated with the container queue
+     */
+    QueueInfo& GetQueueInfo(const WifiContainerQueueId& queueId) const;
+
+    /**
+     * Record that the given container queue has been modified, hence it has to be
+     * checked for expired MPDUs the next time all the expired MPDUs are extracted.
+     *
+     * @param queueId the QueueId identifying the container queue
+     * @param info the information associated with the container queue
+     */
+    void NotifyModified(const WifiContainerQueueId& queueId, QueueInfo& info) const;
+
     /**
      * Transfer non-inflight MPDUs with expired lifetime in the given container queue to the
      * container queue storing MPDUs with expired lifetime.
      *
-     * @param queue the given container queue
+     * @param queueId the QueueId identifying the given container queue
+     * @param info the information associated with the given container queue
      * @return the range [first, last) of iterators pointing to the MPDUs transferred
      *         to the container queue storing MPDUs with expired lifetime
      */
-    std::pair<iterator, iterator> DoExtractExpiredMpdus(ContainerQueue& queue) const;
+    std::pair<iterator, iterator> DoExtractExpiredMpdus(const WifiContainerQueueId& queueId,
+                                                        QueueInfo& info) const;
 
-    mutable std::unordered_map<WifiContainerQueueId, ContainerQueue>
-        m_queues;                          //!< the container queues
-    mutable ContainerQueue m_expiredQueue; //!< queue storing MPDUs with expired lifetime
-    mutable std::unordered_map<WifiContainerQueueId, uint32_t>
-        m_nBytesPerQueue; //!< size in bytes of the container queues
+    mutable std::pmr::unsynchronized_pool_resource
+        m_pool; //!< memory pool of the elements of the container queues
+    mutable std::unordered_map<WifiContainerQueueId, QueueInfo>
+        m_queues;                                   //!< the container queues
+    mutable ContainerQueue m_expiredQueue{&m_pool}; //!< queue storing MPDUs with expired lifetime
+    mutable std::set<std::pair<Time, WifiContainerQueueId>>
+        m_expiryIndex; //!< container queues sorted by the earliest time an MPDU may expire
+    mutable std::vector<WifiContainerQueueId>
+        m_modifiedQueues; //!< container queues modified since the last sweep
 };
 
 } // namespace ns3
@@ -24,6 +24,8 @@
 #include <vector>
 
 class WifiMacQueueDropOldestTest;
+class WifiMacQueuePerformanceTest;
+class WifiMacQueueSchedulerConsistencyTest;
 
 namespace ns3
 {
@@ -44,6 +46,10 @@ class WifiMacQueueSchedulerImpl : public WifiMacQueueScheduler
   public:
     /// allow WifiMacQueueDropOldestTest class access
     friend class ::WifiMacQueueDropOldestTest;
+    /// allow WifiMacQueuePerformanceTest class access
+    friend class ::WifiMacQueuePerformanceTest;
+    /// allow WifiMacQueueSchedulerConsistencyTest class access
+    friend class ::WifiMacQueueSchedulerConsistencyTest;
 
     /**
      * @brief Get the type ID.
@@ -91,8 +97,6 @@ class WifiMacQueueSchedulerImpl : public WifiMacQueueScheduler
     void BlockAllQueues(WifiQueueBlockedReason reason, const std::set<uint8_t>& linkIds) final;
     /** @copydoc ns3::WifiMacQueueScheduler::UnblockAllQueues */
     void UnblockAllQueues(WifiQueueBlockedReason reason, const std::set<uint8_t>& linkIds) final;
-    /** @copydoc ns3::WifiMacQueueScheduler::GetAllQueuesBlockedOnLink */
-    bool GetAllQueuesBlockedOnLink(uint8_t linkId, WifiQueueBlockedReason reason) final;
     /** @copydoc ns3::WifiMacQueueScheduler::GetQueueLinkMask */
     std::optional<Mask> GetQueueLinkMask(AcIndex ac,
                                          const WifiContainerQueueId& queueId,
@@ -284,13 +288,6 @@ class WifiMacQueueSchedulerImpl : public WifiMacQueueScheduler
                           WifiQueueBlockedReason reason,
                           const std::set<uint8_t>& linkIds);
 
-    /**
-     * When it is requested to block all the queues, an entry is added to this map to store the
-     * reason and the IDs of the links to block. This information is used to block queues that
-     * will be created afterwards.
-     */
-    std::map<WifiQueueBlockedReason, std::set<uint8_t>> m_blockAllInfo;
-
     std::vector<PerAcInfo> m_perAcInfo{AC_UNDEF}; //!< vector of per-AC information
     NS_LOG_TEMPLATE_DECLARE;                      //!< the log component
 };
@@ -364,80 +361,7 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::InitQueueInfo(AcIndex ac, Ptr<cons
     // insert queueId in the queue info map if not present yet
     auto [queueInfoIt, ret] = m_perAcInfo[ac].queueInfoMap.insert({queueId, QueueInfo()});
 
-    // Initialize/update the set of link IDs depending on the container queue type
-    if (GetMac() && GetMac()->GetNLinks() > 1 &&
-        mpdu->GetHeader().GetAddr2() == GetMac()->GetAddress())
-    {
-        // this is an MLD and the TA field of the frame contains the MLD address,
-        // which means that the frame can be sent on multiple links
-        const auto rxAddr = mpdu->GetHeader().GetAddr1();
-
-        // this assert checks that the RA field also contain an MLD address, unless
-        // it contains the broadcast address
-        NS_ASSERT_MSG(rxAddr.IsGroup() || GetMac()->GetMldAddress(rxAddr) == rxAddr,
-                      "Address 1 (" << rxAddr << ") is not an MLD address");
-
-        // this assert checks that association (ML setup) has been established
-        // between sender and receiver (unless the receiver is the broadcast address)
-        NS_ASSERT_MSG(GetMac()->CanForwardPacketsTo(rxAddr),
-                      "Cannot forward frame to " << rxAddr
-                                                 << "; check that the receiver is associated");
-        // we have to include all the links in case of broadcast frame (we are an AP)
-        // and the links that have been setup with the receiver in case of unicast frame
-        for (const auto linkId : GetMac()->GetLinkIds())
-        {
-            if (rxAddr.IsGroup() ||
-                GetMac()->GetWifiRemoteStationManager(linkId)->GetAffiliatedStaAddress(rxAddr))
-            {
-                // the mask is not modified if linkId is already in the map
-                auto [it, inserted] = queueInfoIt->second.linkIds.try_emplace(linkId);
-
-                if (inserted)
-                {
-                    // linkId was not in the map, set the mask if all queues are blocked
-                    for (const auto& [reason, linkIds] : m_blockAllInfo)
-                    {
-                        if (linkIds.contains(linkId))
-                        {
-                            it->second.set(static_cast<std::size_t>(reason), true);
-                        }
-                    }
-                }
-            }
-            else
-            {
-                // this link is no (longer) setup
-                queueInfoIt->second.linkIds.erase(linkId);
-            }
-        }
-    }
-    else
-    {
-        // the TA field of the frame contains a link address, which means that the
-        // frame can only be sent on the corresponding link
-        auto linkId = GetMac() ? GetMac()->GetLinkIdByAddress(mpdu->GetHeader().GetAddr2())
-                               : SINGLE_LINK_OP_ID; // make unit test happy
-        NS_ASSERT(linkId.has_value());
-        auto& linkIdsMap = queueInfoIt->second.linkIds;
-        NS_ASSERT_MSG(linkIdsMap.size() <= 1,
-                      "At most one link can be associated with this container queue");
-        // set the link map to contain one entry corresponding to the computed link ID;
-        // unless the link map already contained such an entry (in which case the mask
-        // is preserved)
-        if (linkIdsMap.empty() || linkIdsMap.cbegin()->first != *linkId)
-        {
-            Mask mask;
-            for (const auto& [reason, linkIds] : m_blockAllInfo)
-            {
-                if (linkIds.contains(*linkId))
-                {
-                    mask.set(static_cast<std::size_t>(reason), true);
-                }
-            }
-
-            linkIdsMap = {{*linkId, mask}};
-        }
-    }
+    UpdateQueueLinks(mpdu, queueInfoIt->second.linkIds);
 
     return queueInfoIt;
 }
@@ -490,24 +414,8 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::GetLinkIds(
     const std::list<WifiQueueBlockedReason>& ignoredReasons)
 {
     auto queueInfoIt = InitQueueInfo(ac, mpdu);
-    std::list<uint8_t> linkIds;
 
-    // include only links that are not blocked in the returned list
-    for (auto [linkId, mask] : queueInfoIt->second.linkIds)
-    {
-        // reset the bits of the mask corresponding to the reasons to ignore
-        for (const auto reason : ignoredReasons)
-        {
-            mask.reset(static_cast<std::size_t>(reason));
-        }
-
-        if (mask.none())
-        {
-            linkIds.emplace_back(linkId);
-        }
-    }
-
-    return linkIds;
+    return GetUnblockedLinks(queueInfoIt->second.linkIds, ignoredReasons);
 }
 
 template <class Priority, class Compare>
@@ -528,45 +436,11 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::DoBlockQueues(
         std::copy(linkIds.cbegin(), linkIds.cend(), std::ostream_iterator<uint16_t>(ss, " "));
     }
     NS_LOG_FUNCTION(this << block << reason << ac << rxAddress << txAddress << ss.str());
-    std::list<WifiMacHeader> headers;
 
-    for (const auto queueType : types)
-    {
-        switch (queueType)
-        {
-        case WIFI_CTL_QUEUE:
-            headers.emplace_back(WIFI_MAC_CTL_BACKREQ);
-            break;
-        case WIFI_MGT_QUEUE:
-            headers.emplace_back(WIFI_MAC_MGT_ACTION);
-            break;
-        case WIFI_QOSDATA_QUEUE:
-            NS_ASSERT_MSG(!tids.empty(),
-                          "TID must be specified for queues containing QoS data frames");
-            for (const auto tid : tids)
-            {
-                headers.emplace_back(WIFI_MAC_QOSDATA);
-                headers.back().SetQosTid(tid);
-            }
-            break;
-        case WIFI_DATA_QUEUE:
-            headers.emplace_back(WIFI_MAC_DATA);
-            break;
-        }
-    }
-    for (auto& hdr : headers)
+    for (const auto& hdr : GetQueueHeaders(types, rxAddress, txAddress, tids))
     {
-        hdr.SetAddr1(rxAddress);
-        hdr.SetAddr2(txAddress);
-
         auto queueInfoIt = InitQueueInfo(ac, Create<WifiMpdu>(Create<Packet>(), hdr));
-        for (auto& [linkId, mask] : queueInfoIt->second.linkIds)
-        {
-            if (linkIds.empty() || linkIds.contains(linkId))
-            {
-                mask.set(static_cast<std::size_t>(reason), block);
-            }
-        }
+        SetLinkMasks(queueInfoIt->second.linkIds, block, reason, linkIds);
     }
 }
 
@@ -608,13 +482,7 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::DoBlockAllQueues(bool block,
     {
         for (auto& [queueId, queueInfo] : perAcInfo.queueInfoMap)
         {
-            for (auto& [linkId, mask] : queueInfo.linkIds)
-            {
-                if (linkIds.empty() || linkIds.contains(linkId))
-                {
-                    mask.set(static_cast<std::size_t>(reason), block);
-                }
-            }
+            SetLinkMasks(queueInfo.linkIds, block, reason, linkIds);
         }
     }
 }
@@ -625,15 +493,7 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::BlockAllQueues(WifiQueueBlockedRea
                                                              const std::set<uint8_t>& linkIds)
 {
     DoBlockAllQueues(true, reason, linkIds);
-
-    if (linkIds.empty())
-    {
-        m_blockAllInfo[reason] = GetMac()->GetLinkIds(); // all links blocked
-    }
-    else
-    {
-        m_blockAllInfo[reason].merge(std::set<uint8_t>{linkIds});
-    }
+    SetAllQueuesBlocked(true, reason, linkIds);
 }
 
 template <class Priority, class Compare>
@@ -642,38 +502,7 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::UnblockAllQueues(WifiQueueBlockedR
                                                                const std::set<uint8_t>& linkIds)
 {
     DoBlockAllQueues(false, reason, linkIds);
-
-    auto infoIt = m_blockAllInfo.find(reason);
-
-    if (infoIt == m_blockAllInfo.end())
-    {
-        return; // all queues were not blocked for the given reason
-    }
-    std::erase_if(infoIt->second,
-                  [&](uint8_t id) { return linkIds.empty() || linkIds.contains(id); });
-
-    if (infoIt->second.empty())
-    {
-        // no more links blocked for the given reason
-        m_blockAllInfo.erase(infoIt);
-    }
-}
-
-template <class Priority, class Compare>
-bool
-WifiMacQueueSchedulerImpl<Priority, Compare>::GetAllQueuesBlockedOnLink(
-    uint8_t linkId,
-    WifiQueueBlockedReason reason)
-{
-    for (const auto& [r, linkIds] : m_blockAllInfo)
-    {
-        if ((reason == WifiQueueBlockedReason::REASONS_COUNT || reason == r) &&
-            linkIds.contains(linkId))
-        {
-            return true;
-        }
-    }
-    return false;
+    SetAllQueuesBlocked(false, reason, linkIds);
 }
 
 template <class Priority, class Compare>
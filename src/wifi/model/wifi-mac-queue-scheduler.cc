@@ -8,6 +8,7 @@
 
 #include "wifi-mac-queue-scheduler.h"
 
+#include "wifi-mac-queue.h"
 #include "wifi-mac.h"
 
 namespace ns3
@@ -44,4 +45,246 @@ WifiMacQueueScheduler::GetMac() const
     return m_mac;
 }
 
+bool
+WifiMacQueueScheduler::UpdateQueueLinks(Ptr<const WifiMpdu> mpdu,
+                                        std::map<uint8_t, Mask>& linkMasks) const
+{
+    NS_LOG_FUNCTION(this << *mpdu);
+
+    bool changed = false;
+
+    // Initialize/update the set of link IDs depending on the container queue type
+    if (GetMac() && GetMac()->GetNLinks() > 1 &&
+        mpdu->GetHeader().GetAddr2() == GetMac()->GetAddress())
+    {
+        // this is an MLD and the TA field of the frame contains the MLD address,
+        // which means that the frame can be sent on multiple links
+        const auto rxAddr = mpdu->GetHeader().GetAddr1();
+
+        // this assert checks that the RA field also contain an MLD address, unless
+        // it contains the broadcast address
+        NS_ASSERT_MSG(rxAddr.IsGroup() || GetMac()->GetMldAddress(rxAddr) == rxAddr,
+                      "Address 1 (" << rxAddr << ") is not an MLD address");
+
+        // this assert checks that association (ML setup) has been established
+        // between sender and receiver (unless the receiver is the broadcast address)
+        NS_ASSERT_MSG(GetMac()->CanForwardPacketsTo(rxAddr),
+                      "Cannot forward frame to " << rxAddr
+                                                 << "; check that the receiver is associated");
+        // we have to include all the links in case of broadcast frame (we are an AP)
+        // and the links that have been setup with the receiver in case of unicast frame
+        for (const auto linkId : GetMac()->GetLinkIds())
+        {
+            if (rxAddr.IsGroup() ||
+                GetMac()->GetWifiRemoteStationManager(linkId)->GetAffiliatedStaAddress(rxAddr))
+            {
+                // the mask is not modified if linkId is already in the map
+                auto [it, inserted] = linkMasks.try_emplace(linkId);
+
+                if (inserted)
+                {
+                    // linkId was not in the map, set the mask if all queues are blocked
+                    for (const auto& [reason, linkIds] : m_blockAllInfo)
+                    {
+                        if (linkIds.contains(linkId))
+                        {
+                            it->second.set(static_cast<std::size_t>(reason), true);
+                        }
+                    }
+                    changed = true;
+                }
+            }
+            else
+            {
+                // this link is no (longer) setup
+                changed |= (linkMasks.erase(linkId) > 0);
+            }
+        }
+    }
+    else
+    {
+        // the TA field of the frame contains a link address, which means that the
+        // frame can only be sent on the corresponding link
+        auto linkId = GetMac() ? GetMac()->GetLinkIdByAddress(mpdu->GetHeader().GetAddr2())
+                               : SINGLE_LINK_OP_ID; // make unit test happy
+        NS_ASSERT(linkId.has_value());
+        NS_ASSERT_MSG(linkMasks.size() <= 1,
+                      "At most one link can be associated with this container queue");
+        // set the link map to contain one entry corresponding to the computed link ID;
+        // unless the link map already contained such an entry (in which case the mask
+        // is preserved)
+        if (linkMasks.empty() || linkMasks.cbegin()->first != *linkId)
+        {
+            Mask mask;
+            for (const auto& [reason, linkIds] : m_blockAllInfo)
+            {
+                if (linkIds.contains(*linkId))
+                {
+                    mask.set(static_cast<std::size_t>(reason), true);
+                }
+            }
+
+            linkMasks = {{*linkId, mask}};
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+void
+WifiMacQueueScheduler::SetAllQueuesBlocked(bool block,
+                                           WifiQueueBlockedReason reason,
+                                           const std::set<uint8_t>& linkIds)
+{
+    NS_LOG_FUNCTION(this << block << reason);
+
+    if (block)
+    {
+        if (linkIds.empty())
+        {
+            m_blockAllInfo[reason] = GetMac()->GetLinkIds(); // all links blocked
+        }
+        else
+        {
+            m_blockAllInfo[reason].merge(std::set<uint8_t>{linkIds});
+        }
+        return;
+    }
+
+    auto infoIt = m_blockAllInfo.find(reason);
+
+    if (infoIt == m_blockAllInfo.end())
+    {
+        return; // all queues were not blocked for the given reason
+    }
+    std::erase_if(infoIt->second,
+                  [&](uint8_t id) { return linkIds.empty() || linkIds.contains(id); });
+
+    if (infoIt->second.empty())
+    {
+        // no more links blocked for the given reason
+        m_blockAllInfo.erase(infoIt);
+    }
+}
+
+bool
+WifiMacQueueScheduler::GetAllQueuesBlockedOnLink(uint8_t linkId, WifiQueueBlockedReason reason)
+{
+    for (const auto& [r, linkIds] : m_blockAllInfo)
+    {
+        if ((reason == WifiQueueBlockedReason::REASONS_COUNT || reason == r) &&
+            linkIds.contains(linkId))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::list<WifiMacHeader>
+WifiMacQueueScheduler::GetQueueHeaders(const std::list<WifiContainerQueueType>& types,
+                                       const Mac48Address& rxAddress,
+                                       const Mac48Address& txAddress,
+                                       const std::set<uint8_t>& tids)
+{
+    std::list<WifiMacHeader> headers;
+
+    for (const auto queueType : types)
+    {
+        switch (queueType)
+        {
+        case WIFI_CTL_QUEUE:
+            headers.emplace_back(WIFI_MAC_CTL_BACKREQ);
+            break;
+        case WIFI_MGT_QUEUE:
+            headers.emplace_back(WIFI_MAC_MGT_ACTION);
+            break;
+        case WIFI_QOSDATA_QUEUE:
+            NS_ASSERT_MSG(!tids.empty(),
+                          "TID must be specified for queues containing QoS data frames");
+            for (const auto tid : tids)
+            {
+                headers.emplace_back(WIFI_MAC_QOSDATA);
+                headers.back().SetQosTid(tid);
+            }
+            break;
+        case WIFI_DATA_QUEUE:
+            headers.emplace_back(WIFI_MAC_DATA);
+            break;
+        }
+    }
+    for (auto& hdr : headers)
+    {
+        hdr.SetAddr1(rxAddress);
+        hdr.SetAddr2(txAddress);
+    }
+    return headers;
+}
+
+bool
+WifiMacQueueScheduler::SetLinkMasks(std::map<uint8_t, Mask>& linkMasks,
+                                    bool block,
+                                    WifiQueueBlockedReason reason,
+                                    const std::set<uint8_t>& linkIds)
+{
+    bool changed = false;
+    for (auto& [linkId, mask] : linkMasks)
+    {
+        if (linkIds.empty() || linkIds.contains(linkId))
+        {
+            const auto blocked = mask.any();
+            mask.set(static_cast<std::size_t>(reason), block);
+            changed |= (mask.any() != blocked);
+        }
+    }
+    return changed;
+}
+
+std::list<uint8_t>
+WifiMacQueueScheduler::GetUnblockedLinks(const std::map<uint8_t, Mask>& linkMasks,
+                                         const std::list<WifiQueueBlockedReason>& ignoredReasons)
+{
+    std::list<uint8_t> linkIds;
+
+    // include only links that are not blocked in the returned list
+    for (auto [linkId, mask] : linkMasks)
+    {
+        // reset the bits of the mask corresponding to the reasons to ignore
+        for (const auto reason : ignoredReasons)
+        {
+            mask.reset(static_cast<std::size_t>(reason));
+        }
+
+        if (mask.none())
+        {
+            linkIds.emplace_back(linkId);
+        }
+    }
+
+    return linkIds;
+}
+
+Ptr<WifiMpdu>
+WifiMacQueueScheduler::GetMpduToDrop(Ptr<WifiMacQueue> queue, const WifiContainerQueueId& queueId)
+{
+    if (std::get<WifiContainerQueueType>(queueId) == WIFI_MGT_QUEUE ||
+        std::get<WifiContainerQueueType>(queueId) == WIFI_CTL_QUEUE)
+    {
+        // do not drop control or management frames
+        return nullptr;
+    }
+
+    // do not drop frames that are inflight or to be retransmitted
+    Ptr<WifiMpdu> item;
+    while ((item = queue->PeekByQueueId(queueId, item)))
+    {
+        if (!item->IsInFlight() && !item->GetHeader().IsRetry())
+        {
+            return item;
+        }
+    }
+    return nullptr;
+}
+
 } // namespace ns3
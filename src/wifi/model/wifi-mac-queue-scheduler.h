@@ -10,18 +10,23 @@
 #define WIFI_MAC_QUEUE_SCHEDULER_H
 
 #include "qos-utils.h"
+#include "wifi-mac-header.h"
 #include "wifi-mac-queue-container.h"
 
 #include "ns3/object.h"
 
 #include <bitset>
+#include <list>
+#include <map>
 #include <optional>
+#include <set>
 
 namespace ns3
 {
 
 class WifiMpdu;
 class WifiMac;
+class WifiMacQueue;
 
 /**
  * @ingroup wifi
@@ -203,7 +208,7 @@ class WifiMacQueueScheduler : public Object
      */
     virtual bool GetAllQueuesBlockedOnLink(
         uint8_t linkId,
-        WifiQueueBlockedReason reason = WifiQueueBlockedReason::REASONS_COUNT) = 0;
+        WifiQueueBlockedReason reason = WifiQueueBlockedReason::REASONS_COUNT);
 
     /// Bitset identifying the reasons to block individual links for a container queue
     using Mask = std::bitset<static_cast<std::size_t>(WifiQueueBlockedReason::REASONS_COUNT)>;
@@ -268,8 +273,89 @@ class WifiMacQueueScheduler : public Object
      */
     Ptr<WifiMac> GetMac() const;
 
+    /**
+     * Initialize or update the map of the links over which the packets contained in the
+     * container queue used to store the given MPDU can be sent. The masks of the links that
+     * are added to the map are set if all the queues are blocked on such links, while the
+     * masks of the links already in the map are preserved.
+     *
+     * @param mpdu the given MPDU
+     * @param linkMasks the map of the links of the container queue used to store the given MPDU
+     * @return whether links have been added to or removed from the given map
+     */
+    bool UpdateQueueLinks(Ptr<const WifiMpdu> mpdu, std::map<uint8_t, Mask>& linkMasks) const;
+
+    /**
+     * Record that all the container queues are blocked or unblocked for the given reason on
+     * the given set of links, so that container queues created afterwards are blocked as well.
+     *
+     * @param block true if the queues are blocked, false if they are unblocked
+     * @param reason the reason for blocking the queues
+     * @param linkIds set of links (empty for all setup links)
+     */
+    void SetAllQueuesBlocked(bool block,
+                             WifiQueueBlockedReason reason,
+                             const std::set<uint8_t>& linkIds);
+
+    /**
+     * Get the MAC headers identifying the container queues of the given types that hold frames
+     * having the given Receiver Address (RA), Transmitter Address (TA) and TID (if needed).
+     *
+     * @param types the types of the queues
+     * @param rxAddress the Receiver Address (RA) of the frames
+     * @param txAddress the Transmitter Address (TA) of the frames
+     * @param tids the TIDs optionally identifying the queues
+     * @return the MAC headers identifying the container queues
+     */
+    static std::list<WifiMacHeader> GetQueueHeaders(const std::list<WifiContainerQueueType>& types,
+                                                    const Mac48Address& rxAddress,
+                                                    const Mac48Address& txAddress,
+                                                    const std::set<uint8_t>& tids);
+
+    /**
+     * Set or reset the bit corresponding to the given reason in the masks of the given links.
+     *
+     * @param linkMasks the map of the links of a container queue
+     * @param block true to set the bit, false to reset it
+     * @param reason the reason for blocking the links
+     * @param linkIds set of links (empty for all the links in the map)
+     * @return whether any of the links has been blocked or unblocked
+     */
+    static bool SetLinkMasks(std::map<uint8_t, Mask>& linkMasks,
+                             bool block,
+                             WifiQueueBlockedReason reason,
+                             const std::set<uint8_t>& linkIds);
+
+    /**
+     * @param linkMasks the map of the links of a container queue
+     * @param ignoredReasons list of reasons for blocking a link that are ignored
+     * @return the list of the IDs of the links that are not blocked
+     */
+    static std::list<uint8_t> GetUnblockedLinks(
+        const std::map<uint8_t, Mask>& linkMasks,
+        const std::list<WifiQueueBlockedReason>& ignoredReasons);
+
+    /**
+     * Get the first MPDU of the given container queue that can be dropped to make room for
+     * another MPDU, i.e., that is neither inflight nor to be retransmitted. Control and
+     * management frames are never dropped.
+     *
+     * @param queue the wifi MAC queue
+     * @param queueId the ID of the given container queue
+     * @return the MPDU to drop, if any, or a null pointer, otherwise
+     */
+    static Ptr<WifiMpdu> GetMpduToDrop(Ptr<WifiMacQueue> queue,
+                                       const WifiContainerQueueId& queueId);
+
   private:
     Ptr<WifiMac> m_mac; //!< MAC layer
+
+    /**
+     * When it is requested to block all the queues, an entry is added to this map to store the
+     * reason and the IDs of the links to block. This information is used to block queues that
+     * will be created afterwards.
+     */
+    std::map<WifiQueueBlockedReason, std::set<uint8_t>> m_blockAllInfo;
 };
 
 } // namespace ns3
@@ -710,6 +710,12 @@ WifiMac::NotifyChannelSwitching(uint8_t linkId)
     GetLink(linkId).stationManager->Reset();
 }
 
+void
+WifiMac::NotifyEdcaParametersChanged(uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << +linkId);
+}
+
 void
 WifiMac::NotifyTx(Ptr<const Packet> packet)
 {
@@ -487,6 +487,14 @@ class WifiMac : public Object
      */
     virtual void NotifyChannelSwitching(uint8_t linkId);
 
+    /**
+     * Notify that the EDCA parameters (CWmin, CWmax, AIFSN or TXOP limit) used by one of
+     * the Txop objects on the given link have been changed.
+     *
+     * @param linkId the ID of the given link
+     */
+    virtual void NotifyEdcaParametersChanged(uint8_t linkId);
+
     /**
      * @param packet the packet being enqueued
      *
@@ -20,6 +20,7 @@
 #include "ns3/simulator.h"
 
 #include <list>
+#include <memory_resource>
 #include <optional>
 #include <set>
 #include <variant>
@@ -147,7 +148,7 @@ class WifiMpdu : public SimpleRefCount<WifiMpdu>
     DeaggregatedMsdusCI end() const;
 
     /// Const iterator typedef
-    typedef std::list<WifiMacQueueElem>::iterator Iterator;
+    typedef std::pmr::list<WifiMacQueueElem>::iterator Iterator;
 
     /**
      * Set the queue iterator stored by this object.
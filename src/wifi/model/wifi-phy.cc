@@ -13,6 +13,8 @@
 #include "frame-capture-model.h"
 #include "interference-helper.h"
 #include "preamble-detection-model.h"
+#include "tabulated-error-rate-model.h"
+#include "wifi-link-to-system-mapping.h"
 #include "wifi-net-device.h"
 #include "wifi-ppdu.h"
 #include "wifi-psdu.h"
@@ -429,6 +431,13 @@ WifiPhy::DoInitialize()
             NS_LOG_WARN("Mobility not found, propagation models might not work properly");
         }
     }
+
+    // build the chunk success rate tables before the simulation starts
+    if (auto tabulated = DynamicCast<TabulatedErrorRateModel>(
+            m_interference ? m_interference->GetErrorRateModel() : nullptr))
+    {
+        tabulated->BuildTables(this);
+    }
 }
 
 void
@@ -442,6 +451,7 @@ WifiPhy::DoDispose()
     m_preambleDetectionModel = nullptr;
     m_wifiRadioEnergyModel = nullptr;
     m_postReceptionErrorModel = nullptr;
+    m_linkToSystemMapping = nullptr;
     if (m_interference)
     {
         m_interference->Dispose();
@@ -697,6 +707,19 @@ WifiPhy::SetPostReceptionErrorModel(const Ptr<ErrorModel> em)
     m_postReceptionErrorModel = em;
 }
 
+void
+WifiPhy::SetLinkToSystemMapping(const Ptr<WifiLinkToSystemMapping> mapping)
+{
+    NS_LOG_FUNCTION(this << mapping);
+    m_linkToSystemMapping = mapping;
+}
+
+Ptr<WifiLinkToSystemMapping>
+WifiPhy::GetLinkToSystemMapping() const
+{
+    return m_linkToSystemMapping;
+}
+
 void
 WifiPhy::SetFrameCaptureModel(const Ptr<FrameCaptureModel> model)
 {
@@ -44,6 +44,7 @@ class WifiRadioEnergyModel;
 class UniformRandomVariable;
 class InterferenceHelper;
 class ErrorRateModel;
+class WifiLinkToSystemMapping;
 class WifiMacHeader;
 
 /**
@@ -1072,6 +1073,19 @@ class WifiPhy : public Object
      * @param em Pointer to the ErrorModel.
      */
     void SetPostReceptionErrorModel(const Ptr<ErrorModel> em);
+    /**
+     * Set the link-to-system mapping used by the abstracted PHY. If a mapping is set,
+     * the PHY header fields are not evaluated and the reception of each MPDU is decided
+     * based on the effective SINR of the MPDU; otherwise, it is decided based on the
+     * SINR of each chunk of the MPDU (full PHY).
+     *
+     * @param mapping the link-to-system mapping (null to use the full PHY)
+     */
+    void SetLinkToSystemMapping(const Ptr<WifiLinkToSystemMapping> mapping);
+    /**
+     * @return the link-to-system mapping used by the abstracted PHY (null for the full PHY)
+     */
+    Ptr<WifiLinkToSystemMapping> GetLinkToSystemMapping() const;
     /**
      * Sets the frame capture model.
      *
@@ -1637,6 +1651,7 @@ class WifiPhy : public Object
     Ptr<PreambleDetectionModel> m_preambleDetectionModel; //!< Preamble detection model
     Ptr<WifiRadioEnergyModel> m_wifiRadioEnergyModel;     //!< Wifi radio energy model
     Ptr<ErrorModel> m_postReceptionErrorModel;            //!< Error model for receive packet events
+    Ptr<WifiLinkToSystemMapping> m_linkToSystemMapping;   //!< Mapping of the abstracted PHY
     Time m_timeLastPreambleDetected; //!< Record the time the last preamble was detected
     bool m_notifyRxMacHeaderEnd;     //!< whether the PHY is capable of notifying MAC header RX end
 
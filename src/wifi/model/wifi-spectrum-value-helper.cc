@@ -79,6 +79,90 @@ operator<(const WifiSpectrumModelId& lhs, const WifiSpectrumModelId& rhs)
 static std::map<WifiSpectrumModelId, Ptr<SpectrumModel>>
     g_wifiSpectrumModelMap; ///< static initializer for the class
 
+///< Wifi transmit PSD structure
+struct WifiTxPsdId
+{
+    /// The function creating the PSD
+    enum Type : uint8_t
+    {
+        DSSS = 0,
+        OFDM,
+        DUPLICATED_20MHZ,
+        HT_OFDM,
+        HE_OFDM,
+        HE_MU_OFDM
+    };
+
+    Type type;                               ///< the function creating the PSD
+    std::vector<MHz_u> centerFrequencies;    ///< center frequency per segment
+    MHz_u channelWidth;                      ///< channel width
+    Watt_u txPower;                          ///< transmit power
+    MHz_u guardBandwidth;                    ///< guard band width
+    std::vector<dBr_u> mask;                 ///< relative powers of the transmit mask
+    std::vector<bool> puncturedSubchannels;  ///< punctured 20 MHz subchannels
+    std::vector<WifiSpectrumBandIndices> ru; ///< RU band
+};
+
+/**
+ * Less than operator
+ * @param lhs the left hand side transmit PSD to compare
+ * @param rhs the right hand side transmit PSD to compare
+ * @returns true if the left hand side transmit PSD is less than the right hand side one
+ */
+bool
+operator<(const WifiTxPsdId& lhs, const WifiTxPsdId& rhs)
+{
+    return std::tie(lhs.type,
+                    lhs.centerFrequencies,
+                    lhs.channelWidth,
+                    lhs.txPower,
+                    lhs.guardBandwidth,
+                    lhs.mask,
+                    lhs.puncturedSubchannels,
+                    lhs.ru) < std::tie(rhs.type,
+                                       rhs.centerFrequencies,
+                                       rhs.channelWidth,
+                                       rhs.txPower,
+                                       rhs.guardBandwidth,
+                                       rhs.mask,
+                                       rhs.puncturedSubchannels,
+                                       rhs.ru);
+}
+
+/// transmit PSDs created so far
+static std::map<WifiTxPsdId, Ptr<const SpectrumValue>> g_wifiTxPsdMap;
+
+/// Maximum number of transmit PSDs kept in the cache (the cache is flushed when it is full)
+static const std::size_t WIFI_TX_PSD_MAP_MAX_SIZE = 4096;
+
+/**
+ * @param key the transmit PSD to look for
+ * @return the cached transmit PSD, if any, or a null pointer
+ */
+static Ptr<const SpectrumValue>
+FindTxPsd(const WifiTxPsdId& key)
+{
+    const auto it = g_wifiTxPsdMap.find(key);
+    return (it != g_wifiTxPsdMap.cend()) ? it->second : nullptr;
+}
+
+/**
+ * @param key the transmit PSD to cache
+ * @param psd the value of the transmit PSD
+ * @return the cached transmit PSD
+ */
+static Ptr<const SpectrumValue>
+AddTxPsd(WifiTxPsdId&& key, Ptr<const SpectrumValue> psd)
+{
+    if (g_wifiTxPsdMap.size() >= WIFI_TX_PSD_MAP_MAX_SIZE)
+    {
+        NS_LOG_DEBUG("Flush the cache of transmit PSDs");
+        g_wifiTxPsdMap.clear();
+    }
+    g_wifiTxPsdMap.emplace(std::move(key), psd);
+    return psd;
+}
+
 Ptr<SpectrumModel>
 WifiSpectrumValueHelper::GetSpectrumModel(const std::vector<MHz_u>& centerFrequencies,
                                           MHz_u channelWidth,
@@ -156,12 +240,17 @@ WifiSpectrumValueHelper::GetSpectrumModel(const std::vector<MHz_u>& centerFreque
 }
 
 // Power allocated to 71 center subbands out of 135 total subbands in the band
-Ptr<SpectrumValue>
+Ptr<const SpectrumValue>
 WifiSpectrumValueHelper::CreateDsssTxPowerSpectralDensity(MHz_u centerFrequency,
                                                           Watt_u txPower,
                                                           MHz_u guardBandwidth)
 {
     NS_LOG_FUNCTION(centerFrequency << txPower << +guardBandwidth);
+    WifiTxPsdId key{WifiTxPsdId::DSSS, {centerFrequency}, MHz_u{22}, txPower, guardBandwidth};
+    if (auto psd = FindTxPsd(key))
+    {
+        return psd;
+    }
     MHz_u channelWidth{22}; // DSSS channels are 22 MHz wide
     Hz_u carrierSpacing{312500};
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
@@ -182,10 +271,10 @@ WifiSpectrumValueHelper::CreateDsssTxPowerSpectralDensity(MHz_u centerFrequency,
             *vit = psd;
         }
     }
-    return c;
+    return AddTxPsd(std::move(key), c);
 }
 
-Ptr<SpectrumValue>
+Ptr<const SpectrumValue>
 WifiSpectrumValueHelper::CreateOfdmTxPowerSpectralDensity(MHz_u centerFrequency,
                                                           MHz_u channelWidth,
                                                           Watt_u txPower,
@@ -196,6 +285,16 @@ WifiSpectrumValueHelper::CreateOfdmTxPowerSpectralDensity(MHz_u centerFrequency,
 {
     NS_LOG_FUNCTION(centerFrequency << channelWidth << txPower << guardBandwidth << minInnerBand
                                     << minOuterBand << lowestPoint);
+    WifiTxPsdId key{WifiTxPsdId::OFDM,
+                    {centerFrequency},
+                    channelWidth,
+                    txPower,
+                    guardBandwidth,
+                    {minInnerBand, minOuterBand, lowestPoint}};
+    if (auto psd = FindTxPsd(key))
+    {
+        return psd;
+    }
     Hz_u carrierSpacing{0};
     uint32_t innerSlopeWidth = 0;
     switch (static_cast<uint16_t>(channelWidth))
@@ -255,10 +354,10 @@ WifiSpectrumValueHelper::CreateOfdmTxPowerSpectralDensity(MHz_u centerFrequency,
                               lowestPoint);
     NormalizeSpectrumMask(c, txPower);
     NS_ASSERT_MSG(std::abs(txPower - Integral(*c)) < 1e-6, "Power allocation failed");
-    return c;
+    return AddTxPsd(std::move(key), c);
 }
 
-Ptr<SpectrumValue>
+Ptr<const SpectrumValue>
 WifiSpectrumValueHelper::CreateDuplicated20MhzTxPowerSpectralDensity(
     const std::vector<MHz_u>& centerFrequencies,
     MHz_u channelWidth,
@@ -276,6 +375,17 @@ WifiSpectrumValueHelper::CreateDuplicated20MhzTxPowerSpectralDensity(
     NS_LOG_FUNCTION(printFrequencies(centerFrequencies)
                     << channelWidth << txPower << guardBandwidth << minInnerBand << minOuterBand
                     << lowestPoint);
+    WifiTxPsdId key{WifiTxPsdId::DUPLICATED_20MHZ,
+                    centerFrequencies,
+                    channelWidth,
+                    txPower,
+                    guardBandwidth,
+                    {minInnerBand, minOuterBand, lowestPoint},
+                    puncturedSubchannels};
+    if (auto psd = FindTxPsd(key))
+    {
+        return psd;
+    }
     const Hz_u carrierSpacing{312500};
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
         GetSpectrumModel(centerFrequencies, channelWidth, carrierSpacing, guardBandwidth));
@@ -361,10 +471,10 @@ WifiSpectrumValueHelper::CreateDuplicated20MhzTxPowerSpectralDensity(
                               puncturedSlopeWidth);
     NormalizeSpectrumMask(c, txPower);
     NS_ASSERT_MSG(std::abs(txPower - Integral(*c)) < 1e-6, "Power allocation failed");
-    return c;
+    return AddTxPsd(std::move(key), c);
 }
 
-Ptr<SpectrumValue>
+Ptr<const SpectrumValue>
 WifiSpectrumValueHelper::CreateHtOfdmTxPowerSpectralDensity(
     const std::vector<MHz_u>& centerFrequencies,
     MHz_u channelWidth,
@@ -381,6 +491,16 @@ WifiSpectrumValueHelper::CreateHtOfdmTxPowerSpectralDensity(
     NS_LOG_FUNCTION(printFrequencies(centerFrequencies)
                     << channelWidth << txPower << guardBandwidth << minInnerBand << minOuterBand
                     << lowestPoint);
+    WifiTxPsdId key{WifiTxPsdId::HT_OFDM,
+                    centerFrequencies,
+                    channelWidth,
+                    txPower,
+                    guardBandwidth,
+                    {minInnerBand, minOuterBand, lowestPoint}};
+    if (auto psd = FindTxPsd(key))
+    {
+        return psd;
+    }
     const Hz_u carrierSpacing{312500};
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
         GetSpectrumModel(centerFrequencies, channelWidth, carrierSpacing, guardBandwidth));
@@ -451,10 +571,10 @@ WifiSpectrumValueHelper::CreateHtOfdmTxPowerSpectralDensity(
                               lowestPoint);
     NormalizeSpectrumMask(c, txPower);
     NS_ASSERT_MSG(std::abs(txPower - Integral(*c)) < 1e-6, "Power allocation failed");
-    return c;
+    return AddTxPsd(std::move(key), c);
 }
 
-Ptr<SpectrumValue>
+Ptr<const SpectrumValue>
 WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
     MHz_u centerFrequency,
     MHz_u channelWidth,
@@ -475,7 +595,7 @@ WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
                                               puncturedSubchannels);
 }
 
-Ptr<SpectrumValue>
+Ptr<const SpectrumValue>
 WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
     const std::vector<MHz_u>& centerFrequencies,
     MHz_u channelWidth,
@@ -492,6 +612,17 @@ WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
     NS_LOG_FUNCTION(printFrequencies(centerFrequencies)
                     << channelWidth << txPower << guardBandwidth << minInnerBand << minOuterBand
                     << lowestPoint);
+    WifiTxPsdId key{WifiTxPsdId::HE_OFDM,
+                    centerFrequencies,
+                    channelWidth,
+                    txPower,
+                    guardBandwidth,
+                    {minInnerBand, minOuterBand, lowestPoint},
+                    puncturedSubchannels};
+    if (auto psd = FindTxPsd(key))
+    {
+        return psd;
+    }
     const Hz_u carrierSpacing{78125};
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
         GetSpectrumModel(centerFrequencies, channelWidth, carrierSpacing, guardBandwidth));
@@ -643,10 +774,10 @@ WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
                               puncturedSlopeWidth);
     NormalizeSpectrumMask(c, txPower);
     NS_ASSERT_MSG(std::abs(txPower - Integral(*c)) < 1e-6, "Power allocation failed");
-    return c;
+    return AddTxPsd(std::move(key), c);
 }
 
-Ptr<SpectrumValue>
+Ptr<const SpectrumValue>
 WifiSpectrumValueHelper::CreateHeMuOfdmTxPowerSpectralDensity(
     const std::vector<MHz_u>& centerFrequencies,
     MHz_u channelWidth,
@@ -664,6 +795,18 @@ WifiSpectrumValueHelper::CreateHeMuOfdmTxPowerSpectralDensity(
     };
     NS_LOG_FUNCTION(printFrequencies(centerFrequencies)
                     << channelWidth << txPower << guardBandwidth << printRuIndices(ru));
+    WifiTxPsdId key{WifiTxPsdId::HE_MU_OFDM,
+                    centerFrequencies,
+                    channelWidth,
+                    txPower,
+                    guardBandwidth,
+                    {},
+                    {},
+                    ru};
+    if (auto psd = FindTxPsd(key))
+    {
+        return psd;
+    }
     const Hz_u carrierSpacing{78125};
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
         GetSpectrumModel(centerFrequencies, channelWidth, carrierSpacing, guardBandwidth));
@@ -686,7 +829,7 @@ WifiSpectrumValueHelper::CreateHeMuOfdmTxPowerSpectralDensity(
         *vit = allocated ? psd : 0.0;
     }
 
-    return c;
+    return AddTxPsd(std::move(key), c);
 }
 
 void
@@ -31,6 +31,11 @@ using WifiSpectrumBandIndices = std::pair<uint32_t, uint32_t>;
  *  This class defines all functions to create a spectrum model for
  *  Wi-Fi based on a a spectral model aligned with an OFDM subcarrier
  *  spacing of 312.5 KHz (model also reused for DSSS modulations)
+ *
+ *  Transmit power spectral densities are cached: the calls to a
+ *  Create*TxPowerSpectralDensity function with the same arguments return
+ *  the PSD computed by the first call, which must not be modified (callers
+ *  that need to modify it have to copy it first).
  */
 class WifiSpectrumValueHelper
 {
@@ -69,12 +74,12 @@ class WifiSpectrumValueHelper
      * @param centerFrequency center frequency
      * @param txPower transmit power to allocate
      * @param guardBandwidth width of the guard band
-     * @returns a pointer to a newly allocated SpectrumValue representing the DSSS Transmit Power
+     * @returns a pointer to the cached SpectrumValue representing the DSSS Transmit Power
      * Spectral Density in W/Hz
      */
-    static Ptr<SpectrumValue> CreateDsssTxPowerSpectralDensity(MHz_u centerFrequency,
-                                                               Watt_u txPower,
-                                                               MHz_u guardBandwidth);
+    static Ptr<const SpectrumValue> CreateDsssTxPowerSpectralDensity(MHz_u centerFrequency,
+                                                                     Watt_u txPower,
+                                                                     MHz_u guardBandwidth);
 
     /**
      * Create a transmit power spectral density corresponding to OFDM
@@ -88,16 +93,17 @@ class WifiSpectrumValueHelper
      * @param minInnerBand the minimum relative power in the inner band
      * @param minOuterband the minimum relative power in the outer band
      * @param lowestPoint maximum relative power of the outermost subcarriers of the guard band
-     * @return a pointer to a newly allocated SpectrumValue representing the OFDM Transmit Power
+     * @return a pointer to the cached SpectrumValue representing the OFDM Transmit Power
      * Spectral Density in W/Hz for each Band
      */
-    static Ptr<SpectrumValue> CreateOfdmTxPowerSpectralDensity(MHz_u centerFrequency,
-                                                               MHz_u channelWidth,
-                                                               Watt_u txPower,
-                                                               MHz_u guardBandwidth,
-                                                               dBr_u minInnerBand = dBr_u{-20},
-                                                               dBr_u minOuterband = dBr_u{-28},
-                                                               dBr_u lowestPoint = dBr_u{-40});
+    static Ptr<const SpectrumValue> CreateOfdmTxPowerSpectralDensity(
+        MHz_u centerFrequency,
+        MHz_u channelWidth,
+        Watt_u txPower,
+        MHz_u guardBandwidth,
+        dBr_u minInnerBand = dBr_u{-20},
+        dBr_u minOuterband = dBr_u{-28},
+        dBr_u lowestPoint = dBr_u{-40});
 
     /**
      * Create a transmit power spectral density corresponding to OFDM duplicated over multiple 20
@@ -111,10 +117,10 @@ class WifiSpectrumValueHelper
      * @param minOuterband the minimum relative power in the outer band
      * @param lowestPoint maximum relative power of the outermost subcarriers of the guard band
      * @param puncturedSubchannels bitmap indicating whether a 20 MHz subchannel is punctured or not
-     * @return a pointer to a newly allocated SpectrumValue representing the duplicated 20 MHz OFDM
+     * @return a pointer to the cached SpectrumValue representing the duplicated 20 MHz OFDM
      * Transmit Power Spectral Density in W/Hz for each Band
      */
-    static Ptr<SpectrumValue> CreateDuplicated20MhzTxPowerSpectralDensity(
+    static Ptr<const SpectrumValue> CreateDuplicated20MhzTxPowerSpectralDensity(
         const std::vector<MHz_u>& centerFrequencies,
         MHz_u channelWidth,
         Watt_u txPower,
@@ -136,10 +142,10 @@ class WifiSpectrumValueHelper
      * @param minInnerBand the minimum relative power in the inner band
      * @param minOuterband the minimum relative power in the outer band
      * @param lowestPoint maximum relative power of the outermost subcarriers of the guard band
-     * @return a pointer to a newly allocated SpectrumValue representing the HT OFDM Transmit Power
+     * @return a pointer to the cached SpectrumValue representing the HT OFDM Transmit Power
      * Spectral Density in W/Hz for each Band
      */
-    static Ptr<SpectrumValue> CreateHtOfdmTxPowerSpectralDensity(
+    static Ptr<const SpectrumValue> CreateHtOfdmTxPowerSpectralDensity(
         const std::vector<MHz_u>& centerFrequencies,
         MHz_u channelWidth,
         Watt_u txPower,
@@ -161,10 +167,10 @@ class WifiSpectrumValueHelper
      * @param minOuterband the minimum relative power in the outer band
      * @param lowestPoint maximum relative power of the outermost subcarriers of the guard band
      * @param puncturedSubchannels bitmap indicating whether a 20 MHz subchannel is punctured or not
-     * @return a pointer to a newly allocated SpectrumValue representing the HE OFDM Transmit Power
+     * @return a pointer to the cached SpectrumValue representing the HE OFDM Transmit Power
      * Spectral Density in W/Hz for each Band
      */
-    static Ptr<SpectrumValue> CreateHeOfdmTxPowerSpectralDensity(
+    static Ptr<const SpectrumValue> CreateHeOfdmTxPowerSpectralDensity(
         MHz_u centerFrequency,
         MHz_u channelWidth,
         Watt_u txPower,
@@ -187,10 +193,10 @@ class WifiSpectrumValueHelper
      * @param minOuterband the minimum relative power in the outer band
      * @param lowestPoint maximum relative power of the outermost subcarriers of the guard band
      * @param puncturedSubchannels bitmap indicating whether a 20 MHz subchannel is punctured or not
-     * @return a pointer to a newly allocated SpectrumValue representing the HE OFDM Transmit Power
+     * @return a pointer to the cached SpectrumValue representing the HE OFDM Transmit Power
      * Spectral Density in W/Hz for each Band
      */
-    static Ptr<SpectrumValue> CreateHeOfdmTxPowerSpectralDensity(
+    static Ptr<const SpectrumValue> CreateHeOfdmTxPowerSpectralDensity(
         const std::vector<MHz_u>& centerFrequencies,
         MHz_u channelWidth,
         Watt_u txPower,
@@ -210,10 +216,10 @@ class WifiSpectrumValueHelper
      * @param txPower transmit power to allocate
      * @param guardBandwidth width of the guard band
      * @param ru the RU band used by the STA
-     * @return a pointer to a newly allocated SpectrumValue representing the HE OFDM Transmit Power
+     * @return a pointer to the cached SpectrumValue representing the HE OFDM Transmit Power
      * Spectral Density on the RU used by the STA in W/Hz for each Band
      */
-    static Ptr<SpectrumValue> CreateHeMuOfdmTxPowerSpectralDensity(
+    static Ptr<const SpectrumValue> CreateHeMuOfdmTxPowerSpectralDensity(
         const std::vector<MHz_u>& centerFrequencies,
         MHz_u channelWidth,
         Watt_u txPower,
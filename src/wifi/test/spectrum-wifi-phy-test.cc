@@ -6,6 +6,7 @@
 
 #include "ns3/boolean.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/double.h"
 #include "ns3/he-phy.h" //includes OFDM PHY
 #include "ns3/interference-helper.h"
 #include "ns3/log.h"
@@ -20,6 +21,7 @@
 #include "ns3/string.h"
 #include "ns3/test.h"
 #include "ns3/waveform-generator.h"
+#include "ns3/wifi-link-to-system-mapping.h"
 #include "ns3/wifi-mac-header.h"
 #include "ns3/wifi-net-device.h"
 #include "ns3/wifi-phy-listener.h"
@@ -91,7 +93,7 @@ class ExtInterferenceHelper : public InterferenceHelper
      */
     bool IsBandTracked(const std::vector<WifiSpectrumBandFrequencies>& startStopFreqs) const
     {
-        for (const auto& [band, nis] : m_niChanges)
+        for (const auto& band : m_bands)
         {
             if (band.frequencies == startStopFreqs)
             {
@@ -207,7 +209,7 @@ SpectrumWifiPhyBasicTest::MakeSignal(Watt_u txPower, const WifiPhyOperatingChann
         txPower,
         GUARD_WIDTH);
     auto txParams = Create<WifiSpectrumSignalParameters>();
-    txParams->psd = txPowerSpectrum;
+    txParams->psd = txPowerSpectrum->Copy();
     txParams->txPhy = nullptr;
     txParams->duration = txDuration;
     txParams->ppdu = ppdu;
@@ -446,6 +448,105 @@ SpectrumWifiPhyListenerTest::DoRun()
     m_listener.reset();
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Spectrum Wifi Phy Abstraction Test
+ *
+ * Check the effective SINR mappings and that the abstracted PHY decides the reception
+ * of the MPDUs while keeping the notifications of the PHY state helper: a PPDU whose
+ * PHY header would not be decoded by the full PHY is received and its payload is failed.
+ */
+class SpectrumWifiPhyAbstractionTest : public SpectrumWifiPhyBasicTest
+{
+  public:
+    SpectrumWifiPhyAbstractionTest();
+
+  private:
+    void DoSetup() override;
+    void DoRun() override;
+
+    /**
+     * Check the number of notifications received so far.
+     *
+     * @param rxEndOk the expected number of successful receptions
+     * @param rxEndError the expected number of failed receptions
+     */
+    void CheckRxEnd(uint32_t rxEndOk, uint32_t rxEndError);
+
+    Ptr<WifiLinkToSystemMapping> m_mapping;      ///< link-to-system mapping
+    std::shared_ptr<TestPhyListener> m_listener; ///< listener
+};
+
+SpectrumWifiPhyAbstractionTest::SpectrumWifiPhyAbstractionTest()
+    : SpectrumWifiPhyBasicTest("SpectrumWifiPhy test of the abstracted PHY")
+{
+}
+
+void
+SpectrumWifiPhyAbstractionTest::DoSetup()
+{
+    SpectrumWifiPhyBasicTest::DoSetup();
+    m_mapping = CreateObject<WifiLinkToSystemMapping>();
+    m_phy->SetAttribute("LinkToSystemMapping", PointerValue(m_mapping));
+    m_listener = std::make_shared<TestPhyListener>();
+    m_phy->RegisterListener(m_listener);
+}
+
+void
+SpectrumWifiPhyAbstractionTest::CheckRxEnd(uint32_t rxEndOk, uint32_t rxEndError)
+{
+    NS_TEST_EXPECT_MSG_EQ(m_listener->m_notifyRxEndOk, rxEndOk, "Unexpected successful RX");
+    NS_TEST_EXPECT_MSG_EQ(m_listener->m_notifyRxEndError, rxEndError, "Unexpected failed RX");
+}
+
+void
+SpectrumWifiPhyAbstractionTest::DoRun()
+{
+    const std::vector<std::pair<double, double>> samples{{1, 1}, {1, 3}, {2, 10}};
+    NS_TEST_EXPECT_MSG_EQ_TOL(m_mapping->GetEffectiveSnr({{1, 5}, {3, 5}}),
+                              5,
+                              1e-9,
+                              "Effective SNR of equal samples differs");
+    NS_TEST_EXPECT_MSG_EQ_TOL(m_mapping->GetEffectiveSnr(samples),
+                              std::exp2((1 + 2 + 2 * std::log2(11)) / 4) - 1,
+                              1e-9,
+                              "Unexpected Shannon effective SNR");
+    m_mapping->SetAttribute("Method", StringValue("EESM"));
+    m_mapping->SetAttribute("Beta", DoubleValue(2));
+    NS_TEST_EXPECT_MSG_EQ_TOL(
+        m_mapping->GetEffectiveSnr(samples),
+        -2 * std::log((std::exp(-0.5) + std::exp(-1.5) + 2 * std::exp(-5)) / 4),
+        1e-9,
+        "Unexpected EESM effective SNR");
+    NS_TEST_EXPECT_MSG_EQ_TOL(m_mapping->GetEffectiveSnr({{1, 5}, {3, 5}}),
+                              5,
+                              1e-9,
+                              "Effective SNR of equal samples differs");
+
+    Simulator::Schedule(Seconds(1),
+                        &SpectrumWifiPhyAbstractionTest::SendSignal,
+                        this,
+                        Watt_u{0.01});
+    Simulator::Schedule(Seconds(1.5), &SpectrumWifiPhyAbstractionTest::CheckRxEnd, this, 1, 0);
+    Simulator::Schedule(Seconds(2),
+                        &SpectrumWifiPhyAbstractionTest::SendSignal,
+                        this,
+                        DbmToW(dBm_u{-97}));
+    // the second PPDU is received about 3 dB below the noise floor: its PHY header is
+    // not checked by the abstracted PHY and its payload is failed
+    Simulator::Schedule(Seconds(2.5), &SpectrumWifiPhyAbstractionTest::CheckRxEnd, this, 1, 1);
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_count, 2, "Didn't receive right number of packets");
+    NS_TEST_ASSERT_MSG_EQ(m_listener->m_notifyRxStart, 2, "Didn't receive NotifyRxStart");
+
+    Simulator::Destroy();
+    m_listener.reset();
+    m_mapping = nullptr;
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -2799,6 +2900,7 @@ SpectrumWifiPhyTestSuite::SpectrumWifiPhyTestSuite()
 {
     AddTestCase(new SpectrumWifiPhyBasicTest, TestCase::Duration::QUICK);
     AddTestCase(new SpectrumWifiPhyListenerTest, TestCase::Duration::QUICK);
+    AddTestCase(new SpectrumWifiPhyAbstractionTest, TestCase::Duration::QUICK);
     AddTestCase(new SpectrumWifiPhyFilterTest, TestCase::Duration::QUICK);
     AddTestCase(new SpectrumWifiPhyGetBandTest, TestCase::Duration::QUICK);
     AddTestCase(new SpectrumWifiPhyTrackedBandsTest, TestCase::Duration::QUICK);
@@ -14,16 +14,27 @@
 #include <gsl/gsl_sf_bessel.h>
 #endif
 
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/double.h"
 #include "ns3/dsss-error-rate-model.h"
+#include "ns3/error-rate-table-file.h"
 #include "ns3/he-phy.h" //includes HT and VHT
 #include "ns3/interference-helper.h"
 #include "ns3/log.h"
 #include "ns3/nist-error-rate-model.h"
+#include "ns3/ofdm-phy.h"
+#include "ns3/pointer.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
 #include "ns3/table-based-error-rate-model.h"
+#include "ns3/tabulated-error-rate-model.h"
 #include "ns3/test.h"
 #include "ns3/wifi-phy.h"
+#include "ns3/wifi-ppdu.h"
+#include "ns3/wifi-psdu.h"
 #include "ns3/wifi-utils.h"
 #include "ns3/yans-error-rate-model.h"
+#include "ns3/yans-wifi-phy.h"
 
 using namespace ns3;
 
@@ -390,6 +401,7 @@ class TestInterferenceHelper : public InterferenceHelper
   public:
     using InterferenceHelper::CalculatePayloadChunkSuccessRate;
     using InterferenceHelper::CalculateSnr;
+    using InterferenceHelper::m_niChanges;
 };
 
 /**
@@ -1102,6 +1114,544 @@ TableBasedErrorRateTestCase::DoRun()
     }
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Table-based Error Rate Model with tables loaded from a file Test Case
+ *
+ * Write an error rate table file, check that it is read back unchanged and that the
+ * TableBasedErrorRateModel uses its tables for the transmissions they cover and the
+ * built-in tables otherwise.
+ */
+class TableBasedErrorRateFileTestCase : public TestCase
+{
+  public:
+    TableBasedErrorRateFileTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+TableBasedErrorRateFileTestCase::TableBasedErrorRateFileTestCase()
+    : TestCase("Table-based error rate model with tables loaded from a file")
+{
+}
+
+void
+TableBasedErrorRateFileTestCase::DoRun()
+{
+    ErrorRateTableFile file;
+    file.description = "test tables";
+    // HE MCS 11 is not covered by the built-in tables
+    file.tables.push_back({11,
+                           true,
+                           MHz_u{20},
+                           1000,
+                           {{dB_u{30.0}, 1.0}, {dB_u{31.5}, 0.5}, {dB_u{32.25}, 0.1}}});
+    file.tables.push_back({11, true, MHz_u{20}, 100, {{dB_u{28.0}, 1.0}, {dB_u{29.0}, 0.0}}});
+    file.tables.push_back({0, false, MHz_u{40}, 500, {{dB_u{-1.0}, 0.8}, {dB_u{1.0}, 0.2}}});
+    const auto filename = CreateTempDirFilename("wifi-error-rate-tables.bin");
+    WriteErrorRateTableFile(filename, file);
+
+    const auto readFile = ReadErrorRateTableFile(filename);
+    NS_TEST_EXPECT_MSG_EQ(readFile.description, file.description, "Unexpected description");
+    NS_TEST_ASSERT_MSG_EQ(readFile.tables.size(), file.tables.size(), "Unexpected nb of tables");
+    for (std::size_t i = 0; i < file.tables.size(); ++i)
+    {
+        const auto& expected = file.tables.at(i);
+        const auto& table = readFile.tables.at(i);
+        NS_TEST_EXPECT_MSG_EQ(+table.mcs, +expected.mcs, "Unexpected MCS");
+        NS_TEST_EXPECT_MSG_EQ(table.ldpc, expected.ldpc, "Unexpected FEC coding");
+        NS_TEST_EXPECT_MSG_EQ(table.channelWidth, expected.channelWidth, "Unexpected width");
+        NS_TEST_EXPECT_MSG_EQ(table.refSize, expected.refSize, "Unexpected reference size");
+        NS_TEST_ASSERT_MSG_EQ(table.table.size(), expected.table.size(), "Unexpected nb of points");
+        for (std::size_t j = 0; j < expected.table.size(); ++j)
+        {
+            NS_TEST_EXPECT_MSG_EQ(table.table.at(j).first,
+                                  expected.table.at(j).first,
+                                  "Unexpected SNR");
+            // PERs are stored in single precision
+            NS_TEST_EXPECT_MSG_EQ_TOL(table.table.at(j).second,
+                                      expected.table.at(j).second,
+                                      1e-6,
+                                      "Unexpected PER");
+        }
+    }
+
+    auto model = CreateObjectWithAttributes<TableBasedErrorRateModel>("TableFile",
+                                                                      StringValue(filename));
+    auto builtIn = CreateObject<TableBasedErrorRateModel>();
+    WifiTxVector txVector;
+    txVector.SetChannelWidth(MHz_u{20});
+    txVector.SetMode(HePhy::GetHeMcs11());
+    txVector.SetLdpc(true);
+
+    auto getPer = [&](Ptr<ErrorRateModel> errorModel, dB_u snr, uint64_t size) {
+        return 1 - errorModel->GetChunkSuccessRate(txVector.GetMode(),
+                                                   txVector,
+                                                   DbToRatio(snr),
+                                                   size * 8);
+    };
+
+    // values of the table whose reference size is the closest to the frame size
+    NS_TEST_EXPECT_MSG_EQ_TOL(getPer(model, dB_u{31.5}, 1000), 0.5, 1e-6, "Unexpected PER");
+    NS_TEST_EXPECT_MSG_EQ_TOL(getPer(model, dB_u{32.0}, 1000),
+                              0.5 + (0.1 - 0.5) * (0.5 / 0.75),
+                              1e-6,
+                              "Unexpected interpolated PER");
+    NS_TEST_EXPECT_MSG_EQ_TOL(getPer(model, dB_u{29.5}, 1000), 1.0, 1e-6, "Unexpected PER");
+    NS_TEST_EXPECT_MSG_EQ_TOL(getPer(model, dB_u{33.0}, 1000), 0.0, 1e-6, "Unexpected PER");
+    NS_TEST_EXPECT_MSG_EQ_TOL(getPer(model, dB_u{28.5}, 100),
+                              0.5,
+                              1e-6,
+                              "Unexpected interpolated PER");
+    NS_TEST_EXPECT_MSG_EQ_TOL(getPer(model, dB_u{29.0}, 200), 0.0, 1e-6, "Unexpected PER");
+    // 500 bytes is closer (in ratio) to 1000 bytes than to 100 bytes
+    NS_TEST_EXPECT_MSG_EQ_TOL(getPer(model, dB_u{31.5}, 500),
+                              1 - std::pow(0.5, 0.5),
+                              1e-6,
+                              "Unexpected PER scaled to the frame size");
+    NS_TEST_EXPECT_MSG_EQ_TOL(getPer(model, dB_u{31.5}, 2000),
+                              1 - std::pow(0.5, 2),
+                              1e-6,
+                              "Unexpected PER scaled to the frame size");
+
+    // transmissions not covered by the file use the built-in tables (or the fallback model)
+    txVector.SetChannelWidth(MHz_u{40});
+    NS_TEST_EXPECT_MSG_EQ_TOL(getPer(model, dB_u{31.5}, 1000),
+                              getPer(builtIn, dB_u{31.5}, 1000),
+                              1e-9,
+                              "Width not covered by the file should not use its tables");
+    txVector.SetMode(HePhy::GetHeMcs0());
+    txVector.SetLdpc(false);
+    NS_TEST_EXPECT_MSG_EQ_TOL(getPer(model, dB_u{0.0}, 500), 0.5, 1e-6, "Unexpected PER");
+    txVector.SetChannelWidth(MHz_u{20});
+    NS_TEST_EXPECT_MSG_EQ_TOL(getPer(model, dB_u{0.0}, 500),
+                              getPer(builtIn, dB_u{0.0}, 500),
+                              1e-9,
+                              "Width not covered by the file should not use its tables");
+
+    // unloading the file restores the built-in tables
+    model->SetAttribute("TableFile", StringValue(""));
+    txVector.SetChannelWidth(MHz_u{40});
+    NS_TEST_EXPECT_MSG_EQ_TOL(getPer(model, dB_u{0.0}, 500),
+                              getPer(builtIn, dB_u{0.0}, 500),
+                              1e-9,
+                              "Built-in tables should be used once the file is unloaded");
+}
+
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Tabulated Error Rate Model Test Case
+ *
+ * Check that the chunk success rate returned by the TabulatedErrorRateModel is within
+ * the configured accuracy of the one returned by the wrapped error rate model.
+ */
+class TabulatedErrorRateTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * @param model the error rate model to tabulate
+     */
+    TabulatedErrorRateTestCase(Ptr<ErrorRateModel> model);
+
+  private:
+    void DoRun() override;
+
+    Ptr<ErrorRateModel> m_model; ///< the error rate model to tabulate
+};
+
+TabulatedErrorRateTestCase::TabulatedErrorRateTestCase(Ptr<ErrorRateModel> model)
+    : TestCase("Tabulated " + model->GetInstanceTypeId().GetName()),
+      m_model(model)
+{
+}
+
+void
+TabulatedErrorRateTestCase::DoRun()
+{
+    const double accuracy = 1e-4;
+    auto tabulated = CreateObjectWithAttributes<TabulatedErrorRateModel>("ErrorRateModel",
+                                                                        PointerValue(m_model),
+                                                                        "Accuracy",
+                                                                        DoubleValue(accuracy));
+
+    for (const auto& mode : {OfdmPhy::GetOfdmRate6Mbps(),
+                             OfdmPhy::GetOfdmRate54Mbps(),
+                             HtPhy::GetHtMcs2(),
+                             VhtPhy::GetVhtMcs8(),
+                             HePhy::GetHeMcs11()})
+    {
+        WifiTxVector txVector;
+        txVector.SetMode(mode);
+        txVector.SetChannelWidth(MHz_u{20});
+        for (uint64_t nbits : {24, 100, 3200, 12000, 50000})
+        {
+            // SNR values that are not on the grid of the tables
+            for (dB_u snr{-3.003}; snr <= dB_u{40}; snr += dB_u{0.0731})
+            {
+                const auto expected =
+                    m_model->GetChunkSuccessRate(mode, txVector, DbToRatio(snr), nbits);
+                const auto csr =
+                    tabulated->GetChunkSuccessRate(mode, txVector, DbToRatio(snr), nbits);
+                NS_TEST_ASSERT_MSG_EQ_TOL(csr,
+                                          expected,
+                                          accuracy,
+                                          "Chunk success rate of " << mode << " for " << nbits
+                                                                   << " bits at " << snr
+                                                                   << " dB not within accuracy");
+            }
+        }
+    }
+    // one table per mode and size bucket
+    NS_TEST_EXPECT_MSG_EQ(tabulated->GetNTables(), 5 * 5, "Unexpected number of tables");
+}
+
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Tabulated Error Rate Model Initialization Test Case
+ *
+ * Check that the tables of the TabulatedErrorRateModel used by a PHY are built when the
+ * PHY is initialized, so that no table is built when PPDUs transmitted by the same kind of
+ * PHY are received, and that the tables are shared by the models with the same configuration.
+ */
+class TabulatedErrorRateInitTestCase : public TestCase
+{
+  public:
+    TabulatedErrorRateInitTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Create a PHY using the given error rate model.
+     *
+     * @param model the error rate model
+     * @return the PHY
+     */
+    Ptr<WifiPhy> CreatePhy(Ptr<ErrorRateModel> model) const;
+};
+
+TabulatedErrorRateInitTestCase::TabulatedErrorRateInitTestCase()
+    : TestCase("Tabulated error rate model tables built at PHY initialization")
+{
+}
+
+Ptr<WifiPhy>
+TabulatedErrorRateInitTestCase::CreatePhy(Ptr<ErrorRateModel> model) const
+{
+    auto phy = CreateObject<YansWifiPhy>();
+    phy->SetInterferenceHelper(CreateObject<InterferenceHelper>());
+    phy->SetErrorRateModel(model);
+    phy->SetMobility(CreateObject<ConstantPositionMobilityModel>());
+    phy->SetOperatingChannel(WifiPhy::ChannelTuple{36, 20, WIFI_PHY_BAND_5GHZ, 0});
+    phy->ConfigureStandard(WIFI_STANDARD_80211a);
+    return phy;
+}
+
+void
+TabulatedErrorRateInitTestCase::DoRun()
+{
+    // the tables are shared by the models with the same configuration, hence the models of
+    // this test use a configuration that is not used by the other tests
+    auto createModel = []() {
+        return CreateObjectWithAttributes<TabulatedErrorRateModel>(
+            "ErrorRateModel",
+            PointerValue(CreateObject<NistErrorRateModel>()),
+            "MaxSnr",
+            DoubleValue(40));
+    };
+    auto tabulated = createModel();
+    auto phy = CreatePhy(tabulated);
+    NS_TEST_EXPECT_MSG_EQ(tabulated->GetNTables(), 0, "No table expected before initialization");
+
+    phy->Initialize();
+    // one table per OFDM mode and per bucket of chunk sizes up to the max PSDU size (4095 bytes)
+    const auto nTables = tabulated->GetNTables();
+    NS_TEST_EXPECT_MSG_EQ(nTables, 8 * 15, "Unexpected number of tables built at initialization");
+
+    for (const auto& mode : phy->GetModeList())
+    {
+        WifiTxVector txVector;
+        txVector.SetMode(mode);
+        for (uint64_t nbits : {1, 24, 100, 3200, 32760})
+        {
+            tabulated->GetChunkSuccessRate(mode, txVector, DbToRatio(dB_u{10}), nbits);
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(tabulated->GetNTables(), nTables, "No table expected to be built");
+
+    // another model with the same configuration uses the same tables
+    auto other = createModel();
+    auto otherPhy = CreatePhy(other);
+    NS_TEST_EXPECT_MSG_EQ(other->GetNTables(), nTables, "The tables should be shared");
+    otherPhy->Initialize();
+    NS_TEST_EXPECT_MSG_EQ(other->GetNTables(), nTables, "No table expected to be built");
+
+    // a model with a different configuration of the wrapped model does not
+    auto yans = CreateObjectWithAttributes<TabulatedErrorRateModel>(
+        "ErrorRateModel",
+        PointerValue(CreateObject<YansErrorRateModel>()),
+        "MaxSnr",
+        DoubleValue(40));
+    NS_TEST_EXPECT_MSG_EQ(yans->GetNTables(), 0, "The tables should not be shared");
+
+    phy->Dispose();
+    otherPhy->Dispose();
+}
+
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Check that the payload SNR and PER computed by the interference helper do not depend
+ * on the compaction of the NI changes nor on resuming from a previous window of the payload.
+ *
+ * Many short signals are first received one after the other, so that the NI changes they
+ * leave are dropped and compacted. A PPDU overlapped by an interferer is then received and its
+ * SNR and PER are compared to those computed by an interference helper that only received the
+ * PPDU and the interferer. Finally, the PER of the second half of the payload of another PPDU
+ * is computed after the PER of its first half, both before and after the power of an
+ * interferer is updated, and compared to the PER computed without a previous window.
+ */
+class InterferenceHelperNiChangesTestCase : public TestCase
+{
+  public:
+    InterferenceHelperNiChangesTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Create an interference helper tracking the band of this test.
+     *
+     * @return the interference helper
+     */
+    Ptr<TestInterferenceHelper> CreateInterferenceHelper() const;
+
+    /**
+     * Add the reception of a PPDU to the given interference helpers.
+     *
+     * @param helpers the interference helpers
+     * @param power the received power
+     * @return the event added to each interference helper
+     */
+    std::vector<Ptr<Event>> AddPpdu(const std::vector<Ptr<TestInterferenceHelper>>& helpers,
+                                    Watt_u power) const;
+
+    /**
+     * Add a foreign signal to the given interference helpers.
+     *
+     * @param helpers the interference helpers
+     * @param duration the duration of the signal
+     * @param power the received power
+     * @return the event added to each interference helper
+     */
+    std::vector<Ptr<Event>> AddSignal(const std::vector<Ptr<TestInterferenceHelper>>& helpers,
+                                      Time duration,
+                                      Watt_u power) const;
+
+    /**
+     * Compute the payload SNR and PER of the given event over the given window.
+     *
+     * @param helper the interference helper
+     * @param event the event
+     * @param window the window, relative to the start of the payload
+     * @return the SNR and PER
+     */
+    PhyEntity::SnrPer GetSnrPer(Ptr<TestInterferenceHelper> helper,
+                                Ptr<Event> event,
+                                std::pair<Time, Time> window) const;
+
+    WifiSpectrumBandInfo m_band; //!< the band tracked by the interference helpers
+    WifiTxVector m_txVector;     //!< the TXVECTOR of the PPDUs
+};
+
+InterferenceHelperNiChangesTestCase::InterferenceHelperNiChangesTestCase()
+    : TestCase("Interference helper NI changes compaction and payload PER resumption"),
+      m_band{{{0, 0}}, {{MHzToHz(MHz_u{5170}), MHzToHz(MHz_u{5190})}}},
+      m_txVector(OfdmPhy::GetOfdmRate6Mbps(),
+                 0,
+                 WIFI_PREAMBLE_LONG,
+                 NanoSeconds(800),
+                 1,
+                 1,
+                 0,
+                 MHz_u{20},
+                 false)
+{
+}
+
+Ptr<TestInterferenceHelper>
+InterferenceHelperNiChangesTestCase::CreateInterferenceHelper() const
+{
+    auto helper = CreateObject<TestInterferenceHelper>();
+    helper->SetNoiseFigure(DbToRatio(dB_u{7}));
+    helper->SetErrorRateModel(CreateObject<NistErrorRateModel>());
+    helper->AddBand(m_band);
+    return helper;
+}
+
+std::vector<Ptr<Event>>
+InterferenceHelperNiChangesTestCase::AddPpdu(
+    const std::vector<Ptr<TestInterferenceHelper>>& helpers,
+    Watt_u power) const
+{
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    hdr.SetQosTid(0);
+    auto psdu = Create<WifiPsdu>(Create<Packet>(1000), hdr);
+    auto ppdu = Create<WifiPpdu>(psdu, m_txVector, WifiPhyOperatingChannel());
+    const auto duration = WifiPhy::CalculateTxDuration(psdu, m_txVector, WIFI_PHY_BAND_5GHZ);
+    std::vector<Ptr<Event>> events;
+    for (const auto& helper : helpers)
+    {
+        RxPowerWattPerChannelBand rxPower{{m_band, power}};
+        events.push_back(helper->Add(ppdu, duration, rxPower, WIFI_SPECTRUM_5_GHZ));
+        helper->NotifyRxStart(WIFI_SPECTRUM_5_GHZ);
+    }
+    return events;
+}
+
+std::vector<Ptr<Event>>
+InterferenceHelperNiChangesTestCase::AddSignal(
+    const std::vector<Ptr<TestInterferenceHelper>>& helpers,
+    Time duration,
+    Watt_u power) const
+{
+    // as in InterferenceHelper::AddForeignSignal, which does not return the event
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    hdr.SetQosTid(0);
+    auto ppdu = Create<WifiPpdu>(Create<WifiPsdu>(Create<Packet>(0), hdr),
+                                 WifiTxVector(),
+                                 WifiPhyOperatingChannel());
+    std::vector<Ptr<Event>> events;
+    for (const auto& helper : helpers)
+    {
+        RxPowerWattPerChannelBand rxPower{{m_band, power}};
+        events.push_back(helper->Add(ppdu, duration, rxPower, WIFI_SPECTRUM_5_GHZ));
+    }
+    return events;
+}
+
+PhyEntity::SnrPer
+InterferenceHelperNiChangesTestCase::GetSnrPer(Ptr<TestInterferenceHelper> helper,
+                                               Ptr<Event> event,
+                                               std::pair<Time, Time> window) const
+{
+    return helper->CalculatePayloadSnrPer(event,
+                                          m_txVector.GetChannelWidth(),
+                                          m_band,
+                                          SU_STA_ID,
+                                          window);
+}
+
+void
+InterferenceHelperNiChangesTestCase::DoRun()
+{
+    const auto ppduDuration = WifiPhy::CalculateTxDuration(1000, m_txVector, WIFI_PHY_BAND_5GHZ);
+    const auto payloadDuration =
+        ppduDuration - WifiPhy::CalculatePhyPreambleAndHeaderDuration(m_txVector);
+    const Watt_u ppduPower{1e-10};
+    const Watt_u interfererPower{2e-11};
+
+    // the NI changes of the signals received one after the other are dropped when the next
+    // signal is added and compacted when at least 64 of them have been released
+    auto compacted = CreateInterferenceHelper();
+    const std::size_t nSignals = 200;
+    std::size_t nCompactions = 0;
+    std::size_t maxNiChanges = 0;
+    for (std::size_t i = 0; i < nSignals; ++i)
+    {
+        Simulator::Schedule(MicroSeconds(10 * i), [&, i]() {
+            const auto& nis = compacted->m_niChanges.front();
+            const auto first = nis.first;
+            AddSignal({compacted}, MicroSeconds(5), interfererPower);
+            nCompactions += (nis.first < first) ? 1 : 0;
+            maxNiChanges = std::max(maxNiChanges, nis.times.size());
+        });
+    }
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_GT(nCompactions, 0, "The NI changes should have been compacted");
+    NS_TEST_EXPECT_MSG_LT(nCompactions, nSignals, "The NI changes should not always be compacted");
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(maxNiChanges,
+                                2 * 64 + 1,
+                                "The released NI changes should not accumulate");
+
+    // the SNR and PER of a PPDU received after the compaction are those computed by an
+    // interference helper whose NI changes have never been dropped
+    auto reference = CreateInterferenceHelper();
+    std::vector<Ptr<Event>> events;
+    const auto payloadWindow = std::make_pair(Time{0}, payloadDuration);
+    Simulator::Schedule(MicroSeconds(1),
+                        [&]() { events = AddPpdu({compacted, reference}, ppduPower); });
+    Simulator::Schedule(MicroSeconds(50), [&]() {
+        AddSignal({compacted, reference}, MicroSeconds(200), interfererPower);
+    });
+    Simulator::Schedule(MicroSeconds(60), [&]() {
+        const auto expected = GetSnrPer(reference, events.at(1), payloadWindow);
+        const auto actual = GetSnrPer(compacted, events.at(0), payloadWindow);
+        NS_TEST_EXPECT_MSG_GT(expected.per, 0, "The interferer should cause errors");
+        NS_TEST_EXPECT_MSG_LT(expected.per, 1, "The interferer should not cause certain loss");
+        NS_TEST_EXPECT_MSG_EQ(actual.snr, expected.snr, "Unexpected SNR after compaction");
+        NS_TEST_EXPECT_MSG_EQ(actual.per, expected.per, "Unexpected PER after compaction");
+    });
+    Simulator::Schedule(MicroSeconds(1) + ppduDuration, [&]() {
+        compacted->NotifyRxEnd(Simulator::Now(), WIFI_SPECTRUM_5_GHZ);
+        reference->NotifyRxEnd(Simulator::Now(), WIFI_SPECTRUM_5_GHZ);
+    });
+    Simulator::Run();
+
+    // the PER of the second half of the payload resumes from the computation for the first
+    // half, unless the NI changes have been modified in the meantime
+    auto resumed = CreateInterferenceHelper();
+    auto unchanged = CreateInterferenceHelper();
+    auto changed = CreateInterferenceHelper();
+    const std::vector<Ptr<TestInterferenceHelper>> helpers{resumed, unchanged, changed};
+    const auto firstHalf = std::make_pair(Time{0}, payloadDuration / 2);
+    const auto secondHalf = std::make_pair(payloadDuration / 2, payloadDuration);
+    std::vector<Ptr<Event>> interferers;
+    double perUnchanged{0};
+    Simulator::Schedule(MicroSeconds(1), [&]() { events = AddPpdu(helpers, ppduPower); });
+    Simulator::Schedule(MicroSeconds(2), [&]() {
+        interferers = AddSignal(helpers, payloadDuration, interfererPower);
+    });
+    Simulator::Schedule(MicroSeconds(5), [&]() {
+        GetSnrPer(resumed, events.at(0), firstHalf);
+        const auto actual = GetSnrPer(resumed, events.at(0), secondHalf);
+        perUnchanged = GetSnrPer(unchanged, events.at(1), secondHalf).per;
+        NS_TEST_EXPECT_MSG_EQ(actual.per, perUnchanged, "Unexpected PER when resuming");
+        // save the state for the second half again
+        GetSnrPer(resumed, events.at(0), firstHalf);
+    });
+    // the power of the interferer is increased over the chunks preceding the saved state,
+    // hence the noise and interference power of the saved state is outdated
+    Simulator::Schedule(MicroSeconds(6), [&]() {
+        const auto version = resumed->m_niChanges.front().version;
+        for (std::size_t i = 0; i < helpers.size(); ++i)
+        {
+            helpers.at(i)->UpdateEvent(interferers.at(i), {{m_band, interfererPower}});
+        }
+        NS_TEST_EXPECT_MSG_NE(resumed->m_niChanges.front().version,
+                              version,
+                              "Updating a signal should modify the NI changes");
+        const auto actual = GetSnrPer(resumed, events.at(0), secondHalf);
+        const auto expected = GetSnrPer(changed, events.at(2), secondHalf);
+        NS_TEST_EXPECT_MSG_GT(expected.per, perUnchanged, "The interferer should cause errors");
+        NS_TEST_EXPECT_MSG_EQ(actual.per, expected.per, "Unexpected PER after a change");
+    });
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -1120,6 +1670,7 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite()
     AddTestCase(new WifiErrorRateModelsTestCaseDsss, TestCase::Duration::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseNist, TestCase::Duration::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseMimo, TestCase::Duration::QUICK);
+    AddTestCase(new InterferenceHelperNiChangesTestCase, TestCase::Duration::QUICK);
     AddTestCase(new TableBasedErrorRateTestCase("DefaultTableBasedHtMcs0-1458bytes",
                                                 HtPhy::GetHtMcs0(),
                                                 1458),
@@ -1169,6 +1720,14 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite()
                                                 HePhy::GetHeMcs11(),
                                                 1458),
                 TestCase::Duration::QUICK);
+    AddTestCase(new TableBasedErrorRateFileTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new TabulatedErrorRateTestCase(CreateObject<NistErrorRateModel>()),
+                TestCase::Duration::QUICK);
+    AddTestCase(new TabulatedErrorRateTestCase(CreateObject<YansErrorRateModel>()),
+                TestCase::Duration::QUICK);
+    AddTestCase(new TabulatedErrorRateTestCase(CreateObject<TableBasedErrorRateModel>()),
+                TestCase::Duration::QUICK);
+    AddTestCase(new TabulatedErrorRateInitTestCase, TestCase::Duration::QUICK);
 }
 
 static WifiErrorRateModelsTestSuite wifiErrorRateModelsTestSuite; ///< the test suite
@@ -6,15 +6,30 @@
  * Author: Alexander Krotov <krotov@iitp.ru>
  */
 
+#include "ns3/ap-wifi-mac.h"
+#include "ns3/boolean.h"
+#include "ns3/common-info-basic-mle.h"
 #include "ns3/fcfs-wifi-queue-scheduler.h"
+#include "ns3/heap-wifi-queue-scheduler.h"
+#include "ns3/log.h"
+#include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/random-variable-stream.h"
 #include "ns3/simulator.h"
+#include "ns3/spectrum-wifi-helper.h"
+#include "ns3/string.h"
 #include "ns3/test.h"
 #include "ns3/wifi-mac-queue.h"
+#include "ns3/wifi-net-device.h"
 
 #include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
 
 using namespace ns3;
 
+NS_LOG_COMPONENT_DEFINE("WifiMacQueueTest");
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -417,6 +432,659 @@ WifiExtractExpiredMpdusTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Test the expiry index of the MAC queue container
+ *
+ * This test verifies that extracting all the expired MPDUs finds the MPDUs stored in
+ * container queues that were not modified since the last extraction, as well as MPDUs
+ * enqueued out of expiry order, and does not find the MPDUs that have been dequeued.
+ */
+class WifiMacQueueIndexTest : public TestCase
+{
+  public:
+    WifiMacQueueIndexTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Enqueue a new MPDU into the container.
+     *
+     * @param rxAddr Receiver Address of the MPDU
+     * @param expiryTime the expiry time for the MPDU
+     * @return an iterator pointing to the enqueued MPDU
+     */
+    WifiMacQueueContainer::iterator Enqueue(Mac48Address rxAddr, Time expiryTime);
+
+    /**
+     * Check the sequence numbers of the MPDUs extracted by ExtractAllExpiredMpdus.
+     *
+     * @param expectedSeqNo the expected sequence numbers of the extracted MPDUs
+     */
+    void CheckExpired(std::set<uint16_t> expectedSeqNo);
+
+    WifiMacQueueContainer m_container; //!< MAC queue container
+    Mac48Address m_txAddr;             //!< Transmitter Address of MPDUs
+    uint16_t m_currentSeqNo{0};        //!< sequence number of current MPDU
+};
+
+WifiMacQueueIndexTest::WifiMacQueueIndexTest()
+    : TestCase("Test the expiry index of the MAC queue container")
+{
+}
+
+WifiMacQueueContainer::iterator
+WifiMacQueueIndexTest::Enqueue(Mac48Address rxAddr, Time expiryTime)
+{
+    WifiMacHeader header(WIFI_MAC_QOSDATA);
+    header.SetAddr1(rxAddr);
+    header.SetAddr2(m_txAddr);
+    header.SetQosTid(0);
+    auto mpdu = Create<WifiMpdu>(Create<Packet>(), header);
+    mpdu->AssignSeqNo(m_currentSeqNo++);
+
+    auto queueId = WifiMacQueueContainer::GetQueueId(mpdu);
+    auto elemIt = m_container.insert(m_container.GetQueue(queueId).cend(), mpdu);
+    elemIt->expiryTime = expiryTime;
+    elemIt->deleter = [](auto mpdu) {};
+    return elemIt;
+}
+
+void
+WifiMacQueueIndexTest::CheckExpired(std::set<uint16_t> expectedSeqNo)
+{
+    auto [first, last] = m_container.ExtractAllExpiredMpdus();
+    std::set<uint16_t> actualSeqNo;
+    std::transform(first, last, std::inserter(actualSeqNo, actualSeqNo.end()), [](auto& elem) {
+        return elem.mpdu->GetHeader().GetSequenceNumber();
+    });
+    NS_TEST_EXPECT_MSG_EQ((actualSeqNo == expectedSeqNo),
+                          true,
+                          "Unexpected MPDUs extracted at " << Simulator::Now().As(Time::MS));
+}
+
+void
+WifiMacQueueIndexTest::DoRun()
+{
+    m_txAddr = Mac48Address::Allocate();
+    auto rxAddr1 = Mac48Address::Allocate();
+    auto rxAddr2 = Mac48Address::Allocate();
+    WifiContainerQueueId queueId1{WIFI_QOSDATA_QUEUE, WIFI_UNICAST, rxAddr1, 0};
+    WifiContainerQueueId queueId2{WIFI_QOSDATA_QUEUE, WIFI_UNICAST, rxAddr2, 0};
+
+    // MPDUs 0-4 to rxAddr1 and MPDUs 5-9 to rxAddr2
+    std::vector<WifiMacQueueContainer::iterator> elems;
+    for (uint16_t i = 0; i < 10; ++i)
+    {
+        elems.push_back(Enqueue(i < 5 ? rxAddr1 : rxAddr2, MilliSeconds(10 * (1 + i % 5))));
+    }
+
+    // remove MPDU 3
+    m_container.erase(elems[3]);
+
+    Simulator::Schedule(MilliSeconds(15), [&]() {
+        CheckExpired({0, 5});
+        // no MPDU expired since the last extraction
+        CheckExpired({});
+    });
+    Simulator::Schedule(MilliSeconds(25), [&]() { CheckExpired({1, 6}); });
+    Simulator::Schedule(MilliSeconds(26), [&]() {
+        // insert an MPDU whose lifetime has already expired at the head of container queue 2
+        WifiMacHeader header(WIFI_MAC_QOSDATA);
+        header.SetAddr1(rxAddr2);
+        header.SetAddr2(m_txAddr);
+        header.SetQosTid(0);
+        auto mpdu = Create<WifiMpdu>(Create<Packet>(), header);
+        mpdu->AssignSeqNo(10);
+        auto elemIt = m_container.insert(m_container.GetQueue(queueId2).cbegin(), mpdu);
+        elemIt->expiryTime = MilliSeconds(20);
+        elemIt->deleter = [](auto mpdu) {};
+        CheckExpired({10});
+    });
+    Simulator::Schedule(MilliSeconds(60), [&]() {
+        CheckExpired({2, 4, 7, 8, 9});
+        NS_TEST_EXPECT_MSG_EQ(m_container.GetNBytes(queueId1), 0, "Queue 1 should be empty");
+        NS_TEST_EXPECT_MSG_EQ(m_container.GetNBytes(queueId2), 0, "Queue 2 should be empty");
+    });
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Test that HeapWifiQueueScheduler serves the container queues in the same order
+ *        as FcfsWifiQueueScheduler
+ *
+ * Two MAC queues, one using the FCFS scheduler and one using the heap scheduler, undergo
+ * the same random sequence of enqueue, dequeue, remove and block/unblock operations, while
+ * MPDUs expire and are dropped because the queues are full. After each operation, the
+ * sequence of container queues returned by GetNext() must be the same for both schedulers.
+ */
+class WifiMacQueueSchedulerConsistencyTest : public TestCase
+{
+  public:
+    WifiMacQueueSchedulerConsistencyTest();
+
+  private:
+    void DoRun() override;
+
+    /// Perform a random operation on both queues and compare the schedulers
+    void Step();
+
+    /**
+     * Check that both schedulers return the same sequence of container queues.
+     *
+     * @param linkId the ID of the link the schedulers are queried for, if any
+     */
+    void CheckOrder(std::optional<uint8_t> linkId);
+
+    static constexpr std::size_t N_STEPS = 3000; //!< number of operations
+
+    std::size_t m_step{0};                   //!< number of operations performed
+    Ptr<UniformRandomVariable> m_rv;         //!< random variable to select the operations
+    std::vector<Mac48Address> m_addresses;   //!< the addresses of the receivers
+    std::vector<Ptr<WifiMacQueue>> m_queues; //!< the MAC queues (FCFS, Heap)
+    Ptr<FcfsWifiQueueScheduler> m_fcfs;      //!< the FCFS scheduler
+    Ptr<HeapWifiQueueScheduler> m_heap;      //!< the heap scheduler
+};
+
+WifiMacQueueSchedulerConsistencyTest::WifiMacQueueSchedulerConsistencyTest()
+    : TestCase("Test consistency between the heap scheduler and the FCFS scheduler")
+{
+}
+
+void
+WifiMacQueueSchedulerConsistencyTest::CheckOrder(std::optional<uint8_t> linkId)
+{
+    auto getOrder = [&](Ptr<WifiMacQueueScheduler> scheduler) {
+        std::vector<WifiContainerQueueId> order;
+        auto queueId = scheduler->GetNext(AC_BE, linkId);
+        while (queueId)
+        {
+            order.push_back(*queueId);
+            queueId = scheduler->GetNext(AC_BE, linkId, *queueId);
+        }
+        return order;
+    };
+
+    const auto fcfsOrder = getOrder(m_fcfs);
+    const auto heapOrder = getOrder(m_heap);
+
+    NS_TEST_ASSERT_MSG_EQ(heapOrder.size(),
+                          fcfsOrder.size(),
+                          "Unexpected number of queues at step " << m_step);
+    for (std::size_t i = 0; i < fcfsOrder.size(); ++i)
+    {
+        NS_TEST_ASSERT_MSG_EQ((heapOrder[i] == fcfsOrder[i]),
+                              true,
+                              "Unexpected queue in position " << i << " at step " << m_step);
+    }
+}
+
+void
+WifiMacQueueSchedulerConsistencyTest::Step()
+{
+    const auto& address = m_addresses[m_rv->GetInteger(0, m_addresses.size() - 1)];
+    const uint8_t tid = m_rv->GetInteger(0, 1);
+    const auto reason = (m_rv->GetInteger(0, 1) == 0) ? WifiQueueBlockedReason::WAITING_ADDBA_RESP
+                                                      : WifiQueueBlockedReason::POWER_SAVE_MODE;
+
+    switch (m_rv->GetInteger(0, 9))
+    {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+        for (auto& queue : m_queues)
+        {
+            WifiMacHeader header(WIFI_MAC_QOSDATA);
+            header.SetAddr1(address);
+            header.SetQosTid(tid);
+            queue->Enqueue(Create<WifiMpdu>(Create<Packet>(100), header));
+        }
+        break;
+    case 5:
+    case 6:
+        for (auto& queue : m_queues)
+        {
+            if (auto mpdu = queue->PeekByTidAndAddress(tid, address))
+            {
+                queue->DequeueIfQueued({mpdu});
+            }
+        }
+        break;
+    case 7:
+        for (auto& queue : m_queues)
+        {
+            if (auto mpdu = queue->PeekByTidAndAddress(tid, address))
+            {
+                queue->Remove(mpdu);
+            }
+        }
+        break;
+    case 8:
+        for (Ptr<WifiMacQueueScheduler> scheduler : {Ptr<WifiMacQueueScheduler>(m_fcfs),
+                                                     Ptr<WifiMacQueueScheduler>(m_heap)})
+        {
+            scheduler->BlockQueues(reason,
+                                   AC_BE,
+                                   {WIFI_QOSDATA_QUEUE},
+                                   address,
+                                   Mac48Address(),
+                                   {tid},
+                                   {SINGLE_LINK_OP_ID});
+        }
+        break;
+    case 9:
+        for (Ptr<WifiMacQueueScheduler> scheduler : {Ptr<WifiMacQueueScheduler>(m_fcfs),
+                                                     Ptr<WifiMacQueueScheduler>(m_heap)})
+        {
+            scheduler->UnblockQueues(reason,
+                                     AC_BE,
+                                     {WIFI_QOSDATA_QUEUE},
+                                     address,
+                                     Mac48Address(),
+                                     {tid},
+                                     {SINGLE_LINK_OP_ID});
+        }
+        break;
+    }
+
+    CheckOrder(SINGLE_LINK_OP_ID);
+    CheckOrder(std::nullopt);
+    NS_TEST_ASSERT_MSG_EQ(m_queues[1]->GetNPackets(),
+                          m_queues[0]->GetNPackets(),
+                          "Unexpected number of packets at step " << m_step);
+
+    // every MPDU is enqueued at a distinct time, so that container queues never have
+    // the same priority
+    if (++m_step < N_STEPS)
+    {
+        Simulator::Schedule(MicroSeconds(1), &WifiMacQueueSchedulerConsistencyTest::Step, this);
+    }
+}
+
+void
+WifiMacQueueSchedulerConsistencyTest::DoRun()
+{
+    m_rv = CreateObject<UniformRandomVariable>();
+    m_rv->SetStream(1);
+
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        m_addresses.push_back(Mac48Address::Allocate());
+    }
+
+    m_fcfs = CreateObject<FcfsWifiQueueScheduler>();
+    m_fcfs->SetAttribute("DropPolicy", EnumValue(FcfsWifiQueueScheduler::DROP_OLDEST));
+    m_heap = CreateObject<HeapWifiQueueScheduler>();
+    m_heap->SetAttribute("DropPolicy", EnumValue(HeapWifiQueueScheduler::DROP_OLDEST));
+
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        m_queues.push_back(CreateObject<WifiMacQueue>(AC_BE));
+        m_queues.back()->SetMaxSize(QueueSize(QueueSizeUnit::PACKETS, 40));
+        m_queues.back()->SetMaxDelay(MicroSeconds(80));
+    }
+    m_fcfs->m_perAcInfo[AC_BE].wifiMacQueue = m_queues[0];
+    m_queues[0]->SetScheduler(m_fcfs);
+    m_heap->m_perAcInfo[AC_BE].wifiMacQueue = m_queues[1];
+    m_queues[1]->SetScheduler(m_heap);
+
+    Simulator::ScheduleNow(&WifiMacQueueSchedulerConsistencyTest::Step, this);
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(m_step, N_STEPS, "Not all the operations have been performed");
+
+    m_fcfs->Dispose();
+    m_heap->Dispose();
+    m_queues.clear();
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Test that HeapWifiQueueScheduler tracks the changes to the links of an AP MLD
+ *
+ * An AP MLD with two links has a non-AP MLD associated on both links and a non-empty
+ * container queue of QoS data frames addressed to the non-AP MLD. It is checked that the
+ * container queue:
+ *
+ * - is not served on a link to which the TID is no longer mapped and is served again on
+ *   that link when the TID is mapped to it again
+ * - is not served on a link that has been torn down, even if the container queue stays
+ *   non-empty, once the links on which an MPDU can be sent have been requested (which does
+ *   not return the link that has been torn down)
+ * - is served again on a link that has been setup again while the container queue was
+ *   non-empty, once another MPDU is enqueued
+ *
+ * As done by the MAC, the links on which an MPDU can be sent are requested before enqueuing
+ * the MPDU.
+ */
+class WifiMacQueueSchedulerLinkChangeTest : public TestCase
+{
+  public:
+    WifiMacQueueSchedulerLinkChangeTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Setup the given link between the AP MLD and the non-AP MLD.
+     *
+     * @param linkId the ID of the given link
+     */
+    void SetupLink(uint8_t linkId);
+
+    /**
+     * Enqueue a QoS data frame addressed to the non-AP MLD, after requesting the links on
+     * which it can be sent, as done by Txop::Queue().
+     *
+     * @return the enqueued MPDU
+     */
+    Ptr<WifiMpdu> Enqueue();
+
+    /**
+     * Check the container queue returned by the scheduler for the given link.
+     *
+     * @param linkId the ID of the given link
+     * @param served whether the container queue of the non-AP MLD is expected to be served
+     * @param info information about the check
+     */
+    void CheckServed(uint8_t linkId, bool served, const std::string& info);
+
+    Ptr<ApWifiMac> m_apMac;                        //!< the MAC of the AP MLD
+    Mac48Address m_mldAddress;                     //!< the MLD address of the non-AP MLD
+    std::shared_ptr<CommonInfoBasicMle> m_mleInfo; //!< the MLE common info of the non-AP MLD
+};
+
+WifiMacQueueSchedulerLinkChangeTest::WifiMacQueueSchedulerLinkChangeTest()
+    : TestCase("Test the link changes with the heap scheduler")
+{
+}
+
+void
+WifiMacQueueSchedulerLinkChangeTest::SetupLink(uint8_t linkId)
+{
+    auto manager = m_apMac->GetWifiRemoteStationManager(linkId);
+    const auto staAddress = Mac48Address::Allocate();
+    manager->AddStationMleCommonInfo(staAddress, m_mleInfo);
+    manager->RecordGotAssocTxOk(staAddress);
+}
+
+Ptr<WifiMpdu>
+WifiMacQueueSchedulerLinkChangeTest::Enqueue()
+{
+    WifiMacHeader header(WIFI_MAC_QOSDATA);
+    header.SetAddr1(m_mldAddress);
+    header.SetAddr2(m_apMac->GetAddress());
+    header.SetQosTid(0);
+    auto mpdu = Create<WifiMpdu>(Create<Packet>(100), header);
+    m_apMac->GetMacQueueScheduler()->GetLinkIds(AC_BE, mpdu, {});
+    m_apMac->GetTxopQueue(AC_BE)->Enqueue(mpdu);
+    return mpdu;
+}
+
+void
+WifiMacQueueSchedulerLinkChangeTest::CheckServed(uint8_t linkId,
+                                                 bool served,
+                                                 const std::string& info)
+{
+    const WifiContainerQueueId queueId{WIFI_QOSDATA_QUEUE, WIFI_UNICAST, m_mldAddress, 0};
+    const auto next = m_apMac->GetMacQueueScheduler()->GetNext(AC_BE, linkId);
+    NS_TEST_EXPECT_MSG_EQ(next.has_value(),
+                          served,
+                          "Unexpected selection on link " << +linkId << " " << info);
+    if (next)
+    {
+        NS_TEST_EXPECT_MSG_EQ((*next == queueId),
+                              true,
+                              "Unexpected queue selected on link " << +linkId << " " << info);
+    }
+}
+
+void
+WifiMacQueueSchedulerLinkChangeTest::DoRun()
+{
+    NodeContainer apNode(1);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211be);
+
+    SpectrumWifiPhyHelper phy(2);
+    phy.Set(0, "ChannelSettings", StringValue("{2, 0, BAND_2_4GHZ, 0}"));
+    phy.Set(1, "ChannelSettings", StringValue("{36, 0, BAND_5GHZ, 0}"));
+    phy.SetChannel(CreateObject<MultiModelSpectrumChannel>());
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::ApWifiMac", "BeaconGeneration", BooleanValue(false));
+    mac.SetMacQueueScheduler("ns3::HeapWifiQueueScheduler");
+    auto device = DynamicCast<WifiNetDevice>(wifi.Install(phy, mac, apNode).Get(0));
+    m_apMac = DynamicCast<ApWifiMac>(device->GetMac());
+    auto scheduler = m_apMac->GetMacQueueScheduler();
+
+    m_mldAddress = Mac48Address::Allocate();
+    m_mleInfo = std::make_shared<CommonInfoBasicMle>();
+    m_mleInfo->m_mldMacAddress = m_mldAddress;
+    SetupLink(0);
+    SetupLink(1);
+
+    auto mpdu = Enqueue();
+    CheckServed(0, true, "after link setup");
+    CheckServed(1, true, "after link setup");
+
+    // the TID is no longer mapped to link 1
+    scheduler->BlockQueues(WifiQueueBlockedReason::TID_NOT_MAPPED,
+                           AC_BE,
+                           {WIFI_QOSDATA_QUEUE},
+                           m_mldAddress,
+                           m_apMac->GetAddress(),
+                           {0},
+                           {1});
+    CheckServed(0, true, "after TID unmapped from link 1");
+    CheckServed(1, false, "after TID unmapped from link 1");
+    scheduler->UnblockQueues(WifiQueueBlockedReason::TID_NOT_MAPPED,
+                             AC_BE,
+                             {WIFI_QOSDATA_QUEUE},
+                             m_mldAddress,
+                             m_apMac->GetAddress(),
+                             {0},
+                             {1});
+    CheckServed(1, true, "after TID mapped to link 1 again");
+
+    // link 1 is torn down while the container queue is non-empty
+    m_apMac->GetWifiRemoteStationManager(1)->Reset();
+    NS_TEST_EXPECT_MSG_EQ((scheduler->GetLinkIds(AC_BE, mpdu, {}) == std::list<uint8_t>{0}),
+                          true,
+                          "Unexpected links after link 1 removal");
+    CheckServed(0, true, "after link 1 removal");
+    CheckServed(1, false, "after link 1 removal");
+    Enqueue();
+    CheckServed(1, false, "after enqueuing an MPDU following link 1 removal");
+
+    // link 1 is setup again while the container queue is non-empty
+    SetupLink(1);
+    Enqueue();
+    CheckServed(0, true, "after link 1 setup again");
+    CheckServed(1, true, "after link 1 setup again");
+
+    m_apMac = nullptr;
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Benchmark of the MAC queue of an AP serving many saturated stations
+ *
+ * The MAC queue of the AP stores QoS data frames addressed to a number of stations.
+ * In every TXOP, the AP removes the expired MPDUs, builds an A-MPDU for the station
+ * selected by the wifi queue scheduler (which serves the stations in a round robin
+ * fashion, given that all the queues are saturated), dequeues the acknowledged MPDUs
+ * and enqueues new MPDUs to keep the queue saturated.
+ */
+class WifiMacQueuePerformanceTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * @param nStations the number of stations served by the AP
+     * @param nTxops the number of TXOPs
+     * @param heapScheduler whether to use HeapWifiQueueScheduler instead of
+     *                      FcfsWifiQueueScheduler
+     */
+    WifiMacQueuePerformanceTest(std::size_t nStations, std::size_t nTxops, bool heapScheduler);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Enqueue a QoS data frame addressed to the given station.
+     *
+     * @param station the index of the station
+     */
+    void Enqueue(std::size_t station);
+
+    /// Perform a TXOP for the next station
+    void Txop();
+
+    static constexpr std::size_t AMPDU_SIZE = 32; //!< number of MPDUs per A-MPDU
+
+    std::size_t m_nStations;                        //!< number of stations
+    std::size_t m_nTxops;                           //!< number of TXOPs
+    bool m_heapScheduler;                           //!< whether to use HeapWifiQueueScheduler
+    std::size_t m_txopCount{0};                     //!< number of TXOPs performed
+    std::size_t m_nAcked{0};                        //!< number of acknowledged MPDUs
+    Ptr<WifiMacQueue> m_queue;                      //!< the MAC queue of the AP
+    Ptr<WifiMacQueueScheduler> m_scheduler;         //!< the wifi queue scheduler of the AP
+    std::map<Mac48Address, std::size_t> m_stations; //!< station index per address
+    std::vector<Mac48Address> m_addresses;          //!< the addresses of the stations
+    std::vector<uint16_t> m_nextSeqNo;              //!< the next sequence number of each station
+};
+
+WifiMacQueuePerformanceTest::WifiMacQueuePerformanceTest(std::size_t nStations,
+                                                         std::size_t nTxops,
+                                                         bool heapScheduler)
+    : TestCase("Benchmark of the MAC queue of an AP serving " + std::to_string(nStations) +
+               " saturated stations (" + (heapScheduler ? "Heap" : "Fcfs") + " scheduler)"),
+      m_nStations(nStations),
+      m_nTxops(nTxops),
+      m_heapScheduler(heapScheduler)
+{
+}
+
+void
+WifiMacQueuePerformanceTest::Enqueue(std::size_t station)
+{
+    WifiMacHeader header(WIFI_MAC_QOSDATA);
+    header.SetAddr1(m_addresses[station]);
+    header.SetQosTid(0);
+    m_queue->Enqueue(Create<WifiMpdu>(Create<Packet>(1000), header));
+}
+
+void
+WifiMacQueuePerformanceTest::Txop()
+{
+    m_queue->WipeAllExpiredMpdus();
+
+    const auto queueId = m_scheduler->GetNext(AC_BE, SINGLE_LINK_OP_ID);
+    NS_ASSERT(queueId);
+    const auto& address = std::get<Mac48Address>(*queueId);
+    const auto station = m_stations.at(address);
+
+    // build the A-MPDU
+    std::vector<Ptr<WifiMpdu>> inFlight;
+    Ptr<WifiMpdu> mpdu = nullptr;
+    while (inFlight.size() < AMPDU_SIZE &&
+           (mpdu = m_queue->PeekByTidAndAddress(0, address, mpdu)))
+    {
+        mpdu->AssignSeqNo(m_nextSeqNo[station]);
+        m_nextSeqNo[station] = (m_nextSeqNo[station] + 1) % SEQNO_SPACE_SIZE;
+        mpdu->SetInFlight(0);
+        inFlight.push_back(mpdu);
+    }
+
+    // process the Block Ack, which acknowledges all the MPDUs (as the BlockAckManager does,
+    // the acknowledged MPDUs are taken from the list of in flight MPDUs)
+    for (const auto& acked : inFlight)
+    {
+        acked->ResetInFlight(0);
+        m_queue->DequeueIfQueued({acked});
+        ++m_nAcked;
+    }
+
+    // keep the queue saturated
+    for (std::size_t i = 0; i < inFlight.size(); ++i)
+    {
+        Enqueue(station);
+    }
+
+    if (++m_txopCount < m_nTxops)
+    {
+        Simulator::Schedule(MicroSeconds(100), &WifiMacQueuePerformanceTest::Txop, this);
+    }
+}
+
+void
+WifiMacQueuePerformanceTest::DoRun()
+{
+    const std::size_t queueDepth = 2 * AMPDU_SIZE;
+    m_queue = CreateObject<WifiMacQueue>(AC_BE);
+    m_queue->SetMaxSize(QueueSize(QueueSizeUnit::PACKETS, m_nStations * queueDepth));
+    if (m_heapScheduler)
+    {
+        auto scheduler = CreateObject<HeapWifiQueueScheduler>();
+        scheduler->m_perAcInfo[AC_BE].wifiMacQueue = m_queue;
+        m_scheduler = scheduler;
+    }
+    else
+    {
+        auto scheduler = CreateObject<FcfsWifiQueueScheduler>();
+        scheduler->m_perAcInfo[AC_BE].wifiMacQueue = m_queue;
+        m_scheduler = scheduler;
+    }
+    m_queue->SetScheduler(m_scheduler);
+
+    for (std::size_t i = 0; i < m_nStations; ++i)
+    {
+        m_addresses.push_back(Mac48Address::Allocate());
+        m_stations[m_addresses.back()] = i;
+        m_nextSeqNo.push_back(0);
+        for (std::size_t j = 0; j < queueDepth; ++j)
+        {
+            Enqueue(i);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    Simulator::ScheduleNow(&WifiMacQueuePerformanceTest::Txop, this);
+    Simulator::Run();
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+    NS_LOG_INFO(m_nTxops << " TXOPs for " << m_nStations << " stations executed in "
+                         << elapsed.count() << " s");
+
+    NS_TEST_EXPECT_MSG_EQ(m_nAcked, m_nTxops * AMPDU_SIZE, "Unexpected number of acked MPDUs");
+    NS_TEST_EXPECT_MSG_EQ(m_queue->GetNPackets(),
+                          m_nStations * queueDepth,
+                          "The queue should still be saturated");
+
+    m_scheduler->Dispose();
+    m_scheduler = nullptr;
+    m_queue = nullptr;
+    Simulator::Destroy();
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -434,6 +1102,32 @@ WifiMacQueueTestSuite::WifiMacQueueTestSuite()
 {
     AddTestCase(new WifiMacQueueDropOldestTest, TestCase::Duration::QUICK);
     AddTestCase(new WifiExtractExpiredMpdusTest, TestCase::Duration::QUICK);
+    AddTestCase(new WifiMacQueueIndexTest, TestCase::Duration::QUICK);
+    AddTestCase(new WifiMacQueueSchedulerConsistencyTest, TestCase::Duration::QUICK);
+    AddTestCase(new WifiMacQueueSchedulerLinkChangeTest, TestCase::Duration::QUICK);
 }
 
 static WifiMacQueueTestSuite g_wifiMacQueueTestSuite; ///< the test suite
+
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Wifi MAC Queue Performance Test Suite
+ */
+class WifiMacQueuePerformanceTestSuite : public TestSuite
+{
+  public:
+    WifiMacQueuePerformanceTestSuite();
+};
+
+WifiMacQueuePerformanceTestSuite::WifiMacQueuePerformanceTestSuite()
+    : TestSuite("wifi-mac-queue-performance", Type::PERFORMANCE)
+{
+    AddTestCase(new WifiMacQueuePerformanceTest(500, 20000, false),
+                TestCase::Duration::EXTENSIVE);
+    AddTestCase(new WifiMacQueuePerformanceTest(500, 20000, true), TestCase::Duration::EXTENSIVE);
+}
+
+static WifiMacQueuePerformanceTestSuite
+    g_wifiMacQueuePerformanceTestSuite; ///< the performance test suite
@@ -0,0 +1,309 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/log.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/packet-socket-client.h"
+#include "ns3/packet-socket-helper.h"
+#include "ns3/packet-socket-server.h"
+#include "ns3/packet.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/ssid.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-psdu.h"
+#include "ns3/wifi-remote-station-manager.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("WifiMinstrelHtTest");
+
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Minstrel-HT regression test
+ *
+ * An HT AP using the Minstrel-HT rate manager sends a saturating flow of (non-aggregated)
+ * QoS data frames to a non-AP STA that moves away from the AP, hence the best rate found by
+ * Minstrel-HT keeps decreasing. The simulation is deterministic, hence it is checked that:
+ *
+ * - the number of attempts and of successful attempts (i.e., acknowledged transmissions) at
+ *   each MCS and guard interval
+ * - the sequence of the rates reported by the Rate trace source of the manager
+ * - the MCS used for the transmission of a number of data frames
+ *
+ * match the values obtained before the statistics update of Minstrel-HT was optimized.
+ */
+class MinstrelHtRegressionTest : public TestCase
+{
+  public:
+    MinstrelHtRegressionTest();
+
+  private:
+    void DoSetup() override;
+    void DoRun() override;
+
+    /**
+     * Callback invoked when the AP starts transmitting a PSDU.
+     *
+     * @param psduMap the PSDU map
+     * @param txVector the TX vector
+     * @param txPower the TX power
+     */
+    void Transmit(WifiConstPsduMap psduMap, WifiTxVector txVector, Watt_u txPower);
+
+    /**
+     * Callback invoked when the AP successfully receives a packet.
+     *
+     * @param packet the received packet
+     */
+    void Receive(Ptr<const Packet> packet);
+
+    /**
+     * Callback invoked when the rate selected by Minstrel-HT changes.
+     *
+     * @param oldRate the previous rate
+     * @param newRate the new rate
+     */
+    void RateChange(uint64_t oldRate, uint64_t newRate);
+
+    /// (MCS, guard interval in nanoseconds) pair
+    using McsGi = std::pair<uint8_t, int64_t>;
+
+    NetDeviceContainer m_apDevice;              //!< AP device
+    NetDeviceContainer m_staDevice;             //!< non-AP STA device
+    std::optional<McsGi> m_lastData;            //!< MCS and GI of the last data frame sent
+    std::map<McsGi, uint32_t> m_attempts;       //!< number of attempts per MCS and GI
+    std::map<McsGi, uint32_t> m_successes;      //!< number of successes per MCS and GI
+    std::vector<uint8_t> m_dataMcs;             //!< MCS of every data frame sent
+    std::vector<uint64_t> m_rates;              //!< rates reported by the Rate trace source
+};
+
+MinstrelHtRegressionTest::MinstrelHtRegressionTest()
+    : TestCase("Check the rates and the statistics of Minstrel-HT")
+{
+}
+
+void
+MinstrelHtRegressionTest::Transmit(WifiConstPsduMap psduMap, WifiTxVector txVector, Watt_u txPower)
+{
+    if (!psduMap.cbegin()->second->GetHeader(0).IsQosData())
+    {
+        return;
+    }
+    m_lastData = {txVector.GetMode().GetMcsValue(), txVector.GetGuardInterval().GetNanoSeconds()};
+    ++m_attempts[*m_lastData];
+    m_dataMcs.push_back(m_lastData->first);
+}
+
+void
+MinstrelHtRegressionTest::Receive(Ptr<const Packet> packet)
+{
+    WifiMacHeader hdr;
+    packet->PeekHeader(hdr);
+    if (hdr.IsAck() && m_lastData)
+    {
+        ++m_successes[*m_lastData];
+        m_lastData.reset();
+    }
+}
+
+void
+MinstrelHtRegressionTest::RateChange(uint64_t oldRate, uint64_t newRate)
+{
+    m_rates.push_back(newRate);
+}
+
+void
+MinstrelHtRegressionTest::DoSetup()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    int64_t streamNumber = 100;
+
+    NodeContainer apNode(1);
+    NodeContainer staNode(1);
+
+    auto channel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel.Create());
+    phy.Set("ChannelSettings", StringValue("{36, 20, BAND_5GHZ, 0}"));
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211n);
+    wifi.SetRemoteStationManager("ns3::MinstrelHtWifiManager");
+    wifi.ConfigHtOptions("ShortGuardIntervalSupported", BooleanValue(true));
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::StaWifiMac", "Ssid", SsidValue(Ssid("minstrel-ht")));
+    m_staDevice = wifi.Install(phy, mac, staNode);
+
+    mac.SetType("ns3::ApWifiMac",
+                "Ssid",
+                SsidValue(Ssid("minstrel-ht")),
+                "BE_MaxAmpduSize",
+                UintegerValue(0));
+    m_apDevice = wifi.Install(phy, mac, apNode);
+
+    streamNumber += WifiHelper::AssignStreams(m_apDevice, streamNumber);
+    streamNumber += WifiHelper::AssignStreams(m_staDevice, streamNumber);
+
+    // the non-AP STA starts at 10 meters from the AP and moves away at 20 m/s
+    MobilityHelper mobility;
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(apNode);
+    mobility.SetMobilityModel("ns3::ConstantVelocityMobilityModel");
+    mobility.Install(staNode);
+    auto staMobility = staNode.Get(0)->GetObject<ConstantVelocityMobilityModel>();
+    staMobility->SetPosition(Vector(10.0, 0.0, 0.0));
+    staMobility->SetVelocity(Vector(20.0, 0.0, 0.0));
+
+    PacketSocketHelper packetSocket;
+    packetSocket.Install(apNode);
+    packetSocket.Install(staNode);
+
+    PacketSocketAddress socket;
+    socket.SetSingleDevice(m_apDevice.Get(0)->GetIfIndex());
+    socket.SetPhysicalAddress(m_staDevice.Get(0)->GetAddress());
+    socket.SetProtocol(1);
+
+    auto client = CreateObject<PacketSocketClient>();
+    client->SetAttribute("PacketSize", UintegerValue(1000));
+    client->SetAttribute("MaxPackets", UintegerValue(0));
+    client->SetAttribute("Interval", TimeValue(MicroSeconds(500)));
+    client->SetRemote(socket);
+    client->SetStartTime(MilliSeconds(500));
+    client->SetStopTime(Seconds(3));
+    apNode.Get(0)->AddApplication(client);
+
+    auto server = CreateObject<PacketSocketServer>();
+    server->SetLocal(socket);
+    staNode.Get(0)->AddApplication(server);
+
+    auto apDev = DynamicCast<WifiNetDevice>(m_apDevice.Get(0));
+    apDev->GetPhy()->TraceConnectWithoutContext(
+        "PhyTxPsduBegin",
+        MakeCallback(&MinstrelHtRegressionTest::Transmit, this));
+    apDev->GetPhy()->TraceConnectWithoutContext(
+        "PhyRxEnd",
+        MakeCallback(&MinstrelHtRegressionTest::Receive, this));
+    apDev->GetRemoteStationManager()->TraceConnectWithoutContext(
+        "Rate",
+        MakeCallback(&MinstrelHtRegressionTest::RateChange, this));
+}
+
+void
+MinstrelHtRegressionTest::DoRun()
+{
+    Simulator::Stop(Seconds(3));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    // (attempts, successes) per MCS and guard interval
+    const std::map<McsGi, std::pair<uint32_t, uint32_t>> expectedStats{
+        {{0, 400}, {7, 1}},
+        {{0, 800}, {9, 0}},
+        {{1, 400}, {28, 1}},
+        {{1, 800}, {25, 1}},
+        {{2, 400}, {52, 1}},
+        {{2, 800}, {44, 1}},
+        {{3, 400}, {64, 1}},
+        {{3, 800}, {78, 1}},
+        {{4, 400}, {1248, 1079}},
+        {{4, 800}, {93, 50}},
+        {{5, 400}, {565, 446}},
+        {{5, 800}, {98, 14}},
+        {{6, 400}, {235, 135}},
+        {{6, 800}, {52, 11}},
+        {{7, 400}, {1062, 911}},
+        {{7, 800}, {15, 0}},
+    };
+    NS_TEST_EXPECT_MSG_EQ(m_attempts.size(), expectedStats.size(), "Unexpected MCS/GI pairs");
+    for (const auto& [mcsGi, stats] : expectedStats)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_attempts[mcsGi],
+                              stats.first,
+                              "Unexpected attempts at MCS " << +mcsGi.first << " GI "
+                                                            << mcsGi.second);
+        NS_TEST_EXPECT_MSG_EQ(m_successes[mcsGi],
+                              stats.second,
+                              "Unexpected successes at MCS " << +mcsGi.first << " GI "
+                                                             << mcsGi.second);
+    }
+
+    const std::vector<uint64_t> expectedRates{
+        57777778, 72222223, 65000000, 72222223, 65000000, 72222223, 65000000, 72222223, 65000000,
+        72222223, 65000000, 58500000, 65000000, 58500000, 65000000, 58500000, 57777778, 52000000,
+        57777778, 52000000, 57777778, 52000000, 57777778, 52000000, 57777778, 52000000, 57777778,
+        52000000, 43333334, 52000000, 43333334, 52000000, 43333334, 52000000, 43333334, 52000000,
+        43333334, 52000000, 43333334, 52000000, 43333334, 52000000, 43333334, 52000000, 43333334,
+        52000000, 43333334, 39000000, 43333334, 39000000, 43333334, 39000000, 43333334, 28888889,
+        43333334, 28888889, 43333334, 28888889, 26000000, 28888889, 26000000, 28888889, 26000000,
+        39000000, 21666667, 39000000, 21666667, 26000000, 19500000, 26000000, 43333334, 21666667,
+        28888889, 19500000, 26000000, 14444445, 26000000, 14444445, 26000000, 14444445, 43333334,
+        21666667, 13000000, 43333334, 21666667, 13000000, 28888889, 39000000, 7222223, 28888889,
+        39000000, 7222223, 14444445, 19500000, 6500000, 14444445, 19500000, 6500000, 26000000,
+        13000000, 43333334};
+    NS_TEST_ASSERT_MSG_EQ(m_rates.size(), expectedRates.size(), "Unexpected number of rates");
+    for (std::size_t i = 0; i < expectedRates.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_rates[i], expectedRates[i], "Unexpected rate " << i);
+    }
+
+    // MCS of the data frame at a given index
+    const std::map<std::size_t, uint8_t> expectedDataMcs{
+        {0, 5},
+        {250, 7},
+        {500, 7},
+        {750, 7},
+        {1000, 7},
+        {1250, 6},
+        {1500, 5},
+        {1750, 5},
+        {2000, 4},
+        {2250, 4},
+        {2500, 4},
+        {2750, 4},
+        {3000, 4},
+        {3250, 4},
+        {3500, 2},
+    };
+    NS_TEST_ASSERT_MSG_EQ(m_dataMcs.size(), 3675, "Unexpected number of data frames");
+    for (const auto& [index, mcs] : expectedDataMcs)
+    {
+        NS_TEST_EXPECT_MSG_EQ(+m_dataMcs[index], +mcs, "Unexpected MCS of data frame " << index);
+    }
+}
+
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Minstrel-HT Test Suite
+ */
+class WifiMinstrelHtTestSuite : public TestSuite
+{
+  public:
+    WifiMinstrelHtTestSuite();
+};
+
+WifiMinstrelHtTestSuite::WifiMinstrelHtTestSuite()
+    : TestSuite("wifi-minstrel-ht", Type::UNIT)
+{
+    AddTestCase(new MinstrelHtRegressionTest, TestCase::Duration::QUICK);
+}
+
+static WifiMinstrelHtTestSuite g_wifiMinstrelHtTestSuite; ///< the test suite
@@ -2501,13 +2501,13 @@ TestMultipleHeTbPreambles::RxHeTbPpdu(uint64_t uid,
         m_phy->GetHePhy()->GetCenterFrequenciesForNonHePart(ppdu, staId).front();
     auto ruWidth = WifiRu::GetBandwidth(WifiRu::GetRuType(txVector.GetRu(staId)));
     auto channelWidth = ruWidth < MHz_u{20} ? MHz_u{20} : ruWidth;
-    Ptr<SpectrumValue> rxPsd = WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
+    auto rxPsd = WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
         centerFrequency,
         channelWidth,
         txPower,
         m_phy->GetGuardBandwidth(channelWidth));
     auto rxParams = Create<WifiSpectrumSignalParameters>();
-    rxParams->psd = rxPsd;
+    rxParams->psd = rxPsd->Copy();
     rxParams->txPhy = nullptr;
     rxParams->duration = nonOfdmaDuration;
     rxParams->ppdu = ppdu;
@@ -2533,7 +2533,7 @@ TestMultipleHeTbPreambles::RxHeTbPpdu(uint64_t uid,
                                                                       DEFAULT_GUARD_WIDTH,
                                                                       band.indices);
     auto rxParamsOfdma = Create<WifiSpectrumSignalParameters>();
-    rxParamsOfdma->psd = rxPsd;
+    rxParamsOfdma->psd = rxPsd->Copy();
     rxParamsOfdma->txPhy = nullptr;
     rxParamsOfdma->duration = ppduDuration - nonOfdmaDuration;
     rxParamsOfdma->ppdu = ppduOfdma;
@@ -130,14 +130,14 @@ WifiPhyReceptionTest::SendPacket(dBm_u rxPower, uint32_t packetSize, uint8_t mcs
     Ptr<WifiPpdu> ppdu =
         Create<HePpdu>(psdu, txVector, m_phy->GetOperatingChannel(), txDuration, m_uid++);
 
-    Ptr<SpectrumValue> txPowerSpectrum =
+    auto txPowerSpectrum =
         WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(FREQUENCY,
                                                                     CHANNEL_WIDTH,
                                                                     DbmToW(rxPower),
                                                                     GUARD_WIDTH);
 
     Ptr<WifiSpectrumSignalParameters> txParams = Create<WifiSpectrumSignalParameters>();
-    txParams->psd = txPowerSpectrum;
+    txParams->psd = txPowerSpectrum->Copy();
     txParams->txPhy = nullptr;
     txParams->duration = txDuration;
     txParams->ppdu = ppdu;
@@ -2757,14 +2757,14 @@ TestAmpduReception::SendAmpduWithThreeMpdus(dBm_u rxPower, uint32_t referencePac
     Ptr<WifiPpdu> ppdu =
         Create<HePpdu>(psdu, txVector, m_phy->GetOperatingChannel(), txDuration, m_uid++);
 
-    Ptr<SpectrumValue> txPowerSpectrum =
+    auto txPowerSpectrum =
         WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(FREQUENCY,
                                                                     CHANNEL_WIDTH,
                                                                     DbmToW(rxPower),
                                                                     GUARD_WIDTH);
 
     Ptr<WifiSpectrumSignalParameters> txParams = Create<WifiSpectrumSignalParameters>();
-    txParams->psd = txPowerSpectrum;
+    txParams->psd = txPowerSpectrum->Copy();
     txParams->txPhy = nullptr;
     txParams->duration = txDuration;
     txParams->ppdu = ppdu;
@@ -4293,7 +4293,7 @@ TestUnsupportedBandwidthReception::SendPpdu(MHz_u centerFreq, MHz_u bandwidth)
                                                                     bandwidth);
 
     auto txParams = Create<WifiSpectrumSignalParameters>();
-    txParams->psd = txPowerSpectrum;
+    txParams->psd = txPowerSpectrum->Copy();
     txParams->txPhy = nullptr;
     txParams->duration = txDuration;
     txParams->ppdu = ppdu;
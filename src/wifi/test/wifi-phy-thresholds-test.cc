@@ -156,7 +156,7 @@ WifiPhyThresholdsTest::MakeWifiSignal(Watt_u txPower, const WifiPhyOperatingChan
         txPower,
         CHANNEL_WIDTH);
     auto txParams = Create<WifiSpectrumSignalParameters>();
-    txParams->psd = txPowerSpectrum;
+    txParams->psd = txPowerSpectrum->Copy();
     txParams->txPhy = nullptr;
     txParams->duration = txDuration;
     txParams->ppdu = ppdu;
@@ -172,7 +172,7 @@ WifiPhyThresholdsTest::MakeForeignSignal(Watt_u txPower)
                                                                     txPower,
                                                                     CHANNEL_WIDTH);
     auto txParams = Create<SpectrumSignalParameters>();
-    txParams->psd = txPowerSpectrum;
+    txParams->psd = txPowerSpectrum->Copy();
     txParams->txPhy = nullptr;
     txParams->duration = Seconds(0.5);
     return txParams;
@@ -0,0 +1,339 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/ap-wifi-mac.h"
+#include "ns3/boolean.h"
+#include "ns3/he-configuration.h"
+#include "ns3/log.h"
+#include "ns3/mgt-headers.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/packet-socket-client.h"
+#include "ns3/packet-socket-helper.h"
+#include "ns3/packet-socket-server.h"
+#include "ns3/packet.h"
+#include "ns3/qos-txop.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/spectrum-wifi-helper.h"
+#include "ns3/sta-wifi-mac.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-psdu.h"
+#include "ns3/wifi-static-setup-helper.h"
+
+#include <set>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("WifiStaticSetupTest");
+
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Test the static setup of association and Block Ack agreements
+ *
+ * A number of non-AP STAs are statically associated with an AP that caches the serialized
+ * Beacon frames and Block Ack agreements are statically established for TID 0 in both the
+ * downlink and the uplink direction. It is checked that:
+ *
+ * - the non-AP STAs are associated and have distinct AIDs before the simulation starts
+ * - Block Ack agreements exist in both directions before the simulation starts
+ * - no management frame other than Beacon frames is transmitted
+ * - the Timestamp field of the (cached) Beacon frames is set to the generation time
+ * - the (cached) Beacon frames advertise the EDCA parameters, the MU EDCA parameters and the
+ *   BSS color that are changed at runtime
+ * - data frames are acknowledged by means of BlockAck frames and all packets are received
+ */
+class WifiStaticSetupTest : public TestCase
+{
+  public:
+    WifiStaticSetupTest();
+
+  private:
+    void DoSetup() override;
+    void DoRun() override;
+
+    /**
+     * Callback invoked when a PSDU is transmitted.
+     *
+     * @param psduMap the PSDU map
+     * @param txVector the TX vector
+     * @param txPower the TX power
+     */
+    void Transmit(WifiConstPsduMap psduMap, WifiTxVector txVector, Watt_u txPower);
+
+    /**
+     * Callback invoked when a packet is received by a packet socket server.
+     *
+     * @param packet the received packet
+     * @param from the address of the sender
+     */
+    void Receive(Ptr<const Packet> packet, const Address& from);
+
+    const std::size_t m_nStations{3};           //!< number of non-AP STAs
+    const std::size_t m_nPackets{10};           //!< number of packets sent by each client
+    const Time m_changeTime{MilliSeconds(250)}; //!< time the advertised parameters are changed
+    NetDeviceContainer m_apDevices;             //!< AP device
+    NetDeviceContainer m_staDevices;            //!< non-AP STA devices
+    std::size_t m_nBeacons{0};                  //!< number of transmitted Beacon frames
+    std::size_t m_nOtherMgtFrames{0};           //!< number of other transmitted management frames
+    std::size_t m_nBlockAcks{0};                //!< number of transmitted BlockAck frames
+    std::size_t m_nRxPackets{0};                //!< number of packets received by the servers
+};
+
+WifiStaticSetupTest::WifiStaticSetupTest()
+    : TestCase("Check static association and Block Ack agreement setup")
+{
+}
+
+void
+WifiStaticSetupTest::Transmit(WifiConstPsduMap psduMap, WifiTxVector txVector, Watt_u txPower)
+{
+    const auto psdu = psduMap.cbegin()->second;
+    const auto& hdr = psdu->GetHeader(0);
+
+    if (hdr.IsBeacon())
+    {
+        MgtBeaconHeader beacon;
+        (*psdu->begin())->GetPacket()->PeekHeader(beacon);
+        // beacon jitter is disabled, hence Beacon frames are generated at multiples of the
+        // beacon interval, when the Timestamp field is set
+        NS_TEST_EXPECT_MSG_EQ(beacon.GetTimestamp(),
+                              m_nBeacons * 102400,
+                              "Unexpected Timestamp in Beacon frame");
+        ++m_nBeacons;
+        NS_TEST_EXPECT_MSG_EQ(beacon.GetBeaconIntervalUs(),
+                              102400,
+                              "Unexpected Beacon Interval in Beacon frame");
+        NS_TEST_EXPECT_MSG_EQ(beacon.Get<Ssid>()->IsEqual(Ssid("static-setup")),
+                              true,
+                              "Unexpected SSID in Beacon frame");
+
+        const auto changed = (Simulator::Now() > m_changeTime);
+        NS_TEST_ASSERT_MSG_EQ(beacon.Get<EdcaParameterSet>().has_value(),
+                              true,
+                              "Expected an EDCA Parameter Set element in Beacon frame");
+        NS_TEST_EXPECT_MSG_EQ(+beacon.Get<EdcaParameterSet>()->GetBeAifsn(),
+                              (changed ? 5 : 3),
+                              "Unexpected AIFSN for AC BE in Beacon frame");
+        NS_TEST_EXPECT_MSG_EQ(beacon.Get<EdcaParameterSet>()->GetViCWmin(),
+                              (changed ? 31 : 7),
+                              "Unexpected CWmin for AC VI in Beacon frame");
+        NS_TEST_EXPECT_MSG_EQ(beacon.Get<MuEdcaParameterSet>().has_value(),
+                              changed,
+                              "Unexpected presence of MU EDCA Parameter Set element");
+        NS_TEST_ASSERT_MSG_EQ(beacon.Get<HeOperation>().has_value(),
+                              true,
+                              "Expected an HE Operation element in Beacon frame");
+        NS_TEST_EXPECT_MSG_EQ(+beacon.Get<HeOperation>()->m_bssColorInfo.m_bssColor,
+                              (changed ? 7 : 0),
+                              "Unexpected BSS color in Beacon frame");
+    }
+    else if (hdr.IsMgt())
+    {
+        ++m_nOtherMgtFrames;
+    }
+    else if (hdr.IsBlockAck())
+    {
+        ++m_nBlockAcks;
+    }
+}
+
+void
+WifiStaticSetupTest::Receive(Ptr<const Packet> packet, const Address& from)
+{
+    ++m_nRxPackets;
+}
+
+void
+WifiStaticSetupTest::DoSetup()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    int64_t streamNumber = 100;
+
+    NodeContainer apNode(1);
+    NodeContainer staNodes(m_nStations);
+
+    auto spectrumChannel = CreateObject<MultiModelSpectrumChannel>();
+    spectrumChannel->AddPropagationLossModel(CreateObject<FriisPropagationLossModel>());
+    spectrumChannel->SetPropagationDelayModel(
+        CreateObject<ConstantSpeedPropagationDelayModel>());
+
+    SpectrumWifiPhyHelper phy;
+    phy.SetChannel(spectrumChannel);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("HeMcs5"),
+                                 "ControlMode",
+                                 StringValue("OfdmRate24Mbps"));
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::StaWifiMac", "Ssid", SsidValue(Ssid("static-setup")));
+    m_staDevices = wifi.Install(phy, mac, staNodes);
+
+    mac.SetType("ns3::ApWifiMac",
+                "Ssid",
+                SsidValue(Ssid("static-setup")),
+                "EnableBeaconJitter",
+                BooleanValue(false),
+                "EnableBeaconCache",
+                BooleanValue(true));
+    m_apDevices = wifi.Install(phy, mac, apNode);
+
+    streamNumber += WifiHelper::AssignStreams(m_apDevices, streamNumber);
+    streamNumber += WifiHelper::AssignStreams(m_staDevices, streamNumber);
+
+    MobilityHelper mobility;
+    auto positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    for (std::size_t i = 0; i < m_nStations; ++i)
+    {
+        positionAlloc->Add(Vector(1.0, static_cast<double>(i), 0.0));
+    }
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(apNode);
+    mobility.Install(staNodes);
+
+    auto apDev = DynamicCast<WifiNetDevice>(m_apDevices.Get(0));
+    WifiStaticSetupHelper::SetStaticAssociation(apDev, m_staDevices);
+    WifiStaticSetupHelper::SetStaticBlockAck(apDev, m_staDevices, {0});
+
+    PacketSocketHelper packetSocket;
+    packetSocket.Install(apNode);
+    packetSocket.Install(staNodes);
+
+    // DL and UL flows between the AP and every non-AP STA
+    uint16_t protocol = 1;
+    for (std::size_t i = 0; i < m_nStations; ++i)
+    {
+        for (const auto& [from, to] : {std::pair{apDev->GetNode(), staNodes.Get(i)},
+                                       std::pair{staNodes.Get(i), apDev->GetNode()}})
+        {
+            PacketSocketAddress socket;
+            socket.SetSingleDevice(from->GetDevice(0)->GetIfIndex());
+            socket.SetPhysicalAddress(to->GetDevice(0)->GetAddress());
+            socket.SetProtocol(protocol++);
+
+            auto client = CreateObject<PacketSocketClient>();
+            client->SetAttribute("PacketSize", UintegerValue(1000));
+            client->SetAttribute("MaxPackets", UintegerValue(m_nPackets));
+            client->SetAttribute("Interval", TimeValue(MicroSeconds(0)));
+            client->SetRemote(socket);
+            from->AddApplication(client);
+            client->SetStartTime(MilliSeconds(10));
+
+            auto server = CreateObject<PacketSocketServer>();
+            server->SetLocal(socket);
+            to->AddApplication(server);
+            server->TraceConnectWithoutContext("Rx",
+                                               MakeCallback(&WifiStaticSetupTest::Receive, this));
+        }
+    }
+
+    for (auto devices : {m_apDevices, m_staDevices})
+    {
+        for (auto it = devices.Begin(); it != devices.End(); ++it)
+        {
+            DynamicCast<WifiNetDevice>(*it)->GetPhy()->TraceConnectWithoutContext(
+                "PhyTxPsduBegin",
+                MakeCallback(&WifiStaticSetupTest::Transmit, this));
+        }
+    }
+}
+
+void
+WifiStaticSetupTest::DoRun()
+{
+    auto apMac = DynamicCast<ApWifiMac>(DynamicCast<WifiNetDevice>(m_apDevices.Get(0))->GetMac());
+    NS_TEST_ASSERT_MSG_NE(apMac, nullptr, "Expected an AP");
+    NS_TEST_EXPECT_MSG_EQ(apMac->GetStaList(0).size(), m_nStations, "Unexpected number of STAs");
+
+    std::set<uint16_t> aids;
+    for (auto it = m_staDevices.Begin(); it != m_staDevices.End(); ++it)
+    {
+        auto staMac = DynamicCast<StaWifiMac>(DynamicCast<WifiNetDevice>(*it)->GetMac());
+        NS_TEST_ASSERT_MSG_NE(staMac, nullptr, "Expected a non-AP STA");
+        NS_TEST_EXPECT_MSG_EQ(staMac->IsAssociated(), true, "Non-AP STA is not associated");
+        NS_TEST_EXPECT_MSG_EQ(staMac->GetBssid(0), apMac->GetAddress(), "Unexpected BSSID");
+        NS_TEST_EXPECT_MSG_EQ(apMac->GetAssociationId(staMac->GetAddress(), 0),
+                              staMac->GetAssociationId(),
+                              "AID stored by AP and non-AP STA differ");
+        aids.insert(staMac->GetAssociationId());
+
+        NS_TEST_EXPECT_MSG_EQ(
+            apMac->GetBaAgreementEstablishedAsOriginator(staMac->GetAddress(), 0).has_value(),
+            true,
+            "No DL Block Ack agreement at the AP");
+        NS_TEST_EXPECT_MSG_EQ(
+            staMac->GetBaAgreementEstablishedAsRecipient(apMac->GetAddress(), 0).has_value(),
+            true,
+            "No DL Block Ack agreement at the non-AP STA");
+        NS_TEST_EXPECT_MSG_EQ(
+            staMac->GetBaAgreementEstablishedAsOriginator(apMac->GetAddress(), 0).has_value(),
+            true,
+            "No UL Block Ack agreement at the non-AP STA");
+        NS_TEST_EXPECT_MSG_EQ(
+            apMac->GetBaAgreementEstablishedAsRecipient(staMac->GetAddress(), 0).has_value(),
+            true,
+            "No UL Block Ack agreement at the AP");
+    }
+    NS_TEST_EXPECT_MSG_EQ(aids.size(), m_nStations, "AIDs are not distinct");
+
+    // change the parameters advertised in Beacon frames after some Beacon frames (built once
+    // and then reused) have been transmitted
+    Simulator::Schedule(m_changeTime, [=]() {
+        apMac->GetQosTxop(AC_BE)->SetAifsn(5, 0);
+        apMac->SetAttribute("CwMinsForSta", StringValue("VI 31"));
+        auto heConfiguration = apMac->GetHeConfiguration();
+        heConfiguration->m_bssColor = 7;
+        heConfiguration->m_beMuEdcaTimer = MicroSeconds(8192);
+        heConfiguration->m_bkMuEdcaTimer = MicroSeconds(8192);
+        heConfiguration->m_viMuEdcaTimer = MicroSeconds(8192);
+        heConfiguration->m_voMuEdcaTimer = MicroSeconds(8192);
+    });
+
+    Simulator::Stop(MilliSeconds(500));
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(m_nRxPackets, 2 * m_nStations * m_nPackets, "Packets were lost");
+    NS_TEST_EXPECT_MSG_GT(m_nBeacons, 4, "Too few Beacon frames transmitted");
+    NS_TEST_EXPECT_MSG_EQ(m_nOtherMgtFrames, 0, "Unexpected management frames transmitted");
+    NS_TEST_EXPECT_MSG_GT(m_nBlockAcks, 0, "Expected BlockAck frames");
+    for (auto it = m_staDevices.Begin(); it != m_staDevices.End(); ++it)
+    {
+        auto staMac = DynamicCast<StaWifiMac>(DynamicCast<WifiNetDevice>(*it)->GetMac());
+        NS_TEST_EXPECT_MSG_EQ(staMac->IsAssociated(), true, "Non-AP STA disassociated");
+    }
+
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Static setup Test Suite
+ */
+class WifiStaticSetupTestSuite : public TestSuite
+{
+  public:
+    WifiStaticSetupTestSuite();
+};
+
+WifiStaticSetupTestSuite::WifiStaticSetupTestSuite()
+    : TestSuite("wifi-static-setup", Type::UNIT)
+{
+    AddTestCase(new WifiStaticSetupTest, TestCase::Duration::QUICK);
+}
+
+static WifiStaticSetupTestSuite g_wifiStaticSetupTestSuite; ///< the test suite
@@ -91,10 +91,10 @@ class WifiOfdmMaskSlopesTestCase : public TestCase
     std::vector<bool>
         m_puncturedSubchannels; ///< bitmap indicating whether a 20 MHz subchannel is punctured or
                                 ///< not (only used for 802.11ax and later)
-    Ptr<SpectrumValue> m_actualSpectrum; ///< actual spectrum value
-    IndexPowerVect m_expectedPsd;        ///< expected power values
-    dB_u m_tolerance;                    ///< tolerance
-    std::size_t m_precision;             ///< precision for double calculations (in decimals)
+    Ptr<const SpectrumValue> m_actualSpectrum; ///< actual spectrum value
+    IndexPowerVect m_expectedPsd;              ///< expected power values
+    dB_u m_tolerance;                          ///< tolerance
+    std::size_t m_precision;                   ///< precision for double calculations (in decimals)
 };
 
 WifiOfdmMaskSlopesTestCase::WifiOfdmMaskSlopesTestCase(
@@ -299,6 +299,69 @@ WifiOfdmMaskSlopesTestCase::DoRun()
     }
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Test checks that the transmit PSDs are cached for the calls with the same parameters
+ * and only for them.
+ */
+class WifiTxPsdCacheTestCase : public TestCase
+{
+  public:
+    WifiTxPsdCacheTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+WifiTxPsdCacheTestCase::WifiTxPsdCacheTestCase()
+    : TestCase("Check the cache of transmit PSDs")
+{
+}
+
+void
+WifiTxPsdCacheTestCase::DoRun()
+{
+    const std::vector<MHz_u> centerFrequencies{MHz_u{5210}};
+    const MHz_u channelWidth{80};
+    const MHz_u guardBandwidth{80};
+    auto createHe = [&](Watt_u txPower,
+                        dBr_u minInnerBand,
+                        const std::vector<bool>& puncturedSubchannels) {
+        return WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(centerFrequencies,
+                                                                          channelWidth,
+                                                                          txPower,
+                                                                          guardBandwidth,
+                                                                          minInnerBand,
+                                                                          dBr_u{-28},
+                                                                          dBr_u{-40},
+                                                                          puncturedSubchannels);
+    };
+
+    auto expected = createHe(Watt_u{0.1}, dBr_u{-20}, {});
+    NS_TEST_EXPECT_MSG_EQ(createHe(Watt_u{0.1}, dBr_u{-20}, {}),
+                          expected,
+                          "The cached PSD is expected to be returned");
+
+    NS_TEST_EXPECT_MSG_NE(Sum(*createHe(Watt_u{0.2}, dBr_u{-20}, {})),
+                          Sum(*expected),
+                          "The PSD created with another TX power is the cached one");
+    NS_TEST_EXPECT_MSG_NE(Sum(*createHe(Watt_u{0.1}, dBr_u{-25}, {})),
+                          Sum(*expected),
+                          "The PSD created with another transmit mask is the cached one");
+    NS_TEST_EXPECT_MSG_NE(Sum(*createHe(Watt_u{0.1}, dBr_u{-20}, {false, false, true, false})),
+                          Sum(*expected),
+                          "The PSD created with punctured subchannels is the cached one");
+    NS_TEST_EXPECT_MSG_NE(Sum(*WifiSpectrumValueHelper::CreateHtOfdmTxPowerSpectralDensity(
+                              centerFrequencies,
+                              channelWidth,
+                              Watt_u{0.1},
+                              guardBandwidth)),
+                          Sum(*expected),
+                          "The PSD created by another function is the cached one");
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -1504,4 +1567,6 @@ WifiTransmitMaskTestSuite::WifiTransmitMaskTestSuite()
                                        prec,
                                        {false, false, false, false, false, false, true, true}),
         TestCase::Duration::QUICK);
+
+    AddTestCase(new WifiTxPsdCacheTestCase, TestCase::Duration::QUICK);
 }